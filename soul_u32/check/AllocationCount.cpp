@@ -0,0 +1,41 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <soul_u32/check/Check.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace soul { namespace check {
+
+std::atomic<int64_t> numAllocations(0);
+
+int64_t NumAllocations()
+{
+    return numAllocations.load(std::memory_order_relaxed);
+}
+
+} } // namespace soul::check
+
+void* operator new(std::size_t size)
+{
+    soul::check::numAllocations.fetch_add(1, std::memory_order_relaxed);
+    void* p = std::malloc(size != 0 ? size : 1);
+    if (!p)
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t /* size */) noexcept
+{
+    operator delete(p);
+}
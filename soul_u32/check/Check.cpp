@@ -0,0 +1,51 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <soul_u32/check/Check.hpp>
+#include <iostream>
+
+namespace soul { namespace check {
+
+std::string groupName;
+int numChecks = 0;
+int numFailedChecks = 0;
+
+void Check(bool condition, const std::string& description)
+{
+    ++numChecks;
+    if (!condition)
+    {
+        ++numFailedChecks;
+        std::cerr << groupName << ": check failed: " << description << std::endl;
+    }
+}
+
+void BeginCheckGroup(const std::string& name)
+{
+    groupName = name;
+    std::cout << name << std::endl;
+}
+
+int NumChecks()
+{
+    return numChecks;
+}
+
+int NumFailedChecks()
+{
+    return numFailedChecks;
+}
+
+void Report(const std::string& measurement)
+{
+    std::cout << "    " << measurement << std::endl;
+}
+
+double Milliseconds(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+{
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+} } // namespace soul::check
@@ -0,0 +1,48 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#ifndef SOUL_CHECK_CHECK_INCLUDED
+#define SOUL_CHECK_CHECK_INCLUDED
+#include <chrono>
+#include <stdint.h>
+#include <string>
+
+namespace soul { namespace check {
+
+//  Records the result of a check. A failed check is reported to standard error together with the name of the running check group.
+
+void Check(bool condition, const std::string& description);
+void BeginCheckGroup(const std::string& name);
+int NumChecks();
+int NumFailedChecks();
+
+//  Benchmarks check their results too, but they also report measurements. NumAllocations() counts the calls of the global operator new.
+
+void Report(const std::string& measurement);
+double Milliseconds(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end);
+int64_t NumAllocations();
+
+//  Check groups.
+
+void CheckParsingLimits();
+void CheckStackSegmentation();
+void CheckXmlBatchParser();
+void CheckXmlDocument();
+void CheckXmlLimits();
+void CheckXmlParallelParser();
+void CheckXmlPaths();
+void CheckXmlReader();
+void CheckXmlTextOptions();
+void CheckXmlWriter();
+
+//  Benchmark groups.
+
+void BenchmarkViewHandler();
+void BenchmarkXmlParallelParser();
+void BenchmarkXmlWriter();
+
+} } // namespace soul::check
+
+#endif // SOUL_CHECK_CHECK_INCLUDED
@@ -0,0 +1,116 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <soul_u32/check/EventLog.hpp>
+#include <soul_u32/util/Unicode.hpp>
+
+namespace soul { namespace check {
+
+using soul::unicode::ToUtf8;
+using soul::xml::AttributeView;
+
+EventLog::EventLog() : EventLog(std::u32string())
+{
+}
+
+EventLog::EventLog(const std::u32string& skipName_) : skipName(skipName_), mergeText(false), dropWhitespaceText(false)
+{
+}
+
+void EventLog::StartDocument()
+{
+    lines.append("start document\n");
+}
+
+void EventLog::EndDocument()
+{
+    FlushText(false);
+    lines.append("end document\n");
+}
+
+void EventLog::Text(const U32StringView& text)
+{
+    if (mergeText)
+    {
+        pendingText.append(text.begin(), text.end());
+    }
+    else
+    {
+        Add("text ", text);
+    }
+}
+
+void EventLog::Comment(const U32StringView& comment)
+{
+    BeginChild();
+    Add("comment ", comment);
+}
+
+void EventLog::PI(const U32StringView& target, const U32StringView& data)
+{
+    BeginChild();
+    Add("pi " + ToUtf8(target.ToString()) + " ", data);
+}
+
+void EventLog::StartElement(const U32StringView& namespaceUri, const U32StringView& /* localName */, const U32StringView& qualifiedName, const AttributeViews& attributes)
+{
+    BeginChild();
+    hasChildren.push_back(false);
+    std::string line = "start " + ToUtf8(namespaceUri.ToString()) + " " + ToUtf8(qualifiedName.ToString());
+    for (const AttributeView& attribute : attributes)
+    {
+        line.append(" " + ToUtf8(attribute.NamespaceUri().ToString()) + " " + ToUtf8(attribute.QualifiedName().ToString()) + "=" + ToUtf8(attribute.Value().ToString()));
+    }
+    lines.append(line + "\n");
+    if (qualifiedName == skipName)
+    {
+        SkipSubtree();
+    }
+}
+
+void EventLog::EndElement(const U32StringView& /* namespaceUri */, const U32StringView& /* localName */, const U32StringView& qualifiedName)
+{
+    FlushText(!hasChildren.empty() && !hasChildren.back());
+    if (!hasChildren.empty())
+    {
+        hasChildren.pop_back();
+    }
+    Add("end ", qualifiedName);
+}
+
+void EventLog::SkippedEntity(const U32StringView& entityName)
+{
+    FlushText(true);
+    Add("skipped ", entityName);
+}
+
+void EventLog::BeginChild()
+{
+    FlushText(false);
+    if (!hasChildren.empty())
+    {
+        hasChildren.back() = true;
+    }
+}
+
+void EventLog::FlushText(bool keepWhitespace)
+{
+    if (pendingText.empty())
+    {
+        return;
+    }
+    if (!dropWhitespaceText || keepWhitespace || pendingText.find_first_not_of(U" \t\n\r") != std::u32string::npos)
+    {
+        Add("text ", pendingText);
+    }
+    pendingText.clear();
+}
+
+void EventLog::Add(const std::string& kind, const U32StringView& value)
+{
+    lines.append(kind + ToUtf8(value.ToString()) + "\n");
+}
+
+} } // namespace soul::check
@@ -0,0 +1,51 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#ifndef SOUL_CHECK_EVENT_LOG_INCLUDED
+#define SOUL_CHECK_EVENT_LOG_INCLUDED
+#include <soul_u32/xml/XmlViewHandler.hpp>
+#include <vector>
+
+namespace soul { namespace check {
+
+using soul::util::U32StringView;
+using soul::xml::AttributeViews;
+
+//  Writes a line for each XML event, so that the events of two parses can be compared. Skips the subtrees of the elements named skipName.
+//  The log can merge adjacent text events to one line and drop whitespace-only text itself, as XmlProcessor does with the text options of
+//  the handler, so that the events of an unmerged parse can be compared with those of a processor with text options.
+
+class EventLog : public soul::xml::XmlViewHandler
+{
+public:
+    EventLog();
+    EventLog(const std::u32string& skipName_);
+    void SetMergeText(bool mergeText_) { mergeText = mergeText_; }
+    //  Drops merged text that consists of whitespace only, unless it is the whole content of an element or it is followed by a skipped entity.
+    void SetDropWhitespaceText(bool dropWhitespaceText_) { dropWhitespaceText = dropWhitespaceText_; }
+    const std::string& Lines() const { return lines; }
+    void StartDocument() override;
+    void EndDocument() override;
+    void Text(const U32StringView& text) override;
+    void Comment(const U32StringView& comment) override;
+    void PI(const U32StringView& target, const U32StringView& data) override;
+    void StartElement(const U32StringView& namespaceUri, const U32StringView& localName, const U32StringView& qualifiedName, const AttributeViews& attributes) override;
+    void EndElement(const U32StringView& namespaceUri, const U32StringView& localName, const U32StringView& qualifiedName) override;
+    void SkippedEntity(const U32StringView& entityName) override;
+private:
+    std::u32string skipName;
+    std::string lines;
+    bool mergeText;
+    bool dropWhitespaceText;
+    std::u32string pendingText;
+    std::vector<bool> hasChildren;
+    void BeginChild();
+    void FlushText(bool keepWhitespace);
+    void Add(const std::string& kind, const U32StringView& value);
+};
+
+} } // namespace soul::check
+
+#endif // SOUL_CHECK_EVENT_LOG_INCLUDED
@@ -0,0 +1,135 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <soul_u32/check/Check.hpp>
+#include <soul_u32/parsing/InitDone.hpp>
+#include <soul_u32/util/InitDone.hpp>
+#include <iostream>
+#include <string>
+#include <vector>
+
+class InitDone
+{
+public:
+    InitDone()
+    {
+        soul::parsing::Init();
+        soul::util::Init();
+    }
+    ~InitDone()
+    {
+        soul::util::Done();
+        soul::parsing::Done();
+    }
+};
+
+struct CheckGroup
+{
+    const char* name;
+    void (*run)();
+    bool benchmark;
+};
+
+std::vector<CheckGroup> checkGroups = 
+{
+    { "parsing-limits", soul::check::CheckParsingLimits, false },
+    { "stack-segmentation", soul::check::CheckStackSegmentation, false },
+    { "xml-batch-parser", soul::check::CheckXmlBatchParser, false },
+    { "xml-document", soul::check::CheckXmlDocument, false },
+    { "xml-limits", soul::check::CheckXmlLimits, false },
+    { "xml-parallel-parser", soul::check::CheckXmlParallelParser, false },
+    { "xml-paths", soul::check::CheckXmlPaths, false },
+    { "xml-reader", soul::check::CheckXmlReader, false },
+    { "xml-text-options", soul::check::CheckXmlTextOptions, false },
+    { "xml-writer", soul::check::CheckXmlWriter, false },
+    { "view-handler-benchmark", soul::check::BenchmarkViewHandler, true },
+    { "xml-parallel-parser-benchmark", soul::check::BenchmarkXmlParallelParser, true },
+    { "xml-writer-benchmark", soul::check::BenchmarkXmlWriter, true }
+};
+
+void PrintUsage()
+{
+    std::cout << "Usage: soulcheck [--bench] [<group>...]\n" << "Run the regression checks of the given groups, or all groups if none are given.\n" << 
+        "Benchmark groups are run only when they are given, or all of them with --bench." << std::endl;
+    std::cout << "groups:\n";
+    for (const CheckGroup& group : checkGroups)
+    {
+        std::cout << group.name << std::endl;
+    }
+}
+
+int main(int argc, const char** argv)
+{
+    try
+    {
+        InitDone initDone;
+        std::vector<std::string> names;
+        bool benchmarks = false;
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+            if (arg == "-h" || arg == "--help")
+            {
+                PrintUsage();
+                return 0;
+            }
+            else if (arg == "--bench")
+            {
+                benchmarks = true;
+            }
+            else
+            {
+                names.push_back(arg);
+            }
+        }
+        for (const std::string& name : names)
+        {
+            bool found = false;
+            for (const CheckGroup& group : checkGroups)
+            {
+                if (name == group.name)
+                {
+                    found = true;
+                }
+            }
+            if (!found)
+            {
+                std::cerr << "unknown check group '" << name << "'" << std::endl;
+                PrintUsage();
+                return 1;
+            }
+        }
+        for (const CheckGroup& group : checkGroups)
+        {
+            bool run = names.empty() && (!group.benchmark || benchmarks);
+            for (const std::string& name : names)
+            {
+                if (name == group.name)
+                {
+                    run = true;
+                }
+            }
+            if (run)
+            {
+                soul::check::BeginCheckGroup(group.name);
+                try
+                {
+                    group.run();
+                }
+                catch (const std::exception& ex)
+                {
+                    soul::check::Check(false, std::string("unexpected exception: ") + ex.what());
+                }
+            }
+        }
+        std::cout << soul::check::NumChecks() << " checks, " << soul::check::NumFailedChecks() << " failed" << std::endl;
+        return soul::check::NumFailedChecks() == 0 ? 0 : 1;
+    }
+    catch (const std::exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        return 1;
+    }
+}
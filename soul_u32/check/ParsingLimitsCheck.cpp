@@ -0,0 +1,131 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <soul_u32/check/Check.hpp>
+#include <soul_u32/xml/XmlGrammar.hpp>
+#include <soul_u32/xml/XmlParser.hpp>
+#include <soul_u32/xml/XmlProcessor.hpp>
+#include <soul_u32/parsing/Exception.hpp>
+#include <soul_u32/parsing/ParsingDomain.hpp>
+#include <soul_u32/parsing/ParsingData.hpp>
+#include <soul_u32/util/Unicode.hpp>
+#include <thread>
+
+namespace soul { namespace check {
+
+using namespace soul::xml;
+using namespace soul::parsing;
+
+//  Returns the parsing limit that a parse exceeded, or ParsingLimit::none if it succeeded.
+
+template<typename Parse>
+ParsingLimit ExceededParsingLimit(Parse parse)
+{
+    try
+    {
+        parse();
+    }
+    catch (const ParsingLimitExceeded& ex)
+    {
+        return ex.Limit();
+    }
+    return ParsingLimit::none;
+}
+
+std::string Elements(int depth, int count)
+{
+    std::string content;
+    for (int i = 0; i < depth; ++i)
+    {
+        content.append("<e>");
+    }
+    for (int i = 0; i < count; ++i)
+    {
+        content.append("<i a='1'>t</i>");
+    }
+    for (int i = 0; i < depth; ++i)
+    {
+        content.append("</e>");
+    }
+    return content;
+}
+
+ParsingLimit ParseWithParsingLimits(const std::string& content, const ParsingLimits* parsingLimits)
+{
+    XmlLimits limits;
+    limits.SetParsingLimits(parsingLimits);
+    XmlViewHandler handler;
+    return ExceededParsingLimit([&] { ParseXmlContent(content, "limits", &limits, &handler); });
+}
+
+int CountStopped(const std::string& content, const ParsingLimits* parsingLimits, int numParses)
+{
+    int count = 0;
+    for (int i = 0; i < numParses; ++i)
+    {
+        if (ParseWithParsingLimits(content, parsingLimits) != ParsingLimit::none)
+        {
+            ++count;
+        }
+    }
+    return count;
+}
+
+void CheckParsingLimits()
+{
+    std::string nested = Elements(200, 1);
+    std::string flat = Elements(1, 1000);
+
+    ParsingLimits depthLimits;
+    depthLimits.SetMaxDepth(100);
+    Check(ParseWithParsingLimits(nested, &depthLimits) == ParsingLimit::depth, "rule depth over the limit");
+    Check(ParseWithParsingLimits(flat, &depthLimits) == ParsingLimit::none, "rule depth under the limit");
+
+    ParsingLimits stepLimits;
+    stepLimits.SetMaxSteps(500);
+    Check(ParseWithParsingLimits(flat, &stepLimits) == ParsingLimit::steps, "steps over the limit");
+    Check(ParseWithParsingLimits("<r/>", &stepLimits) == ParsingLimit::none, "steps under the limit");
+
+    ParsingLimits deadlineLimits;
+    deadlineLimits.SetTimeout(std::chrono::milliseconds(1));
+    Check(ParseWithParsingLimits(Elements(1, 300000), &deadlineLimits) == ParsingLimit::deadline, "deadline");
+
+    Check(ParseWithParsingLimits(nested, nullptr) == ParsingLimit::none, "no parsing limits");
+    Check(ParsingLimitStr(ParsingLimit::none) != ParsingLimitStr(ParsingLimit::steps), "ParsingLimitStr(none)");
+
+    //  Cancelling the limits of one parse does not stop a concurrent parse that has other limits.
+    ParsingLimits cancelledLimits;
+    cancelledLimits.Cancel();
+    ParsingLimits runningLimits;
+    runningLimits.SetMaxDepth(1000);
+    int cancelledSuccesses = 0;
+    int runningFailures = 0;
+    std::thread cancelled([&] { cancelledSuccesses = 100 - CountStopped(flat, &cancelledLimits, 100); });
+    std::thread running([&] { runningFailures = CountStopped(flat, &runningLimits, 100); });
+    cancelled.join();
+    running.join();
+    Check(cancelledSuccesses == 0, "a cancelled parse stops");
+    Check(runningFailures == 0, "a concurrent parse with other limits is not cancelled");
+    cancelledLimits.ResetCancel();
+    Check(ParseWithParsingLimits(flat, &cancelledLimits) == ParsingLimit::none, "limits can be reused after ResetCancel");
+
+    //  Parsing data reused from a parse with limits does not keep them.
+    std::unique_ptr<ParsingData> parsingData(new ParsingData(GetXmlGrammar()->GetParsingDomain()->GetNumRules()));
+    std::u32string small = soul::unicode::ToUtf32(Elements(1, 1));
+    std::u32string large = soul::unicode::ToUtf32(flat);
+    XmlViewHandler handler;
+    XmlLimits limits;
+    limits.SetParsingLimits(&stepLimits);
+    XmlProcessor limitedProcessor(small.c_str(), small.c_str() + small.length(), &handler);
+    limitedProcessor.SetLimits(&limits);
+    Check(ExceededParsingLimit([&] { ParseXmlContent(limitedProcessor, "reused", parsingData.get()); }) == ParsingLimit::none, "limited parse with parsing data");
+    Check(parsingData->Limits() == &stepLimits, "parsing data has the limits of the parse");
+    XmlProcessor unlimitedProcessor(large.c_str(), large.c_str() + large.length(), &handler);
+    Check(ExceededParsingLimit([&] { ParseXmlContent(unlimitedProcessor, "reused", parsingData.get()); }) == ParsingLimit::none,
+        "unlimited parse with reused parsing data");
+    Check(parsingData->Limits() == nullptr, "reused parsing data has no limits");
+}
+
+} } // namespace soul::check
@@ -0,0 +1,92 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <soul_u32/check/Check.hpp>
+#include <soul_u32/xml/XmlGrammar.hpp>
+#include <soul_u32/xml/XmlParser.hpp>
+#include <boost/coroutine2/coroutine.hpp>
+#include <boost/coroutine2/fixedsize_stack.hpp>
+#include <stdexcept>
+
+namespace soul { namespace check {
+
+using namespace soul::xml;
+
+bool StackSegmentationRejected(int rulesPerSegment, std::size_t segmentSize)
+{
+    try
+    {
+        GetXmlGrammar()->SetStackSegmentation(rulesPerSegment, segmentSize);
+    }
+    catch (const std::runtime_error&)
+    {
+        return true;
+    }
+    return false;
+}
+
+//  Parses the content on a stack of stackSize bytes. Returns true if the parse succeeded.
+
+bool ParseOnSmallStack(const std::string& content, std::size_t stackSize)
+{
+    typedef boost::coroutines2::coroutine<void> Coroutine;
+    bool succeeded = false;
+    Coroutine::pull_type coroutine(boost::coroutines2::fixedsize_stack(stackSize), [&](Coroutine::push_type&)
+    {
+        XmlViewHandler handler;
+        ParseXmlContent(content, "nested", &handler);
+        succeeded = true;
+    });
+    return succeeded;
+}
+
+std::string DeeplyNested(int depth, int count)
+{
+    std::string content = "<r>";
+    for (int i = 0; i < count; ++i)
+    {
+        for (int j = 0; j < depth; ++j)
+        {
+            content.append("<e>");
+        }
+        for (int j = 0; j < depth; ++j)
+        {
+            content.append("</e>");
+        }
+    }
+    content.append("</r>");
+    return content;
+}
+
+void CheckStackSegmentation()
+{
+    Check(StackSegmentationRejected(20, 0), "zero segment size");
+    Check(StackSegmentationRejected(20, 16), "segment size under the minimum");
+    Check(StackSegmentationRejected(-1, 64 * 1024), "negative rules per segment");
+    Check(!StackSegmentationRejected(0, 0), "segmentation off");
+
+    //  Without segmentation a parse of a few hundred nested elements overflows a 256 KB stack.
+    //  Repeated deep subtrees make the parse leave and reenter segments that are kept for reuse.
+    std::size_t stackSize = 256 * 1024;
+    GetXmlGrammar()->SetStackSegmentation(20, 64 * 1024);
+    Check(ParseOnSmallStack(DeeplyNested(2000, 1), stackSize), "nesting depth 2000 on a 256 KB stack");
+    Check(ParseOnSmallStack(DeeplyNested(500, 20), stackSize), "repeated nesting depth 500 on a 256 KB stack");
+    std::string malformed = DeeplyNested(2000, 1);
+    malformed.insert(malformed.length() / 2, "<");
+    bool thrown = false;
+    try
+    {
+        ParseOnSmallStack(malformed, stackSize);
+    }
+    catch (const std::exception&)
+    {
+        thrown = true;
+    }
+    Check(thrown, "error at nesting depth 2000 propagates through the segments");
+    GetXmlGrammar()->SetStackSegmentation(0, 0);
+    Check(ParseOnSmallStack(DeeplyNested(20, 1), stackSize), "shallow nesting without segmentation");
+}
+
+} } // namespace soul::check
@@ -0,0 +1,134 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <soul_u32/check/Check.hpp>
+#include <soul_u32/xml/XmlParser.hpp>
+#include <soul_u32/util/Unicode.hpp>
+
+namespace soul { namespace check {
+
+using namespace soul::xml;
+using soul::unicode::ToUtf8;
+using soul::unicode::ToUtf32;
+
+//  The handlers record the events in the same format, so the events that a content handler and a view handler receive can be compared.
+
+class ContentRecorder : public XmlContentHandler
+{
+public:
+    ContentRecorder(bool record_) : record(record_), numElements(0) {}
+    const std::string& Events() const { return events; }
+    int NumElements() const { return numElements; }
+    void Version(const std::u32string& version) override { if (record) Add("V", version); }
+    void Text(const std::u32string& text) override { if (record) Add("T", text); }
+    void Comment(const std::u32string& comment) override { if (record) Add("C", comment); }
+    void PI(const std::u32string& target, const std::u32string& data) override { if (record) Add("P", target + U"|" + data); }
+    void StartElement(const std::u32string& namespaceUri, const std::u32string& localName, const std::u32string& qualifiedName, const Attributes& attributes) override
+    {
+        ++numElements;
+        if (!record) return;
+        std::u32string element = namespaceUri + U"|" + localName + U"|" + qualifiedName;
+        for (const Attribute& attribute : attributes)
+        {
+            element.append(U" " + attribute.NamespaceUri() + U"|" + attribute.LocalName() + U"|" + attribute.QualifiedName() + U"=" + attribute.Value());
+        }
+        Add("S", element);
+    }
+    void EndElement(const std::u32string& namespaceUri, const std::u32string& localName, const std::u32string& qualifiedName) override
+    {
+        if (record) Add("E", namespaceUri + U"|" + localName + U"|" + qualifiedName);
+    }
+    void SkippedEntity(const std::u32string& entityName) override { if (record) Add("K", entityName); }
+private:
+    bool record;
+    int numElements;
+    std::string events;
+    void Add(const std::string& kind, const std::u32string& value)
+    {
+        events.append(kind + "[" + ToUtf8(value) + "]");
+    }
+};
+
+class ViewRecorder : public XmlViewHandler
+{
+public:
+    ViewRecorder(bool record_) : record(record_), numElements(0) {}
+    const std::string& Events() const { return events; }
+    int NumElements() const { return numElements; }
+    void Version(const U32StringView& version) override { if (record) Add("V", version.ToString()); }
+    void Text(const U32StringView& text) override { if (record) Add("T", text.ToString()); }
+    void Comment(const U32StringView& comment) override { if (record) Add("C", comment.ToString()); }
+    void PI(const U32StringView& target, const U32StringView& data) override { if (record) Add("P", target.ToString() + U"|" + data.ToString()); }
+    void StartElement(const U32StringView& namespaceUri, const U32StringView& localName, const U32StringView& qualifiedName, const AttributeViews& attributes) override
+    {
+        ++numElements;
+        if (!record) return;
+        std::u32string element = namespaceUri.ToString() + U"|" + localName.ToString() + U"|" + qualifiedName.ToString();
+        for (const AttributeView& attribute : attributes)
+        {
+            element.append(U" " + attribute.NamespaceUri().ToString() + U"|" + attribute.LocalName().ToString() + U"|" + attribute.QualifiedName().ToString() + U"=" +
+                attribute.Value().ToString());
+        }
+        Add("S", element);
+    }
+    void EndElement(const U32StringView& namespaceUri, const U32StringView& localName, const U32StringView& qualifiedName) override
+    {
+        if (record) Add("E", namespaceUri.ToString() + U"|" + localName.ToString() + U"|" + qualifiedName.ToString());
+    }
+    void SkippedEntity(const U32StringView& entityName) override { if (record) Add("K", entityName.ToString()); }
+private:
+    bool record;
+    int numElements;
+    std::string events;
+    void Add(const std::string& kind, const std::u32string& value)
+    {
+        events.append(kind + "[" + ToUtf8(value) + "]");
+    }
+};
+
+//  Compares the allocations and the time of parsing a 300,001 element document with a content handler and with a view handler.
+//  Neither handler records the events, so the difference comes from copying the views to the strings that the content handler receives.
+
+void BenchmarkViewHandler()
+{
+    std::u32string content = U"<?xml version=\"1.0\"?><!-- c --><r xmlns=\"urn:d\" xmlns:p=\"urn:p\" a=\"x&amp;y&#65;z\" p:b='q&lt;'>"
+        U"<p:c d=\"plain\">t &amp; u &#x42; &foo; </p:c><?pi data?><e/><f xmlns=\"urn:f\" g=\"\"/></r>";
+    ContentRecorder contentRecorder(true);
+    ParseXmlContent(content, "events", &contentRecorder);
+    ViewRecorder viewRecorder(true);
+    ParseXmlContent(content, "events", &viewRecorder);
+    Check(!contentRecorder.Events().empty() && contentRecorder.Events() == viewRecorder.Events(), "content handler and view handler receive the same events");
+
+    std::u32string document = U"<root xmlns:a=\"urn:a\">";
+    for (int i = 0; i < 100000; ++i)
+    {
+        document.append(U"<item id=\"" + ToUtf32(std::to_string(i)) + U"\" a:kind=\"thing\"><name>Item name</name><price cur=\"EUR\">12.50</price></item>");
+    }
+    document.append(U"</root>");
+    ViewRecorder warmUpHandler(false);
+    ParseXmlContent(document, "document", &warmUpHandler);
+    ContentRecorder contentHandler(false);
+    int64_t startAllocations = NumAllocations();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    ParseXmlContent(document, "document", &contentHandler);
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    int64_t contentAllocations = NumAllocations() - startAllocations;
+    double contentTime = Milliseconds(start, end);
+    ViewRecorder viewHandler(false);
+    startAllocations = NumAllocations();
+    start = std::chrono::steady_clock::now();
+    ParseXmlContent(document, "document", &viewHandler);
+    end = std::chrono::steady_clock::now();
+    int64_t viewAllocations = NumAllocations() - startAllocations;
+    double viewTime = Milliseconds(start, end);
+    Check(contentHandler.NumElements() == 300001 && viewHandler.NumElements() == 300001, "elements");
+    Check(viewAllocations <= contentAllocations, "view handler does not allocate more than content handler");
+    Report("elements: " + std::to_string(viewHandler.NumElements()));
+    Report("content handler: " + std::to_string(double(contentAllocations) / contentHandler.NumElements()) + " allocations per element, " +
+        std::to_string(contentTime) + " ms");
+    Report("view handler: " + std::to_string(double(viewAllocations) / viewHandler.NumElements()) + " allocations per element, " + std::to_string(viewTime) + " ms");
+}
+
+} } // namespace soul::check
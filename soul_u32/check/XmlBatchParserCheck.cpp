@@ -0,0 +1,204 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <soul_u32/check/Check.hpp>
+#include <soul_u32/check/EventLog.hpp>
+#include <soul_u32/xml/XmlBatchParser.hpp>
+#include <soul_u32/xml/XmlParser.hpp>
+#include <atomic>
+#include <memory>
+#include <thread>
+
+namespace soul { namespace check {
+
+using namespace soul::xml;
+
+//  Logs the events of each document. BeginDocument, a start tag or EndDocument throws an exception that is not a std::exception for the documents
+//  whose message says so. Worker 0 waits in its first document until the other workers have parsed all other documents, which they can do only by
+//  stealing the documents of its range.
+
+class BatchLog : public XmlBatchHandler
+{
+public:
+    BatchLog(const std::vector<std::string>& messages_, bool holdWorker0_) :
+        messages(messages_), holdWorker0(holdWorker0_), logs(messages.size()), workerIndices(messages.size(), -1), endCalls(messages.size(), 0), numEnded(0)
+    {
+    }
+    XmlViewHandler* BeginDocument(int documentIndex, int workerIndex) override
+    {
+        workerIndices[documentIndex] = workerIndex;
+        if (holdWorker0 && workerIndex == 0)
+        {
+            holdWorker0 = false;
+            std::chrono::steady_clock::time_point timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+            while (numEnded < int(messages.size()) - 1 && std::chrono::steady_clock::now() < timeout)
+            {
+                std::this_thread::yield();
+            }
+        }
+        if (messages[documentIndex].find("throw-begin") != std::string::npos)
+        {
+            throw 1;
+        }
+        logs[documentIndex].reset(new ThrowingEventLog());
+        return logs[documentIndex].get();
+    }
+    void EndDocument(int documentIndex, int /* workerIndex */, const XmlBatchResult& /* result */) override
+    {
+        ++endCalls[documentIndex];
+        ++numEnded;
+        if (messages[documentIndex].find("throw-end") != std::string::npos)
+        {
+            throw 1;
+        }
+    }
+    std::string Lines(int documentIndex) const { return logs[documentIndex] ? logs[documentIndex]->Lines() : std::string(); }
+    int WorkerIndex(int documentIndex) const { return workerIndices[documentIndex]; }
+    int EndCalls(int documentIndex) const { return endCalls[documentIndex]; }
+private:
+    class ThrowingEventLog : public EventLog
+    {
+    public:
+        void StartElement(const U32StringView& namespaceUri, const U32StringView& localName, const U32StringView& qualifiedName, const AttributeViews& attributes) override
+        {
+            EventLog::StartElement(namespaceUri, localName, qualifiedName, attributes);
+            if (qualifiedName == U"throw-element")
+            {
+                throw 1;
+            }
+        }
+    };
+    const std::vector<std::string>& messages;
+    bool holdWorker0;
+    std::vector<std::unique_ptr<EventLog>> logs;
+    std::vector<int> workerIndices;
+    std::vector<int> endCalls;
+    std::atomic<int> numEnded;
+};
+
+struct SequentialResult
+{
+    bool succeeded;
+    std::string error;
+    std::string lines;
+};
+
+SequentialResult ParseMessage(const std::string& message, const std::string& systemId)
+{
+    SequentialResult result;
+    EventLog log;
+    try
+    {
+        ParseXmlContent(message, systemId, &log);
+        result.succeeded = true;
+    }
+    catch (const std::exception& ex)
+    {
+        result.succeeded = false;
+        result.error = ex.what();
+    }
+    result.lines = log.Lines();
+    return result;
+}
+
+//  Messages of different sizes, every 97th of them malformed.
+
+std::vector<std::string> Messages(int numMessages)
+{
+    std::vector<std::string> messages;
+    for (int i = 0; i < numMessages; ++i)
+    {
+        std::string n = std::to_string(i);
+        std::string message = "<?xml version='1.0'?><message xmlns='urn:m' id='" + n + "'><to>user" + n + "</to>";
+        for (int j = 0; j < i % 7; ++j)
+        {
+            message.append("<line n='" + std::to_string(j) + "'>text &amp; " + n + "<!--c--></line>");
+        }
+        message.append(i % 97 == 13 ? "</mesage>" : "</message>");
+        messages.push_back(message);
+    }
+    return messages;
+}
+
+std::vector<XmlBatchInput> BatchInputs(const std::vector<std::string>& messages)
+{
+    std::vector<XmlBatchInput> inputs;
+    for (const std::string& message : messages)
+    {
+        inputs.push_back(XmlBatchInput(message.c_str(), message.length()));
+    }
+    return inputs;
+}
+
+//  The results and the events of each document are those of ParseXmlContent, in input order. Each document is parsed once, and the documents
+//  of a held worker's range are stolen by the others.
+
+void CheckXmlBatchParser()
+{
+    XmlBatchParser batchParser(4);
+    std::vector<std::string> messages = Messages(1000);
+    std::vector<XmlBatchInput> inputs = BatchInputs(messages);
+    for (int batch = 0; batch < 2; ++batch)
+    {
+        BatchLog log(messages, batch == 0);
+        std::vector<XmlBatchResult> results = batchParser.Parse(inputs, &log);
+        bool same = results.size() == messages.size();
+        bool parsedOnce = true;
+        int stolen = 0;
+        for (int i = 0; i < int(messages.size()) && same; ++i)
+        {
+            SequentialResult sequential = ParseMessage(messages[i], "document " + std::to_string(i));
+            same = results[i].succeeded == sequential.succeeded && results[i].error == sequential.error && log.Lines(i) == sequential.lines;
+            parsedOnce = parsedOnce && log.EndCalls(i) == 1;
+            if (i < 250 && log.WorkerIndex(i) != 0)
+            {
+                ++stolen;
+            }
+        }
+        std::string batchName = batch == 0 ? "first batch" : "second batch";
+        Check(same, batchName + ": same results and events as ParseXmlContent in input order");
+        Check(parsedOnce, batchName + ": each document parsed once");
+        if (batch == 0)
+        {
+            Check(stolen == 249, "documents of a held worker stolen by the others");
+        }
+    }
+
+    //  Exceptions that are not std::exceptions fail their documents and leave the workers usable.
+    std::vector<std::string> throwing = Messages(100);
+    throwing[10] = "<throw-begin/>";
+    throwing[20] = "<r><throw-element/></r>";
+    throwing[30] = "<throw-end/>";
+    throwing[40] = "<r><throw-element/><x></r>";
+    std::vector<XmlBatchInput> throwingInputs = BatchInputs(throwing);
+    BatchLog throwingLog(throwing, false);
+    std::vector<XmlBatchResult> throwingResults = batchParser.Parse(throwingInputs, &throwingLog);
+    int numFailed = 0;
+    for (const XmlBatchResult& result : throwingResults)
+    {
+        if (!result.succeeded)
+        {
+            ++numFailed;
+        }
+    }
+    std::string notStd = "the handler threw an exception that is not a std::exception";
+    Check(!throwingResults[10].succeeded && throwingResults[10].error == "error in 'document 10': " + notStd, "exception from BeginDocument");
+    Check(!throwingResults[20].succeeded && throwingResults[20].error == "error in 'document 20': " + notStd, "exception from a view handler");
+    Check(!throwingResults[30].succeeded && throwingResults[30].error == "error in 'document 30': " + notStd && throwingLog.EndCalls(30) == 1,
+        "exception from EndDocument");
+    Check(!throwingResults[40].succeeded && throwingResults[40].error == "error in 'document 40': " + notStd, "exception from a view handler in a malformed document");
+    Check(numFailed == 5 && !throwingResults[13].succeeded, "other documents not affected by the exceptions");
+    BatchLog afterLog(messages, false);
+    std::vector<XmlBatchResult> afterResults = batchParser.Parse(inputs, &afterLog);
+    bool same = true;
+    for (int i = 0; i < int(messages.size()) && same; ++i)
+    {
+        SequentialResult sequential = ParseMessage(messages[i], "document " + std::to_string(i));
+        same = afterResults[i].succeeded == sequential.succeeded && afterResults[i].error == sequential.error && afterLog.Lines(i) == sequential.lines;
+    }
+    Check(same, "workers reused after exceptions");
+}
+
+} } // namespace soul::check
@@ -0,0 +1,205 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <soul_u32/check/Check.hpp>
+#include <soul_u32/check/EventLog.hpp>
+#include <soul_u32/xml/XmlDocument.hpp>
+#include <soul_u32/xml/XmlParser.hpp>
+#include <soul_u32/util/Unicode.hpp>
+
+namespace soul { namespace check {
+
+using namespace soul::xml;
+using soul::unicode::ToUtf8;
+using soul::unicode::ToUtf32;
+
+//  Writes the nodes of a document in the format of EventLog.
+
+void AppendNodeLines(const XmlNode& node, std::string& lines)
+{
+    switch (node.Kind())
+    {
+        case XmlNodeKind::element:
+        {
+            lines.append("start " + ToUtf8(node.NamespaceUri().ToString()) + " " + ToUtf8(node.QualifiedName().ToString()));
+            for (int i = 0; i < node.AttributeCount(); ++i)
+            {
+                XmlAttribute attribute = node.GetAttribute(i);
+                lines.append(" " + ToUtf8(attribute.NamespaceUri().ToString()) + " " + ToUtf8(attribute.QualifiedName().ToString()) + "=" + ToUtf8(attribute.Value().ToString()));
+            }
+            lines.append("\n");
+            for (XmlNode child = node.FirstChild(); child; child = child.NextSibling())
+            {
+                AppendNodeLines(child, lines);
+            }
+            lines.append("end " + ToUtf8(node.QualifiedName().ToString()) + "\n");
+            break;
+        }
+        case XmlNodeKind::text: lines.append("text " + ToUtf8(node.Text().ToString()) + "\n"); break;
+        case XmlNodeKind::comment: lines.append("comment " + ToUtf8(node.Text().ToString()) + "\n"); break;
+        case XmlNodeKind::pi: lines.append("pi " + ToUtf8(node.QualifiedName().ToString()) + " " + ToUtf8(node.Text().ToString()) + "\n"); break;
+        default: break;
+    }
+}
+
+std::string DocumentLines(const XmlDocument& document)
+{
+    std::string lines = "start document\n";
+    for (XmlNode child = document.Root().FirstChild(); child; child = child.NextSibling())
+    {
+        AppendNodeLines(child, lines);
+    }
+    lines.append("end document\n");
+    return lines;
+}
+
+std::u32string SubtreeText(const XmlNode& node)
+{
+    std::u32string text;
+    for (XmlNode child = node.FirstChild(); child; child = child.NextSibling())
+    {
+        if (child.Kind() == XmlNodeKind::text)
+        {
+            text.append(child.Text().begin(), child.Text().end());
+        }
+        else if (child.Kind() == XmlNodeKind::element)
+        {
+            text.append(SubtreeText(child));
+        }
+    }
+    return text;
+}
+
+class CommentlessLog : public EventLog
+{
+public:
+    void Comment(const U32StringView& /* comment */) override {}
+};
+
+class TextCollector : public XmlViewHandler
+{
+public:
+    const std::u32string& Collected() const { return collected; }
+    void Text(const U32StringView& text) override { collected.append(text.begin(), text.end()); }
+private:
+    std::u32string collected;
+};
+
+//  The inner text of each element is the text of its subtree, and the elements of each name are found by their name in document order.
+
+bool InnerTextsAndNamesMatch(const XmlDocument& document)
+{
+    int numElements = 0;
+    int numIndexed = 0;
+    for (int i = 0; i < document.NodeCount(); ++i)
+    {
+        XmlNode node(&document, i);
+        if (node.Kind() != XmlNodeKind::element)
+        {
+            continue;
+        }
+        ++numElements;
+        if (node.InnerText() != SubtreeText(node))
+        {
+            return false;
+        }
+        XmlNodeList elements = document.ElementsByName(node.NameId());
+        bool found = false;
+        for (int j = 0; j < elements.Count(); ++j)
+        {
+            found = found || elements[j] == node;
+            if (elements[j].NameId() != node.NameId() || (j > 0 && elements[j - 1].Index() >= elements[j].Index()))
+            {
+                return false;
+            }
+        }
+        if (!found)
+        {
+            return false;
+        }
+        int nameId = document.FindName(node.NamespaceUri(), node.LocalName());
+        if (nameId == -1 || document.NamespaceUri(nameId) != node.NamespaceUri() || document.LocalName(nameId) != node.LocalName() ||
+            document.QualifiedName(document.FindName(node.QualifiedName())) != node.QualifiedName())
+        {
+            return false;
+        }
+    }
+    for (int nameId = 0; nameId < document.NameCount(); ++nameId)
+    {
+        numIndexed += document.ElementsByName(nameId).Count();
+    }
+    return numElements == numIndexed;
+}
+
+std::vector<std::u32string> DomDocuments()
+{
+    std::vector<std::u32string> documents =
+    {
+        U"<r>  <a>x &amp; y<![CDATA[ z ]]>&#x41;</a>\n  <b>   </b>\n  <c> <!--k--> </c><d> <?p d?> t </d>\n</r>",
+        U"<r>a<b/>  <c/>b &#32;<![CDATA[  ]]>\r\n</r>",
+        U"<?xml version='1.0'?><!--prolog--><r xmlns='urn:d' xmlns:p='urn:p' p:a='1 &amp; 2' b='&#x33;'><p:s>a&amp;b&#x43;<![CDATA[d]]>e&lt;&gt;f</p:s>"
+            U"<s>&lt;<!--c-->&gt;g<x/>h&amp;</s><p:t xmlns:p='urn:q' p:a='x'>&#xA;<p:s/></p:t><s><?pi?>i<![CDATA[]]>j&amp;&amp;k</s></r><?epilog?>"
+    };
+    std::u32string items = U"<items xmlns:m='urn:m'>\n";
+    for (int i = 0; i < 50; ++i)
+    {
+        std::u32string n = ToUtf32(std::to_string(i));
+        items.append(U"  <item m:id='" + n + U"'>\n    <name>n &lt; " + n + U" &amp; more</name><m:name>" + n + U"</m:name>\n    <empty>  </empty>\n  </item>\n");
+    }
+    items.append(U"</items>\n");
+    documents.push_back(items);
+    return documents;
+}
+
+void CheckXmlDocument()
+{
+    std::vector<std::u32string> documents = DomDocuments();
+    for (int i = 0; i < int(documents.size()); ++i)
+    {
+        //  The nodes are those of the merged events: the builder joins the text in place or in the pool, and leaves out comments and whitespace text as asked.
+        for (int options = 0; options < 3; ++options)
+        {
+            XmlDocumentOptions documentOptions;
+            documentOptions.keepWhitespaceText = options != 1;
+            documentOptions.keepComments = options != 2;
+            documentOptions.indexByName = options == 1;
+            std::unique_ptr<EventLog> log(documentOptions.keepComments ? new EventLog() : new CommentlessLog());
+            log->SetMergeText(true);
+            log->SetDropWhitespaceText(!documentOptions.keepWhitespaceText);
+            ParseXmlContent(documents[i], "document", log.get());
+            std::unique_ptr<XmlDocument> document = ParseXmlDocument(std::u32string(documents[i]), "document", documentOptions);
+            std::string description = "document " + std::to_string(i) + (options == 1 ? " without whitespace text" : options == 2 ? " without comments" : "");
+            Check(DocumentLines(*document) == log->Lines(), "nodes of " + description);
+            Check(InnerTextsAndNamesMatch(*document), "inner texts and names of " + description);
+        }
+        TextCollector collector;
+        ParseXmlContent(documents[i], "document", &collector);
+        std::unique_ptr<XmlDocument> document = ParseXmlDocument(std::u32string(documents[i]), "document");
+        Check(document->DocumentElement().InnerText() == collector.Collected(), "inner text of the document element of document " + std::to_string(i));
+    }
+
+    //  The memory of a document is a small multiple of the UTF-32 content that it keeps, also when most of its text is copied to the pool.
+    std::u32string plain = U"<feed xmlns='urn:atom'>";
+    std::u32string referenced = U"<feed xmlns='urn:atom'>";
+    for (int i = 0; i < 10000; ++i)
+    {
+        std::u32string n = ToUtf32(std::to_string(i));
+        plain.append(U"<entry id='" + n + U"'><title>Entry " + n + U"</title><content type='text'>Lorem ipsum dolor sit amet, consectetur adipiscing elit.</content></entry>");
+        referenced.append(U"<e n='" + n + U"'>a&amp;b&lt;c&gt;d&#x45;f&amp;g&lt;h&gt;i&#x4A;</e>");
+    }
+    plain.append(U"</feed>");
+    referenced.append(U"</feed>");
+    for (const std::u32string* content : { &plain, &referenced })
+    {
+        size_t contentSize = content->length() * sizeof(char32_t);
+        XmlDocumentOptions indexed;
+        indexed.indexByName = true;
+        std::unique_ptr<XmlDocument> document = ParseXmlDocument(std::u32string(*content), "feed", indexed);
+        std::string name = content == &plain ? "plain" : "referenced";
+        Check(document->MemoryUsage() < 2 * contentSize, "memory of the " + name + " document under twice the content");
+    }
+}
+
+} } // namespace soul::check
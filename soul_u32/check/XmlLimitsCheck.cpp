@@ -0,0 +1,159 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <soul_u32/check/Check.hpp>
+#include <soul_u32/xml/XmlParser.hpp>
+#include <soul_u32/xml/XmlParallelParser.hpp>
+#include <soul_u32/xml/XmlBatchParser.hpp>
+#include <soul_u32/xml/XmlDocument.hpp>
+#include <soul_u32/xml/XmlReader.hpp>
+#include <soul_u32/xml/XmlProcessor.hpp>
+#include <thread>
+
+namespace soul { namespace check {
+
+using namespace soul::xml;
+
+//  Returns the limit that a parse exceeded, or XmlLimit::none if it succeeded.
+
+template<typename Parse>
+XmlLimit ExceededLimit(Parse parse)
+{
+    try
+    {
+        parse();
+    }
+    catch (const XmlLimitExceeded& ex)
+    {
+        return ex.Limit();
+    }
+    return XmlLimit::none;
+}
+
+std::string NestedElements(int depth)
+{
+    std::string content;
+    for (int i = 0; i < depth; ++i)
+    {
+        content.append("<e>");
+    }
+    for (int i = 0; i < depth; ++i)
+    {
+        content.append("</e>");
+    }
+    return content;
+}
+
+class BatchHandler : public XmlBatchHandler
+{
+public:
+    XmlViewHandler* BeginDocument(int, int) override { return &viewHandler; }
+private:
+    XmlViewHandler viewHandler;
+};
+
+int CountExceeded(const std::string& content, const XmlLimits* limits, int numParses)
+{
+    int count = 0;
+    for (int i = 0; i < numParses; ++i)
+    {
+        XmlViewHandler handler;
+        if (ExceededLimit([&] { ParseXmlContent(content, "concurrent", limits, &handler); }) != XmlLimit::none)
+        {
+            ++count;
+        }
+    }
+    return count;
+}
+
+void ReadAll(XmlReader& reader)
+{
+    while (reader.Next() != XmlEventKind::none)
+    {
+    }
+}
+
+void CheckXmlLimits()
+{
+    XmlViewHandler handler;
+    XmlLimits limits;
+    limits.SetMaxDocumentSize(100);
+    limits.SetMaxElementDepth(5);
+    limits.SetMaxAttributes(3);
+    limits.SetMaxAttributeValueLength(10);
+    std::string depth5 = NestedElements(5);
+    std::string depth6 = NestedElements(6);
+    std::string large = "<r>" + std::string(120, 'x') + "</r>";
+    Check(ExceededLimit([&] { ParseXmlContent(depth5, "depth5", &limits, &handler); }) == XmlLimit::none, "depth at the limit");
+    Check(ExceededLimit([&] { ParseXmlContent(depth6, "depth6", &limits, &handler); }) == XmlLimit::elementDepth, "depth over the limit");
+    Check(ExceededLimit([&] { ParseXmlContent(large, "large", &limits, &handler); }) == XmlLimit::documentSize, "document size");
+    Check(ExceededLimit([&] { ParseXmlContent(std::string("<r a='1' b='2' c='3' xmlns:p='u'/>"), "atts", &limits, &handler); }) == XmlLimit::attributes, 
+        "namespace declarations count as attributes");
+    Check(ExceededLimit([&] { ParseXmlContent(std::string("<r a='&amp;&amp;&amp;&amp;&amp;&amp;&amp;&amp;&amp;&amp;&amp;'/>"), "value", &limits, &handler); }) == 
+        XmlLimit::attributeValueLength, "attribute value length after references are decoded");
+    Check(ExceededLimit([&] { ParseXmlContent(depth6, "depth6", &handler); }) == XmlLimit::none, "no limits without the limits argument");
+    Check(XmlLimitStr(XmlLimit::none) != XmlLimitStr(XmlLimit::documentSize), "XmlLimitStr(none)");
+
+    //  Limits are per parse: concurrent parses with and without limits do not see each other's limits.
+    XmlLimits shallowLimits;
+    shallowLimits.SetMaxElementDepth(2);
+    std::string depth3 = NestedElements(3);
+    int unlimitedFailures = 0;
+    int limitedSuccesses = 0;
+    std::thread unlimited([&] { unlimitedFailures = CountExceeded(depth3, nullptr, 200); });
+    std::thread limited([&] { limitedSuccesses = 200 - CountExceeded(depth3, &shallowLimits, 200); });
+    unlimited.join();
+    limited.join();
+    Check(unlimitedFailures == 0, "a parse without limits is not limited by a concurrent parse");
+    Check(limitedSuccesses == 0, "a parse with limits is limited while a concurrent parse has none");
+
+    Check(ExceededLimit([&] { XmlReader reader(depth6, "reader", &limits); ReadAll(reader); }) == XmlLimit::elementDepth, "reader depth");
+    Check(ExceededLimit([&] { XmlReader reader(large, "reader", &limits); ReadAll(reader); }) == XmlLimit::documentSize, "reader document size");
+    Check(ExceededLimit([&] { XmlReader reader(depth6, "reader"); ReadAll(reader); }) == XmlLimit::none, "reader without limits");
+
+    XmlDocumentOptions documentOptions;
+    documentOptions.limits = &limits;
+    Check(ExceededLimit([&] { ParseXmlDocument(depth6, "document", documentOptions); }) == XmlLimit::elementDepth, "document depth");
+    Check(ExceededLimit([&] { ParseXmlDocument(depth6, "document"); }) == XmlLimit::none, "document without limits");
+
+    //  A worker processor that parsed with limits parses the next batch without them.
+    XmlBatchParser batchParser(2);
+    BatchHandler batchHandler;
+    std::vector<XmlBatchInput> inputs;
+    for (int i = 0; i < 4; ++i)
+    {
+        inputs.push_back(XmlBatchInput(depth6.c_str(), depth6.length()));
+    }
+    inputs.push_back(XmlBatchInput(large.c_str(), large.length()));
+    std::vector<XmlBatchResult> limitedResults = batchParser.Parse(inputs, &limits, &batchHandler);
+    std::vector<XmlBatchResult> unlimitedResults = batchParser.Parse(inputs, &batchHandler);
+    for (int i = 0; i < int(inputs.size()); ++i)
+    {
+        Check(!limitedResults[i].succeeded, "batch document " + std::to_string(i) + " with limits");
+        Check(unlimitedResults[i].succeeded, "batch document " + std::to_string(i) + " without limits");
+    }
+
+    //  The ancestors of a chunk count in the element depth of a parallel parse.
+    XmlLimits parallelLimits;
+    parallelLimits.SetMaxElementDepth(4);
+    std::string items;
+    std::string deepItems;
+    for (int i = 0; i < 200; ++i)
+    {
+        items.append("<i><a><b>t</b></a></i>");
+        deepItems.append(i == 150 ? "<i><a><b><c>t</c></b></a></i>" : "<i><a><b>t</b></a></i>");
+    }
+    XmlParallelOptions parallelOptions;
+    parallelOptions.numThreads = 3;
+    parallelOptions.minChunkSize = 100;
+    parallelOptions.limits = &parallelLimits;
+    Check(ExceededLimit([&] { ParseXmlContentParallel("<r>" + items + "</r>", "parallel", parallelOptions, &handler); }) == XmlLimit::none, "parallel depth at the limit");
+    Check(ExceededLimit([&] { ParseXmlContentParallel("<r>" + deepItems + "</r>", "parallel", parallelOptions, &handler); }) == XmlLimit::elementDepth, 
+        "parallel depth over the limit");
+    parallelOptions.limits = nullptr;
+    Check(ExceededLimit([&] { ParseXmlContentParallel("<r>" + deepItems + "</r>", "parallel", parallelOptions, &handler); }) == XmlLimit::none, "parallel without limits");
+}
+
+} } // namespace soul::check
@@ -0,0 +1,165 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <soul_u32/check/Check.hpp>
+#include <soul_u32/check/EventLog.hpp>
+#include <soul_u32/xml/XmlParallelParser.hpp>
+#include <soul_u32/xml/XmlParser.hpp>
+#include <soul_u32/util/Unicode.hpp>
+#include <atomic>
+#include <thread>
+
+namespace soul { namespace check {
+
+using namespace soul::xml;
+using soul::unicode::ToUtf8;
+using soul::unicode::ToUtf32;
+
+class ElementCounter : public XmlViewHandler
+{
+public:
+    ElementCounter() : numElements(0) {}
+    int NumElements() const { return numElements; }
+    void StartElement(const U32StringView& /* namespaceUri */, const U32StringView& /* localName */, const U32StringView& /* qualifiedName */,
+        const AttributeViews& /* attributes */) override
+    {
+        ++numElements;
+    }
+private:
+    std::atomic<int> numElements;
+};
+
+struct ParseResult
+{
+    std::string lines;
+    bool failed;
+};
+
+ParseResult ParseSequentially(const std::u32string& content, const std::u32string& skipName)
+{
+    EventLog log(skipName);
+    ParseResult result;
+    result.failed = false;
+    try
+    {
+        ParseXmlContent(content, "sequential", &log);
+    }
+    catch (const std::exception&)
+    {
+        result.failed = true;
+    }
+    result.lines = log.Lines();
+    return result;
+}
+
+ParseResult ParseInParallel(const std::u32string& content, const std::u32string& skipName, int splitDepth)
+{
+    EventLog log(skipName);
+    XmlParallelOptions options;
+    options.numThreads = 4;
+    options.splitDepth = splitDepth;
+    options.minChunkSize = 100;
+    ParseResult result;
+    result.failed = false;
+    try
+    {
+        ParseXmlContentParallel(content, "parallel", options, &log);
+    }
+    catch (const std::exception&)
+    {
+        result.failed = true;
+    }
+    result.lines = log.Lines();
+    return result;
+}
+
+std::u32string Items(int numItems)
+{
+    std::u32string content = U"<?xml version='1.0'?>\n<!--c-->\n<r xmlns='urn:d' xmlns:p='urn:p'>\n<head>h</head>\n<list xmlns:q='urn:q'>\n";
+    for (int i = 0; i < numItems; ++i)
+    {
+        std::u32string n = ToUtf32(std::to_string(i));
+        content.append(U"  <item n='" + n + U"' p:a='x&amp;y' q:b='2'><b>t &lt; " + n + U"<![CDATA[<c>]]></b><!--k--><?pi d?><p:c/></item>\n");
+    }
+    content.append(U"</list>\n<tail>x</tail>\n</r>\n<!--end-->");
+    return content;
+}
+
+void CheckXmlParallelParser()
+{
+    std::u32string items = Items(200);
+    for (int splitDepth = 1; splitDepth <= 3; ++splitDepth)
+    {
+        //  Skipping 'r' or 'list' skips subtrees that contain chunks, skipping 'b' skips subtrees inside the chunks.
+        for (const std::u32string& skipName : { std::u32string(), std::u32string(U"b"), std::u32string(U"list"), std::u32string(U"r") })
+        {
+            ParseResult sequential = ParseSequentially(items, skipName);
+            ParseResult parallel = ParseInParallel(items, skipName, splitDepth);
+            Check(!sequential.failed && !parallel.failed && sequential.lines == parallel.lines,
+                "same events at split depth " + std::to_string(splitDepth) + (skipName.empty() ? "" : " skipping '" + ToUtf8(skipName) + "'"));
+        }
+    }
+
+    //  Up to an error, a parallel parse delivers the same events as a sequential one, also from the chunk that has the error.
+    std::vector<std::pair<std::u32string, std::u32string>> errors =
+    {
+        { U"<b>t &lt; 0<", U"<b x>t &lt; 0<" },
+        { U"<b>t &lt; 150<", U"<b x>t &lt; 150<" },
+        { U"<b>t &lt; 179<", U"<b>t < 179<" },
+        { U"<b>t &lt; 199<", U"<b>t &lt; 199</q><" },
+        { U"n='120'", U"n='120" }
+    };
+    for (const std::pair<std::u32string, std::u32string>& error : errors)
+    {
+        std::u32string malformed = items;
+        malformed.replace(malformed.find(error.first), error.first.length(), error.second);
+        ParseResult sequential = ParseSequentially(malformed, std::u32string());
+        for (int splitDepth = 1; splitDepth <= 2; ++splitDepth)
+        {
+            ParseResult parallel = ParseInParallel(malformed, std::u32string(), splitDepth);
+            Check(sequential.failed && parallel.failed && sequential.lines == parallel.lines,
+                "same events before the error '" + ToUtf8(error.second) + "' at split depth " + std::to_string(splitDepth));
+        }
+    }
+}
+
+//  Compares a sequential parse of a 36.6M character feed with ordered and unordered parallel parses.
+
+void BenchmarkXmlParallelParser()
+{
+    std::u32string feed = U"<feed xmlns='urn:atom'>";
+    for (int i = 0; i < 100000; ++i)
+    {
+        std::u32string n = ToUtf32(std::to_string(i));
+        feed.append(U"<entry id='" + n + U"'><title>Entry " + n + U" &amp; more</title><author><name>Someone</name><email>a@b.c</email></author>"
+            U"<content type='html'>Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua.</content>"
+            U"<link rel='alternate' href='http://example.com/x'/><category term='a'/><category term='b'/></entry>\n");
+    }
+    feed.append(U"</feed>");
+    Report("size: " + std::to_string(feed.length()) + " characters, hardware threads: " + std::to_string(std::thread::hardware_concurrency()));
+    ElementCounter sequentialCounter;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    ParseXmlContent(feed, "feed", &sequentialCounter);
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    Report("sequential: " + std::to_string(Milliseconds(start, end)) + " ms");
+    for (bool ordered : { true, false })
+    {
+        for (int numThreads : { 1, 2, 4, 8 })
+        {
+            ElementCounter counter;
+            XmlParallelOptions options;
+            options.numThreads = numThreads;
+            options.ordered = ordered;
+            start = std::chrono::steady_clock::now();
+            ParseXmlContentParallel(feed, "feed", options, &counter);
+            end = std::chrono::steady_clock::now();
+            std::string mode = ordered ? "ordered" : "unordered";
+            Check(counter.NumElements() == sequentialCounter.NumElements(), mode + " elements with " + std::to_string(numThreads) + " threads");
+            Report(mode + ", " + std::to_string(numThreads) + " threads: " + std::to_string(Milliseconds(start, end)) + " ms");
+        }
+    }
+}
+
+} } // namespace soul::check
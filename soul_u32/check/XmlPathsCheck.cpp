@@ -0,0 +1,213 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <soul_u32/check/Check.hpp>
+#include <soul_u32/check/EventLog.hpp>
+#include <soul_u32/xml/XmlPaths.hpp>
+#include <soul_u32/xml/XmlParser.hpp>
+#include <soul_u32/xml/XmlProcessor.hpp>
+#include <soul_u32/util/Unicode.hpp>
+#include <stdexcept>
+
+namespace soul { namespace check {
+
+using namespace soul::xml;
+using soul::unicode::ToUtf8;
+
+//  Selects the events of a full parse by matching each path against the names of the open elements directly, without an automaton,
+//  and forwards the selected events to a log.
+
+class PathFilter : public XmlViewHandler
+{
+public:
+    PathFilter(const std::vector<std::u32string>& paths, EventLog& log_) : log(log_)
+    {
+        for (const std::u32string& path : paths)
+        {
+            filterPaths.push_back(ParsePath(path));
+        }
+    }
+    void StartDocument() override { log.StartDocument(); }
+    void EndDocument() override { log.EndDocument(); }
+    void Text(const U32StringView& text) override { if (InSelected()) log.Text(text); }
+    void Comment(const U32StringView& comment) override { if (InSelected()) log.Comment(comment); }
+    void PI(const U32StringView& target, const U32StringView& data) override { if (InSelected()) log.PI(target, data); }
+    void StartElement(const U32StringView& namespaceUri, const U32StringView& localName, const U32StringView& qualifiedName, const AttributeViews& attributes) override
+    {
+        names.push_back(qualifiedName.ToString());
+        bool selected = InSelected();
+        std::vector<std::u32string> selectedAttributes;
+        for (const FilterPath& path : filterPaths)
+        {
+            if (Matches(path, 0, 0))
+            {
+                if (path.attribute.empty())
+                {
+                    selected = true;
+                }
+                else
+                {
+                    selectedAttributes.push_back(path.attribute);
+                }
+            }
+        }
+        AttributeViews filtered;
+        for (const AttributeView& attribute : attributes)
+        {
+            for (const std::u32string& selectedAttribute : selectedAttributes)
+            {
+                if (selectedAttribute == U"*" || attribute.QualifiedName() == U32StringView(selectedAttribute))
+                {
+                    filtered.Add(attribute);
+                    break;
+                }
+            }
+        }
+        bool delivered = selected || filtered.Count() > 0;
+        selectedStack.push_back(selected);
+        deliveredStack.push_back(delivered);
+        if (delivered)
+        {
+            log.StartElement(namespaceUri, localName, qualifiedName, selected ? attributes : filtered);
+        }
+    }
+    void EndElement(const U32StringView& namespaceUri, const U32StringView& localName, const U32StringView& qualifiedName) override
+    {
+        if (deliveredStack.back())
+        {
+            log.EndElement(namespaceUri, localName, qualifiedName);
+        }
+        names.pop_back();
+        selectedStack.pop_back();
+        deliveredStack.pop_back();
+    }
+private:
+    struct FilterStep
+    {
+        std::u32string name;
+        bool descendant;
+    };
+    struct FilterPath
+    {
+        std::vector<FilterStep> steps;
+        std::u32string attribute;
+    };
+    EventLog& log;
+    std::vector<FilterPath> filterPaths;
+    std::vector<std::u32string> names;
+    std::vector<bool> selectedStack;
+    std::vector<bool> deliveredStack;
+    bool InSelected() const { return !selectedStack.empty() && selectedStack.back(); }
+    static FilterPath ParsePath(const std::u32string& path)
+    {
+        FilterPath filterPath;
+        size_t pos = 0;
+        while (pos < path.length())
+        {
+            FilterStep step;
+            step.descendant = path.compare(pos, 2, U"//") == 0;
+            pos += step.descendant ? 2 : 1;
+            size_t end = path.find('/', pos);
+            std::u32string name = path.substr(pos, end == std::u32string::npos ? std::u32string::npos : end - pos);
+            pos = end == std::u32string::npos ? path.length() : end;
+            if (name[0] == '@')
+            {
+                filterPath.attribute = name.substr(1);
+            }
+            else
+            {
+                step.name = name;
+                filterPath.steps.push_back(step);
+            }
+        }
+        return filterPath;
+    }
+    //  Matches the steps from stepIndex on to the open elements from nameIndex on, the last step matching the innermost element.
+    bool Matches(const FilterPath& path, size_t stepIndex, size_t nameIndex) const
+    {
+        if (stepIndex == path.steps.size())
+        {
+            return nameIndex == names.size();
+        }
+        const FilterStep& step = path.steps[stepIndex];
+        size_t last = step.descendant ? names.size() : std::min(nameIndex + 1, names.size());
+        for (size_t i = nameIndex; i < last; ++i)
+        {
+            if ((step.name == U"*" || step.name == names[i]) && Matches(path, stepIndex + 1, i + 1))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+std::string FilteredLines(const std::u32string& content, const std::vector<std::u32string>& paths)
+{
+    EventLog log;
+    PathFilter filter(paths, log);
+    ParseXmlContent(content, "paths", &filter);
+    return log.Lines();
+}
+
+std::string SelectedLines(const std::u32string& content, const std::vector<std::u32string>& paths)
+{
+    XmlPaths xmlPaths;
+    for (const std::u32string& path : paths)
+    {
+        xmlPaths.Add(path);
+    }
+    EventLog log;
+    ParseXmlContent(content, "paths", xmlPaths, &log);
+    return log.Lines();
+}
+
+void CheckXmlPaths()
+{
+    std::u32string content = U"<a xmlns:p='urn:p'>\n <b x='1' y='2'>t1<b x='3'>t2</b><c><b>t3</b></c></b>\n <c x='4' p:z='5'><d><b x='6'/>t4</d><!--k--><?pi d?></c>\n"
+        U" <p:b x='7'>t5</p:b>\n <e><c><b x='8'><c><b>t6</b></c></b></c><c y='9'/></e>\n</a>";
+    std::vector<std::vector<std::u32string>> pathSets =
+    {
+        { U"/a/b" }, { U"//b" }, { U"/a/*" }, { U"//*" }, { U"/*/*/*" }, { U"//c//b" }, { U"//c/b" }, { U"/a//c" }, { U"//p:b" },
+        { U"//b/@x" }, { U"/a/c/@*" }, { U"//c/@x" }, { U"//*/@y" }, { U"//b/@x", U"/a/c" }, { U"/a/b/@x", U"//d" }, { U"//c/@x", U"//c//b" },
+        { U"/a/e/c/@y" }, { U"/b" }, { U"//f/@x" }
+    };
+    for (const std::vector<std::u32string>& paths : pathSets)
+    {
+        std::string description;
+        for (const std::u32string& path : paths)
+        {
+            description.append((description.empty() ? "" : ", ") + ToUtf8(path));
+        }
+        Check(SelectedLines(content, paths) == FilteredLines(content, paths), "events selected by " + description);
+    }
+    Check(SelectedLines(content, { U"//c/@x" }) == ToUtf8(U"start document\nstart  c  x=4\nend c\nend document\n"), "element with only a selected attribute");
+
+    //  The UTF-8 and the limits overloads select the same events, and the limits apply to the skipped subtrees too.
+    XmlPaths bPaths;
+    bPaths.Add(U"/a/b");
+    EventLog utf8Log;
+    ParseXmlContent(ToUtf8(content), "paths", bPaths, &utf8Log);
+    Check(utf8Log.Lines() == SelectedLines(content, { U"/a/b" }), "UTF-8 content");
+    XmlLimits limits;
+    limits.SetMaxElementDepth(6);
+    EventLog limitedLog;
+    ParseXmlContent(ToUtf8(content), "paths", bPaths, &limits, &limitedLog);
+    Check(limitedLog.Lines() == utf8Log.Lines(), "limits that the document does not exceed");
+    limits.SetMaxElementDepth(5);
+    bool thrown = false;
+    try
+    {
+        EventLog log;
+        ParseXmlContent(content, "paths", bPaths, &limits, &log);
+    }
+    catch (const std::exception&)
+    {
+        thrown = true;
+    }
+    Check(thrown, "element depth limit exceeded in a skipped subtree");
+}
+
+} } // namespace soul::check
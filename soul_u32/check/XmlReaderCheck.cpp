@@ -0,0 +1,81 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <soul_u32/check/Check.hpp>
+#include <soul_u32/xml/XmlParser.hpp>
+#include <soul_u32/xml/XmlReader.hpp>
+#include <soul_u32/xml/XmlProcessor.hpp>
+
+namespace soul { namespace check {
+
+using namespace soul::xml;
+
+class SkippingHandler : public XmlViewHandler
+{
+public:
+    void StartElement(const U32StringView& /* namespaceUri */, const U32StringView& /* localName */, const U32StringView& qualifiedName, const AttributeViews& /* attributes */) override
+    {
+        if (qualifiedName == U"s")
+        {
+            SkipSubtree();
+        }
+    }
+};
+
+std::string PushParserError(const std::string& content, const XmlLimits* limits)
+{
+    try
+    {
+        SkippingHandler handler;
+        ParseXmlContent(content, "errors", limits, &handler);
+    }
+    catch (const std::exception& ex)
+    {
+        return ex.what();
+    }
+    return std::string();
+}
+
+std::string ReaderError(const std::string& content, const XmlLimits* limits)
+{
+    try
+    {
+        XmlReader reader(content, "errors", limits);
+        while (reader.Next() != XmlEventKind::none)
+        {
+            if (reader.Kind() == XmlEventKind::startElement && reader.QualifiedName() == U"s")
+            {
+                reader.Skip();
+            }
+        }
+    }
+    catch (const std::exception& ex)
+    {
+        return ex.what();
+    }
+    return std::string();
+}
+
+void CheckXmlReader()
+{
+    //  Errors other than syntax errors have the same message and position as in the push parser.
+    XmlLimits limits;
+    limits.SetMaxElementDepth(3);
+    limits.SetMaxAttributes(1);
+    limits.SetMaxAttributeValueLength(3);
+    std::vector<std::string> contents =
+    {
+        "<a><b></a>", "<a></b>", "<a>\n<b>\n</c>\n</a>", "<a\n><b\n></a>", "<a><s><b></c></s></a>",
+        "<q:a/>", "<a><q:b></q:b></a>", "<a b:c='1'/>", "<a  x = '1'  z:y = '2'  />",
+        "<a><b><c><d/></c></b></a>", "<a><s><b><c/></b></s></a>", "<a x='1' y='2'/>", "<a x='1234'/>"
+    };
+    for (const std::string& content : contents)
+    {
+        std::string pushParserError = PushParserError(content, &limits);
+        Check(!pushParserError.empty() && pushParserError == ReaderError(content, &limits), "reader error of '" + content + "'");
+    }
+}
+
+} } // namespace soul::check
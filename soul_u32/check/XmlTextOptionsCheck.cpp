@@ -0,0 +1,80 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <soul_u32/check/Check.hpp>
+#include <soul_u32/check/EventLog.hpp>
+#include <soul_u32/xml/XmlParser.hpp>
+#include <soul_u32/util/Unicode.hpp>
+
+namespace soul { namespace check {
+
+using namespace soul::xml;
+using soul::unicode::ToUtf8;
+
+//  Documents whose text is split by references, CDATA sections and markup, and that have whitespace-only text in different positions.
+
+std::vector<std::u32string> TextDocuments()
+{
+    std::vector<std::u32string> documents =
+    {
+        U"<r>  <a>x &amp; y<![CDATA[ z ]]>&#x41;</a>\n  <b>   </b>\n  <c> <!--k--> </c><d> <?p d?> t </d>\n</r>",
+        U"<!DOCTYPE r [<!ENTITY e ' ent '><!ENTITY w '  '>]><r> &e; <x>&w;</x><y> &w; <z/></y> &#x20; &unknown; <u>&unknown; </u></r>",
+        U"<r>a<b/>  <c/>b &#32;<![CDATA[  ]]>\r\n</r>",
+        U"<r><a> </a><a>&#x9;</a><a><![CDATA[ ]]></a><a/><a>&#x20;<!----></a><a><?p?>&#xA;</a></r>"
+    };
+    std::u32string items = U"<?xml version='1.0'?>\n<items>\n";
+    for (int i = 0; i < 50; ++i)
+    {
+        items.append(U"    <item>\n        <name>n &lt; " + soul::unicode::ToUtf32(std::to_string(i)) + U" </name>\n        <empty>  </empty>\n    </item>\n");
+    }
+    items.append(U"</items>\n");
+    documents.push_back(items);
+    return documents;
+}
+
+//  With coalescing the processor delivers exactly the merged runs of an unmerged parse, so its events are compared unmerged.
+//  Without coalescing the processor may deliver a run in pieces, so only the merged events are compared.
+
+void CheckXmlTextOptions()
+{
+    std::vector<std::u32string> documents = TextDocuments();
+    for (int i = 0; i < int(documents.size()); ++i)
+    {
+        for (int options = 1; options <= 3; ++options)
+        {
+            bool coalesce = (options & 1) != 0;
+            bool ignoreWhitespace = (options & 2) != 0;
+            EventLog reference;
+            reference.SetMergeText(true);
+            reference.SetDropWhitespaceText(ignoreWhitespace);
+            ParseXmlContent(documents[i], "text", &reference);
+            EventLog processed;
+            processed.SetCoalesceText(coalesce);
+            processed.SetIgnoreWhitespaceText(ignoreWhitespace);
+            processed.SetMergeText(!coalesce);
+            ParseXmlContent(documents[i], "text", &processed);
+            std::string description = std::string(coalesce ? "coalesced" : "") + (options == 3 ? " and " : "") + (ignoreWhitespace ? "whitespace suppressed" : "") +
+                " text of document " + std::to_string(i);
+            Check(processed.Lines() == reference.Lines(), description);
+        }
+    }
+
+    //  The processor leaves whitespace-only text out only when it is asked to, and then only where the merged log does.
+    EventLog unmerged;
+    ParseXmlContent(documents[0], "text", &unmerged);
+    EventLog coalesced;
+    coalesced.SetCoalesceText(true);
+    ParseXmlContent(documents[0], "text", &coalesced);
+    Check(unmerged.Lines().find("text  \n") != std::string::npos && coalesced.Lines().find("text  \n") != std::string::npos &&
+        coalesced.Lines().find("text x & y z A\n") != std::string::npos, "whitespace kept and runs coalesced without whitespace suppression");
+    EventLog suppressed;
+    suppressed.SetIgnoreWhitespaceText(true);
+    suppressed.SetCoalesceText(true);
+    ParseXmlContent(documents[3], "text", &suppressed);
+    Check(suppressed.Lines() == ToUtf8(U"start document\nstart  r\nstart  a\ntext  \nend a\nstart  a\ntext \t\nend a\nstart  a\ntext  \nend a\nstart  a\nend a\n"
+        U"start  a\ncomment \nend a\nstart  a\npi p \nend a\nend r\nend document\n"), "whitespace that is the whole content of an element kept");
+}
+
+} } // namespace soul::check
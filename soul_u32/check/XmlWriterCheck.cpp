@@ -0,0 +1,240 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <soul_u32/check/Check.hpp>
+#include <soul_u32/check/EventLog.hpp>
+#include <soul_u32/xml/XmlWriter.hpp>
+#include <soul_u32/xml/XmlParser.hpp>
+#include <soul_u32/util/Unicode.hpp>
+#include <stdexcept>
+
+namespace soul { namespace check {
+
+using namespace soul::xml;
+using soul::unicode::ToUtf8;
+using soul::unicode::ToUtf32;
+
+//  Writes the events that it receives with an XML writer.
+
+class WritingHandler : public XmlViewHandler
+{
+public:
+    WritingHandler(XmlWriter& writer_) : writer(writer_) {}
+    void Text(const U32StringView& text) override { writer.Text(text); }
+    void Comment(const U32StringView& comment) override { writer.Comment(comment); }
+    void PI(const U32StringView& target, const U32StringView& data) override { writer.PI(target, data); }
+    void StartElement(const U32StringView& namespaceUri, const U32StringView& /* localName */, const U32StringView& qualifiedName, const AttributeViews& attributes) override
+    {
+        writer.StartElement(namespaceUri, qualifiedName);
+        for (const AttributeView& attribute : attributes)
+        {
+            writer.Attribute(attribute.NamespaceUri(), attribute.QualifiedName(), attribute.Value());
+        }
+    }
+    void EndElement(const U32StringView& /* namespaceUri */, const U32StringView& /* localName */, const U32StringView& /* qualifiedName */) override
+    {
+        writer.EndElement();
+    }
+private:
+    XmlWriter& writer;
+};
+
+template<typename Write>
+bool Rejected(Write write)
+{
+    std::string output;
+    XmlWriter writer(output);
+    writer.StartElement(U"r");
+    try
+    {
+        write(writer);
+    }
+    catch (const std::runtime_error&)
+    {
+        return true;
+    }
+    return false;
+}
+
+//  The events of a document and of the document written by an XML writer. With indenting, white space text is not compared.
+
+bool RoundTrips(const std::u32string& content, bool indent)
+{
+    XmlWriterOptions options;
+    options.indent = indent;
+    std::string output;
+    {
+        XmlWriter writer(output, options);
+        writer.XmlDeclaration();
+        WritingHandler writingHandler(writer);
+        ParseXmlContent(content, "original", &writingHandler);
+    }
+    EventLog original;
+    original.SetMergeText(true);
+    original.SetDropWhitespaceText(indent);
+    ParseXmlContent(content, "original", &original);
+    EventLog written;
+    written.SetMergeText(true);
+    written.SetDropWhitespaceText(indent);
+    ParseXmlContent(output, "written", &written);
+    return original.Lines() == written.Lines();
+}
+
+std::u32string Feed(int numEntries)
+{
+    std::u32string feed = U"<feed xmlns='urn:atom' xmlns:x='urn:x'>";
+    for (int i = 0; i < numEntries; ++i)
+    {
+        std::u32string n = ToUtf32(std::to_string(i));
+        feed.append(U"<entry id='" + n + U"' x:k='v'><title>Entry " + n + U" &amp; more \u00E4</title><author><name>Someone</name><email>a@b.c</email></author>"
+            U"<content type='html'>Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do &lt;b&gt;eiusmod&lt;/b&gt; tempor incididunt ut labore et dolore magna aliqua."
+            U"</content><link rel='alternate' href='http://example.com/x?a=1&amp;b=2'/><category term='a'/><category term='b'/></entry>");
+    }
+    feed.append(U"</feed>");
+    return feed;
+}
+
+void CheckXmlWriter()
+{
+    //  White space in attribute values and carriage returns are written as character references, so they are read back unchanged.
+    std::string output;
+    {
+        XmlWriter writer(output);
+        writer.StartElement(U"r");
+        writer.Attribute(U"a", U"<&\"'\t\n\r\U0001F600");
+        writer.Text(U"<&>\r\n\t]]>\uFFFD\U00010000");
+        writer.EndElement();
+    }
+    EventLog written;
+    written.SetMergeText(true);
+    ParseXmlContent(output, "written", &written);
+    Check(written.Lines() == ToUtf8(U"start document\nstart  r  a=<&\"'\t\n\r\U0001F600\ntext <&>\r\n\t]]>\uFFFD\U00010000\nend r\nend document\n"),
+        "escaped characters read back unchanged");
+
+    Check(Rejected([](XmlWriter& writer) { writer.Text(U"a\x01"); }), "control character in text");
+    Check(Rejected([](XmlWriter& writer) { writer.Attribute(U"a", U"\x1F"); }), "control character in attribute value");
+    Check(Rejected([](XmlWriter& writer) { writer.CData(std::u32string(1, char32_t(0))); }), "null character in CDATA section");
+    Check(Rejected([](XmlWriter& writer) { writer.Comment(std::u32string(1, char32_t(0xD800))); }), "surrogate in comment");
+    Check(Rejected([](XmlWriter& writer) { writer.Text(std::u32string(1, char32_t(0xFFFE))); }), "0xFFFE in text");
+    Check(Rejected([](XmlWriter& writer) { writer.PI(U"pi", std::u32string(1, char32_t(0xFFFF))); }), "0xFFFF in processing instruction");
+    Check(Rejected([](XmlWriter& writer) { writer.Text(std::u32string(1, char32_t(0x110000))); }), "character out of range");
+    Check(Rejected([](XmlWriter& writer) { writer.Comment(U"a--b"); }), "\"--\" in comment");
+    Check(!Rejected([](XmlWriter& writer) { writer.Text(U"\t\n\r\uD7FF\uE000\uFFFD\U00010000\U0010FFFF"); }), "characters at the edges of the allowed ranges");
+
+    std::u32string feed = Feed(10);
+    Check(RoundTrips(feed, false), "round trip");
+    Check(RoundTrips(feed, true), "round trip with indenting");
+}
+
+//  Compares writing the events of a 100,000 entry feed, 42 MB as UTF-8, with an XML writer to string concatenation that escapes character by character.
+
+std::string EscapeByConcatenation(const U32StringView& text, bool attribute)
+{
+    std::string escaped;
+    for (char32_t c : text)
+    {
+        if (c == '<')
+        {
+            escaped += "&lt;";
+        }
+        else if (c == '&')
+        {
+            escaped += "&amp;";
+        }
+        else if (c == '>' && !attribute)
+        {
+            escaped += "&gt;";
+        }
+        else if (c == '"' && attribute)
+        {
+            escaped += "&quot;";
+        }
+        else
+        {
+            escaped += ToUtf8(std::u32string(1, c));
+        }
+    }
+    return escaped;
+}
+
+class ConcatenatingHandler : public XmlViewHandler
+{
+public:
+    const std::string& Output() const { return output; }
+    void Text(const U32StringView& text) override { output += EscapeByConcatenation(text, false); }
+    void StartElement(const U32StringView& /* namespaceUri */, const U32StringView& /* localName */, const U32StringView& qualifiedName, const AttributeViews& attributes) override
+    {
+        output += "<" + ToUtf8(qualifiedName.ToString());
+        for (const AttributeView& attribute : attributes)
+        {
+            output += " " + ToUtf8(attribute.QualifiedName().ToString()) + "=\"" + EscapeByConcatenation(attribute.Value(), true) + "\"";
+        }
+        output += ">";
+    }
+    void EndElement(const U32StringView& /* namespaceUri */, const U32StringView& /* localName */, const U32StringView& qualifiedName) override
+    {
+        output += "</" + ToUtf8(qualifiedName.ToString()) + ">";
+    }
+private:
+    std::string output;
+};
+
+void BenchmarkXmlWriter()
+{
+    std::u32string feed = Feed(100000);
+    Check(RoundTrips(feed, false), "round trip");
+    XmlViewHandler nullHandler;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    ParseXmlContent(feed, "feed", &nullHandler);
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    double parseTime = Milliseconds(start, end);
+    std::string output;
+    start = std::chrono::steady_clock::now();
+    {
+        XmlWriter writer(output);
+        WritingHandler writingHandler(writer);
+        ParseXmlContent(feed, "feed", &writingHandler);
+    }
+    end = std::chrono::steady_clock::now();
+    double writerTime = Milliseconds(start, end);
+    ConcatenatingHandler concatenatingHandler;
+    start = std::chrono::steady_clock::now();
+    ParseXmlContent(feed, "feed", &concatenatingHandler);
+    end = std::chrono::steady_clock::now();
+    double concatenationTime = Milliseconds(start, end);
+    Report("output: XmlWriter " + std::to_string(output.length() / 1000000.0) + " MB, concatenation " + std::to_string(concatenatingHandler.Output().length() / 1000000.0) + " MB");
+    Report("parse only: " + std::to_string(parseTime) + " ms");
+    Report("parse and XmlWriter: " + std::to_string(writerTime) + " ms");
+    Report("parse and concatenation: " + std::to_string(concatenationTime) + " ms");
+
+    std::u32string text;
+    for (int i = 0; i < 1000; ++i)
+    {
+        text.append(U"Lorem ipsum dolor sit amet, consectetur <adipiscing> elit & \u00E4\u00F6 sed do eiusmod tempor. ");
+    }
+    std::string escapedText;
+    start = std::chrono::steady_clock::now();
+    {
+        XmlWriter writer(escapedText);
+        writer.StartElement(U"r");
+        for (int i = 0; i < 200; ++i)
+        {
+            writer.Text(text);
+        }
+    }
+    end = std::chrono::steady_clock::now();
+    double writerRate = escapedText.length() / 1000.0 / Milliseconds(start, end);
+    std::string concatenatedText;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 200; ++i)
+    {
+        concatenatedText += EscapeByConcatenation(text, false);
+    }
+    end = std::chrono::steady_clock::now();
+    double concatenationRate = concatenatedText.length() / 1000.0 / Milliseconds(start, end);
+    Report("escaping text: XmlWriter " + std::to_string(writerRate) + " MB/s, concatenation " + std::to_string(concatenationRate) + " MB/s");
+}
+
+} } // namespace soul::check
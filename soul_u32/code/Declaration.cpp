@@ -58,6 +58,11 @@ DeclarationGrammar::DeclarationGrammar(soul::parsing::ParsingDomain* parsingDoma
 }
 
 soul::codedom::CppObject* DeclarationGrammar::Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName)
+{
+    return Parse(start, end, fileIndex, fileName, nullptr);
+}
+
+soul::codedom::CppObject* DeclarationGrammar::Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, const soul::parsing::ParsingLimits* limits)
 {
     soul::parsing::Scanner scanner(start, end, fileName, fileIndex, SkipRule());
     std::unique_ptr<soul::parsing::XmlLog> xmlLog;
@@ -70,7 +75,7 @@ soul::codedom::CppObject* DeclarationGrammar::Parse(const char32_t* start, const
     soul::parsing::ObjectStack stack;
     std::unique_ptr<soul::parsing::ParsingData> parsingData(new soul::parsing::ParsingData(GetParsingDomain()->GetNumRules()));
     scanner.SetParsingData(parsingData.get());
-    soul::parsing::Match match = soul::parsing::Grammar::Parse(scanner, stack, parsingData.get());
+    soul::parsing::Match match = soul::parsing::Grammar::Parse(scanner, stack, parsingData.get(), limits);
     soul::parsing::Span stop = scanner.GetSpan();
     if (Log())
     {
@@ -87,10 +92,7 @@ soul::codedom::CppObject* DeclarationGrammar::Parse(const char32_t* start, const
             throw soul::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<soul::parsing::Object> value = std::move(stack.top());
-    soul::codedom::CppObject* result = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(value.get());
-    stack.pop();
-    return result;
+    return soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
 }
 
 class DeclarationGrammar::BlockDeclarationRule : public soul::parsing::Rule
@@ -103,15 +105,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::CppObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::CppObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -136,62 +136,54 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromNamespaceAliasDefinition;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromUsingDirective;
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromUsingDeclaration;
     }
     void A3Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromSimpleDeclaration;
     }
     void PostNamespaceAliasDefinition(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromNamespaceAliasDefinition_value = std::move(stack.top());
-            context->fromNamespaceAliasDefinition = *static_cast<soul::parsing::ValueObject<soul::codedom::UsingObject*>*>(fromNamespaceAliasDefinition_value.get());
-            stack.pop();
+            context->fromNamespaceAliasDefinition = soul::parsing::PopValue<soul::codedom::UsingObject*>(stack);
         }
     }
     void PostUsingDirective(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromUsingDirective_value = std::move(stack.top());
-            context->fromUsingDirective = *static_cast<soul::parsing::ValueObject<soul::codedom::UsingObject*>*>(fromUsingDirective_value.get());
-            stack.pop();
+            context->fromUsingDirective = soul::parsing::PopValue<soul::codedom::UsingObject*>(stack);
         }
     }
     void PostUsingDeclaration(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromUsingDeclaration_value = std::move(stack.top());
-            context->fromUsingDeclaration = *static_cast<soul::parsing::ValueObject<soul::codedom::UsingObject*>*>(fromUsingDeclaration_value.get());
-            stack.pop();
+            context->fromUsingDeclaration = soul::parsing::PopValue<soul::codedom::UsingObject*>(stack);
         }
     }
     void PostSimpleDeclaration(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromSimpleDeclaration_value = std::move(stack.top());
-            context->fromSimpleDeclaration = *static_cast<soul::parsing::ValueObject<soul::codedom::SimpleDeclaration*>*>(fromSimpleDeclaration_value.get());
-            stack.pop();
+            context->fromSimpleDeclaration = soul::parsing::PopValue<soul::codedom::SimpleDeclaration*>(stack);
         }
     }
 private:
@@ -217,15 +209,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::SimpleDeclaration*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::SimpleDeclaration*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -244,32 +234,30 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->sd.reset(new SimpleDeclaration);
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->sd.release();
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->sd->SetInitDeclaratorList(context->fromInitDeclaratorList);
     }
     void PreDeclSpecifierSeq(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::SimpleDeclaration*>(context->sd.get())));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::codedom::SimpleDeclaration*>(stack, context->sd.get());
     }
     void PostInitDeclaratorList(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromInitDeclaratorList_value = std::move(stack.top());
-            context->fromInitDeclaratorList = *static_cast<soul::parsing::ValueObject<soul::codedom::InitDeclaratorList*>*>(fromInitDeclaratorList_value.get());
-            stack.pop();
+            context->fromInitDeclaratorList = soul::parsing::PopValue<soul::codedom::InitDeclaratorList*>(stack);
         }
     }
 private:
@@ -292,11 +280,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> declaration_value = std::move(stack.top());
-        context->declaration = *static_cast<soul::parsing::ValueObject<soul::codedom::SimpleDeclaration*>*>(declaration_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->declaration = soul::parsing::PopValue<soul::codedom::SimpleDeclaration*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -315,32 +300,28 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->declaration->Add(context->fromDeclSpecifier);
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->declaration->Add(context->fromTypeName);
     }
     void PostDeclSpecifier(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromDeclSpecifier_value = std::move(stack.top());
-            context->fromDeclSpecifier = *static_cast<soul::parsing::ValueObject<soul::codedom::DeclSpecifier*>*>(fromDeclSpecifier_value.get());
-            stack.pop();
+            context->fromDeclSpecifier = soul::parsing::PopValue<soul::codedom::DeclSpecifier*>(stack);
         }
     }
     void PostTypeName(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromTypeName_value = std::move(stack.top());
-            context->fromTypeName = *static_cast<soul::parsing::ValueObject<soul::codedom::TypeName*>*>(fromTypeName_value.get());
-            stack.pop();
+            context->fromTypeName = soul::parsing::PopValue<soul::codedom::TypeName*>(stack);
         }
     }
 private:
@@ -363,15 +344,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::DeclSpecifier*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::DeclSpecifier*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -392,47 +371,41 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromStorageClassSpecifier;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromTypeSpecifier;
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromTypedef;
     }
     void PostStorageClassSpecifier(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromStorageClassSpecifier_value = std::move(stack.top());
-            context->fromStorageClassSpecifier = *static_cast<soul::parsing::ValueObject<soul::codedom::StorageClassSpecifier*>*>(fromStorageClassSpecifier_value.get());
-            stack.pop();
+            context->fromStorageClassSpecifier = soul::parsing::PopValue<soul::codedom::StorageClassSpecifier*>(stack);
         }
     }
     void PostTypeSpecifier(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromTypeSpecifier_value = std::move(stack.top());
-            context->fromTypeSpecifier = *static_cast<soul::parsing::ValueObject<soul::codedom::TypeSpecifier*>*>(fromTypeSpecifier_value.get());
-            stack.pop();
+            context->fromTypeSpecifier = soul::parsing::PopValue<soul::codedom::TypeSpecifier*>(stack);
         }
     }
     void PostTypedef(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromTypedef_value = std::move(stack.top());
-            context->fromTypedef = *static_cast<soul::parsing::ValueObject<soul::codedom::DeclSpecifier*>*>(fromTypedef_value.get());
-            stack.pop();
+            context->fromTypedef = soul::parsing::PopValue<soul::codedom::DeclSpecifier*>(stack);
         }
     }
 private:
@@ -456,15 +429,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::StorageClassSpecifier*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::StorageClassSpecifier*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -475,7 +446,7 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new StorageClassSpecifier(std::u32string(matchBegin, matchEnd));
     }
 private:
@@ -496,15 +467,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::TypeSpecifier*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::TypeSpecifier*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -521,32 +490,28 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromSimpleTypeSpecifier;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromCVQualifier;
     }
     void PostSimpleTypeSpecifier(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromSimpleTypeSpecifier_value = std::move(stack.top());
-            context->fromSimpleTypeSpecifier = *static_cast<soul::parsing::ValueObject<soul::codedom::TypeSpecifier*>*>(fromSimpleTypeSpecifier_value.get());
-            stack.pop();
+            context->fromSimpleTypeSpecifier = soul::parsing::PopValue<soul::codedom::TypeSpecifier*>(stack);
         }
     }
     void PostCVQualifier(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromCVQualifier_value = std::move(stack.top());
-            context->fromCVQualifier = *static_cast<soul::parsing::ValueObject<soul::codedom::TypeSpecifier*>*>(fromCVQualifier_value.get());
-            stack.pop();
+            context->fromCVQualifier = soul::parsing::PopValue<soul::codedom::TypeSpecifier*>(stack);
         }
     }
 private:
@@ -569,15 +534,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::TypeSpecifier*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::TypeSpecifier*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -588,7 +551,7 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new TypeSpecifier(std::u32string(matchBegin, matchEnd));
     }
 private:
@@ -609,15 +572,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::TypeName*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::TypeName*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -634,28 +595,26 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new soul::codedom::TypeName(std::u32string(matchBegin, matchEnd));
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value->IsTemplate() = true;
     }
     void PostQualifiedId(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromQualifiedId_value = std::move(stack.top());
-            context->fromQualifiedId = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromQualifiedId_value.get());
-            stack.pop();
+            context->fromQualifiedId = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
     void PreTemplateArgumentList(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::TypeName*>(context->value)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::codedom::TypeName*>(stack, context->value);
     }
 private:
     struct Context : soul::parsing::Context
@@ -676,11 +635,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> typeName_value = std::move(stack.top());
-        context->typeName = *static_cast<soul::parsing::ValueObject<soul::codedom::TypeName*>*>(typeName_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->typeName = soul::parsing::PopValue<soul::codedom::TypeName*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -695,17 +651,15 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->typeName->AddTemplateArgument(context->fromTemplateArgument);
     }
     void PostTemplateArgument(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromTemplateArgument_value = std::move(stack.top());
-            context->fromTemplateArgument = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromTemplateArgument_value.get());
-            stack.pop();
+            context->fromTemplateArgument = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
 private:
@@ -727,15 +681,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::CppObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::CppObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -752,32 +704,28 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromTypeId;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromAssignmentExpression;
     }
     void PostTypeId(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromTypeId_value = std::move(stack.top());
-            context->fromTypeId = *static_cast<soul::parsing::ValueObject<soul::codedom::TypeId*>*>(fromTypeId_value.get());
-            stack.pop();
+            context->fromTypeId = soul::parsing::PopValue<soul::codedom::TypeId*>(stack);
         }
     }
     void PostAssignmentExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromAssignmentExpression_value = std::move(stack.top());
-            context->fromAssignmentExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromAssignmentExpression_value.get());
-            stack.pop();
+            context->fromAssignmentExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
 private:
@@ -800,15 +748,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::DeclSpecifier*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::DeclSpecifier*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -819,7 +765,7 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new Typedef;
     }
 private:
@@ -840,15 +786,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::TypeSpecifier*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::TypeSpecifier*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -861,12 +805,12 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new Const;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new Volatile;
     }
 private:
@@ -887,15 +831,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::UsingObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::UsingObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -910,27 +852,23 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new NamespaceAlias(context->fromIdentifier, context->fromQualifiedId);
     }
     void PostIdentifier(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromIdentifier_value = std::move(stack.top());
-            context->fromIdentifier = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromIdentifier_value.get());
-            stack.pop();
+            context->fromIdentifier = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
     void PostQualifiedId(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromQualifiedId_value = std::move(stack.top());
-            context->fromQualifiedId = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromQualifiedId_value.get());
-            stack.pop();
+            context->fromQualifiedId = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
 private:
@@ -953,15 +891,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::UsingObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::UsingObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -974,17 +910,15 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new UsingDeclaration(context->fromQualifiedId);
     }
     void PostQualifiedId(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromQualifiedId_value = std::move(stack.top());
-            context->fromQualifiedId = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromQualifiedId_value.get());
-            stack.pop();
+            context->fromQualifiedId = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
 private:
@@ -1006,15 +940,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::UsingObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::UsingObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1027,17 +959,15 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new UsingDirective(context->fromQualifiedId);
     }
     void PostQualifiedId(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromQualifiedId_value = std::move(stack.top());
-            context->fromQualifiedId = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromQualifiedId_value.get());
-            stack.pop();
+            context->fromQualifiedId = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
 private:
@@ -1052,40 +982,40 @@ private:
 void DeclarationGrammar::GetReferencedGrammars()
 {
     soul::parsing::ParsingDomain* pd = GetParsingDomain();
-    soul::parsing::Grammar* grammar0 = pd->GetGrammar(ToUtf32("soul.code.ExpressionGrammar"));
+    soul::parsing::Grammar* grammar0 = pd->GetGrammar(ToUtf32("soul.code.DeclaratorGrammar"));
     if (!grammar0)
     {
-        grammar0 = soul::code::ExpressionGrammar::Create(pd);
+        grammar0 = soul::code::DeclaratorGrammar::Create(pd);
     }
     AddGrammarReference(grammar0);
-    soul::parsing::Grammar* grammar1 = pd->GetGrammar(ToUtf32("soul.code.IdentifierGrammar"));
+    soul::parsing::Grammar* grammar1 = pd->GetGrammar(ToUtf32("soul.code.ExpressionGrammar"));
     if (!grammar1)
     {
-        grammar1 = soul::code::IdentifierGrammar::Create(pd);
+        grammar1 = soul::code::ExpressionGrammar::Create(pd);
     }
     AddGrammarReference(grammar1);
-    soul::parsing::Grammar* grammar2 = pd->GetGrammar(ToUtf32("soul.parsing.stdlib"));
+    soul::parsing::Grammar* grammar2 = pd->GetGrammar(ToUtf32("soul.code.IdentifierGrammar"));
     if (!grammar2)
     {
-        grammar2 = soul::parsing::stdlib::Create(pd);
+        grammar2 = soul::code::IdentifierGrammar::Create(pd);
     }
     AddGrammarReference(grammar2);
-    soul::parsing::Grammar* grammar3 = pd->GetGrammar(ToUtf32("soul.code.DeclaratorGrammar"));
+    soul::parsing::Grammar* grammar3 = pd->GetGrammar(ToUtf32("soul.parsing.stdlib"));
     if (!grammar3)
     {
-        grammar3 = soul::code::DeclaratorGrammar::Create(pd);
+        grammar3 = soul::parsing::stdlib::Create(pd);
     }
     AddGrammarReference(grammar3);
 }
 
 void DeclarationGrammar::CreateRules()
 {
-    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("AssignmentExpression"), this, ToUtf32("ExpressionGrammar.AssignmentExpression")));
-    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("QualifiedId"), this, ToUtf32("IdentifierGrammar.QualifiedId")));
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("identifier"), this, ToUtf32("soul.parsing.stdlib.identifier")));
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("InitDeclaratorList"), this, ToUtf32("DeclaratorGrammar.InitDeclaratorList")));
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("TypeId"), this, ToUtf32("DeclaratorGrammar.TypeId")));
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("Identifier"), this, ToUtf32("IdentifierGrammar.Identifier")));
+    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("QualifiedId"), this, ToUtf32("IdentifierGrammar.QualifiedId")));
+    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("AssignmentExpression"), this, ToUtf32("ExpressionGrammar.AssignmentExpression")));
     AddRule(new BlockDeclarationRule(ToUtf32("BlockDeclaration"), GetScope(), GetParsingDomain()->GetNextRuleId(),
         new soul::parsing::AlternativeParser(
             new soul::parsing::AlternativeParser(
@@ -13,6 +13,7 @@ public:
     static DeclarationGrammar* Create();
     static DeclarationGrammar* Create(soul::parsing::ParsingDomain* parsingDomain);
     soul::codedom::CppObject* Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName);
+    soul::codedom::CppObject* Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, const soul::parsing::ParsingLimits* limits);
 private:
     std::vector<std::u32string> keywords0;
     std::vector<std::u32string> keywords1;
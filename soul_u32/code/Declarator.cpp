@@ -43,6 +43,11 @@ DeclaratorGrammar::DeclaratorGrammar(soul::parsing::ParsingDomain* parsingDomain
 }
 
 soul::codedom::InitDeclaratorList* DeclaratorGrammar::Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName)
+{
+    return Parse(start, end, fileIndex, fileName, nullptr);
+}
+
+soul::codedom::InitDeclaratorList* DeclaratorGrammar::Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, const soul::parsing::ParsingLimits* limits)
 {
     soul::parsing::Scanner scanner(start, end, fileName, fileIndex, SkipRule());
     std::unique_ptr<soul::parsing::XmlLog> xmlLog;
@@ -55,7 +60,7 @@ soul::codedom::InitDeclaratorList* DeclaratorGrammar::Parse(const char32_t* star
     soul::parsing::ObjectStack stack;
     std::unique_ptr<soul::parsing::ParsingData> parsingData(new soul::parsing::ParsingData(GetParsingDomain()->GetNumRules()));
     scanner.SetParsingData(parsingData.get());
-    soul::parsing::Match match = soul::parsing::Grammar::Parse(scanner, stack, parsingData.get());
+    soul::parsing::Match match = soul::parsing::Grammar::Parse(scanner, stack, parsingData.get(), limits);
     soul::parsing::Span stop = scanner.GetSpan();
     if (Log())
     {
@@ -72,10 +77,7 @@ soul::codedom::InitDeclaratorList* DeclaratorGrammar::Parse(const char32_t* star
             throw soul::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<soul::parsing::Object> value = std::move(stack.top());
-    soul::codedom::InitDeclaratorList* result = *static_cast<soul::parsing::ValueObject<soul::codedom::InitDeclaratorList*>*>(value.get());
-    stack.pop();
-    return result;
+    return soul::parsing::PopValue<soul::codedom::InitDeclaratorList*>(stack);
 }
 
 class DeclaratorGrammar::InitDeclaratorListRule : public soul::parsing::Rule
@@ -89,15 +91,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::InitDeclaratorList*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::InitDeclaratorList*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -114,27 +114,25 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->idl.reset(new InitDeclaratorList);
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->idl.release();
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->idl->Add(context->fromInitDeclarator);
     }
     void PostInitDeclarator(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromInitDeclarator_value = std::move(stack.top());
-            context->fromInitDeclarator = *static_cast<soul::parsing::ValueObject<soul::codedom::InitDeclarator*>*>(fromInitDeclarator_value.get());
-            stack.pop();
+            context->fromInitDeclarator = soul::parsing::PopValue<soul::codedom::InitDeclarator*>(stack);
         }
     }
 private:
@@ -157,15 +155,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::InitDeclarator*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::InitDeclarator*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -180,27 +176,23 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new InitDeclarator(context->fromDeclarator, context->fromInitializer);
     }
     void PostDeclarator(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromDeclarator_value = std::move(stack.top());
-            context->fromDeclarator = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromDeclarator_value.get());
-            stack.pop();
+            context->fromDeclarator = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
     void PostInitializer(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromInitializer_value = std::move(stack.top());
-            context->fromInitializer = *static_cast<soul::parsing::ValueObject<soul::codedom::Initializer*>*>(fromInitializer_value.get());
-            stack.pop();
+            context->fromInitializer = soul::parsing::PopValue<soul::codedom::Initializer*>(stack);
         }
     }
 private:
@@ -223,15 +215,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<std::u32string>(context->value)));
+            soul::parsing::PushValue<std::u32string>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -245,17 +235,15 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = Trim(std::u32string(matchBegin, matchEnd));
     }
     void PostDeclarator(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromDeclarator_value = std::move(stack.top());
-            context->fromDeclarator = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromDeclarator_value.get());
-            stack.pop();
+            context->fromDeclarator = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
 private:
@@ -277,8 +265,7 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -296,27 +283,23 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->o.reset(context->fromConstantExpression);
     }
     void PostConstantExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromConstantExpression_value = std::move(stack.top());
-            context->fromConstantExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromConstantExpression_value.get());
-            stack.pop();
+            context->fromConstantExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PostDeclarator(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromDeclarator_value = std::move(stack.top());
-            context->fromDeclarator = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromDeclarator_value.get());
-            stack.pop();
+            context->fromDeclarator = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
 private:
@@ -339,8 +322,7 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -359,32 +341,28 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->o.reset(context->fromIdExpression);
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->o.reset(context->fromTypeName);
     }
     void PostIdExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromIdExpression_value = std::move(stack.top());
-            context->fromIdExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::IdExpr*>*>(fromIdExpression_value.get());
-            stack.pop();
+            context->fromIdExpression = soul::parsing::PopValue<soul::codedom::IdExpr*>(stack);
         }
     }
     void PostTypeName(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromTypeName_value = std::move(stack.top());
-            context->fromTypeName = *static_cast<soul::parsing::ValueObject<soul::codedom::TypeName*>*>(fromTypeName_value.get());
-            stack.pop();
+            context->fromTypeName = soul::parsing::PopValue<soul::codedom::TypeName*>(stack);
         }
     }
 private:
@@ -408,15 +386,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::TypeId*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::TypeId*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -439,47 +415,43 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->ti.reset(new TypeId);
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->ti.release();
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->ti->Add(context->fromTypeName);
     }
     void A3Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->ti->Declarator() = context->fromAbstractDeclarator;
     }
     void PreTypeSpecifierSeq(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::TypeId*>(context->ti.get())));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::codedom::TypeId*>(stack, context->ti.get());
     }
     void PostTypeName(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromTypeName_value = std::move(stack.top());
-            context->fromTypeName = *static_cast<soul::parsing::ValueObject<soul::codedom::TypeName*>*>(fromTypeName_value.get());
-            stack.pop();
+            context->fromTypeName = soul::parsing::PopValue<soul::codedom::TypeName*>(stack);
         }
     }
     void PostAbstractDeclarator(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromAbstractDeclarator_value = std::move(stack.top());
-            context->fromAbstractDeclarator = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromAbstractDeclarator_value.get());
-            stack.pop();
+            context->fromAbstractDeclarator = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
 private:
@@ -504,15 +476,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::Type*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::Type*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -533,42 +503,38 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->t.reset(new Type);
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->t.release();
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->t->Add(context->fromTypeSpecifier);
     }
     void A3Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->t->Add(context->fromTypeName);
     }
     void PostTypeSpecifier(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromTypeSpecifier_value = std::move(stack.top());
-            context->fromTypeSpecifier = *static_cast<soul::parsing::ValueObject<soul::codedom::TypeSpecifier*>*>(fromTypeSpecifier_value.get());
-            stack.pop();
+            context->fromTypeSpecifier = soul::parsing::PopValue<soul::codedom::TypeSpecifier*>(stack);
         }
     }
     void PostTypeName(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromTypeName_value = std::move(stack.top());
-            context->fromTypeName = *static_cast<soul::parsing::ValueObject<soul::codedom::TypeName*>*>(fromTypeName_value.get());
-            stack.pop();
+            context->fromTypeName = soul::parsing::PopValue<soul::codedom::TypeName*>(stack);
         }
     }
 private:
@@ -592,11 +558,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> typeId_value = std::move(stack.top());
-        context->typeId = *static_cast<soul::parsing::ValueObject<soul::codedom::TypeId*>*>(typeId_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->typeId = soul::parsing::PopValue<soul::codedom::TypeId*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -611,17 +574,15 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->typeId->Add(context->fromTypeSpecifier);
     }
     void PostTypeSpecifier(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromTypeSpecifier_value = std::move(stack.top());
-            context->fromTypeSpecifier = *static_cast<soul::parsing::ValueObject<soul::codedom::TypeSpecifier*>*>(fromTypeSpecifier_value.get());
-            stack.pop();
+            context->fromTypeSpecifier = soul::parsing::PopValue<soul::codedom::TypeSpecifier*>(stack);
         }
     }
 private:
@@ -643,15 +604,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<std::u32string>(context->value)));
+            soul::parsing::PushValue<std::u32string>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -665,17 +624,15 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = Trim(std::u32string(matchBegin, matchEnd));
     }
     void PostAbstractDeclarator(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromAbstractDeclarator_value = std::move(stack.top());
-            context->fromAbstractDeclarator = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromAbstractDeclarator_value.get());
-            stack.pop();
+            context->fromAbstractDeclarator = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
 private:
@@ -697,8 +654,7 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -715,27 +671,23 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->o.reset(context->fromConstantExpression);
     }
     void PostConstantExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromConstantExpression_value = std::move(stack.top());
-            context->fromConstantExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromConstantExpression_value.get());
-            stack.pop();
+            context->fromConstantExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PostAbstractDeclarator(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromAbstractDeclarator_value = std::move(stack.top());
-            context->fromAbstractDeclarator = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromAbstractDeclarator_value.get());
-            stack.pop();
+            context->fromAbstractDeclarator = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
 private:
@@ -758,8 +710,7 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -774,17 +725,15 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->o.reset(context->fromCVQualifier);
     }
     void PostCVQualifier(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromCVQualifier_value = std::move(stack.top());
-            context->fromCVQualifier = *static_cast<soul::parsing::ValueObject<soul::codedom::TypeSpecifier*>*>(fromCVQualifier_value.get());
-            stack.pop();
+            context->fromCVQualifier = soul::parsing::PopValue<soul::codedom::TypeSpecifier*>(stack);
         }
     }
 private:
@@ -806,15 +755,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::Initializer*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::Initializer*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -831,32 +778,28 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new Initializer(context->fromInitializerClause, GetEmptyVector());
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new Initializer(nullptr, context->fromExpressionList);
     }
     void PostInitializerClause(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromInitializerClause_value = std::move(stack.top());
-            context->fromInitializerClause = *static_cast<soul::parsing::ValueObject<soul::codedom::AssignInit*>*>(fromInitializerClause_value.get());
-            stack.pop();
+            context->fromInitializerClause = soul::parsing::PopValue<soul::codedom::AssignInit*>(stack);
         }
     }
     void PostExpressionList(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromExpressionList_value = std::move(stack.top());
-            context->fromExpressionList = *static_cast<soul::parsing::ValueObject<std::vector<soul::codedom::CppObject*>>*>(fromExpressionList_value.get());
-            stack.pop();
+            context->fromExpressionList = soul::parsing::PopValue<std::vector<soul::codedom::CppObject*>>(stack);
         }
     }
 private:
@@ -879,15 +822,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::AssignInit*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::AssignInit*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -906,33 +847,31 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new AssignInit(context->fromAssignmentExpression);
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new AssignInit(nullptr);
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new AssignInit(nullptr);
     }
     void PostAssignmentExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromAssignmentExpression_value = std::move(stack.top());
-            context->fromAssignmentExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromAssignmentExpression_value.get());
-            stack.pop();
+            context->fromAssignmentExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PreInitializerList(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::AssignInit*>(context->value)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::codedom::AssignInit*>(stack, context->value);
     }
 private:
     struct Context : soul::parsing::Context
@@ -953,11 +892,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> init_value = std::move(stack.top());
-        context->init = *static_cast<soul::parsing::ValueObject<soul::codedom::AssignInit*>*>(init_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->init = soul::parsing::PopValue<soul::codedom::AssignInit*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -972,17 +908,15 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->init->Add(context->fromInitializerClause);
     }
     void PostInitializerClause(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromInitializerClause_value = std::move(stack.top());
-            context->fromInitializerClause = *static_cast<soul::parsing::ValueObject<soul::codedom::AssignInit*>*>(fromInitializerClause_value.get());
-            stack.pop();
+            context->fromInitializerClause = soul::parsing::PopValue<soul::codedom::AssignInit*>(stack);
         }
     }
 private:
@@ -997,29 +931,29 @@ private:
 void DeclaratorGrammar::GetReferencedGrammars()
 {
     soul::parsing::ParsingDomain* pd = GetParsingDomain();
-    soul::parsing::Grammar* grammar0 = pd->GetGrammar(ToUtf32("soul.code.ExpressionGrammar"));
+    soul::parsing::Grammar* grammar0 = pd->GetGrammar(ToUtf32("soul.code.DeclarationGrammar"));
     if (!grammar0)
     {
-        grammar0 = soul::code::ExpressionGrammar::Create(pd);
+        grammar0 = soul::code::DeclarationGrammar::Create(pd);
     }
     AddGrammarReference(grammar0);
-    soul::parsing::Grammar* grammar1 = pd->GetGrammar(ToUtf32("soul.code.DeclarationGrammar"));
+    soul::parsing::Grammar* grammar1 = pd->GetGrammar(ToUtf32("soul.code.ExpressionGrammar"));
     if (!grammar1)
     {
-        grammar1 = soul::code::DeclarationGrammar::Create(pd);
+        grammar1 = soul::code::ExpressionGrammar::Create(pd);
     }
     AddGrammarReference(grammar1);
 }
 
 void DeclaratorGrammar::CreateRules()
 {
-    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("IdExpression"), this, ToUtf32("ExpressionGrammar.IdExpression")));
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("ConstantExpression"), this, ToUtf32("ExpressionGrammar.ConstantExpression")));
-    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("CVQualifier"), this, ToUtf32("DeclarationGrammar.CVQualifier")));
+    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("IdExpression"), this, ToUtf32("ExpressionGrammar.IdExpression")));
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("ExpressionList"), this, ToUtf32("ExpressionGrammar.ExpressionList")));
-    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("TypeSpecifier"), this, ToUtf32("DeclarationGrammar.TypeSpecifier")));
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("AssignmentExpression"), this, ToUtf32("ExpressionGrammar.AssignmentExpression")));
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("TypeName"), this, ToUtf32("DeclarationGrammar.TypeName")));
+    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("TypeSpecifier"), this, ToUtf32("DeclarationGrammar.TypeSpecifier")));
+    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("CVQualifier"), this, ToUtf32("DeclarationGrammar.CVQualifier")));
     AddRule(new InitDeclaratorListRule(ToUtf32("InitDeclaratorList"), GetScope(), GetParsingDomain()->GetNextRuleId(),
         new soul::parsing::SequenceParser(
             new soul::parsing::ActionParser(ToUtf32("A0"),
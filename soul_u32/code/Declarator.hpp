@@ -13,6 +13,7 @@ public:
     static DeclaratorGrammar* Create();
     static DeclaratorGrammar* Create(soul::parsing::ParsingDomain* parsingDomain);
     soul::codedom::InitDeclaratorList* Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName);
+    soul::codedom::InitDeclaratorList* Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, const soul::parsing::ParsingLimits* limits);
 private:
     DeclaratorGrammar(soul::parsing::ParsingDomain* parsingDomain_);
     virtual void CreateRules();
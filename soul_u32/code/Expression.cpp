@@ -45,6 +45,11 @@ ExpressionGrammar::ExpressionGrammar(soul::parsing::ParsingDomain* parsingDomain
 }
 
 soul::codedom::CppObject* ExpressionGrammar::Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName)
+{
+    return Parse(start, end, fileIndex, fileName, nullptr);
+}
+
+soul::codedom::CppObject* ExpressionGrammar::Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, const soul::parsing::ParsingLimits* limits)
 {
     soul::parsing::Scanner scanner(start, end, fileName, fileIndex, SkipRule());
     std::unique_ptr<soul::parsing::XmlLog> xmlLog;
@@ -57,7 +62,7 @@ soul::codedom::CppObject* ExpressionGrammar::Parse(const char32_t* start, const
     soul::parsing::ObjectStack stack;
     std::unique_ptr<soul::parsing::ParsingData> parsingData(new soul::parsing::ParsingData(GetParsingDomain()->GetNumRules()));
     scanner.SetParsingData(parsingData.get());
-    soul::parsing::Match match = soul::parsing::Grammar::Parse(scanner, stack, parsingData.get());
+    soul::parsing::Match match = soul::parsing::Grammar::Parse(scanner, stack, parsingData.get(), limits);
     soul::parsing::Span stop = scanner.GetSpan();
     if (Log())
     {
@@ -74,10 +79,7 @@ soul::codedom::CppObject* ExpressionGrammar::Parse(const char32_t* start, const
             throw soul::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<soul::parsing::Object> value = std::move(stack.top());
-    soul::codedom::CppObject* result = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(value.get());
-    stack.pop();
-    return result;
+    return soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
 }
 
 class ExpressionGrammar::ExpressionRule : public soul::parsing::Rule
@@ -90,15 +92,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::CppObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::CppObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -115,32 +115,28 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromleft;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new BinaryOpExpr(context->value, Operator::comma, 0, context->fromright);
     }
     void Postleft(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void Postright(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
 private:
@@ -163,15 +159,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::CppObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::CppObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -184,17 +178,15 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromExpression;
     }
     void PostExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromExpression_value = std::move(stack.top());
-            context->fromExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromExpression_value.get());
-            stack.pop();
+            context->fromExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
 private:
@@ -217,15 +209,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::CppObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::CppObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -252,72 +242,62 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new BinaryOpExpr(context->lor.release(), context->fromAssingmentOp, 1, context->fromAssignmentExpression);
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->lor.reset(context->fromLogicalOrExpression);
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromConditionalExpression;
     }
     void A3Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromThrowExpression;
     }
     void PostLogicalOrExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromLogicalOrExpression_value = std::move(stack.top());
-            context->fromLogicalOrExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromLogicalOrExpression_value.get());
-            stack.pop();
+            context->fromLogicalOrExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PostAssingmentOp(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromAssingmentOp_value = std::move(stack.top());
-            context->fromAssingmentOp = *static_cast<soul::parsing::ValueObject<Operator>*>(fromAssingmentOp_value.get());
-            stack.pop();
+            context->fromAssingmentOp = soul::parsing::PopValue<Operator>(stack);
         }
     }
     void PostAssignmentExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromAssignmentExpression_value = std::move(stack.top());
-            context->fromAssignmentExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromAssignmentExpression_value.get());
-            stack.pop();
+            context->fromAssignmentExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PostConditionalExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromConditionalExpression_value = std::move(stack.top());
-            context->fromConditionalExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromConditionalExpression_value.get());
-            stack.pop();
+            context->fromConditionalExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PostThrowExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromThrowExpression_value = std::move(stack.top());
-            context->fromThrowExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromThrowExpression_value.get());
-            stack.pop();
+            context->fromThrowExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
 private:
@@ -344,15 +324,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<Operator>(context->value)));
+            soul::parsing::PushValue<Operator>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -363,7 +341,7 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = GetOperator(std::u32string(matchBegin, matchEnd));
     }
 private:
@@ -384,15 +362,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::CppObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::CppObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -405,17 +381,15 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new ThrowExpr(context->fromAssignmentExpression);
     }
     void PostAssignmentExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromAssignmentExpression_value = std::move(stack.top());
-            context->fromAssignmentExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromAssignmentExpression_value.get());
-            stack.pop();
+            context->fromAssignmentExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
 private:
@@ -437,15 +411,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::CppObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::CppObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -464,42 +436,36 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromleft;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new ConditionalExpr(context->value, context->fromExpression, context->fromAssignmentExpression);
     }
     void Postleft(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PostExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromExpression_value = std::move(stack.top());
-            context->fromExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromExpression_value.get());
-            stack.pop();
+            context->fromExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PostAssignmentExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromAssignmentExpression_value = std::move(stack.top());
-            context->fromAssignmentExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromAssignmentExpression_value.get());
-            stack.pop();
+            context->fromAssignmentExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
 private:
@@ -523,15 +489,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::CppObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::CppObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -548,32 +512,28 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromleft;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new BinaryOpExpr(context->value, Operator::or_, 2, context->fromright);
     }
     void Postleft(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void Postright(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
 private:
@@ -596,15 +556,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::CppObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::CppObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -621,32 +579,28 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromleft;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new BinaryOpExpr(context->value, Operator::and_, 3, context->fromright);
     }
     void Postleft(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void Postright(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
 private:
@@ -669,15 +623,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::CppObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::CppObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -694,32 +646,28 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromleft;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new BinaryOpExpr(context->value, Operator::bitor_, 4, context->fromright);
     }
     void Postleft(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void Postright(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
 private:
@@ -742,15 +690,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::CppObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::CppObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -767,32 +713,28 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromleft;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new BinaryOpExpr(context->value, Operator::bitxor, 5, context->fromright);
     }
     void Postleft(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void Postright(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
 private:
@@ -815,15 +757,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::CppObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::CppObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -840,32 +780,28 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromleft;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new BinaryOpExpr(context->value, Operator::bitand_, 6, context->fromright);
     }
     void Postleft(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void Postright(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
 private:
@@ -888,15 +824,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::CppObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::CppObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -915,42 +849,36 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromleft;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new BinaryOpExpr(context->value, context->fromEqOp, 7, context->fromright);
     }
     void Postleft(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PostEqOp(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromEqOp_value = std::move(stack.top());
-            context->fromEqOp = *static_cast<soul::parsing::ValueObject<Operator>*>(fromEqOp_value.get());
-            stack.pop();
+            context->fromEqOp = soul::parsing::PopValue<Operator>(stack);
         }
     }
     void Postright(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
 private:
@@ -974,15 +902,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<Operator>(context->value)));
+            soul::parsing::PushValue<Operator>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -995,12 +921,12 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = Operator::eq;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = Operator::notEq;
     }
 private:
@@ -1021,15 +947,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::CppObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::CppObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1048,42 +972,36 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromleft;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new BinaryOpExpr(context->value, context->fromRelOp, 8, context->fromright);
     }
     void Postleft(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PostRelOp(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromRelOp_value = std::move(stack.top());
-            context->fromRelOp = *static_cast<soul::parsing::ValueObject<Operator>*>(fromRelOp_value.get());
-            stack.pop();
+            context->fromRelOp = soul::parsing::PopValue<Operator>(stack);
         }
     }
     void Postright(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
 private:
@@ -1107,15 +1025,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<Operator>(context->value)));
+            soul::parsing::PushValue<Operator>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1132,22 +1048,22 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = Operator::lessOrEq;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = Operator::greaterOrEq;
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = Operator::less;
     }
     void A3Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = Operator::greater;
     }
 private:
@@ -1168,15 +1084,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::CppObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::CppObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1195,42 +1109,36 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromleft;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new BinaryOpExpr(context->value, context->fromShiftOp, 9, context->fromright);
     }
     void Postleft(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PostShiftOp(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromShiftOp_value = std::move(stack.top());
-            context->fromShiftOp = *static_cast<soul::parsing::ValueObject<Operator>*>(fromShiftOp_value.get());
-            stack.pop();
+            context->fromShiftOp = soul::parsing::PopValue<Operator>(stack);
         }
     }
     void Postright(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
 private:
@@ -1254,15 +1162,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<Operator>(context->value)));
+            soul::parsing::PushValue<Operator>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1275,12 +1181,12 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = Operator::shiftLeft;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = Operator::shiftRight;
     }
 private:
@@ -1301,15 +1207,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::CppObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::CppObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1328,42 +1232,36 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromleft;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new BinaryOpExpr(context->value, context->fromAddOp, 10, context->fromright);
     }
     void Postleft(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PostAddOp(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromAddOp_value = std::move(stack.top());
-            context->fromAddOp = *static_cast<soul::parsing::ValueObject<Operator>*>(fromAddOp_value.get());
-            stack.pop();
+            context->fromAddOp = soul::parsing::PopValue<Operator>(stack);
         }
     }
     void Postright(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
 private:
@@ -1387,15 +1285,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<Operator>(context->value)));
+            soul::parsing::PushValue<Operator>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1408,12 +1304,12 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = Operator::plus;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = Operator::minus;
     }
 private:
@@ -1434,15 +1330,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::CppObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::CppObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1461,42 +1355,36 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromleft;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new BinaryOpExpr(context->value, context->fromMulOp, 11, context->fromright);
     }
     void Postleft(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PostMulOp(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromMulOp_value = std::move(stack.top());
-            context->fromMulOp = *static_cast<soul::parsing::ValueObject<Operator>*>(fromMulOp_value.get());
-            stack.pop();
+            context->fromMulOp = soul::parsing::PopValue<Operator>(stack);
         }
     }
     void Postright(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
 private:
@@ -1520,15 +1408,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<Operator>(context->value)));
+            soul::parsing::PushValue<Operator>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1543,17 +1429,17 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = Operator::mul;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = Operator::div;
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = Operator::rem;
     }
 private:
@@ -1574,15 +1460,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::CppObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::CppObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1601,42 +1485,36 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromleft;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new BinaryOpExpr(context->value, context->fromPmOp, 12, context->fromright);
     }
     void Postleft(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PostPmOp(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromPmOp_value = std::move(stack.top());
-            context->fromPmOp = *static_cast<soul::parsing::ValueObject<Operator>*>(fromPmOp_value.get());
-            stack.pop();
+            context->fromPmOp = soul::parsing::PopValue<Operator>(stack);
         }
     }
     void Postright(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
 private:
@@ -1660,15 +1538,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<Operator>(context->value)));
+            soul::parsing::PushValue<Operator>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1681,12 +1557,12 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = Operator::dotStar;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = Operator::arrowStar;
     }
 private:
@@ -1709,15 +1585,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::CppObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::CppObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1740,52 +1614,46 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->ce.release();
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->ce.reset(new CastExpr(context->ti.release(), context->fromCastExpression));
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->ti.reset(context->fromTypeId);
     }
     void A3Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->ce.reset(context->fromUnaryExpression);
     }
     void PostTypeId(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromTypeId_value = std::move(stack.top());
-            context->fromTypeId = *static_cast<soul::parsing::ValueObject<soul::codedom::TypeId*>*>(fromTypeId_value.get());
-            stack.pop();
+            context->fromTypeId = soul::parsing::PopValue<soul::codedom::TypeId*>(stack);
         }
     }
     void PostCastExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromCastExpression_value = std::move(stack.top());
-            context->fromCastExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromCastExpression_value.get());
-            stack.pop();
+            context->fromCastExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PostUnaryExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromUnaryExpression_value = std::move(stack.top());
-            context->fromUnaryExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromUnaryExpression_value.get());
-            stack.pop();
+            context->fromUnaryExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
 private:
@@ -1812,15 +1680,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::CppObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::CppObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1869,152 +1735,132 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->ue.release();
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->ue.reset(context->fromPostfixExpression);
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->ue.reset(context->fromPostCastExpression);
     }
     void A3Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->ue.reset(new PreIncrementExpr(context->frome1));
     }
     void A4Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->ue.reset(new PreDecrementExpr(context->frome2));
     }
     void A5Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->ue.reset(new UnaryOpExpr(context->fromUnaryOperator, context->fromCastExpression));
     }
     void A6Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->ue.reset(new SizeOfExpr(context->fromTypeId, true));
     }
     void A7Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->ue.reset(new SizeOfExpr(context->frome3, false));
     }
     void A8Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->ue.reset(context->fromNewExpression);
     }
     void A9Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->ue.reset(context->fromDeleteExpression);
     }
     void PostPostfixExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromPostfixExpression_value = std::move(stack.top());
-            context->fromPostfixExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromPostfixExpression_value.get());
-            stack.pop();
+            context->fromPostfixExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PostPostCastExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromPostCastExpression_value = std::move(stack.top());
-            context->fromPostCastExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromPostCastExpression_value.get());
-            stack.pop();
+            context->fromPostCastExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void Poste1(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> frome1_value = std::move(stack.top());
-            context->frome1 = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(frome1_value.get());
-            stack.pop();
+            context->frome1 = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void Poste2(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> frome2_value = std::move(stack.top());
-            context->frome2 = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(frome2_value.get());
-            stack.pop();
+            context->frome2 = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PostUnaryOperator(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromUnaryOperator_value = std::move(stack.top());
-            context->fromUnaryOperator = *static_cast<soul::parsing::ValueObject<Operator>*>(fromUnaryOperator_value.get());
-            stack.pop();
+            context->fromUnaryOperator = soul::parsing::PopValue<Operator>(stack);
         }
     }
     void PostCastExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromCastExpression_value = std::move(stack.top());
-            context->fromCastExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromCastExpression_value.get());
-            stack.pop();
+            context->fromCastExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PostTypeId(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromTypeId_value = std::move(stack.top());
-            context->fromTypeId = *static_cast<soul::parsing::ValueObject<soul::codedom::TypeId*>*>(fromTypeId_value.get());
-            stack.pop();
+            context->fromTypeId = soul::parsing::PopValue<soul::codedom::TypeId*>(stack);
         }
     }
     void Poste3(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> frome3_value = std::move(stack.top());
-            context->frome3 = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(frome3_value.get());
-            stack.pop();
+            context->frome3 = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PostNewExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromNewExpression_value = std::move(stack.top());
-            context->fromNewExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromNewExpression_value.get());
-            stack.pop();
+            context->fromNewExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PostDeleteExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromDeleteExpression_value = std::move(stack.top());
-            context->fromDeleteExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromDeleteExpression_value.get());
-            stack.pop();
+            context->fromDeleteExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
 private:
@@ -2046,15 +1892,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<Operator>(context->value)));
+            soul::parsing::PushValue<Operator>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2075,32 +1919,32 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = Operator::deref;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = Operator::addrOf;
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = Operator::plus;
     }
     void A3Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = Operator::minus;
     }
     void A4Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = Operator::not_;
     }
     void A5Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = Operator::neg;
     }
 private:
@@ -2124,15 +1968,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::CppObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::CppObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2157,64 +1999,56 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new NewExpr(context->global, context->fromNewPlacement, context->typeId, context->parens, context->fromNewInitializer);
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->global = true;
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->typeId = context->fromNewTypeId;
         context->parens = false;
     }
     void A3Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->typeId = context->fromTypeId;
         context->parens = true;
     }
     void PostNewPlacement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromNewPlacement_value = std::move(stack.top());
-            context->fromNewPlacement = *static_cast<soul::parsing::ValueObject<std::vector<soul::codedom::CppObject*>>*>(fromNewPlacement_value.get());
-            stack.pop();
+            context->fromNewPlacement = soul::parsing::PopValue<std::vector<soul::codedom::CppObject*>>(stack);
         }
     }
     void PostNewTypeId(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromNewTypeId_value = std::move(stack.top());
-            context->fromNewTypeId = *static_cast<soul::parsing::ValueObject<soul::codedom::TypeId*>*>(fromNewTypeId_value.get());
-            stack.pop();
+            context->fromNewTypeId = soul::parsing::PopValue<soul::codedom::TypeId*>(stack);
         }
     }
     void PostTypeId(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromTypeId_value = std::move(stack.top());
-            context->fromTypeId = *static_cast<soul::parsing::ValueObject<soul::codedom::TypeId*>*>(fromTypeId_value.get());
-            stack.pop();
+            context->fromTypeId = soul::parsing::PopValue<soul::codedom::TypeId*>(stack);
         }
     }
     void PostNewInitializer(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromNewInitializer_value = std::move(stack.top());
-            context->fromNewInitializer = *static_cast<soul::parsing::ValueObject<std::vector<soul::codedom::CppObject*>>*>(fromNewInitializer_value.get());
-            stack.pop();
+            context->fromNewInitializer = soul::parsing::PopValue<std::vector<soul::codedom::CppObject*>>(stack);
         }
     }
 private:
@@ -2243,15 +2077,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::TypeId*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::TypeId*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2274,47 +2106,43 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->ti.reset(new TypeId);
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->ti.release();
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->ti->Add(context->fromTypeName);
     }
     void A3Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->ti->Declarator() = context->fromNewDeclarator;
     }
     void PreTypeSpecifierSeq(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::TypeId*>(context->ti.get())));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::codedom::TypeId*>(stack, context->ti.get());
     }
     void PostTypeName(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromTypeName_value = std::move(stack.top());
-            context->fromTypeName = *static_cast<soul::parsing::ValueObject<soul::codedom::TypeName*>*>(fromTypeName_value.get());
-            stack.pop();
+            context->fromTypeName = soul::parsing::PopValue<soul::codedom::TypeName*>(stack);
         }
     }
     void PostNewDeclarator(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromNewDeclarator_value = std::move(stack.top());
-            context->fromNewDeclarator = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromNewDeclarator_value.get());
-            stack.pop();
+            context->fromNewDeclarator = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
 private:
@@ -2338,15 +2166,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<std::u32string>(context->value)));
+            soul::parsing::PushValue<std::u32string>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2360,17 +2186,15 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = Trim(std::u32string(matchBegin, matchEnd));
     }
     void PostNewDeclarator(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromNewDeclarator_value = std::move(stack.top());
-            context->fromNewDeclarator = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromNewDeclarator_value.get());
-            stack.pop();
+            context->fromNewDeclarator = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
 private:
@@ -2392,8 +2216,7 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -2412,32 +2235,28 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->e.reset(context->fromExpression);
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->e.reset(context->fromConstantExpression);
     }
     void PostExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromExpression_value = std::move(stack.top());
-            context->fromExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromExpression_value.get());
-            stack.pop();
+            context->fromExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PostConstantExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromConstantExpression_value = std::move(stack.top());
-            context->fromConstantExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromConstantExpression_value.get());
-            stack.pop();
+            context->fromConstantExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
 private:
@@ -2460,15 +2279,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<std::vector<soul::codedom::CppObject*>>(context->value)));
+            soul::parsing::PushValue<std::vector<soul::codedom::CppObject*>>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2481,17 +2298,15 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromExpressionList;
     }
     void PostExpressionList(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromExpressionList_value = std::move(stack.top());
-            context->fromExpressionList = *static_cast<soul::parsing::ValueObject<std::vector<soul::codedom::CppObject*>>*>(fromExpressionList_value.get());
-            stack.pop();
+            context->fromExpressionList = soul::parsing::PopValue<std::vector<soul::codedom::CppObject*>>(stack);
         }
     }
 private:
@@ -2513,15 +2328,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<std::vector<soul::codedom::CppObject*>>(context->value)));
+            soul::parsing::PushValue<std::vector<soul::codedom::CppObject*>>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2534,17 +2347,15 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromExpressionList;
     }
     void PostExpressionList(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromExpressionList_value = std::move(stack.top());
-            context->fromExpressionList = *static_cast<soul::parsing::ValueObject<std::vector<soul::codedom::CppObject*>>*>(fromExpressionList_value.get());
-            stack.pop();
+            context->fromExpressionList = soul::parsing::PopValue<std::vector<soul::codedom::CppObject*>>(stack);
         }
     }
 private:
@@ -2568,15 +2379,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::CppObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::CppObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2593,27 +2402,25 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new DeleteExpr(context->global, context->array, context->fromCastExpression);
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->global = true;
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->array = true;
     }
     void PostCastExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromCastExpression_value = std::move(stack.top());
-            context->fromCastExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromCastExpression_value.get());
-            stack.pop();
+            context->fromCastExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
 private:
@@ -2638,15 +2445,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::CppObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::CppObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2687,117 +2492,103 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->pe.release();
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->pe.reset(context->fromPrimaryExpression);
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->pe.reset(new IndexExpr(context->pe.release(), context->fromindex));
     }
     void A3Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->pe.reset(new InvokeExpr(context->pe.release(), context->frominvoke));
     }
     void A4Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->pe.reset(new MemberAccessExpr(context->pe.release(), context->frommember));
     }
     void A5Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->pe.reset(new PtrMemberAccessExpr(context->pe.release(), context->fromptrmember));
     }
     void A6Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->pe.reset(new PostIncrementExpr(context->pe.release()));
     }
     void A7Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->pe.reset(new PostDecrementExpr(context->pe.release()));
     }
     void A8Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->pe.reset(new InvokeExpr(context->fromTypeSpecifierOrTypeName, context->fromtypeConstruction));
     }
     void PostPrimaryExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromPrimaryExpression_value = std::move(stack.top());
-            context->fromPrimaryExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromPrimaryExpression_value.get());
-            stack.pop();
+            context->fromPrimaryExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void Postindex(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromindex_value = std::move(stack.top());
-            context->fromindex = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromindex_value.get());
-            stack.pop();
+            context->fromindex = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void Postinvoke(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> frominvoke_value = std::move(stack.top());
-            context->frominvoke = *static_cast<soul::parsing::ValueObject<std::vector<soul::codedom::CppObject*>>*>(frominvoke_value.get());
-            stack.pop();
+            context->frominvoke = soul::parsing::PopValue<std::vector<soul::codedom::CppObject*>>(stack);
         }
     }
     void Postmember(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> frommember_value = std::move(stack.top());
-            context->frommember = *static_cast<soul::parsing::ValueObject<soul::codedom::IdExpr*>*>(frommember_value.get());
-            stack.pop();
+            context->frommember = soul::parsing::PopValue<soul::codedom::IdExpr*>(stack);
         }
     }
     void Postptrmember(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromptrmember_value = std::move(stack.top());
-            context->fromptrmember = *static_cast<soul::parsing::ValueObject<soul::codedom::IdExpr*>*>(fromptrmember_value.get());
-            stack.pop();
+            context->fromptrmember = soul::parsing::PopValue<soul::codedom::IdExpr*>(stack);
         }
     }
     void PostTypeSpecifierOrTypeName(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromTypeSpecifierOrTypeName_value = std::move(stack.top());
-            context->fromTypeSpecifierOrTypeName = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromTypeSpecifierOrTypeName_value.get());
-            stack.pop();
+            context->fromTypeSpecifierOrTypeName = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PosttypeConstruction(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromtypeConstruction_value = std::move(stack.top());
-            context->fromtypeConstruction = *static_cast<soul::parsing::ValueObject<std::vector<soul::codedom::CppObject*>>*>(fromtypeConstruction_value.get());
-            stack.pop();
+            context->fromtypeConstruction = soul::parsing::PopValue<std::vector<soul::codedom::CppObject*>>(stack);
         }
     }
 private:
@@ -2826,15 +2617,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::CppObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::CppObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2851,32 +2640,28 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromSimpleTypeSpecifier;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromTypeName;
     }
     void PostSimpleTypeSpecifier(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromSimpleTypeSpecifier_value = std::move(stack.top());
-            context->fromSimpleTypeSpecifier = *static_cast<soul::parsing::ValueObject<soul::codedom::TypeSpecifier*>*>(fromSimpleTypeSpecifier_value.get());
-            stack.pop();
+            context->fromSimpleTypeSpecifier = soul::parsing::PopValue<soul::codedom::TypeSpecifier*>(stack);
         }
     }
     void PostTypeName(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromTypeName_value = std::move(stack.top());
-            context->fromTypeName = *static_cast<soul::parsing::ValueObject<soul::codedom::TypeName*>*>(fromTypeName_value.get());
-            stack.pop();
+            context->fromTypeName = soul::parsing::PopValue<soul::codedom::TypeName*>(stack);
         }
     }
 private:
@@ -2899,15 +2684,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::CppObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::CppObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2944,117 +2727,99 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new PostCastExpr(U"dynamic_cast", context->fromdct, context->fromdce);
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new PostCastExpr(U"static_cast", context->fromsct, context->fromsce);
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new PostCastExpr(U"reinterpret_cast", context->fromrct, context->fromrce);
     }
     void A3Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new PostCastExpr(U"const_cast", context->fromcct, context->fromcce);
     }
     void A4Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new TypeIdExpr(context->fromtypeidExpr);
     }
     void Postdct(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromdct_value = std::move(stack.top());
-            context->fromdct = *static_cast<soul::parsing::ValueObject<soul::codedom::TypeId*>*>(fromdct_value.get());
-            stack.pop();
+            context->fromdct = soul::parsing::PopValue<soul::codedom::TypeId*>(stack);
         }
     }
     void Postdce(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromdce_value = std::move(stack.top());
-            context->fromdce = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromdce_value.get());
-            stack.pop();
+            context->fromdce = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void Postsct(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromsct_value = std::move(stack.top());
-            context->fromsct = *static_cast<soul::parsing::ValueObject<soul::codedom::TypeId*>*>(fromsct_value.get());
-            stack.pop();
+            context->fromsct = soul::parsing::PopValue<soul::codedom::TypeId*>(stack);
         }
     }
     void Postsce(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromsce_value = std::move(stack.top());
-            context->fromsce = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromsce_value.get());
-            stack.pop();
+            context->fromsce = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void Postrct(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromrct_value = std::move(stack.top());
-            context->fromrct = *static_cast<soul::parsing::ValueObject<soul::codedom::TypeId*>*>(fromrct_value.get());
-            stack.pop();
+            context->fromrct = soul::parsing::PopValue<soul::codedom::TypeId*>(stack);
         }
     }
     void Postrce(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromrce_value = std::move(stack.top());
-            context->fromrce = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromrce_value.get());
-            stack.pop();
+            context->fromrce = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void Postcct(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromcct_value = std::move(stack.top());
-            context->fromcct = *static_cast<soul::parsing::ValueObject<soul::codedom::TypeId*>*>(fromcct_value.get());
-            stack.pop();
+            context->fromcct = soul::parsing::PopValue<soul::codedom::TypeId*>(stack);
         }
     }
     void Postcce(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromcce_value = std::move(stack.top());
-            context->fromcce = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromcce_value.get());
-            stack.pop();
+            context->fromcce = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PosttypeidExpr(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromtypeidExpr_value = std::move(stack.top());
-            context->fromtypeidExpr = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromtypeidExpr_value.get());
-            stack.pop();
+            context->fromtypeidExpr = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
 private:
@@ -3084,15 +2849,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<std::vector<soul::codedom::CppObject*>>(context->value)));
+            soul::parsing::PushValue<std::vector<soul::codedom::CppObject*>>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -3105,17 +2868,15 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value.push_back(context->fromAssignmentExpression);
     }
     void PostAssignmentExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromAssignmentExpression_value = std::move(stack.top());
-            context->fromAssignmentExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromAssignmentExpression_value.get());
-            stack.pop();
+            context->fromAssignmentExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
 private:
@@ -3138,15 +2899,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::CppObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::CppObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -3171,57 +2930,51 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->pe.release();
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->pe.reset(context->fromLiteral);
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->pe.reset(new ThisAccess);
     }
     void A3Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->pe.reset(context->fromExpression);
     }
     void A4Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->pe.reset(context->fromIdExpression);
     }
     void PostLiteral(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromLiteral_value = std::move(stack.top());
-            context->fromLiteral = *static_cast<soul::parsing::ValueObject<soul::codedom::Literal*>*>(fromLiteral_value.get());
-            stack.pop();
+            context->fromLiteral = soul::parsing::PopValue<soul::codedom::Literal*>(stack);
         }
     }
     void PostExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromExpression_value = std::move(stack.top());
-            context->fromExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromExpression_value.get());
-            stack.pop();
+            context->fromExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PostIdExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromIdExpression_value = std::move(stack.top());
-            context->fromIdExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::IdExpr*>*>(fromIdExpression_value.get());
-            stack.pop();
+            context->fromIdExpression = soul::parsing::PopValue<soul::codedom::IdExpr*>(stack);
         }
     }
 private:
@@ -3246,15 +2999,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::IdExpr*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::IdExpr*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -3273,37 +3024,33 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new IdExpr(std::u32string(matchBegin, matchEnd));
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new IdExpr(std::u32string(matchBegin, matchEnd));
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new IdExpr(std::u32string(matchBegin, matchEnd));
     }
     void Postid1(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromid1_value = std::move(stack.top());
-            context->fromid1 = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromid1_value.get());
-            stack.pop();
+            context->fromid1 = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
     void Postid2(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromid2_value = std::move(stack.top());
-            context->fromid2 = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromid2_value.get());
-            stack.pop();
+            context->fromid2 = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
 private:
@@ -3319,40 +3066,40 @@ private:
 void ExpressionGrammar::GetReferencedGrammars()
 {
     soul::parsing::ParsingDomain* pd = GetParsingDomain();
-    soul::parsing::Grammar* grammar0 = pd->GetGrammar(ToUtf32("soul.code.IdentifierGrammar"));
+    soul::parsing::Grammar* grammar0 = pd->GetGrammar(ToUtf32("soul.code.DeclarationGrammar"));
     if (!grammar0)
     {
-        grammar0 = soul::code::IdentifierGrammar::Create(pd);
+        grammar0 = soul::code::DeclarationGrammar::Create(pd);
     }
     AddGrammarReference(grammar0);
-    soul::parsing::Grammar* grammar1 = pd->GetGrammar(ToUtf32("soul.code.LiteralGrammar"));
+    soul::parsing::Grammar* grammar1 = pd->GetGrammar(ToUtf32("soul.code.DeclaratorGrammar"));
     if (!grammar1)
     {
-        grammar1 = soul::code::LiteralGrammar::Create(pd);
+        grammar1 = soul::code::DeclaratorGrammar::Create(pd);
     }
     AddGrammarReference(grammar1);
-    soul::parsing::Grammar* grammar2 = pd->GetGrammar(ToUtf32("soul.code.DeclarationGrammar"));
+    soul::parsing::Grammar* grammar2 = pd->GetGrammar(ToUtf32("soul.code.IdentifierGrammar"));
     if (!grammar2)
     {
-        grammar2 = soul::code::DeclarationGrammar::Create(pd);
+        grammar2 = soul::code::IdentifierGrammar::Create(pd);
     }
     AddGrammarReference(grammar2);
-    soul::parsing::Grammar* grammar3 = pd->GetGrammar(ToUtf32("soul.code.DeclaratorGrammar"));
+    soul::parsing::Grammar* grammar3 = pd->GetGrammar(ToUtf32("soul.code.LiteralGrammar"));
     if (!grammar3)
     {
-        grammar3 = soul::code::DeclaratorGrammar::Create(pd);
+        grammar3 = soul::code::LiteralGrammar::Create(pd);
     }
     AddGrammarReference(grammar3);
 }
 
 void ExpressionGrammar::CreateRules()
 {
-    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("QualifiedId"), this, ToUtf32("IdentifierGrammar.QualifiedId")));
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("Literal"), this, ToUtf32("LiteralGrammar.Literal")));
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("TypeId"), this, ToUtf32("DeclaratorGrammar.TypeId")));
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("TypeSpecifierSeq"), this, ToUtf32("DeclaratorGrammar.TypeSpecifierSeq")));
-    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("SimpleTypeSpecifier"), this, ToUtf32("DeclarationGrammar.SimpleTypeSpecifier")));
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("PtrOperator"), this, ToUtf32("DeclaratorGrammar.PtrOperator")));
+    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("QualifiedId"), this, ToUtf32("IdentifierGrammar.QualifiedId")));
+    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("SimpleTypeSpecifier"), this, ToUtf32("DeclarationGrammar.SimpleTypeSpecifier")));
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("TypeName"), this, ToUtf32("DeclarationGrammar.TypeName")));
     AddRule(new ExpressionRule(ToUtf32("Expression"), GetScope(), GetParsingDomain()->GetNextRuleId(),
         new soul::parsing::SequenceParser(
@@ -13,6 +13,7 @@ public:
     static ExpressionGrammar* Create();
     static ExpressionGrammar* Create(soul::parsing::ParsingDomain* parsingDomain);
     soul::codedom::CppObject* Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName);
+    soul::codedom::CppObject* Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, const soul::parsing::ParsingLimits* limits);
 private:
     ExpressionGrammar(soul::parsing::ParsingDomain* parsingDomain_);
     virtual void CreateRules();
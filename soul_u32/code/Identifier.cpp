@@ -38,6 +38,11 @@ IdentifierGrammar::IdentifierGrammar(soul::parsing::ParsingDomain* parsingDomain
 }
 
 std::u32string IdentifierGrammar::Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName)
+{
+    return Parse(start, end, fileIndex, fileName, nullptr);
+}
+
+std::u32string IdentifierGrammar::Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, const soul::parsing::ParsingLimits* limits)
 {
     soul::parsing::Scanner scanner(start, end, fileName, fileIndex, SkipRule());
     std::unique_ptr<soul::parsing::XmlLog> xmlLog;
@@ -50,7 +55,7 @@ std::u32string IdentifierGrammar::Parse(const char32_t* start, const char32_t* e
     soul::parsing::ObjectStack stack;
     std::unique_ptr<soul::parsing::ParsingData> parsingData(new soul::parsing::ParsingData(GetParsingDomain()->GetNumRules()));
     scanner.SetParsingData(parsingData.get());
-    soul::parsing::Match match = soul::parsing::Grammar::Parse(scanner, stack, parsingData.get());
+    soul::parsing::Match match = soul::parsing::Grammar::Parse(scanner, stack, parsingData.get(), limits);
     soul::parsing::Span stop = scanner.GetSpan();
     if (Log())
     {
@@ -67,10 +72,7 @@ std::u32string IdentifierGrammar::Parse(const char32_t* start, const char32_t* e
             throw soul::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<soul::parsing::Object> value = std::move(stack.top());
-    std::u32string result = *static_cast<soul::parsing::ValueObject<std::u32string>*>(value.get());
-    stack.pop();
-    return result;
+    return soul::parsing::PopValue<std::u32string>(stack);
 }
 
 class IdentifierGrammar::IdentifierRule : public soul::parsing::Rule
@@ -83,15 +85,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<std::u32string>(context->value)));
+            soul::parsing::PushValue<std::u32string>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -104,17 +104,15 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = std::u32string(matchBegin, matchEnd);
     }
     void Postidentifier(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromidentifier_value = std::move(stack.top());
-            context->fromidentifier = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromidentifier_value.get());
-            stack.pop();
+            context->fromidentifier = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
 private:
@@ -136,15 +134,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<std::u32string>(context->value)));
+            soul::parsing::PushValue<std::u32string>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -157,17 +153,15 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = std::u32string(matchBegin, matchEnd);
     }
     void PostIdentifier(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromIdentifier_value = std::move(stack.top());
-            context->fromIdentifier = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromIdentifier_value.get());
-            stack.pop();
+            context->fromIdentifier = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
 private:
@@ -182,16 +176,16 @@ private:
 void IdentifierGrammar::GetReferencedGrammars()
 {
     soul::parsing::ParsingDomain* pd = GetParsingDomain();
-    soul::parsing::Grammar* grammar0 = pd->GetGrammar(ToUtf32("soul.parsing.stdlib"));
+    soul::parsing::Grammar* grammar0 = pd->GetGrammar(ToUtf32("soul.code.KeywordGrammar"));
     if (!grammar0)
     {
-        grammar0 = soul::parsing::stdlib::Create(pd);
+        grammar0 = soul::code::KeywordGrammar::Create(pd);
     }
     AddGrammarReference(grammar0);
-    soul::parsing::Grammar* grammar1 = pd->GetGrammar(ToUtf32("soul.code.KeywordGrammar"));
+    soul::parsing::Grammar* grammar1 = pd->GetGrammar(ToUtf32("soul.parsing.stdlib"));
     if (!grammar1)
     {
-        grammar1 = soul::code::KeywordGrammar::Create(pd);
+        grammar1 = soul::parsing::stdlib::Create(pd);
     }
     AddGrammarReference(grammar1);
 }
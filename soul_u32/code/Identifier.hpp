@@ -12,6 +12,7 @@ public:
     static IdentifierGrammar* Create();
     static IdentifierGrammar* Create(soul::parsing::ParsingDomain* parsingDomain);
     std::u32string Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName);
+    std::u32string Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, const soul::parsing::ParsingLimits* limits);
 private:
     IdentifierGrammar(soul::parsing::ParsingDomain* parsingDomain_);
     virtual void CreateRules();
@@ -38,6 +38,11 @@ LiteralGrammar::LiteralGrammar(soul::parsing::ParsingDomain* parsingDomain_): so
 }
 
 soul::codedom::Literal* LiteralGrammar::Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName)
+{
+    return Parse(start, end, fileIndex, fileName, nullptr);
+}
+
+soul::codedom::Literal* LiteralGrammar::Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, const soul::parsing::ParsingLimits* limits)
 {
     soul::parsing::Scanner scanner(start, end, fileName, fileIndex, SkipRule());
     std::unique_ptr<soul::parsing::XmlLog> xmlLog;
@@ -50,7 +55,7 @@ soul::codedom::Literal* LiteralGrammar::Parse(const char32_t* start, const char3
     soul::parsing::ObjectStack stack;
     std::unique_ptr<soul::parsing::ParsingData> parsingData(new soul::parsing::ParsingData(GetParsingDomain()->GetNumRules()));
     scanner.SetParsingData(parsingData.get());
-    soul::parsing::Match match = soul::parsing::Grammar::Parse(scanner, stack, parsingData.get());
+    soul::parsing::Match match = soul::parsing::Grammar::Parse(scanner, stack, parsingData.get(), limits);
     soul::parsing::Span stop = scanner.GetSpan();
     if (Log())
     {
@@ -67,10 +72,7 @@ soul::codedom::Literal* LiteralGrammar::Parse(const char32_t* start, const char3
             throw soul::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<soul::parsing::Object> value = std::move(stack.top());
-    soul::codedom::Literal* result = *static_cast<soul::parsing::ValueObject<soul::codedom::Literal*>*>(value.get());
-    stack.pop();
-    return result;
+    return soul::parsing::PopValue<soul::codedom::Literal*>(stack);
 }
 
 class LiteralGrammar::LiteralRule : public soul::parsing::Rule
@@ -83,15 +85,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::Literal*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::Literal*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -124,92 +124,80 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromIntegerLiteral;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromCharacterLiteral;
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromFloatingLiteral;
     }
     void A3Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromStringLiteral;
     }
     void A4Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromBooleanLiteral;
     }
     void A5Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromPointerLiteral;
     }
     void PostIntegerLiteral(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromIntegerLiteral_value = std::move(stack.top());
-            context->fromIntegerLiteral = *static_cast<soul::parsing::ValueObject<soul::codedom::Literal*>*>(fromIntegerLiteral_value.get());
-            stack.pop();
+            context->fromIntegerLiteral = soul::parsing::PopValue<soul::codedom::Literal*>(stack);
         }
     }
     void PostCharacterLiteral(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromCharacterLiteral_value = std::move(stack.top());
-            context->fromCharacterLiteral = *static_cast<soul::parsing::ValueObject<soul::codedom::Literal*>*>(fromCharacterLiteral_value.get());
-            stack.pop();
+            context->fromCharacterLiteral = soul::parsing::PopValue<soul::codedom::Literal*>(stack);
         }
     }
     void PostFloatingLiteral(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromFloatingLiteral_value = std::move(stack.top());
-            context->fromFloatingLiteral = *static_cast<soul::parsing::ValueObject<soul::codedom::Literal*>*>(fromFloatingLiteral_value.get());
-            stack.pop();
+            context->fromFloatingLiteral = soul::parsing::PopValue<soul::codedom::Literal*>(stack);
         }
     }
     void PostStringLiteral(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromStringLiteral_value = std::move(stack.top());
-            context->fromStringLiteral = *static_cast<soul::parsing::ValueObject<soul::codedom::Literal*>*>(fromStringLiteral_value.get());
-            stack.pop();
+            context->fromStringLiteral = soul::parsing::PopValue<soul::codedom::Literal*>(stack);
         }
     }
     void PostBooleanLiteral(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromBooleanLiteral_value = std::move(stack.top());
-            context->fromBooleanLiteral = *static_cast<soul::parsing::ValueObject<soul::codedom::Literal*>*>(fromBooleanLiteral_value.get());
-            stack.pop();
+            context->fromBooleanLiteral = soul::parsing::PopValue<soul::codedom::Literal*>(stack);
         }
     }
     void PostPointerLiteral(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromPointerLiteral_value = std::move(stack.top());
-            context->fromPointerLiteral = *static_cast<soul::parsing::ValueObject<soul::codedom::Literal*>*>(fromPointerLiteral_value.get());
-            stack.pop();
+            context->fromPointerLiteral = soul::parsing::PopValue<soul::codedom::Literal*>(stack);
         }
     }
 private:
@@ -236,15 +224,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::Literal*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::Literal*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -259,17 +245,17 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new Literal(std::u32string(matchBegin, matchEnd));
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new Literal(std::u32string(matchBegin, matchEnd));
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new Literal(std::u32string(matchBegin, matchEnd));
     }
 private:
@@ -290,15 +276,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::Literal*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::Literal*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -313,17 +297,17 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new Literal(std::u32string(matchBegin, matchEnd));
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new Literal(std::u32string(matchBegin, matchEnd));
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new Literal(std::u32string(matchBegin, matchEnd));
     }
 private:
@@ -344,15 +328,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<std::u32string>(context->value)));
+            soul::parsing::PushValue<std::u32string>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -363,7 +345,7 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = std::u32string(matchBegin, matchEnd);
     }
 private:
@@ -384,15 +366,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::Literal*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::Literal*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -405,12 +385,12 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new Literal(std::u32string(matchBegin, matchEnd));
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new Literal(std::u32string(matchBegin, matchEnd));
     }
 private:
@@ -431,15 +411,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::Literal*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::Literal*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -450,7 +428,7 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new Literal(std::u32string(matchBegin, matchEnd));
     }
 private:
@@ -471,15 +449,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::Literal*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::Literal*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -492,12 +468,12 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new Literal(U"true");
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new Literal(U"false");
     }
 private:
@@ -518,15 +494,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::Literal*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::Literal*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -537,7 +511,7 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new soul::codedom::Literal(U"nullptr");
     }
 private:
@@ -13,6 +13,7 @@ public:
     static LiteralGrammar* Create();
     static LiteralGrammar* Create(soul::parsing::ParsingDomain* parsingDomain);
     soul::codedom::Literal* Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName);
+    soul::codedom::Literal* Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, const soul::parsing::ParsingLimits* limits);
 private:
     LiteralGrammar(soul::parsing::ParsingDomain* parsingDomain_);
     virtual void CreateRules();
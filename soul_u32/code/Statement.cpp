@@ -43,6 +43,11 @@ StatementGrammar::StatementGrammar(soul::parsing::ParsingDomain* parsingDomain_)
 }
 
 soul::codedom::CompoundStatement* StatementGrammar::Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName)
+{
+    return Parse(start, end, fileIndex, fileName, nullptr);
+}
+
+soul::codedom::CompoundStatement* StatementGrammar::Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, const soul::parsing::ParsingLimits* limits)
 {
     soul::parsing::Scanner scanner(start, end, fileName, fileIndex, SkipRule());
     std::unique_ptr<soul::parsing::XmlLog> xmlLog;
@@ -55,7 +60,7 @@ soul::codedom::CompoundStatement* StatementGrammar::Parse(const char32_t* start,
     soul::parsing::ObjectStack stack;
     std::unique_ptr<soul::parsing::ParsingData> parsingData(new soul::parsing::ParsingData(GetParsingDomain()->GetNumRules()));
     scanner.SetParsingData(parsingData.get());
-    soul::parsing::Match match = soul::parsing::Grammar::Parse(scanner, stack, parsingData.get());
+    soul::parsing::Match match = soul::parsing::Grammar::Parse(scanner, stack, parsingData.get(), limits);
     soul::parsing::Span stop = scanner.GetSpan();
     if (Log())
     {
@@ -72,10 +77,7 @@ soul::codedom::CompoundStatement* StatementGrammar::Parse(const char32_t* start,
             throw soul::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<soul::parsing::Object> value = std::move(stack.top());
-    soul::codedom::CompoundStatement* result = *static_cast<soul::parsing::ValueObject<soul::codedom::CompoundStatement*>*>(value.get());
-    stack.pop();
-    return result;
+    return soul::parsing::PopValue<soul::codedom::CompoundStatement*>(stack);
 }
 
 class StatementGrammar::StatementRule : public soul::parsing::Rule
@@ -88,15 +90,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::Statement*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::Statement*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -141,137 +141,119 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromLabeledStatement;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromEmptyStatement;
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromCompoundStatement;
     }
     void A3Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromSelectionStatement;
     }
     void A4Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromIterationStatement;
     }
     void A5Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromJumpStatement;
     }
     void A6Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromDeclarationStatement;
     }
     void A7Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromTryStatement;
     }
     void A8Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromExpressionStatement;
     }
     void PostLabeledStatement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromLabeledStatement_value = std::move(stack.top());
-            context->fromLabeledStatement = *static_cast<soul::parsing::ValueObject<soul::codedom::Statement*>*>(fromLabeledStatement_value.get());
-            stack.pop();
+            context->fromLabeledStatement = soul::parsing::PopValue<soul::codedom::Statement*>(stack);
         }
     }
     void PostEmptyStatement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromEmptyStatement_value = std::move(stack.top());
-            context->fromEmptyStatement = *static_cast<soul::parsing::ValueObject<soul::codedom::Statement*>*>(fromEmptyStatement_value.get());
-            stack.pop();
+            context->fromEmptyStatement = soul::parsing::PopValue<soul::codedom::Statement*>(stack);
         }
     }
     void PostCompoundStatement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromCompoundStatement_value = std::move(stack.top());
-            context->fromCompoundStatement = *static_cast<soul::parsing::ValueObject<soul::codedom::CompoundStatement*>*>(fromCompoundStatement_value.get());
-            stack.pop();
+            context->fromCompoundStatement = soul::parsing::PopValue<soul::codedom::CompoundStatement*>(stack);
         }
     }
     void PostSelectionStatement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromSelectionStatement_value = std::move(stack.top());
-            context->fromSelectionStatement = *static_cast<soul::parsing::ValueObject<soul::codedom::Statement*>*>(fromSelectionStatement_value.get());
-            stack.pop();
+            context->fromSelectionStatement = soul::parsing::PopValue<soul::codedom::Statement*>(stack);
         }
     }
     void PostIterationStatement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromIterationStatement_value = std::move(stack.top());
-            context->fromIterationStatement = *static_cast<soul::parsing::ValueObject<soul::codedom::Statement*>*>(fromIterationStatement_value.get());
-            stack.pop();
+            context->fromIterationStatement = soul::parsing::PopValue<soul::codedom::Statement*>(stack);
         }
     }
     void PostJumpStatement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromJumpStatement_value = std::move(stack.top());
-            context->fromJumpStatement = *static_cast<soul::parsing::ValueObject<soul::codedom::Statement*>*>(fromJumpStatement_value.get());
-            stack.pop();
+            context->fromJumpStatement = soul::parsing::PopValue<soul::codedom::Statement*>(stack);
         }
     }
     void PostDeclarationStatement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromDeclarationStatement_value = std::move(stack.top());
-            context->fromDeclarationStatement = *static_cast<soul::parsing::ValueObject<soul::codedom::Statement*>*>(fromDeclarationStatement_value.get());
-            stack.pop();
+            context->fromDeclarationStatement = soul::parsing::PopValue<soul::codedom::Statement*>(stack);
         }
     }
     void PostTryStatement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromTryStatement_value = std::move(stack.top());
-            context->fromTryStatement = *static_cast<soul::parsing::ValueObject<soul::codedom::TryStatement*>*>(fromTryStatement_value.get());
-            stack.pop();
+            context->fromTryStatement = soul::parsing::PopValue<soul::codedom::TryStatement*>(stack);
         }
     }
     void PostExpressionStatement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromExpressionStatement_value = std::move(stack.top());
-            context->fromExpressionStatement = *static_cast<soul::parsing::ValueObject<soul::codedom::Statement*>*>(fromExpressionStatement_value.get());
-            stack.pop();
+            context->fromExpressionStatement = soul::parsing::PopValue<soul::codedom::Statement*>(stack);
         }
     }
 private:
@@ -301,15 +283,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::Statement*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::Statement*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -334,67 +314,57 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new LabeledStatement(context->fromLabel, context->froms1);
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new CaseStatement(context->fromConstantExpression, context->froms2);
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new DefaultStatement(context->froms3);
     }
     void PostLabel(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromLabel_value = std::move(stack.top());
-            context->fromLabel = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromLabel_value.get());
-            stack.pop();
+            context->fromLabel = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
     void Posts1(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> froms1_value = std::move(stack.top());
-            context->froms1 = *static_cast<soul::parsing::ValueObject<soul::codedom::Statement*>*>(froms1_value.get());
-            stack.pop();
+            context->froms1 = soul::parsing::PopValue<soul::codedom::Statement*>(stack);
         }
     }
     void PostConstantExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromConstantExpression_value = std::move(stack.top());
-            context->fromConstantExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromConstantExpression_value.get());
-            stack.pop();
+            context->fromConstantExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void Posts2(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> froms2_value = std::move(stack.top());
-            context->froms2 = *static_cast<soul::parsing::ValueObject<soul::codedom::Statement*>*>(froms2_value.get());
-            stack.pop();
+            context->froms2 = soul::parsing::PopValue<soul::codedom::Statement*>(stack);
         }
     }
     void Posts3(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> froms3_value = std::move(stack.top());
-            context->froms3 = *static_cast<soul::parsing::ValueObject<soul::codedom::Statement*>*>(froms3_value.get());
-            stack.pop();
+            context->froms3 = soul::parsing::PopValue<soul::codedom::Statement*>(stack);
         }
     }
 private:
@@ -420,15 +390,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<std::u32string>(context->value)));
+            soul::parsing::PushValue<std::u32string>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -441,17 +409,15 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromIdentifier;
     }
     void PostIdentifier(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromIdentifier_value = std::move(stack.top());
-            context->fromIdentifier = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromIdentifier_value.get());
-            stack.pop();
+            context->fromIdentifier = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
 private:
@@ -473,15 +439,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::Statement*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::Statement*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -492,7 +456,7 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new EmptyStatement;
     }
 private:
@@ -513,15 +477,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::Statement*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::Statement*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -534,17 +496,15 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new ExpressionStatement(context->fromExpression);
     }
     void PostExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromExpression_value = std::move(stack.top());
-            context->fromExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromExpression_value.get());
-            stack.pop();
+            context->fromExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
 private:
@@ -567,15 +527,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::CompoundStatement*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::CompoundStatement*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -592,27 +550,25 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->cs.reset(new CompoundStatement);
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->cs->Add(context->fromStatement);
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->cs.release();
     }
     void PostStatement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromStatement_value = std::move(stack.top());
-            context->fromStatement = *static_cast<soul::parsing::ValueObject<soul::codedom::Statement*>*>(fromStatement_value.get());
-            stack.pop();
+            context->fromStatement = soul::parsing::PopValue<soul::codedom::Statement*>(stack);
         }
     }
 private:
@@ -635,15 +591,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::Statement*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::Statement*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -660,32 +614,28 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromIfStatement;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromSwitchStatement;
     }
     void PostIfStatement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromIfStatement_value = std::move(stack.top());
-            context->fromIfStatement = *static_cast<soul::parsing::ValueObject<soul::codedom::Statement*>*>(fromIfStatement_value.get());
-            stack.pop();
+            context->fromIfStatement = soul::parsing::PopValue<soul::codedom::Statement*>(stack);
         }
     }
     void PostSwitchStatement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromSwitchStatement_value = std::move(stack.top());
-            context->fromSwitchStatement = *static_cast<soul::parsing::ValueObject<soul::codedom::Statement*>*>(fromSwitchStatement_value.get());
-            stack.pop();
+            context->fromSwitchStatement = soul::parsing::PopValue<soul::codedom::Statement*>(stack);
         }
     }
 private:
@@ -708,15 +658,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::Statement*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::Statement*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -733,37 +681,31 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new IfStatement(context->fromCondition, context->fromthenStatement, context->fromelseStatement);
     }
     void PostCondition(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromCondition_value = std::move(stack.top());
-            context->fromCondition = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromCondition_value.get());
-            stack.pop();
+            context->fromCondition = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PostthenStatement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromthenStatement_value = std::move(stack.top());
-            context->fromthenStatement = *static_cast<soul::parsing::ValueObject<soul::codedom::Statement*>*>(fromthenStatement_value.get());
-            stack.pop();
+            context->fromthenStatement = soul::parsing::PopValue<soul::codedom::Statement*>(stack);
         }
     }
     void PostelseStatement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromelseStatement_value = std::move(stack.top());
-            context->fromelseStatement = *static_cast<soul::parsing::ValueObject<soul::codedom::Statement*>*>(fromelseStatement_value.get());
-            stack.pop();
+            context->fromelseStatement = soul::parsing::PopValue<soul::codedom::Statement*>(stack);
         }
     }
 private:
@@ -787,15 +729,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::Statement*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::Statement*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -810,27 +750,23 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new SwitchStatement(context->fromCondition, context->fromStatement);
     }
     void PostCondition(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromCondition_value = std::move(stack.top());
-            context->fromCondition = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromCondition_value.get());
-            stack.pop();
+            context->fromCondition = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PostStatement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromStatement_value = std::move(stack.top());
-            context->fromStatement = *static_cast<soul::parsing::ValueObject<soul::codedom::Statement*>*>(fromStatement_value.get());
-            stack.pop();
+            context->fromStatement = soul::parsing::PopValue<soul::codedom::Statement*>(stack);
         }
     }
 private:
@@ -853,15 +789,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::Statement*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::Statement*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -882,47 +816,41 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromWhileStatement;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromDoStatement;
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromForStatement;
     }
     void PostWhileStatement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromWhileStatement_value = std::move(stack.top());
-            context->fromWhileStatement = *static_cast<soul::parsing::ValueObject<soul::codedom::Statement*>*>(fromWhileStatement_value.get());
-            stack.pop();
+            context->fromWhileStatement = soul::parsing::PopValue<soul::codedom::Statement*>(stack);
         }
     }
     void PostDoStatement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromDoStatement_value = std::move(stack.top());
-            context->fromDoStatement = *static_cast<soul::parsing::ValueObject<soul::codedom::Statement*>*>(fromDoStatement_value.get());
-            stack.pop();
+            context->fromDoStatement = soul::parsing::PopValue<soul::codedom::Statement*>(stack);
         }
     }
     void PostForStatement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromForStatement_value = std::move(stack.top());
-            context->fromForStatement = *static_cast<soul::parsing::ValueObject<soul::codedom::Statement*>*>(fromForStatement_value.get());
-            stack.pop();
+            context->fromForStatement = soul::parsing::PopValue<soul::codedom::Statement*>(stack);
         }
     }
 private:
@@ -946,15 +874,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::Statement*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::Statement*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -969,27 +895,23 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new WhileStatement(context->fromCondition, context->fromStatement);
     }
     void PostCondition(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromCondition_value = std::move(stack.top());
-            context->fromCondition = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromCondition_value.get());
-            stack.pop();
+            context->fromCondition = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PostStatement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromStatement_value = std::move(stack.top());
-            context->fromStatement = *static_cast<soul::parsing::ValueObject<soul::codedom::Statement*>*>(fromStatement_value.get());
-            stack.pop();
+            context->fromStatement = soul::parsing::PopValue<soul::codedom::Statement*>(stack);
         }
     }
 private:
@@ -1012,15 +934,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::Statement*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::Statement*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1035,27 +955,23 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new DoStatement(context->fromStatement, context->fromExpression);
     }
     void PostStatement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromStatement_value = std::move(stack.top());
-            context->fromStatement = *static_cast<soul::parsing::ValueObject<soul::codedom::Statement*>*>(fromStatement_value.get());
-            stack.pop();
+            context->fromStatement = soul::parsing::PopValue<soul::codedom::Statement*>(stack);
         }
     }
     void PostExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromExpression_value = std::move(stack.top());
-            context->fromExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromExpression_value.get());
-            stack.pop();
+            context->fromExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
 private:
@@ -1078,15 +994,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::Statement*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::Statement*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1105,47 +1019,39 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new ForStatement(context->fromForInitStatement, context->fromCondition, context->fromExpression, context->fromStatement);
     }
     void PostForInitStatement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromForInitStatement_value = std::move(stack.top());
-            context->fromForInitStatement = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromForInitStatement_value.get());
-            stack.pop();
+            context->fromForInitStatement = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PostCondition(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromCondition_value = std::move(stack.top());
-            context->fromCondition = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromCondition_value.get());
-            stack.pop();
+            context->fromCondition = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PostExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromExpression_value = std::move(stack.top());
-            context->fromExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromExpression_value.get());
-            stack.pop();
+            context->fromExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PostStatement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromStatement_value = std::move(stack.top());
-            context->fromStatement = *static_cast<soul::parsing::ValueObject<soul::codedom::Statement*>*>(fromStatement_value.get());
-            stack.pop();
+            context->fromStatement = soul::parsing::PopValue<soul::codedom::Statement*>(stack);
         }
     }
 private:
@@ -1170,15 +1076,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::CppObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::CppObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1199,47 +1103,41 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromEmptyStatement;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromExpressionStatement;
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromSimpleDeclaration;
     }
     void PostEmptyStatement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromEmptyStatement_value = std::move(stack.top());
-            context->fromEmptyStatement = *static_cast<soul::parsing::ValueObject<soul::codedom::Statement*>*>(fromEmptyStatement_value.get());
-            stack.pop();
+            context->fromEmptyStatement = soul::parsing::PopValue<soul::codedom::Statement*>(stack);
         }
     }
     void PostExpressionStatement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromExpressionStatement_value = std::move(stack.top());
-            context->fromExpressionStatement = *static_cast<soul::parsing::ValueObject<soul::codedom::Statement*>*>(fromExpressionStatement_value.get());
-            stack.pop();
+            context->fromExpressionStatement = soul::parsing::PopValue<soul::codedom::Statement*>(stack);
         }
     }
     void PostSimpleDeclaration(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromSimpleDeclaration_value = std::move(stack.top());
-            context->fromSimpleDeclaration = *static_cast<soul::parsing::ValueObject<soul::codedom::SimpleDeclaration*>*>(fromSimpleDeclaration_value.get());
-            stack.pop();
+            context->fromSimpleDeclaration = soul::parsing::PopValue<soul::codedom::SimpleDeclaration*>(stack);
         }
     }
 private:
@@ -1263,15 +1161,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::Statement*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::Statement*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1296,62 +1192,54 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromBreakStatement;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromContinueStatement;
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromReturnStatement;
     }
     void A3Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromGotoStatement;
     }
     void PostBreakStatement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromBreakStatement_value = std::move(stack.top());
-            context->fromBreakStatement = *static_cast<soul::parsing::ValueObject<soul::codedom::Statement*>*>(fromBreakStatement_value.get());
-            stack.pop();
+            context->fromBreakStatement = soul::parsing::PopValue<soul::codedom::Statement*>(stack);
         }
     }
     void PostContinueStatement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromContinueStatement_value = std::move(stack.top());
-            context->fromContinueStatement = *static_cast<soul::parsing::ValueObject<soul::codedom::Statement*>*>(fromContinueStatement_value.get());
-            stack.pop();
+            context->fromContinueStatement = soul::parsing::PopValue<soul::codedom::Statement*>(stack);
         }
     }
     void PostReturnStatement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromReturnStatement_value = std::move(stack.top());
-            context->fromReturnStatement = *static_cast<soul::parsing::ValueObject<soul::codedom::Statement*>*>(fromReturnStatement_value.get());
-            stack.pop();
+            context->fromReturnStatement = soul::parsing::PopValue<soul::codedom::Statement*>(stack);
         }
     }
     void PostGotoStatement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromGotoStatement_value = std::move(stack.top());
-            context->fromGotoStatement = *static_cast<soul::parsing::ValueObject<soul::codedom::Statement*>*>(fromGotoStatement_value.get());
-            stack.pop();
+            context->fromGotoStatement = soul::parsing::PopValue<soul::codedom::Statement*>(stack);
         }
     }
 private:
@@ -1376,15 +1264,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::Statement*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::Statement*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1395,7 +1281,7 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new BreakStatement;
     }
 private:
@@ -1416,15 +1302,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::Statement*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::Statement*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1435,7 +1319,7 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new ContinueStatement;
     }
 private:
@@ -1456,15 +1340,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::Statement*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::Statement*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1477,17 +1359,15 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new ReturnStatement(context->fromExpression);
     }
     void PostExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromExpression_value = std::move(stack.top());
-            context->fromExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromExpression_value.get());
-            stack.pop();
+            context->fromExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
 private:
@@ -1509,15 +1389,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::Statement*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::Statement*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1530,17 +1408,15 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new GotoStatement(context->fromGotoTarget);
     }
     void PostGotoTarget(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromGotoTarget_value = std::move(stack.top());
-            context->fromGotoTarget = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromGotoTarget_value.get());
-            stack.pop();
+            context->fromGotoTarget = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
 private:
@@ -1562,15 +1438,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<std::u32string>(context->value)));
+            soul::parsing::PushValue<std::u32string>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1583,17 +1457,15 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromIdentifier;
     }
     void PostIdentifier(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromIdentifier_value = std::move(stack.top());
-            context->fromIdentifier = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromIdentifier_value.get());
-            stack.pop();
+            context->fromIdentifier = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
 private:
@@ -1615,15 +1487,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::Statement*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::Statement*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1636,17 +1506,15 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new DeclarationStatement(context->fromBlockDeclaration);
     }
     void PostBlockDeclaration(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromBlockDeclaration_value = std::move(stack.top());
-            context->fromBlockDeclaration = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromBlockDeclaration_value.get());
-            stack.pop();
+            context->fromBlockDeclaration = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
 private:
@@ -1669,15 +1537,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::CppObject*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::CppObject*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1700,57 +1566,49 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->ti.reset(context->fromTypeId);
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new ConditionWithDeclarator(context->ti.release(), context->fromDeclarator, context->fromAssignmentExpression);
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromExpression;
     }
     void PostTypeId(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromTypeId_value = std::move(stack.top());
-            context->fromTypeId = *static_cast<soul::parsing::ValueObject<soul::codedom::TypeId*>*>(fromTypeId_value.get());
-            stack.pop();
+            context->fromTypeId = soul::parsing::PopValue<soul::codedom::TypeId*>(stack);
         }
     }
     void PostDeclarator(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromDeclarator_value = std::move(stack.top());
-            context->fromDeclarator = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromDeclarator_value.get());
-            stack.pop();
+            context->fromDeclarator = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
     void PostAssignmentExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromAssignmentExpression_value = std::move(stack.top());
-            context->fromAssignmentExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromAssignmentExpression_value.get());
-            stack.pop();
+            context->fromAssignmentExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
     void PostExpression(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromExpression_value = std::move(stack.top());
-            context->fromExpression = *static_cast<soul::parsing::ValueObject<soul::codedom::CppObject*>*>(fromExpression_value.get());
-            stack.pop();
+            context->fromExpression = soul::parsing::PopValue<soul::codedom::CppObject*>(stack);
         }
     }
 private:
@@ -1776,15 +1634,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::TryStatement*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::TryStatement*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1799,23 +1655,21 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new TryStatement(context->fromCompoundStatement);
     }
     void PostCompoundStatement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromCompoundStatement_value = std::move(stack.top());
-            context->fromCompoundStatement = *static_cast<soul::parsing::ValueObject<soul::codedom::CompoundStatement*>*>(fromCompoundStatement_value.get());
-            stack.pop();
+            context->fromCompoundStatement = soul::parsing::PopValue<soul::codedom::CompoundStatement*>(stack);
         }
     }
     void PreHandlerSeq(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<TryStatement*>(context->value)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<TryStatement*>(stack, context->value);
     }
 private:
     struct Context : soul::parsing::Context
@@ -1836,11 +1690,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> st_value = std::move(stack.top());
-        context->st = *static_cast<soul::parsing::ValueObject<TryStatement*>*>(st_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->st = soul::parsing::PopValue<TryStatement*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -1857,23 +1708,21 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->st->Add(context->fromHandler);
     }
     void PostHandler(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromHandler_value = std::move(stack.top());
-            context->fromHandler = *static_cast<soul::parsing::ValueObject<soul::codedom::Handler*>*>(fromHandler_value.get());
-            stack.pop();
+            context->fromHandler = soul::parsing::PopValue<soul::codedom::Handler*>(stack);
         }
     }
     void PreHandlerSeq(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<TryStatement*>(context->st)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<TryStatement*>(stack, context->st);
     }
 private:
     struct Context : soul::parsing::Context
@@ -1894,15 +1743,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::Handler*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::Handler*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1917,27 +1764,23 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new Handler(context->fromExceptionDeclaration, context->fromCompoundStatement);
     }
     void PostExceptionDeclaration(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromExceptionDeclaration_value = std::move(stack.top());
-            context->fromExceptionDeclaration = *static_cast<soul::parsing::ValueObject<soul::codedom::ExceptionDeclaration*>*>(fromExceptionDeclaration_value.get());
-            stack.pop();
+            context->fromExceptionDeclaration = soul::parsing::PopValue<soul::codedom::ExceptionDeclaration*>(stack);
         }
     }
     void PostCompoundStatement(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromCompoundStatement_value = std::move(stack.top());
-            context->fromCompoundStatement = *static_cast<soul::parsing::ValueObject<soul::codedom::CompoundStatement*>*>(fromCompoundStatement_value.get());
-            stack.pop();
+            context->fromCompoundStatement = soul::parsing::PopValue<soul::codedom::CompoundStatement*>(stack);
         }
     }
 private:
@@ -1961,15 +1804,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::ExceptionDeclaration*>(context->value)));
+            soul::parsing::PushValue<soul::codedom::ExceptionDeclaration*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1994,52 +1835,48 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->ed.reset(new ExceptionDeclaration);
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->ed.release();
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->ed->GetTypeId()->Declarator() = context->fromDeclarator;
     }
     void A3Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->ed->GetTypeId()->Declarator() = context->fromAbstractDeclarator;
     }
     void A4Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value->CatchAll() = true;
     }
     void PreTypeSpecifierSeq(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::codedom::TypeId*>(context->ed->GetTypeId())));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::codedom::TypeId*>(stack, context->ed->GetTypeId());
     }
     void PostDeclarator(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromDeclarator_value = std::move(stack.top());
-            context->fromDeclarator = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromDeclarator_value.get());
-            stack.pop();
+            context->fromDeclarator = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
     void PostAbstractDeclarator(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromAbstractDeclarator_value = std::move(stack.top());
-            context->fromAbstractDeclarator = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromAbstractDeclarator_value.get());
-            stack.pop();
+            context->fromAbstractDeclarator = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
 private:
@@ -2056,22 +1893,22 @@ private:
 void StatementGrammar::GetReferencedGrammars()
 {
     soul::parsing::ParsingDomain* pd = GetParsingDomain();
-    soul::parsing::Grammar* grammar0 = pd->GetGrammar(ToUtf32("soul.code.ExpressionGrammar"));
+    soul::parsing::Grammar* grammar0 = pd->GetGrammar(ToUtf32("soul.code.DeclarationGrammar"));
     if (!grammar0)
     {
-        grammar0 = soul::code::ExpressionGrammar::Create(pd);
+        grammar0 = soul::code::DeclarationGrammar::Create(pd);
     }
     AddGrammarReference(grammar0);
-    soul::parsing::Grammar* grammar1 = pd->GetGrammar(ToUtf32("soul.code.DeclarationGrammar"));
+    soul::parsing::Grammar* grammar1 = pd->GetGrammar(ToUtf32("soul.code.DeclaratorGrammar"));
     if (!grammar1)
     {
-        grammar1 = soul::code::DeclarationGrammar::Create(pd);
+        grammar1 = soul::code::DeclaratorGrammar::Create(pd);
     }
     AddGrammarReference(grammar1);
-    soul::parsing::Grammar* grammar2 = pd->GetGrammar(ToUtf32("soul.code.DeclaratorGrammar"));
+    soul::parsing::Grammar* grammar2 = pd->GetGrammar(ToUtf32("soul.code.ExpressionGrammar"));
     if (!grammar2)
     {
-        grammar2 = soul::code::DeclaratorGrammar::Create(pd);
+        grammar2 = soul::code::ExpressionGrammar::Create(pd);
     }
     AddGrammarReference(grammar2);
     soul::parsing::Grammar* grammar3 = pd->GetGrammar(ToUtf32("soul.code.IdentifierGrammar"));
@@ -2091,15 +1928,15 @@ void StatementGrammar::GetReferencedGrammars()
 void StatementGrammar::CreateRules()
 {
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("Expression"), this, ToUtf32("ExpressionGrammar.Expression")));
-    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("Declarator"), this, ToUtf32("DeclaratorGrammar.Declarator")));
-    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("AssignmentExpression"), this, ToUtf32("ExpressionGrammar.AssignmentExpression")));
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("ConstantExpression"), this, ToUtf32("ExpressionGrammar.ConstantExpression")));
-    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("BlockDeclaration"), this, ToUtf32("DeclarationGrammar.BlockDeclaration")));
+    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("AssignmentExpression"), this, ToUtf32("ExpressionGrammar.AssignmentExpression")));
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("TypeId"), this, ToUtf32("DeclaratorGrammar.TypeId")));
+    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("Declarator"), this, ToUtf32("DeclaratorGrammar.Declarator")));
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("TypeSpecifierSeq"), this, ToUtf32("DeclaratorGrammar.TypeSpecifierSeq")));
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("AbstractDeclarator"), this, ToUtf32("DeclaratorGrammar.AbstractDeclarator")));
-    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("SimpleDeclaration"), this, ToUtf32("DeclarationGrammar.SimpleDeclaration")));
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("Identifier"), this, ToUtf32("IdentifierGrammar.Identifier")));
+    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("SimpleDeclaration"), this, ToUtf32("DeclarationGrammar.SimpleDeclaration")));
+    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("BlockDeclaration"), this, ToUtf32("DeclarationGrammar.BlockDeclaration")));
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("spaces_and_comments"), this, ToUtf32("soul.parsing.stdlib.spaces_and_comments")));
     AddRule(new StatementRule(ToUtf32("Statement"), GetScope(), GetParsingDomain()->GetNextRuleId(),
         new soul::parsing::AlternativeParser(
@@ -13,6 +13,7 @@ public:
     static StatementGrammar* Create();
     static StatementGrammar* Create(soul::parsing::ParsingDomain* parsingDomain);
     soul::codedom::CompoundStatement* Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName);
+    soul::codedom::CompoundStatement* Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, const soul::parsing::ParsingLimits* limits);
 private:
     StatementGrammar(soul::parsing::ParsingDomain* parsingDomain_);
     virtual void CreateRules();
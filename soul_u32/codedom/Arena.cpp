@@ -0,0 +1,74 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <soul_u32/codedom/Arena.hpp>
+#include <soul_u32/codedom/Object.hpp>
+
+namespace soul { namespace codedom {
+
+thread_local Arena* currentArena = nullptr;
+
+const std::size_t arenaAlignment = alignof(std::max_align_t);
+
+Arena::Arena() : pos(nullptr), end(nullptr), allocatedBytes(0)
+{
+}
+
+Arena::~Arena()
+{
+    for (int i = int(objects.size()) - 1; i >= 0; --i)
+    {
+        CppObject* object = objects[i];
+        if (object)
+        {
+            object->~CppObject();
+        }
+    }
+}
+
+void* Arena::Allocate(std::size_t size)
+{
+    size = (size + arenaAlignment - 1) & ~(arenaAlignment - 1);
+    if (size > std::size_t(end - pos))
+    {
+        if (size > blockSize / 4)
+        {
+            //  A large object gets a block of its own, so that the rest of the current block is not wasted.
+            blocks.push_back(Block(size));
+            allocatedBytes += size;
+            return blocks.back().mem.get();
+        }
+        blocks.push_back(Block(blockSize));
+        pos = blocks.back().mem.get();
+        end = pos + blockSize;
+    }
+    void* p = pos;
+    pos += size;
+    allocatedBytes += size;
+    return p;
+}
+
+int Arena::Register(CppObject* object)
+{
+    objects.push_back(object);
+    return int(objects.size()) - 1;
+}
+
+Arena* Arena::Current()
+{
+    return currentArena;
+}
+
+ArenaScope::ArenaScope(Arena* arena) : prevArena(currentArena)
+{
+    currentArena = arena;
+}
+
+ArenaScope::~ArenaScope()
+{
+    currentArena = prevArena;
+}
+
+} } // namespace soul::codedom
@@ -0,0 +1,62 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#ifndef SOUL_CODEDOM_ARENA_INCLUDED
+#define SOUL_CODEDOM_ARENA_INCLUDED
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace soul { namespace codedom {
+
+class CppObject;
+
+//  Arena allocates codedom objects from large memory blocks and destroys them all at once when the arena itself is destroyed.
+//  While an ArenaScope is active, the CppObjects created with new on the same thread are allocated from its arena.
+//  Arena objects are not owned by other codedom objects: IsOwned() returns true for them, so Own() and the owners that check IsOwned() leave them alone.
+//  Deleting an arena object runs its destructor but does not release its memory. The arena must outlive all pointers to its objects.
+
+class Arena
+{
+public:
+    Arena();
+    ~Arena();
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+    void* Allocate(std::size_t size);
+    int Register(CppObject* object);
+    void Unregister(int index) { objects[index] = nullptr; }
+    std::size_t AllocatedBytes() const { return allocatedBytes; }
+    static Arena* Current();
+private:
+    friend class ArenaScope;
+    static const std::size_t blockSize = 64 * 1024;
+    struct Block
+    {
+        Block(std::size_t size_) : mem(new char[size_]), size(size_) {}
+        std::unique_ptr<char[]> mem;
+        std::size_t size;
+    };
+    std::vector<Block> blocks;
+    char* pos;
+    char* end;
+    std::size_t allocatedBytes;
+    std::vector<CppObject*> objects;
+};
+
+class ArenaScope
+{
+public:
+    ArenaScope(Arena* arena);
+    ~ArenaScope();
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+private:
+    Arena* prevArena;
+};
+
+} } // namespace soul::codedom
+
+#endif // SOUL_CODEDOM_ARENA_INCLUDED
@@ -29,7 +29,7 @@ void AssignInit::Print(CodeFormatter& formatter)
 {
     if (assignmentExpr)
     {
-        assignmentExpr->Print(formatter);
+        PrintOperand(assignmentExpr, assignmentPrecedence, formatter);
     }
     else
     {
@@ -111,7 +111,7 @@ InitDeclarator::InitDeclarator(const std::u32string& declarator_, Initializer* i
 
 void InitDeclarator::Print(CodeFormatter& formatter)
 {
-    formatter.Write(ToUtf8(declarator));
+    formatter.Write(declarator);
     if (initializer)
     {
         initializer->Print(formatter);
@@ -222,7 +222,11 @@ NamespaceAlias::NamespaceAlias(const std::u32string& aliasName_, const std::u32s
 
 void NamespaceAlias::Print(CodeFormatter& formatter)
 {
-    formatter.WriteLine("namespace " + ToUtf8(aliasName) + " = " + ToUtf8(namespaceName) + ";");
+    formatter.Write("namespace ");
+    formatter.Write(aliasName);
+    formatter.Write(" = ");
+    formatter.Write(namespaceName);
+    formatter.WriteLine(";");
 }
 
 void NamespaceAlias::Accept(Visitor& visitor)
@@ -237,7 +241,9 @@ UsingDeclaration::UsingDeclaration(const std::u32string& usingId_):
 
 void UsingDeclaration::Print(CodeFormatter& formatter)
 {
-    formatter.WriteLine("using " + ToUtf8(usingId) + ";");
+    formatter.Write("using ");
+    formatter.Write(usingId);
+    formatter.WriteLine(";");
 }
 
 void UsingDeclaration::Accept(Visitor& visitor)
@@ -252,7 +258,9 @@ UsingDirective::UsingDirective(const std::u32string& usingNs_):
 
 void UsingDirective::Print(CodeFormatter& formatter)
 {
-    formatter.WriteLine("using namespace " + ToUtf8(usingNs) + ";");
+    formatter.Write("using namespace ");
+    formatter.Write(usingNs);
+    formatter.WriteLine(";");
 }
 
 void UsingDirective::Accept(Visitor& visitor)
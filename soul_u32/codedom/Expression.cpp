@@ -13,6 +13,28 @@ namespace soul { namespace codedom {
 using namespace soul::util;
 using namespace soul::unicode;
 
+int Precedence(CppObject* expr)
+{
+    int rank = expr->Rank();
+    if (rank >= postfixPrecedence) return postfixPrecedence;
+    if (rank >= unaryPrecedence) return unaryPrecedence;
+    return rank;
+}
+
+void PrintOperand(CppObject* operand, int minPrecedence, CodeFormatter& formatter)
+{
+    if (Precedence(operand) < minPrecedence)
+    {
+        formatter.Write("(");
+        operand->Print(formatter);
+        formatter.Write(")");
+    }
+    else
+    {
+        operand->Print(formatter);
+    }
+}
+
 void PrintExprs(const std::vector<CppObject*>& expressions, CodeFormatter& formatter)
 {
     bool first = true;
@@ -26,7 +48,7 @@ void PrintExprs(const std::vector<CppObject*>& expressions, CodeFormatter& forma
         {
             formatter.Write(", ");
         }
-        expr->Print(formatter);
+        PrintOperand(expr, assignmentPrecedence, formatter);
     }
 }
 
@@ -68,7 +90,7 @@ IndexExpr::IndexExpr(CppObject* child_, CppObject* index_): PostfixExpression(U"
 
 void IndexExpr::Print(CodeFormatter& formatter)
 {
-    Child()->Print(formatter);
+    PrintOperand(Child(), postfixPrecedence, formatter);
     formatter.Write("[");
     index->Print(formatter);
     formatter.Write("]");
@@ -90,7 +112,7 @@ InvokeExpr::InvokeExpr(CppObject* child_, const std::vector<CppObject*>& argumen
 
 void InvokeExpr::Print(CodeFormatter& formatter)
 {
-    Child()->Print(formatter);
+    PrintOperand(Child(), postfixPrecedence, formatter);
     formatter.Write("(");
     PrintExprs(arguments, formatter);
     formatter.Write(")");
@@ -113,7 +135,7 @@ MemberAccessExpr::MemberAccessExpr(CppObject* child_, CppObject* member_): Postf
 
 void MemberAccessExpr::Print(CodeFormatter& formatter)
 {
-    Child()->Print(formatter);
+    PrintOperand(Child(), postfixPrecedence, formatter);
     formatter.Write(".");
     member->Print(formatter);
 }
@@ -131,7 +153,7 @@ PtrMemberAccessExpr::PtrMemberAccessExpr(CppObject* child_, CppObject* member_):
 
 void PtrMemberAccessExpr::Print(CodeFormatter& formatter)
 {
-    Child()->Print(formatter);
+    PrintOperand(Child(), postfixPrecedence, formatter);
     formatter.Write("->");
     member->Print(formatter);
 }
@@ -148,7 +170,7 @@ PostIncrementExpr::PostIncrementExpr(CppObject* child_): PostfixExpression(U"++"
 
 void PostIncrementExpr::Print(CodeFormatter& formatter)
 {
-    Child()->Print(formatter);
+    PrintOperand(Child(), postfixPrecedence, formatter);
     formatter.Write("++");
 }
 
@@ -164,7 +186,7 @@ PostDecrementExpr::PostDecrementExpr(CppObject* child_): PostfixExpression(U"--"
 
 void PostDecrementExpr::Print(CodeFormatter& formatter)
 {
-    Child()->Print(formatter);
+    PrintOperand(Child(), postfixPrecedence, formatter);
     formatter.Write("--");
 }
 
@@ -181,7 +203,8 @@ PostCastExpr::PostCastExpr(const std::u32string& name_, CppObject* type_, CppObj
 
 void PostCastExpr::Print(CodeFormatter& formatter)
 {
-    formatter.Write(ToUtf8(Name()) + "<");
+    formatter.Write(Name());
+    formatter.Write("<");
     type->Print(formatter);
     formatter.Write(">(");
     Child()->Print(formatter);
@@ -219,7 +242,7 @@ PreIncrementExpr::PreIncrementExpr(CppObject* child_): UnaryExpression(U"++", ch
 void PreIncrementExpr::Print(CodeFormatter& formatter)
 {
     formatter.Write("++");
-    Child()->Print(formatter);
+    PrintOperand(Child(), castPrecedence, formatter);
 }
 
 void PreIncrementExpr::Accept(Visitor& visitor)
@@ -235,7 +258,7 @@ PreDecrementExpr::PreDecrementExpr(CppObject* child_): UnaryExpression(U"--", ch
 void PreDecrementExpr::Print(CodeFormatter& formatter)
 {
     formatter.Write("--");
-    Child()->Print(formatter);
+    PrintOperand(Child(), castPrecedence, formatter);
 }
 
 void PreDecrementExpr::Accept(Visitor& visitor)
@@ -250,16 +273,13 @@ UnaryOpExpr::UnaryOpExpr(Operator op_, CppObject* child_): UnaryExpression(GetOp
 
 void UnaryOpExpr::Print(CodeFormatter& formatter)
 {
-    formatter.Write(ToUtf8(Name()));
-    if (Child()->Rank() < Rank())
-    {
-        formatter.Write("(");
-    }
-    Child()->Print(formatter);
-    if (Child()->Rank() < Rank())
+    formatter.Write(Name());
+    if ((op == Operator::plus || op == Operator::minus) && Precedence(Child()) >= castPrecedence && !Child()->Name().empty() && Child()->Name()[0] == Name()[0])
     {
-        formatter.Write(")");
+        //  - -x and + +x must not be printed as --x and ++x.
+        formatter.Write(" ");
     }
+    PrintOperand(Child(), castPrecedence, formatter);
 }
 
 void UnaryOpExpr::Accept(Visitor& visitor)
@@ -283,11 +303,15 @@ void SizeOfExpr::Print(CodeFormatter& formatter)
     {
         formatter.Write(" ");
     }
-    Child()->Print(formatter);
     if (parens)
     {
+        Child()->Print(formatter);
         formatter.Write(")");
     }
+    else
+    {
+        PrintOperand(Child(), unaryPrecedence, formatter);
+    }
 }
 
 void SizeOfExpr::Accept(Visitor& visitor)
@@ -307,15 +331,7 @@ void CastExpr::Print(CodeFormatter& formatter)
     formatter.Write("(");
     typeId->Print(formatter);
     formatter.Write(")");
-    if (expr->Rank() < Rank())
-    {
-        formatter.Write("(");
-    }
-    expr->Print(formatter);
-    if (expr->Rank() < Rank())
-    {
-        formatter.Write(")");
-    }
+    PrintOperand(expr, castPrecedence, formatter);
 }
 
 void CastExpr::Accept(Visitor& visitor)
@@ -337,27 +353,13 @@ BinaryOpExpr::BinaryOpExpr(CppObject* left_, Operator op_, int rank_, CppObject*
 
 void BinaryOpExpr::Print(CodeFormatter& formatter)
 {
-    if (Left()->Rank() < Rank())
-    {
-        formatter.Write("(");
-    }
-    Left()->Print(formatter);
-    if (Left()->Rank() < Rank())
-    {
-        formatter.Write(")");
-    }
+    //  Assignment operators associate to the right, all other binary operators to the left.
+    bool rightAssociative = rank == assignmentPrecedence;
+    PrintOperand(Left(), rightAssociative ? rank + 1 : rank, formatter);
     formatter.Write(" ");
-    formatter.Write(ToUtf8(Name()));
+    formatter.Write(Name());
     formatter.Write(" ");
-    if (Right()->Rank() < Rank())
-    {
-        formatter.Write("(");
-    }
-    Right()->Print(formatter);
-    if (Right()->Rank() < Rank())
-    {
-        formatter.Write(")");
-    }
+    PrintOperand(Right(), rightAssociative ? rank : rank + 1, formatter);
 }
 
 void BinaryOpExpr::Accept(Visitor& visitor)
@@ -377,11 +379,11 @@ ConditionalExpr::ConditionalExpr(CppObject* condition_, CppObject* thenExpr_, Cp
 
 void ConditionalExpr::Print(CodeFormatter& formatter)
 {
-    condition->Print(formatter);
+    PrintOperand(condition, logicalOrPrecedence, formatter);
     formatter.Write(" ? ");
-    thenExpr->Print(formatter);
+    PrintOperand(thenExpr, commaPrecedence, formatter);
     formatter.Write(" : ");
-    elseExpr->Print(formatter);
+    PrintOperand(elseExpr, assignmentPrecedence, formatter);
 }
 
 void ConditionalExpr::Accept(Visitor& visitor)
@@ -403,7 +405,7 @@ void ThrowExpr::Print(CodeFormatter& formatter)
     if (exception)
     {
         formatter.Write(" ");
-        exception->Print(formatter);
+        PrintOperand(exception, assignmentPrecedence, formatter);
     }
 }
 
@@ -495,7 +497,7 @@ void DeleteExpr::Print(CodeFormatter& formatter)
         formatter.Write("[]");
     }
     formatter.Write(" ");
-    expr->Print(formatter);
+    PrintOperand(expr, castPrecedence, formatter);
 }
 
 void DeleteExpr::Accept(Visitor& visitor)
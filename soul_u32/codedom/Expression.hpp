@@ -10,6 +10,20 @@
 
 namespace soul { namespace codedom {
 
+//  The ranks of expressions define their precedence: primary and postfix expressions (rank 18 and above) form the highest precedence level,
+//  unary expressions (14 to 17) the next one, followed by casts (13) and the binary operators from pointer to member (12) down to comma (0).
+//  An operand is printed in parentheses if its precedence is lower than its position in the enclosing expression requires,
+//  so the printed code keeps the structure of the parsed code even though the parser does not keep parentheses.
+
+const int commaPrecedence = 0;
+const int assignmentPrecedence = 1;
+const int logicalOrPrecedence = 2;
+const int castPrecedence = 13;
+const int unaryPrecedence = 14;
+const int postfixPrecedence = 18;
+
+int Precedence(CppObject* expr);
+void PrintOperand(CppObject* operand, int minPrecedence, CodeFormatter& formatter);
 void PrintExprs(const std::vector<CppObject*>& expressions, CodeFormatter& formatter);
 
 class Expression : public CppObject
@@ -215,6 +229,7 @@ public:
     ConditionalExpr(CppObject* condition_, CppObject* thenExpr_, CppObject* elseExpr_);
     virtual void Print(CodeFormatter& formatter);
     virtual void Accept(Visitor& visitor);
+    virtual int Rank() const { return assignmentPrecedence; }
 private:
     CppObject* condition;
     CppObject* thenExpr;
@@ -227,6 +242,7 @@ public:
     ThrowExpr(CppObject* exception_);
     virtual void Print(CodeFormatter& formatter);
     virtual void Accept(Visitor& visitor);
+    virtual int Rank() const { return assignmentPrecedence; }
 private:
     CppObject* exception;
 };
@@ -4,6 +4,7 @@
 // =================================
 
 #include <soul_u32/codedom/Object.hpp>
+#include <soul_u32/codedom/Arena.hpp>
 #include <soul_u32/util/Unicode.hpp>
 
 namespace soul { namespace codedom {
@@ -11,12 +12,71 @@ namespace soul { namespace codedom {
 using namespace soul::util;
 using namespace soul::unicode;
 
-CppObject::CppObject(const std::u32string& name_): name(name_), isOwned(false)
+//  Every CppObject allocation is preceded by a header that records the arena of the object, or null for a heap object, so that deleting an arena object does not free its memory.
+//  The constructor reads the arena from the header. It must not read the header of an object that was not created by operator new, so operator new also keeps
+//  the allocations whose constructors have not run yet in a short per-thread list: a new expression within the arguments of another one adds a second entry.
+
+const std::size_t allocationHeaderSize = alignof(std::max_align_t) > sizeof(Arena*) ? alignof(std::max_align_t) : sizeof(Arena*);
+
+thread_local std::vector<void*> pendingAllocations;
+
+bool RemovePendingAllocation(void* p)
+{
+    for (int i = int(pendingAllocations.size()) - 1; i >= 0; --i)
+    {
+        if (pendingAllocations[i] == p)
+        {
+            pendingAllocations.erase(pendingAllocations.begin() + i);
+            return true;
+        }
+    }
+    return false;
+}
+
+inline Arena*& AllocationArena(void* p)
 {
+    return *reinterpret_cast<Arena**>(static_cast<char*>(p) - allocationHeaderSize);
+}
+
+void* CppObject::operator new(std::size_t size)
+{
+    Arena* arena = Arena::Current();
+    char* mem = static_cast<char*>(arena ? arena->Allocate(allocationHeaderSize + size) : ::operator new(allocationHeaderSize + size));
+    void* p = mem + allocationHeaderSize;
+    AllocationArena(p) = arena;
+    pendingAllocations.push_back(p);
+    return p;
+}
+
+void CppObject::operator delete(void* p)
+{
+    if (!p) return;
+    //  If the initialization of a new expression throws, the constructor has not taken the allocation from the list.
+    RemovePendingAllocation(p);
+    if (!AllocationArena(p))
+    {
+        ::operator delete(static_cast<char*>(p) - allocationHeaderSize);
+    }
+}
+
+CppObject::CppObject(const std::u32string& name_): name(name_), isOwned(false), arena(nullptr), arenaIndex(-1)
+{
+    if (RemovePendingAllocation(this))
+    {
+        arena = AllocationArena(this);
+        if (arena)
+        {
+            arenaIndex = arena->Register(this);
+        }
+    }
 }
 
 CppObject::~CppObject()
 {
+    if (arena)
+    {
+        arena->Unregister(arenaIndex);
+    }
 }
 
 void CppObject::Own(CppObject* object)
@@ -38,7 +98,7 @@ std::u32string CppObject::ToString() const
 
 void CppObject::Print(CodeFormatter& formatter)
 {
-    formatter.Write(ToUtf8(name));
+    formatter.Write(name);
 }
 
 } } // namespace cminor::codedom
@@ -6,6 +6,7 @@
 #ifndef SOUL_CODEDOM_OBJECT_INCLUDED
 #define SOUL_CODEDOM_OBJECT_INCLUDED
 #include <soul_u32/util/CodeFormatter.hpp>
+#include <cstddef>
 #include <string>
 #include <vector>
 #include <memory>
@@ -14,16 +15,22 @@ namespace soul { namespace codedom {
 
 using soul::util::CodeFormatter;
 class Visitor;
+class Arena;
+
+//  CppObjects created while an ArenaScope is active are allocated from its arena and destroyed together with it; see Arena.hpp.
 
 class CppObject
 {
 public:
+    static void* operator new(std::size_t size);
+    static void operator delete(void* p);
     CppObject(const std::u32string& name_);
     virtual ~CppObject();
     const std::u32string& Name() const { return name; }
     void SetName(const std::u32string& newName) { name = newName; }
     void Own(CppObject* object);
-    bool IsOwned() const { return isOwned; }
+    bool IsOwned() const { return isOwned || arena != nullptr; }
+    bool InArena() const { return arena != nullptr; }
     void SetOwned() { isOwned = true; }
     void ResetOwned() { isOwned = false; }
     virtual std::u32string ToString() const;
@@ -33,6 +40,8 @@ public:
 private:
     std::u32string name;
     bool isOwned;
+    Arena* arena;
+    int arenaIndex;
     std::vector<std::unique_ptr<CppObject>> ownedObjects;
 };
 
@@ -24,7 +24,7 @@ LabeledStatement::LabeledStatement(const std::u32string& label_, Statement* stat
 
 void LabeledStatement::Print(CodeFormatter& formatter)
 {
-    formatter.Write(ToUtf8(label));
+    formatter.Write(label);
     formatter.Write(" : ");
     statement->Print(formatter);
 }
@@ -375,7 +375,9 @@ GotoStatement::GotoStatement(const std::u32string& target_): JumpStatement(U"got
 
 void GotoStatement::Print(CodeFormatter& formatter)
 {
-    formatter.WriteLine("goto " + ToUtf8(target) + ";");
+    formatter.Write("goto ");
+    formatter.Write(target);
+    formatter.WriteLine(";");
 }
 
 void GotoStatement::Accept(Visitor& visitor)
@@ -418,7 +420,9 @@ ConditionWithDeclarator::ConditionWithDeclarator(TypeId* type_, const std::u32st
 void ConditionWithDeclarator::Print(CodeFormatter& formatter)
 {
     type->Print(formatter);
-    formatter.Write(" " + ToUtf8(declarator) + " = ");
+    formatter.Write(" ");
+    formatter.Write(declarator);
+    formatter.Write(" = ");
     expression->Print(formatter);
 }
 
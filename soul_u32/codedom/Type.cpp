@@ -74,7 +74,21 @@ std::u32string TypeName::ToString() const
 
 void TypeName::Print(CodeFormatter& formatter)
 {
-    formatter.Write(ToUtf8(ToString()));
+    formatter.Write(Name());
+    if (isTemplate)
+    {
+        formatter.Write("<");
+        int n = int(templateArguments.size());
+        for (int i = 0; i < n; ++i)
+        {
+            if (i > 0)
+            {
+                formatter.Write(", ");
+            }
+            templateArguments[i]->Print(formatter);
+        }
+        formatter.Write(">");
+    }
 }
 
 void TypeName::Accept(Visitor& visitor)
@@ -109,7 +123,15 @@ std::u32string Type::ToString() const
 
 void Type::Print(CodeFormatter& formatter)
 {
-    formatter.Write(ToUtf8(ToString()));
+    int n = int(typeSpecifiers.size());
+    for (int i = 0; i < n; ++i)
+    {
+        if (i > 0)
+        {
+            formatter.Write(" ");
+        }
+        typeSpecifiers[i]->Print(formatter);
+    }
 }
 
 void Type::Accept(Visitor& visitor)
@@ -159,7 +181,7 @@ void TypeId::Print(CodeFormatter& formatter)
     }
     if (!declarator.empty())
     {
-        formatter.Write(ToUtf8(declarator));
+        formatter.Write(declarator);
     }
 }
 
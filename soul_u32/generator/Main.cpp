@@ -3,6 +3,7 @@
 // Distributed under the MIT license
 // =================================
 
+#include <soul_u32/generator/Server.hpp>
 #include <soul_u32/syntax/Generator.hpp>
 #include <soul_u32/syntax/CodeGenerator.hpp>
 #include <soul_u32/parsing/InitDone.hpp>
@@ -50,68 +51,95 @@ void AddToLibraryDirectories(const std::string& libraryPath, std::vector<std::st
 
 const char* version = "1.0";
 
-int main(int argc, const char** argv)
+void PrintUsage()
+{
+    std::cout << "Usage: soulpg [options] {<file>.pp}\n" << "Compile Soul parsing project file(s) <file>.pp..." << std::endl;
+    std::cout << "options:\n";
+    std::cout << "-L <dir1>;<dir2>;...: add <dir1>, <dir2>, ... to library reference directories" << std::endl;
+    std::cout << "-F                  : force code generation" << std::endl;
+    std::cout << "-R <n>              : generate rule classes to separate source files, <n> rule classes per file" << std::endl;
+    std::cout << "--local             : do not use a running soulpg server" << std::endl;
+    std::cout << "--server            : run as a server that keeps grammars and parsed library files in memory between builds" << std::endl;
+    std::cout << "--stop-server       : stop a running soulpg server" << std::endl;
+}
+
+std::string MakeAbsolute(const std::string& filePath, const std::string& workingDirectory)
+{
+    return boost::filesystem::absolute(boost::filesystem::path(filePath), boost::filesystem::path(workingDirectory)).generic_string();
+}
+
+int RunGenerator(soul::syntax::GeneratorContext& context, const GeneratorRequest& request)
 {
-#if defined(_MSC_VER) && !defined(NDEBUG)
-    int dbgFlags = _CrtSetDbgFlag(_CRTDBG_REPORT_FLAG);
-    dbgFlags |= _CRTDBG_LEAK_CHECK_DF;
-    _CrtSetDbgFlag(dbgFlags);
-    //_CrtSetBreakAlloc(40183);
-#endif // defined(_MSC_VER) && !defined(NDEBUG)
     try
     {
         std::cout << "Soul Parser Generator version " << version << std::endl;
-        if (argc < 2)
-        {
-            std::cout << "Usage: soulpg [options] {<file>.pp}\n" << "Compile Soul parsing project file(s) <file>.pp..." << std::endl;
-            std::cout << "options:\n";
-            std::cout << "-L <dir1>;<dir2>;...: add <dir1>, <dir2>, ... to library reference directories" << std::endl;
-            std::cout << "-F                  : force code generation" << std::endl;
-            return 1;
-        }
-        std::vector<std::string> projectFilePaths;
-        std::vector<std::string> libraryDirectories;
-        std::string soul_u32_root;
-        const char* soul_u32_root_env = getenv("SOUL_U32_ROOT");
-        if (soul_u32_root_env)
-        {
-            soul_u32_root = soul_u32_root_env;
-        }
-        if (soul_u32_root.empty())
+        if (request.soulU32Root.empty())
         {
             std::cerr << "please set 'SOUL_U32_ROOT' environment variable to contain /path/to/soul_u32 directory." << std::endl;
             return 2;
         }
-        std::string libraryPath = (boost::filesystem::path(soul_u32_root) / boost::filesystem::path("parsing")).generic_string();
+        std::vector<std::string> projectFilePaths;
+        std::vector<std::string> libraryDirectories;
+        std::string libraryPath = (boost::filesystem::path(request.soulU32Root) / boost::filesystem::path("parsing")).generic_string();
         AddToLibraryDirectories(libraryPath, libraryDirectories);
         bool prevWasL = false;
-        for (int i = 1; i < argc; ++i)
+        bool prevWasR = false;
+        bool force = false;
+        int rulesPerFile = 0;
+        for (const std::string& arg : request.args)
         {
-            std::string arg = argv[i];
             if (arg == "-L")
             {
                 prevWasL = true;
             }
             else if (arg == "-F")
             {
-                soul::syntax::SetForceCodeGen(true);
+                force = true;
+            }
+            else if (arg == "-R")
+            {
+                prevWasR = true;
+            }
+            else if (arg == "--local")
+            {
+            }
+            else if (prevWasR)
+            {
+                prevWasR = false;
+                rulesPerFile = std::stoi(arg);
+                if (rulesPerFile <= 0)
+                {
+                    std::cerr << "number of rule classes per file must be positive" << std::endl;
+                    return 1;
+                }
             }
             else if (prevWasL)
             {
                 prevWasL = false;
-                AddToLibraryDirectories(arg, libraryDirectories);
+                std::vector<std::string> dirs;
+                AddToLibraryDirectories(arg, dirs);
+                for (const std::string& dir : dirs)
+                {
+                    libraryDirectories.push_back(MakeAbsolute(dir, request.workingDirectory));
+                }
             }
             else
             {
-                projectFilePaths.push_back(arg);
+                projectFilePaths.push_back(MakeAbsolute(arg, request.workingDirectory));
             }
         }
-        InitDone initDone;
+        soul::syntax::SetForceCodeGen(force);
+        soul::syntax::SetRulesPerFile(rulesPerFile);
+        std::string generatorVersion = version;
+        if (rulesPerFile > 0)
+        {
+            generatorVersion.append(" -R " + std::to_string(rulesPerFile));
+        }
         int n = int(projectFilePaths.size());
         for (int i = 0; i < n; ++i)
         {
             const std::string& projectFilePath = projectFilePaths[i];
-            soul::syntax::Generate(projectFilePath, libraryDirectories);
+            context.Generate(projectFilePath, libraryDirectories, generatorVersion);
         }
     }
     catch (std::exception& ex)
@@ -126,3 +154,74 @@ int main(int argc, const char** argv)
     }
     return 0;
 }
+
+int main(int argc, const char** argv)
+{
+#if defined(_MSC_VER) && !defined(NDEBUG)
+    int dbgFlags = _CrtSetDbgFlag(_CRTDBG_REPORT_FLAG);
+    dbgFlags |= _CRTDBG_LEAK_CHECK_DF;
+    _CrtSetDbgFlag(dbgFlags);
+    //_CrtSetBreakAlloc(40183);
+#endif // defined(_MSC_VER) && !defined(NDEBUG)
+    try
+    {
+        if (argc < 2)
+        {
+            std::cout << "Soul Parser Generator version " << version << std::endl;
+            PrintUsage();
+            return 1;
+        }
+        GeneratorRequest request;
+        request.workingDirectory = boost::filesystem::current_path().generic_string();
+        const char* soul_u32_root_env = getenv("SOUL_U32_ROOT");
+        if (soul_u32_root_env)
+        {
+            request.soulU32Root = soul_u32_root_env;
+        }
+        bool local = false;
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+            if (arg == "--server")
+            {
+                InitDone initDone;
+                soul::syntax::GeneratorContext context;
+                RunServer(GetServerSocketPath(), [&context](const GeneratorRequest& request) { return RunGenerator(context, request); });
+                return 0;
+            }
+            else if (arg == "--stop-server")
+            {
+                if (!StopServer(GetServerSocketPath()))
+                {
+                    std::cerr << "no soulpg server running" << std::endl;
+                    return 1;
+                }
+                return 0;
+            }
+            else if (arg == "--local")
+            {
+                local = true;
+            }
+            request.args.push_back(arg);
+        }
+        int exitCode = 0;
+        if (!local && RunInServer(GetServerSocketPath(), request, exitCode))
+        {
+            return exitCode;
+        }
+        InitDone initDone;
+        soul::syntax::GeneratorContext context;
+        return RunGenerator(context, request);
+    }
+    catch (std::exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        return 3;
+    }
+    catch (...)
+    {
+        std::cerr << "unknown exception" << std::endl;
+        return 4;
+    }
+    return 0;
+}
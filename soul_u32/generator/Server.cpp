@@ -0,0 +1,253 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <soul_u32/generator/Server.hpp>
+#include <boost/asio.hpp>
+#include <boost/filesystem.hpp>
+#include <iostream>
+#include <stdexcept>
+#include <streambuf>
+#include <stdint.h>
+#include <stdlib.h>
+#include <signal.h>
+
+std::string GetServerSocketPath()
+{
+    const char* socketPathEnv = getenv("SOULPG_SOCKET");
+    if (socketPathEnv && *socketPathEnv)
+    {
+        return socketPathEnv;
+    }
+    return (boost::filesystem::temp_directory_path() / "soulpg.socket").string();
+}
+
+#if defined(BOOST_ASIO_HAS_LOCAL_SOCKETS)
+
+using boost::asio::local::stream_protocol;
+
+//  Messages are framed as a kind byte followed by a 32-bit little-endian payload length and the payload.
+
+const char workingDirectoryFrame = 'd';
+const char rootFrame = 'r';
+const char argFrame = 'a';
+const char runFrame = 'g';
+const char stopFrame = 'q';
+const char outFrame = 'o';
+const char errFrame = 'e';
+const char exitFrame = 'x';
+
+void WriteFrame(stream_protocol::socket& socket, char kind, const std::string& payload)
+{
+    uint32_t length = uint32_t(payload.length());
+    uint8_t header[5] = { uint8_t(kind), uint8_t(length), uint8_t(length >> 8), uint8_t(length >> 16), uint8_t(length >> 24) };
+    std::vector<boost::asio::const_buffer> buffers;
+    buffers.push_back(boost::asio::buffer(header, sizeof(header)));
+    buffers.push_back(boost::asio::buffer(payload));
+    boost::asio::write(socket, buffers);
+}
+
+bool ReadFrame(stream_protocol::socket& socket, char& kind, std::string& payload)
+{
+    uint8_t header[5];
+    boost::system::error_code ec;
+    boost::asio::read(socket, boost::asio::buffer(header, sizeof(header)), ec);
+    if (ec) return false;
+    kind = char(header[0]);
+    uint32_t length = uint32_t(header[1]) | (uint32_t(header[2]) << 8) | (uint32_t(header[3]) << 16) | (uint32_t(header[4]) << 24);
+    payload.resize(length);
+    if (length > 0)
+    {
+        boost::asio::read(socket, boost::asio::buffer(&payload[0], length), ec);
+        if (ec) return false;
+    }
+    return true;
+}
+
+//  Stream buffer that sends its content to the client as frames of the given kind.
+
+class FrameStreamBuf : public std::streambuf
+{
+public:
+    FrameStreamBuf(stream_protocol::socket& socket_, char kind_) : socket(socket_), kind(kind_), failed(false)
+    {
+    }
+    ~FrameStreamBuf()
+    {
+        sync();
+    }
+protected:
+    virtual int_type overflow(int_type c)
+    {
+        if (c != traits_type::eof())
+        {
+            buffer.append(1, traits_type::to_char_type(c));
+            if (buffer.length() >= bufferSize)
+            {
+                sync();
+            }
+        }
+        return traits_type::not_eof(c);
+    }
+    virtual std::streamsize xsputn(const char* s, std::streamsize count)
+    {
+        buffer.append(s, size_t(count));
+        if (buffer.length() >= bufferSize)
+        {
+            sync();
+        }
+        return count;
+    }
+    virtual int sync()
+    {
+        if (!buffer.empty() && !failed)
+        {
+            try
+            {
+                WriteFrame(socket, kind, buffer);
+            }
+            catch (const std::exception&)
+            {
+                failed = true;
+            }
+        }
+        buffer.clear();
+        return 0;
+    }
+private:
+    static const size_t bufferSize = 4096;
+    stream_protocol::socket& socket;
+    char kind;
+    std::string buffer;
+    bool failed;
+};
+
+class RedirectOutput
+{
+public:
+    RedirectOutput(stream_protocol::socket& socket) : outBuf(socket, outFrame), errBuf(socket, errFrame), prevOut(std::cout.rdbuf(&outBuf)), prevErr(std::cerr.rdbuf(&errBuf))
+    {
+    }
+    ~RedirectOutput()
+    {
+        std::cout.flush();
+        std::cerr.flush();
+        std::cout.rdbuf(prevOut);
+        std::cerr.rdbuf(prevErr);
+    }
+private:
+    FrameStreamBuf outBuf;
+    FrameStreamBuf errBuf;
+    std::streambuf* prevOut;
+    std::streambuf* prevErr;
+};
+
+void RunServer(const std::string& socketPath, GeneratorRequestHandler handler)
+{
+#ifndef _WIN32
+    signal(SIGPIPE, SIG_IGN);
+#endif
+    boost::asio::io_service ioService;
+    boost::filesystem::remove(socketPath);
+    stream_protocol::acceptor acceptor(ioService, stream_protocol::endpoint(socketPath));
+    std::cout << "soulpg server listening on " << socketPath << std::endl;
+    bool stop = false;
+    while (!stop)
+    {
+        stream_protocol::socket socket(ioService);
+        acceptor.accept(socket);
+        GeneratorRequest request;
+        char kind;
+        std::string payload;
+        bool run = false;
+        while (!run && !stop && ReadFrame(socket, kind, payload))
+        {
+            switch (kind)
+            {
+                case workingDirectoryFrame: request.workingDirectory = payload; break;
+                case rootFrame: request.soulU32Root = payload; break;
+                case argFrame: request.args.push_back(payload); break;
+                case runFrame: run = true; break;
+                case stopFrame: stop = true; break;
+            }
+        }
+        if (!run) continue;
+        int exitCode = 0;
+        {
+            RedirectOutput redirect(socket);
+            exitCode = handler(request);
+        }
+        try
+        {
+            WriteFrame(socket, exitFrame, std::to_string(exitCode));
+        }
+        catch (const std::exception&)
+        {
+        }
+    }
+    acceptor.close();
+    boost::filesystem::remove(socketPath);
+}
+
+bool Connect(const std::string& socketPath, stream_protocol::socket& socket)
+{
+    if (!boost::filesystem::exists(socketPath)) return false;
+    boost::system::error_code ec;
+    socket.connect(stream_protocol::endpoint(socketPath), ec);
+    return !ec;
+}
+
+bool RunInServer(const std::string& socketPath, const GeneratorRequest& request, int& exitCode)
+{
+    boost::asio::io_service ioService;
+    stream_protocol::socket socket(ioService);
+    if (!Connect(socketPath, socket)) return false;
+    WriteFrame(socket, workingDirectoryFrame, request.workingDirectory);
+    WriteFrame(socket, rootFrame, request.soulU32Root);
+    for (const std::string& arg : request.args)
+    {
+        WriteFrame(socket, argFrame, arg);
+    }
+    WriteFrame(socket, runFrame, std::string());
+    char kind;
+    std::string payload;
+    while (ReadFrame(socket, kind, payload))
+    {
+        switch (kind)
+        {
+            case outFrame: std::cout << payload << std::flush; break;
+            case errFrame: std::cerr << payload << std::flush; break;
+            case exitFrame: exitCode = atoi(payload.c_str()); return true;
+        }
+    }
+    throw std::runtime_error("connection to soulpg server at '" + socketPath + "' lost");
+}
+
+bool StopServer(const std::string& socketPath)
+{
+    boost::asio::io_service ioService;
+    stream_protocol::socket socket(ioService);
+    if (!Connect(socketPath, socket)) return false;
+    WriteFrame(socket, stopFrame, std::string());
+    return true;
+}
+
+#else
+
+void RunServer(const std::string& socketPath, GeneratorRequestHandler handler)
+{
+    throw std::runtime_error("soulpg server mode needs local socket support");
+}
+
+bool RunInServer(const std::string& socketPath, const GeneratorRequest& request, int& exitCode)
+{
+    return false;
+}
+
+bool StopServer(const std::string& socketPath)
+{
+    return false;
+}
+
+#endif
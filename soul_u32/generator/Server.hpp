@@ -0,0 +1,38 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#ifndef SOUL_GENERATOR_SERVER_INCLUDED
+#define SOUL_GENERATOR_SERVER_INCLUDED
+#include <functional>
+#include <string>
+#include <vector>
+
+//  soulpg can run as a server that keeps its grammars and parsed library files in memory between builds.
+//  Clients connect to the server through a local socket, send their working directory, environment and command line arguments,
+//  and receive the output and exit code of the build. Requests are served one at a time.
+//  The socket path is taken from the SOULPG_SOCKET environment variable, or defaults to soulpg.socket in the temporary directory.
+
+struct GeneratorRequest
+{
+    std::string workingDirectory;
+    std::string soulU32Root;
+    std::vector<std::string> args;
+};
+
+typedef std::function<int(const GeneratorRequest&)> GeneratorRequestHandler;
+
+std::string GetServerSocketPath();
+
+//  Serves requests until a client sends a stop request. The output written to std::cout and std::cerr by the handler is sent to the client.
+
+void RunServer(const std::string& socketPath, GeneratorRequestHandler handler);
+
+//  Sends the request to a running server. Returns false if no server is listening on the socket, otherwise sets the exit code of the build.
+
+bool RunInServer(const std::string& socketPath, const GeneratorRequest& request, int& exitCode);
+
+bool StopServer(const std::string& socketPath);
+
+#endif // SOUL_GENERATOR_SERVER_INCLUDED
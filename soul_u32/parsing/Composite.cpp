@@ -4,6 +4,7 @@
 // =================================
 
 #include <soul_u32/parsing/Composite.hpp>
+#include <soul_u32/parsing/Primitive.hpp>
 #include <soul_u32/parsing/Scanner.hpp>
 #include <soul_u32/parsing/Visitor.hpp>
 #include <soul_u32/parsing/Exception.hpp>
@@ -44,6 +45,15 @@ PositiveParser::PositiveParser(Parser* child_): UnaryParser(U"positive", child_,
 
 Match PositiveParser::Parse(Scanner& scanner, ObjectStack& stack, ParsingData* parsingData)
 {
+    if (Child()->IsCharSetParser() && !scanner.SkipperActive())
+    {
+        int length = static_cast<CharSetParser*>(Child())->ParseRun(scanner);
+        if (length > 0)
+        {
+            return Match(true, length);
+        }
+        return Match::Nothing();
+    }
     Match match = Child()->Parse(scanner, stack, parsingData);
     if (match.Hit())
     {
@@ -79,6 +89,10 @@ KleeneStarParser::KleeneStarParser(Parser* child_): UnaryParser(U"kleene", child
 
 Match KleeneStarParser::Parse(Scanner& scanner, ObjectStack& stack, ParsingData* parsingData)
 {
+    if (Child()->IsCharSetParser() && !scanner.SkipperActive())
+    {
+        return Match(true, static_cast<CharSetParser*>(Child())->ParseRun(scanner));
+    }
     Match match = Match::Empty();
     bool first = true;
     for (;;)
@@ -96,4 +96,9 @@ void ExpectationFailure::CombineInfo(const std::u32string& parentInfo)
     info = parentInfo + info;
 }
 
+ParsingLimitExceeded::ParsingLimitExceeded(ParsingLimit limit_, const std::string& fileName_, const Span& span_, const char32_t* start, const char32_t* end) :
+    ParsingException("parsing aborted (" + ParsingLimitStr(limit_) + ")", fileName_, span_, start, end), limit(limit_)
+{
+}
+
 } } // namespace soul::parsing
@@ -41,6 +41,15 @@ private:
     std::u32string info;
 };
 
+class ParsingLimitExceeded : public ParsingException
+{
+public:
+    ParsingLimitExceeded(ParsingLimit limit_, const std::string& fileName_, const Span& span_, const char32_t* start, const char32_t* end);
+    ParsingLimit Limit() const { return limit; }
+private:
+    ParsingLimit limit;
+};
+
 } } // namespace soul::parsing
 
 #endif // SOUL_PARSING_EXCEPTION_INCLUDED
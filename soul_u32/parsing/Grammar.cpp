@@ -13,6 +13,7 @@
 #include <soul_u32/parsing/Linking.hpp>
 #include <soul_u32/parsing/ParsingDomain.hpp>
 #include <soul_u32/util/Unicode.hpp>
+#include <algorithm>
 
 namespace soul { namespace parsing {
 
@@ -20,14 +21,14 @@ using namespace soul::util;
 using namespace soul::unicode;
 
 Grammar::Grammar(const std::u32string& name_, Scope* enclosingScope_): ParsingObject(name_, enclosingScope_), parsingDomain(new ParsingDomain()), ns(nullptr),
-    linking(false), linked(false), contentParser(nullptr), startRule(nullptr), skipRule(nullptr), log(0), maxLogLineLength(80)
+    linking(false), linked(false), contentParser(nullptr), startRule(nullptr), skipRule(nullptr), log(0), maxLogLineLength(80), rulesPerSegment(0), segmentSize(0)
 {
     RegisterParsingDomain(parsingDomain);
     SetScope(new Scope(Name(), EnclosingScope()));
 }
 
 Grammar::Grammar(const std::u32string& name_, Scope* enclosingScope_, ParsingDomain* parsingDomain_): ParsingObject(name_, enclosingScope_), parsingDomain(parsingDomain_), ns(nullptr), 
-    linking(false), linked(false), contentParser(nullptr), startRule(nullptr), skipRule(nullptr), log(0), maxLogLineLength(80)
+    linking(false), linked(false), contentParser(nullptr), startRule(nullptr), skipRule(nullptr), log(0), maxLogLineLength(80), rulesPerSegment(0), segmentSize(0)
 {
     SetScope(new Scope(Name(), EnclosingScope()));
 }
@@ -50,11 +51,16 @@ void Grammar::AddRule(Rule* rule)
 }
 
 Rule* Grammar::GetRule(const std::u32string& ruleName) const
+{
+    return GetRule(Symbol(ruleName));
+}
+
+Rule* Grammar::GetRule(Symbol ruleName) const
 {
     ParsingObject* object = GetScope()->Get(ruleName);
     if (!object)
     {
-        ThrowException("rule '" + ToUtf8(ruleName) + "' not found in grammar '" + ToUtf8(FullName()) + "'", GetSpan());
+        ThrowException("rule '" + ToUtf8(ruleName.Name()) + "' not found in grammar '" + ToUtf8(FullName()) + "'", GetSpan());
     }
     if (object->IsRule())
     {
@@ -70,21 +76,28 @@ Rule* Grammar::GetRule(const std::u32string& ruleName) const
         }
         else
         {
-            ThrowException("rule link '" + ToUtf8(ruleName) + "' not bound in grammar '" + ToUtf8(FullName()) + "'", GetSpan());
+            ThrowException("rule link '" + ToUtf8(ruleName.Name()) + "' not bound in grammar '" + ToUtf8(FullName()) + "'", GetSpan());
         }
     }
     else
     {
-        ThrowException("'" + ToUtf8(ruleName) + "' is not a rule or rule link", GetSpan());
+        ThrowException("'" + ToUtf8(ruleName.Name()) + "' is not a rule or rule link", GetSpan());
     }
     return nullptr;
 }
 
+void Grammar::SetStackSegmentation(int rulesPerSegment_, std::size_t segmentSize_)
+{
+    CheckStackSegmentation(rulesPerSegment_, segmentSize_);
+    rulesPerSegment = rulesPerSegment_;
+    segmentSize = segmentSize_;
+}
+
 void Grammar::Accept(Visitor& visitor)
 {
     visitor.BeginVisit(*this);
-    RuleLinkSetIt e = ruleLinks.cend();
-    for (RuleLinkSetIt i = ruleLinks.cbegin(); i != e; ++i)
+    RuleLinkVecIt e = ruleLinks.cend();
+    for (RuleLinkVecIt i = ruleLinks.cbegin(); i != e; ++i)
     {
         RuleLink* ruleLink = *i;
         ruleLink->Accept(visitor);
@@ -99,6 +112,11 @@ void Grammar::Accept(Visitor& visitor)
 }
 
 void Grammar::Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, ParsingData* parsingData)
+{
+    Parse(start, end, fileIndex, fileName, parsingData, nullptr);
+}
+
+void Grammar::Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, ParsingData* parsingData, const ParsingLimits* limits)
 {
     Scanner scanner(start, end, fileName, fileIndex, skipRule);
     scanner.SetParsingData(parsingData);
@@ -110,7 +128,7 @@ void Grammar::Parse(const char32_t* start, const char32_t* end, int fileIndex, c
         xmlLog->WriteBeginRule("parse");
     }
     ObjectStack stack;
-    Match match = Parse(scanner, stack, parsingData);
+    Match match = Parse(scanner, stack, parsingData, limits);
     Span stop = scanner.GetSpan();
     if (log)
     {
@@ -131,6 +149,16 @@ void Grammar::Parse(const char32_t* start, const char32_t* end, int fileIndex, c
 
 Match Grammar::Parse(Scanner& scanner, ObjectStack& stack, ParsingData* parsingData)
 {
+    return Parse(scanner, stack, parsingData, nullptr);
+}
+
+Match Grammar::Parse(Scanner& scanner, ObjectStack& stack, ParsingData* parsingData, const ParsingLimits* limits)
+{
+    if (parsingData)
+    {
+        parsingData->SetLimits(limits);
+        parsingData->SetStackSegmentation(rulesPerSegment, segmentSize);
+    }
     if (startRule)
     {
         if (!contentParser)
@@ -217,7 +245,10 @@ void Grammar::AddGrammarReference(Grammar* grammarReference)
 void Grammar::AddRuleLink(RuleLink* ruleLink)
 {
     Own(ruleLink);
-    ruleLinks.insert(ruleLink);
+    if (std::find(ruleLinks.cbegin(), ruleLinks.cend(), ruleLink) == ruleLinks.cend())
+    {
+        ruleLinks.push_back(ruleLink);
+    }
 }
 
 } } // namespace soul::parsing
@@ -29,12 +29,17 @@ public:
     void SetSkipRuleName(const std::u32string& skipRuleName_) { skipRuleName = skipRuleName_; }
     void AddRule(Rule* rule);
     Rule* GetRule(const std::u32string& ruleName) const;
+    Rule* GetRule(Symbol ruleName) const;
     virtual void GetReferencedGrammars() {}
     virtual void CreateRules() {}
     virtual void Link();
     void AddGrammarReference(Grammar* grammarReference);
     const GrammarSet& GrammarReferences() const { return grammarReferences; }
     void Accept(Visitor& visitor);
+    //  The overloads that take limits apply them to that parse only. Limits are set to the parsing data for each parse, so parsing data reused
+    //  from a parse with limits has no limits when the next parse is given none.
+    void Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, ParsingData* parsingData, const ParsingLimits* limits);
+    Match Parse(Scanner& scanner, ObjectStack& stack, ParsingData* parsingData, const ParsingLimits* limits);
     void Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, ParsingData* parsingData);
     Match Parse(Scanner& scanner, ObjectStack& stack, ParsingData* parsingData);
     void Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName);
@@ -47,6 +52,9 @@ public:
     void SetLog(std::ostream* log_) { log = log_; }
     int MaxLogLineLength() const { return maxLogLineLength; }
     void SetMaxLogLineLength(int maxLogLineLength_) { maxLogLineLength = maxLogLineLength_; }
+    void SetStackSegmentation(int rulesPerSegment_, std::size_t segmentSize_);
+    int RulesPerSegment() const { return rulesPerSegment; }
+    std::size_t SegmentSize() const { return segmentSize; }
     ParsingDomain* GetParsingDomain() const { return parsingDomain; }
     const RuleVec& Rules() const { return rules; }
     Namespace* Ns() const { return ns; }
@@ -65,13 +73,15 @@ private:
     bool linked;
     Parser* contentParser;
     GrammarSet grammarReferences;
-    typedef std::unordered_set<RuleLink*> RuleLinkSet;
-    typedef RuleLinkSet::const_iterator RuleLinkSetIt;
-    RuleLinkSet ruleLinks;
+    typedef std::vector<RuleLink*> RuleLinkVec;
+    typedef RuleLinkVec::const_iterator RuleLinkVecIt;
+    RuleLinkVec ruleLinks;
     Rule* startRule;
     Rule* skipRule;
     std::ostream* log;
     int maxLogLineLength;
+    int rulesPerSegment;
+    std::size_t segmentSize;
 };
 
 } } // namespace soul::parsing
@@ -6,6 +6,7 @@
 #include <soul_u32/parsing/InitDone.hpp>
 #include <soul_u32/parsing/ParsingDomain.hpp>
 #include <soul_u32/parsing/Keyword.hpp>
+#include <soul_u32/parsing/Symbol.hpp>
 #include <soul_u32/codedom/InitDone.hpp>
 
 namespace soul { namespace parsing {
@@ -13,6 +14,7 @@ namespace soul { namespace parsing {
 void Init()
 {
     soul::codedom::Init();
+    SymbolInit();
     ParsingDomainInit();
     KeywordInit();
 }
@@ -21,6 +23,7 @@ void Done()
 {
     KeywordDone();
     ParsingDomainDone();
+    SymbolDone();
     soul::codedom::Done();
 }
 
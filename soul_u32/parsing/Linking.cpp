@@ -50,7 +50,7 @@ void LinkerVisitor::Visit(RuleLink& link)
 {
     if (currentGrammar)
     {
-        ParsingObject* object = currentGrammar->GetScope()->Get(link.LinkedRuleName());
+        ParsingObject* object = currentGrammar->GetScope()->Get(link.LinkedRuleSymbol());
         if (object)
         {
             if (object->IsRule())
@@ -108,7 +108,7 @@ void LinkerVisitor::Visit(NonterminalParser& parser)
     {
         try
         {
-            Rule* rule = currentGrammar->GetRule(parser.RuleName());
+            Rule* rule = currentGrammar->GetRule(parser.RuleSymbol());
             parser.SetRule(rule);
             if (parser.Specialized())
             {
@@ -21,7 +21,8 @@ public:
     typedef std::vector<soul::codedom::CppObject*> ArgumentVector;
     NonterminalParser(const std::u32string& name_, const std::u32string& ruleName_);
     NonterminalParser(const std::u32string& name_, const std::u32string& ruleName_, int numberOfArguments_);
-    const std::u32string& RuleName() const { return ruleName; }
+    const std::u32string& RuleName() const { return ruleName.Name(); }
+    Symbol RuleSymbol() const { return ruleName; }
     const ArgumentVector& Arguments() const { return arguments; }
     Rule* GetRule() const { return rule; }
     void SetRule(Rule* rule_) { rule = rule_; }
@@ -41,7 +42,7 @@ public:
     virtual bool IsNonterminalParser() const { return true; }
 private:
     std::u32string name;
-    std::u32string ruleName;
+    Symbol ruleName;
     int numberOfArguments;
     ArgumentVector arguments;
     std::vector<std::unique_ptr<soul::codedom::CppObject>> ownedArgs;
@@ -4,6 +4,12 @@
 // =================================
 
 #include <soul_u32/parsing/ParsingData.hpp>
+#include <soul_u32/parsing/Exception.hpp>
+#include <boost/coroutine2/coroutine.hpp>
+#include <boost/coroutine2/fixedsize_stack.hpp>
+#include <boost/context/stack_traits.hpp>
+#include <limits>
+#include <stdexcept>
 
 namespace soul { namespace parsing {
 
@@ -11,9 +17,182 @@ Context::~Context()
 {
 }
 
-ParsingData::ParsingData(int numRules)
+std::string ParsingLimitStr(ParsingLimit limit)
+{
+    switch (limit)
+    {
+        case ParsingLimit::none: return "no limit exceeded";
+        case ParsingLimit::steps: return "step limit exceeded";
+        case ParsingLimit::deadline: return "deadline exceeded";
+        case ParsingLimit::depth: return "maximum depth exceeded";
+        case ParsingLimit::cancelled: return "cancelled";
+    }
+    return "";
+}
+
+ParsingLimits::ParsingLimits() : maxSteps(0), timeout(0), maxDepth(0), cancelled(false)
+{
+}
+
+ParsingData::ParsingData(int numRules) : 
+    limits(nullptr), steps(0), maxSteps(std::numeric_limits<int64_t>::max()), depth(0), maxDepth(std::numeric_limits<int>::max()), hasDeadline(false), deadline(),
+    rulesPerSegment(0), segmentDepth(0), segmentSize(0)
 {
     ruleData.resize(numRules);
 }
 
+void ParsingData::SetLimits(const ParsingLimits* limits_)
+{
+    limits = limits_;
+    steps = 0;
+    depth = 0;
+    maxSteps = std::numeric_limits<int64_t>::max();
+    maxDepth = std::numeric_limits<int>::max();
+    hasDeadline = false;
+    if (limits)
+    {
+        if (limits->MaxSteps() > 0)
+        {
+            maxSteps = limits->MaxSteps();
+        }
+        if (limits->MaxDepth() > 0)
+        {
+            maxDepth = limits->MaxDepth();
+        }
+        if (limits->Timeout().count() > 0)
+        {
+            hasDeadline = true;
+            deadline = std::chrono::steady_clock::now() + limits->Timeout();
+        }
+    }
+}
+
+void ParsingData::CheckLimits(const Scanner& scanner)
+{
+    ParsingLimit limit = ParsingLimit::none;
+    if (limits->Cancelled())
+    {
+        limit = ParsingLimit::cancelled;
+    }
+    else if (steps > maxSteps)
+    {
+        limit = ParsingLimit::steps;
+    }
+    else if (depth > maxDepth)
+    {
+        limit = ParsingLimit::depth;
+    }
+    else if (hasDeadline && std::chrono::steady_clock::now() >= deadline)
+    {
+        limit = ParsingLimit::deadline;
+    }
+    if (limit != ParsingLimit::none)
+    {
+        throw ParsingLimitExceeded(limit, scanner.FileName(), scanner.GetSpan(), scanner.Start(), scanner.End());
+    }
+}
+
+//  Stack segmentation bounds native stack usage of deeply nested parses: 
+//  after rulesPerSegment nested rule invocations the parse continues on a fresh heap-allocated stack segment of segmentSize bytes,
+//  so the maximum nesting depth is bounded by available memory, not by the size of the calling thread's stack.
+//  rulesPerSegment = 0 turns segmentation off.
+
+void CheckStackSegmentation(int rulesPerSegment, std::size_t segmentSize)
+{
+    if (rulesPerSegment < 0)
+    {
+        throw std::runtime_error("invalid stack segmentation: rules per segment " + std::to_string(rulesPerSegment) + " is negative");
+    }
+    if (rulesPerSegment > 0 && segmentSize < boost::context::stack_traits::minimum_size())
+    {
+        throw std::runtime_error("invalid stack segmentation: segment size " + std::to_string(segmentSize) + " is less than the minimum stack size " + 
+            std::to_string(boost::context::stack_traits::minimum_size()));
+    }
+}
+
+//  Segments that a parse has left are kept for reuse, so crossing a segment boundary allocates only when the parse is nested deeper than before.
+
+class StackSegmentPool
+{
+public:
+    StackSegmentPool(std::size_t segmentSize_) : segmentSize(segmentSize_) {}
+    StackSegmentPool(const StackSegmentPool&) = delete;
+    StackSegmentPool& operator=(const StackSegmentPool&) = delete;
+    ~StackSegmentPool()
+    {
+        for (boost::context::stack_context& segment : freeSegments)
+        {
+            boost::context::fixedsize_stack(segmentSize).deallocate(segment);
+        }
+    }
+    std::size_t SegmentSize() const { return segmentSize; }
+    boost::context::stack_context Allocate()
+    {
+        if (freeSegments.empty())
+        {
+            return boost::context::fixedsize_stack(segmentSize).allocate();
+        }
+        boost::context::stack_context segment = freeSegments.back();
+        freeSegments.pop_back();
+        return segment;
+    }
+    void Deallocate(boost::context::stack_context& segment)
+    {
+        freeSegments.push_back(segment);
+    }
+private:
+    std::size_t segmentSize;
+    std::vector<boost::context::stack_context> freeSegments;
+};
+
+//  Stack allocator of the coroutines: copies of it share the pool of the parsing data.
+
+class PooledStackAllocator
+{
+public:
+    PooledStackAllocator(StackSegmentPool& pool_) : pool(&pool_) {}
+    boost::context::stack_context allocate() { return pool->Allocate(); }
+    void deallocate(boost::context::stack_context& segment) { pool->Deallocate(segment); }
+private:
+    StackSegmentPool* pool;
+};
+
+ParsingData::~ParsingData()
+{
+}
+
+void ParsingData::SetStackSegmentation(int rulesPerSegment_, std::size_t segmentSize_)
+{
+    CheckStackSegmentation(rulesPerSegment_, segmentSize_);
+    rulesPerSegment = rulesPerSegment_;
+    segmentSize = segmentSize_;
+    segmentDepth = 0;
+    if (rulesPerSegment > 0 && (!segmentPool || segmentPool->SegmentSize() != segmentSize))
+    {
+        segmentPool.reset(new StackSegmentPool(segmentSize));
+    }
+}
+
+class StackSegmentDepthGuard
+{
+public:
+    StackSegmentDepthGuard(int& segmentDepth_) : segmentDepth(segmentDepth_), savedSegmentDepth(segmentDepth_) { segmentDepth = 0; }
+    ~StackSegmentDepthGuard() { segmentDepth = savedSegmentDepth; }
+private:
+    int& segmentDepth;
+    int savedSegmentDepth;
+};
+
+Match ParsingData::ParseInNewStackSegment(const std::function<Match()>& parse)
+{
+    typedef boost::coroutines2::coroutine<void> Segment;
+    StackSegmentDepthGuard guard(segmentDepth);
+    Match match = Match::Nothing();
+    Segment::pull_type segment(PooledStackAllocator(*segmentPool), [&](Segment::push_type&)
+    {
+        match = parse();
+    });
+    return match;
+}
+
 } } // namespace soul::parsing
@@ -5,13 +5,21 @@
 
 #ifndef SOUL_PARSING_PARSING_DATA_INCLUDED
 #define SOUL_PARSING_PARSING_DATA_INCLUDED
+#include <soul_u32/parsing/Match.hpp>
 #include <soul_u32/util/Error.hpp>
+#include <atomic>
+#include <chrono>
+#include <functional>
 #include <memory>
 #include <stack>
+#include <stdint.h>
+#include <string>
 #include <vector>
 
 namespace soul { namespace parsing {
 
+class Scanner;
+
 struct Context
 {
     virtual ~Context();
@@ -32,10 +40,47 @@ struct RuleData
     ContextStack contextStack;
 };
 
+enum class ParsingLimit : uint8_t
+{
+    none, steps, deadline, depth, cancelled
+};
+
+std::string ParsingLimitStr(ParsingLimit limit);
+
+//  ParsingLimits puts hard bounds on a parse of untrusted input. Zero value means unlimited.
+//  A step is one rule invocation. Cancel() may be called from any thread: it stops the parses that were given these limits.
+
+class ParsingLimits
+{
+public:
+    ParsingLimits();
+    int64_t MaxSteps() const { return maxSteps; }
+    void SetMaxSteps(int64_t maxSteps_) { maxSteps = maxSteps_; }
+    std::chrono::milliseconds Timeout() const { return timeout; }
+    void SetTimeout(std::chrono::milliseconds timeout_) { timeout = timeout_; }
+    int MaxDepth() const { return maxDepth; }
+    void SetMaxDepth(int maxDepth_) { maxDepth = maxDepth_; }
+    void Cancel() { cancelled.store(true, std::memory_order_relaxed); }
+    bool Cancelled() const { return cancelled.load(std::memory_order_relaxed); }
+    void ResetCancel() { cancelled.store(false, std::memory_order_relaxed); }
+private:
+    int64_t maxSteps;
+    std::chrono::milliseconds timeout;
+    int maxDepth;
+    std::atomic<bool> cancelled;
+};
+
+//  Throws if rulesPerSegment is negative, or if segmentation is on and segmentSize is smaller than the minimum coroutine stack size.
+
+void CheckStackSegmentation(int rulesPerSegment, std::size_t segmentSize);
+
+class StackSegmentPool;
+
 class ParsingData
 {
 public:
     ParsingData(int numRules);
+    ~ParsingData();
     void PushContext(int ruleId, Context* context) 
     { 
         Assert(ruleId >= 0 && ruleId < ruleData.size(), "invalid rule id"); 
@@ -52,8 +97,44 @@ public:
         Assert(ruleId >= 0 && ruleId < ruleData.size(), "invalid rule id"); 
         return ruleData[ruleId].context.get();  
     }
+    const ParsingLimits* Limits() const { return limits; }
+    //  Starts the limits of a new parse: the step and depth counts and the deadline start over. Null means no limits.
+    void SetLimits(const ParsingLimits* limits_);
+    void EnterRule(const Scanner& scanner)
+    {
+        if (!limits) return;
+        ++steps;
+        ++depth;
+        if (steps > maxSteps || depth > maxDepth || limits->Cancelled() || (hasDeadline && (steps & deadlineCheckMask) == 0))
+        {
+            CheckLimits(scanner);
+        }
+    }
+    void LeaveRule()
+    {
+        if (!limits) return;
+        --depth;
+    }
+    int64_t Steps() const { return steps; }
+    void SetStackSegmentation(int rulesPerSegment_, std::size_t segmentSize_);
+    bool NeedsNewStackSegment() { return rulesPerSegment > 0 && ++segmentDepth > rulesPerSegment; }
+    void LeaveStackSegmentRule() { if (rulesPerSegment > 0) --segmentDepth; }
+    Match ParseInNewStackSegment(const std::function<Match()>& parse);
 private:
     std::vector<RuleData> ruleData;
+    static const int64_t deadlineCheckMask = 1023;
+    const ParsingLimits* limits;
+    int64_t steps;
+    int64_t maxSteps;
+    int depth;
+    int maxDepth;
+    bool hasDeadline;
+    std::chrono::steady_clock::time_point deadline;
+    int rulesPerSegment;
+    int segmentDepth;
+    std::size_t segmentSize;
+    std::unique_ptr<StackSegmentPool> segmentPool;
+    void CheckLimits(const Scanner& scanner);
 };
 
 } } // namespace soul::parsing
@@ -71,7 +71,7 @@ ParsingDomain::ParsingDomain(): ParsingObject(U"parsingDomain"),
 {
     Own(globalNamespace);
     globalScope->SetNs(globalNamespace);
-    namespaceMap[currentNamespace->FullName()] = currentNamespace;
+    namespaceMap[Symbol(currentNamespace->FullName())] = currentNamespace;
 }
 
 Scope* ParsingDomain::CurrentScope() const 
@@ -83,7 +83,8 @@ void ParsingDomain::BeginNamespace(const std::u32string& ns)
 {
     std::u32string fullNamespaceName = currentNamespace->FullName().empty() ? ns : currentNamespace->FullName() + U"." + ns;
     namespaceStack.push(currentNamespace);
-    NamespaceMapIt i = namespaceMap.find(fullNamespaceName);
+    Symbol fullNamespaceSymbol(fullNamespaceName);
+    NamespaceMapIt i = namespaceMap.find(fullNamespaceSymbol);
     if (i != namespaceMap.end())
     {
         currentNamespace = i->second;
@@ -93,7 +94,7 @@ void ParsingDomain::BeginNamespace(const std::u32string& ns)
         Namespace* newNs(new Namespace(fullNamespaceName, globalScope));
         Own(newNs);
         newNs->GetScope()->SetNs(newNs);
-        namespaceMap[newNs->FullName()] = newNs;
+        namespaceMap[fullNamespaceSymbol] = newNs;
         currentNamespace = newNs;
         globalScope->AddNamespace(newNs);
     }
@@ -122,6 +123,11 @@ Scope* ParsingDomain::GetNamespaceScope(const std::u32string& fullNamespaceName)
 }
 
 Grammar* ParsingDomain::GetGrammar(const std::u32string& grammarName)
+{
+    return GetGrammar(Symbol(grammarName));
+}
+
+Grammar* ParsingDomain::GetGrammar(Symbol grammarName)
 {
     GrammarMapIt i = grammarMap.find(grammarName);
     if (i != grammarMap.end())
@@ -134,7 +140,7 @@ Grammar* ParsingDomain::GetGrammar(const std::u32string& grammarName)
 void ParsingDomain::AddGrammar(Grammar* grammar)
 {
     Own(grammar);
-    std::u32string grammarFullName = grammar->FullName();
+    Symbol grammarFullName(grammar->FullName());
     GrammarMapIt i = grammarMap.find(grammarFullName);
     if (i == grammarMap.end())
     {
@@ -144,9 +150,22 @@ void ParsingDomain::AddGrammar(Grammar* grammar)
     }
 }
 
+//  Removes the grammar from its namespace and deletes it. Used to return a parsing domain to the state it had before the grammar was added,
+//  so no other grammar of the domain may refer to it.
+
+void ParsingDomain::RemoveGrammar(Grammar* grammar)
+{
+    grammarMap.erase(Symbol(grammar->FullName()));
+    if (grammar->EnclosingScope())
+    {
+        grammar->EnclosingScope()->Remove(grammar);
+    }
+    DeleteOwned(grammar);
+}
+
 void ParsingDomain::Accept(Visitor& visitor)
 {
-    for (const std::pair<std::u32string, Grammar*>& p : grammarMap)
+    for (const auto& p : grammarMap)
     {
         Grammar* grammar = p.second;
         grammar->Accept(visitor);
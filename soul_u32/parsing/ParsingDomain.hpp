@@ -22,7 +22,9 @@ public:
     ParsingDomain();
     Scope* GetNamespaceScope(const std::u32string& fullNamespaceName);
     Grammar* GetGrammar(const std::u32string& grammarName);
+    Grammar* GetGrammar(Symbol grammarName);
     void AddGrammar(Grammar* grammar);
+    void RemoveGrammar(Grammar* grammar);
     void BeginNamespace(const std::u32string& ns);
     void EndNamespace();
     Namespace* GlobalNamespace() const { return globalNamespace; }
@@ -32,12 +34,12 @@ public:
     int GetNextRuleId() { return nextRuleId++; }
     int GetNumRules() const { return nextRuleId; }
 private:
-    typedef std::unordered_map<std::u32string, Grammar*> GrammarMap;
+    typedef std::unordered_map<Symbol, Grammar*> GrammarMap;
     typedef GrammarMap::const_iterator GrammarMapIt;
     GrammarMap grammarMap;
     Namespace* globalNamespace;
     Scope* globalScope;
-    typedef std::unordered_map<std::u32string, Namespace*> NamespaceMap;
+    typedef std::unordered_map<Symbol, Namespace*> NamespaceMap;
     typedef NamespaceMap::const_iterator NamespaceMapIt;
     NamespaceMap namespaceMap;
     std::stack<Namespace*> namespaceStack;
@@ -34,9 +34,9 @@ std::u32string ParsingObject::FullName() const
     }
     if (scopeName.empty())
     {
-        return name;
+        return Name();
     }
-    return scopeName + U"." + name;
+    return scopeName + U"." + Name();
 }
 
 void ParsingObject::Own(ParsingObject* object)
@@ -51,6 +51,18 @@ void ParsingObject::Own(ParsingObject* object)
     }
 }
 
+void ParsingObject::DeleteOwned(ParsingObject* object)
+{
+    for (std::vector<std::unique_ptr<ParsingObject>>::iterator i = ownedObjects.begin(); i != ownedObjects.end(); ++i)
+    {
+        if (i->get() == object)
+        {
+            ownedObjects.erase(i);
+            return;
+        }
+    }
+}
+
 void ParsingObject::SetScope(Scope* scope_)
 {
     scope = scope_;
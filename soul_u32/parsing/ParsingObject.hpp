@@ -6,6 +6,7 @@
 #ifndef SOUL_PARSING_PARSING_OBJECT_INCLUDED
 #define SOUL_PARSING_PARSING_OBJECT_INCLUDED
 #include <soul_u32/parsing/Scanner.hpp>
+#include <soul_u32/parsing/Symbol.hpp>
 #include <memory>
 
 namespace soul { namespace parsing {
@@ -22,6 +23,7 @@ public:
     virtual ~ParsingObject();
     virtual void Accept(Visitor& visitor) = 0;
     void Own(ParsingObject* object);
+    void DeleteOwned(ParsingObject* object);
     bool IsOwned() const { return isOwned; }
     void SetOwned() { isOwned = true; }
     void ResetOwned() { isOwned = false; }
@@ -29,8 +31,9 @@ public:
     int Owner() const { return owner; }
     void SetExternal() { owner = external; }
     bool IsExternal() const { return owner == external; }
-    const std::u32string& Name() const { return name; }
-    void SetName(const std::u32string& name_) { name = name_; }
+    const std::u32string& Name() const { return name.Name(); }
+    Symbol NameSymbol() const { return name; }
+    void SetName(const std::u32string& name_) { name = Symbol(name_); }
     virtual std::u32string FullName() const;
     Scope* EnclosingScope() const { return enclosingScope; }
     void SetEnclosingScope(Scope* enclosingScope_) { enclosingScope = enclosingScope_; }
@@ -38,6 +41,7 @@ public:
     Scope* GetScope() const { if (scope == nullptr) return enclosingScope; else return scope; }
     virtual bool IsActionParser() const { return false; }
     virtual bool IsNonterminalParser() const { return false; }
+    virtual bool IsCharSetParser() const { return false; }
     virtual bool IsRule() const { return false; }
     virtual bool IsRuleLink() const { return false; }
     virtual bool IsNamespace() const { return false; }
@@ -45,7 +49,7 @@ public:
     void SetSpan(const Span& span_) { span = span_; }
     const Span& GetSpan() const { return span; }
 private:
-    std::u32string name;
+    Symbol name;
     std::vector<std::unique_ptr<ParsingObject>> ownedObjects;
     int owner;
     bool isOwned;
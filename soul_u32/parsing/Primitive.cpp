@@ -103,23 +103,29 @@ void CharSetParser::InitRanges()
         }
         ranges.push_back(CharRange(first, last));
     }
+    for (char32_t c = 0; c < 128; ++c)
+    {
+        asciiChars[c] = MatchesNonAscii(c);
+    }
 }
 
-Match CharSetParser::Parse(Scanner& scanner, ObjectStack& stack, ParsingData* parsingData)
+bool CharSetParser::MatchesNonAscii(char32_t c) const
 {
-    if (!scanner.AtEnd())
+    for (const CharRange& range : ranges)
     {
-        char32_t c = scanner.GetChar();
-        bool found = false;
-        for (const CharRange& range : ranges)
+        if (range.Includes(c))
         {
-            if (range.Includes(c))
-            {
-                found = true;
-                break;
-            }
+            return !inverse;
         }
-        if (found != inverse)
+    }
+    return inverse;
+}
+
+Match CharSetParser::Parse(Scanner& scanner, ObjectStack& stack, ParsingData* parsingData)
+{
+    if (!scanner.AtEnd())
+    {
+        if (Matches(scanner.GetChar()))
         {
             ++scanner;
             return Match::One();
@@ -128,6 +134,20 @@ Match CharSetParser::Parse(Scanner& scanner, ObjectStack& stack, ParsingData* pa
     return Match::Nothing();
 }
 
+int CharSetParser::ParseRun(Scanner& scanner) const
+{
+    const char32_t* runStart = scanner.Start() + scanner.GetSpan().Start();
+    const char32_t* runEnd = runStart;
+    const char32_t* end = scanner.End();
+    while (runEnd < end && Matches(*runEnd))
+    {
+        ++runEnd;
+    }
+    int length = int(runEnd - runStart);
+    scanner.Advance(length);
+    return length;
+}
+
 void CharSetParser::Accept(Visitor& visitor)
 {
     visitor.Visit(*this);
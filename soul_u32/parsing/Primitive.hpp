@@ -51,13 +51,27 @@ public:
     CharSetParser(const std::u32string& s_, bool inverse_);
     const std::u32string& Set() const { return s; }
     bool Inverse() const { return inverse; }
-    virtual Match Parse(Scanner& scanner, ObjectStack& stack, ParsingData* parsingData);
+    virtual bool IsCharSetParser() const { return true; }
+    bool Matches(char32_t c) const
+    {
+        if (c < 128)
+        {
+            return asciiChars[c];
+        }
+        return MatchesNonAscii(c);
+    }
+    virtual Match Parse(Scanner& scanner, ObjectStack& stack, ParsingData* parsingData);
+    //  Matches the longest run of characters in the set starting at the current position in one loop and returns its length.
+    //  KleeneStarParser and PositiveParser use it for [...]* and [...]+ when there is nothing to skip between the characters.
+    int ParseRun(Scanner& scanner) const;
     virtual void Accept(Visitor& visitor);
 private:
     std::u32string s;
     bool inverse;
     std::vector<CharRange> ranges;
+    std::bitset<128> asciiChars;
     void InitRanges();
+    bool MatchesNonAscii(char32_t c) const;
 };
 
 class EmptyParser : public Parser
@@ -205,9 +205,32 @@ Match Rule::Parse(Scanner& scanner, ObjectStack& stack, ParsingData* parsingData
         scanner.Log()->IncIndent();
     }
     int startIndex = scanner.GetSpan().Start();
+    if (parsingData)
+    {
+        parsingData->EnterRule(scanner);
+    }
     Enter(stack, parsingData);
-    Match match = definition ? definition->Parse(scanner, stack, parsingData) : Match::Nothing();
+    Match match = Match::Nothing();
+    if (definition)
+    {
+        if (parsingData && parsingData->NeedsNewStackSegment())
+        {
+            match = parsingData->ParseInNewStackSegment([&]() { return definition->Parse(scanner, stack, parsingData); });
+        }
+        else
+        {
+            match = definition->Parse(scanner, stack, parsingData);
+        }
+        if (parsingData)
+        {
+            parsingData->LeaveStackSegmentRule();
+        }
+    }
     Leave(stack, parsingData, match.Hit());
+    if (parsingData)
+    {
+        parsingData->LeaveRule();
+    }
     if (writeToLog)
     {
         scanner.Log()->DecIndent();
@@ -236,43 +259,23 @@ void Rule::Accept(Visitor& visitor)
     visitor.EndVisit(*this);
 }
 
-std::u32string GetPrefix(const std::u32string& fullName)
+Symbol QualifyStdLibRuleName(Symbol linkedRuleName)
 {
-    std::u32string::size_type dotPos = fullName.find('.');
-    if (dotPos != std::u32string::npos)
+    if (linkedRuleName.Prefix() == Symbol(U"stdlib"))
     {
-        return fullName.substr(0, dotPos);
+        return Symbol(U"soul.parsing.stdlib." + linkedRuleName.CommonName().Name());
     }
-    return fullName;
-}
-
-std::u32string GetCommonName(const std::u32string& qualifiedId)
-{
-    std::u32string::size_type lastDotPos = qualifiedId.rfind('.');
-    if (lastDotPos != std::u32string::npos)
-    {
-        return qualifiedId.substr(lastDotPos + 1);
-    }
-    return qualifiedId;
+    return linkedRuleName;
 }
 
 RuleLink::RuleLink(const std::u32string& name_, Grammar* grammar_, const std::u32string& linkedRuleName_): 
-    ParsingObject(name_, grammar_->GetScope()), linkedRuleName(linkedRuleName_), grammar(grammar_)
+    ParsingObject(name_, grammar_->GetScope()), linkedRuleName(QualifyStdLibRuleName(Symbol(linkedRuleName_))), grammar(grammar_)
 {
-    std::u32string prefix = GetPrefix(linkedRuleName);
-    if (prefix == U"stdlib")
-    {
-        linkedRuleName = U"soul.parsing.stdlib." + GetCommonName(linkedRuleName);
-    }
 }
 
-RuleLink::RuleLink(Grammar* grammar_, const std::u32string& linkedRuleName_): ParsingObject(GetCommonName(linkedRuleName_), grammar_->GetScope()), linkedRuleName(linkedRuleName_), grammar(grammar_)
+RuleLink::RuleLink(Grammar* grammar_, const std::u32string& linkedRuleName_): 
+    ParsingObject(Symbol(linkedRuleName_).CommonName().Name(), grammar_->GetScope()), linkedRuleName(QualifyStdLibRuleName(Symbol(linkedRuleName_))), grammar(grammar_)
 {
-    std::u32string prefix = GetPrefix(linkedRuleName);
-    if (prefix == U"stdlib")
-    {
-        linkedRuleName = U"soul.parsing.stdlib." + GetCommonName(linkedRuleName);
-    }
 }
 
 void RuleLink::AddToScope()
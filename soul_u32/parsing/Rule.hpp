@@ -74,6 +74,37 @@ private:
     NonterminalVec nonterminals;
 };
 
+//  Helpers used by the generated rule classes to pass attribute values through the object stack and to manage rule contexts.
+//  Keeping them here instead of expanding them in every generated rule makes the generated code smaller and faster to compile.
+
+template<typename ValueType>
+inline void PushValue(ObjectStack& stack, const ValueType& value)
+{
+    stack.push(std::unique_ptr<Object>(new ValueObject<ValueType>(value)));
+}
+
+template<typename ValueType>
+inline ValueType PopValue(ObjectStack& stack)
+{
+    std::unique_ptr<Object> value = std::move(stack.top());
+    stack.pop();
+    return *static_cast<ValueObject<ValueType>*>(value.get());
+}
+
+template<typename ContextType>
+inline ContextType* PushContext(ParsingData* parsingData, int ruleId)
+{
+    ContextType* context = new ContextType();
+    parsingData->PushContext(ruleId, context);
+    return context;
+}
+
+template<typename ContextType>
+inline ContextType* GetContext(ParsingData* parsingData, int ruleId)
+{
+    return static_cast<ContextType*>(parsingData->GetContext(ruleId));
+}
+
 class RuleLink: public ParsingObject
 {
 public:
@@ -82,11 +113,12 @@ public:
     virtual bool IsRuleLink() const { return true; }
     virtual void Accept(Visitor& visitor);
     virtual void AddToScope();
-    const std::u32string& LinkedRuleName() const { return linkedRuleName; }
+    const std::u32string& LinkedRuleName() const { return linkedRuleName.Name(); }
+    Symbol LinkedRuleSymbol() const { return linkedRuleName; }
     void SetRule(Rule* rule_) { rule = rule_; }
     Rule* GetRule() const { return rule; }
 private:
-    std::u32string linkedRuleName;
+    Symbol linkedRuleName;
     Grammar* grammar;
     Rule* rule;
 };
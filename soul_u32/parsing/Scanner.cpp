@@ -69,6 +69,29 @@ void Scanner::operator++()
     }
 }
 
+void Scanner::Advance(int count)
+{
+    if (countSourceLines)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            operator++();
+        }
+        return;
+    }
+    const char32_t* p = start + span.Start();
+    int numNewLines = int(std::count(p, p + count, '\n'));
+    if (numNewLines > 0)
+    {
+        atBeginningOfLine = true;
+        for (int i = 0; i < numNewLines; ++i)
+        {
+            span.IncLineNumber();
+        }
+    }
+    span.Advance(count);
+}
+
 void Scanner::Skip()
 {
     if (tokenCounter == 0 && skipper)
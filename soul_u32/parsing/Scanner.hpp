@@ -44,6 +44,11 @@ public:
         --end;
     }
     void SetEnd(int32_t end_) { end = end_; }
+    void Advance(int32_t count)
+    {
+        start += count;
+        end += count;
+    }
     bool IsNull() const { return fileIndex == 0 && lineNumber == 0 && start == 0 && end == 0; }
 private:
     int32_t fileIndex;
@@ -66,10 +71,12 @@ public:
     const char32_t* End() const { return end; }
     char32_t GetChar() const { return start[span.Start()]; }
     void operator++();
+    void Advance(int count);
     bool AtEnd() const { return start + span.Start() >= end; }
     void BeginToken() { ++tokenCounter; }
     void EndToken() { --tokenCounter; }
     void Skip();
+    bool SkipperActive() const { return tokenCounter == 0 && skipper != nullptr; }
     const std::string& FileName() const { return fileName; }
     const Span& GetSpan() const { return span; }
     void SetSpan(const Span& span_) { span = span_; }
@@ -44,15 +44,15 @@ void Scope::Accept(Visitor& visitor)
 void Scope::Add(ParsingObject* object)
 {
     Own(object);
-    std::u32string objectFullName = object->FullName();
+    Symbol objectFullName(object->FullName());
     if (!fullNameMap.insert(std::make_pair(objectFullName, object)).second)
     {
-        std::u32string msg = U"object '" + objectFullName + U"' already exists (detected in scope '" + FullName() + U"')";
+        std::u32string msg = U"object '" + objectFullName.Name() + U"' already exists (detected in scope '" + FullName() + U"')";
         throw std::runtime_error(ToUtf8(msg));
     }
-    if (!shortNameMap.insert(std::make_pair(object->Name(), object)).second)
+    if (!shortNameMap.insert(std::make_pair(object->NameSymbol(), object)).second)
     {
-        std::u32string msg = U"object '" + objectFullName + U"' already exists (detected in scope '" + FullName() + U"')";
+        std::u32string msg = U"object '" + objectFullName.Name() + U"' already exists (detected in scope '" + FullName() + U"')";
         throw std::runtime_error(ToUtf8(msg));
     }
 }
@@ -67,21 +67,24 @@ Scope* Scope::GetGlobalScope() const
     return globalScope;
 }
 
+void Scope::Remove(ParsingObject* object)
+{
+    fullNameMap.erase(Symbol(object->FullName()));
+    shortNameMap.erase(object->NameSymbol());
+}
+
 void Scope::AddNamespace(Namespace* nsToAdd)
 {
     Own(nsToAdd);
     Namespace* parent = GetGlobalScope()->Ns();
-    std::vector<std::u32string> nameComponents = soul::util::Split(nsToAdd->FullName(), '.');
-    if (nameComponents.empty())
-    {
-        throw std::runtime_error("namespace components empty");
-    }
-    int n = int(nameComponents.size());
+    Symbol nsFullName(nsToAdd->FullName());
+    int n = nsFullName.NumComponents();
     for (int i = 0; i < n - 1; ++i)
     {
-        const std::u32string& namespaceName = nameComponents[i];
+        Symbol namespaceSymbol = nsFullName.Component(i);
+        const std::u32string& namespaceName = namespaceSymbol.Name();
         Scope* parentScope = parent->GetScope();
-        ParsingObject* object = parentScope->Get(namespaceName);
+        ParsingObject* object = parentScope->Get(namespaceSymbol);
         if (object)
         {
             if (object->IsNamespace())
@@ -102,7 +105,7 @@ void Scope::AddNamespace(Namespace* nsToAdd)
             parentScope->Add(parent);
         }
     }
-    std::u32string commonName = nameComponents[n - 1];
+    const std::u32string& commonName = nsFullName.CommonName().Name();
     nsToAdd->SetName(commonName);
     nsToAdd->GetScope()->SetName(commonName);
     nsToAdd->SetEnclosingScope(parent->GetScope());
@@ -110,16 +113,15 @@ void Scope::AddNamespace(Namespace* nsToAdd)
     parent->GetScope()->Add(nsToAdd);
 }
 
-ParsingObject* Scope::GetQualifiedObject(const std::u32string& qualifiedObjectName) const
+ParsingObject* Scope::GetQualifiedObject(Symbol qualifiedObjectName) const
 {
-    std::vector<std::u32string> components = soul::util::Split(qualifiedObjectName, '.');
-    int n = int(components.size());
+    int n = qualifiedObjectName.NumComponents();
     Scope* s = const_cast<Scope*>(this);
     while (s)
     {
         Scope* subScope = s;
         int i = 0;
-        ShortNameMapIt it = subScope->shortNameMap.find(components[i]);
+        ShortNameMapIt it = subScope->shortNameMap.find(qualifiedObjectName.Component(i));
         while (it != subScope->shortNameMap.end())
         {
             ParsingObject* object = it->second;
@@ -129,7 +131,7 @@ ParsingObject* Scope::GetQualifiedObject(const std::u32string& qualifiedObjectNa
             }
             ++i;
             subScope = object->GetScope();
-            it = subScope->shortNameMap.find(components[i]);
+            it = subScope->shortNameMap.find(qualifiedObjectName.Component(i));
         }
         s = s->EnclosingScope();
     }
@@ -138,7 +140,12 @@ ParsingObject* Scope::GetQualifiedObject(const std::u32string& qualifiedObjectNa
 
 ParsingObject* Scope::Get(const std::u32string& objectName) const
 {
-    if (objectName.find('.') != std::string::npos)
+    return Get(Symbol(objectName));
+}
+
+ParsingObject* Scope::Get(Symbol objectName) const
+{
+    if (objectName.NumComponents() > 1)
     {
         FullNameMapIt i = fullNameMap.find(objectName);
         if (i != fullNameMap.end())
@@ -166,6 +173,11 @@ ParsingObject* Scope::Get(const std::u32string& objectName) const
 }
 
 Namespace* Scope::GetNamespace(const std::u32string& fullNamespaceName) const
+{
+    return GetNamespace(Symbol(fullNamespaceName));
+}
+
+Namespace* Scope::GetNamespace(Symbol fullNamespaceName) const
 {
     ParsingObject* object = GetQualifiedObject(fullNamespaceName);
     if (object)
@@ -176,7 +188,7 @@ Namespace* Scope::GetNamespace(const std::u32string& fullNamespaceName) const
         }
         else
         {
-            throw std::runtime_error("object '" + ToUtf8(fullNamespaceName) + "' is not a namespace");
+            throw std::runtime_error("object '" + ToUtf8(fullNamespaceName.Name()) + "' is not a namespace");
         }
     }
     return nullptr;
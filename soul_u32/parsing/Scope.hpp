@@ -21,20 +21,23 @@ public:
     void SetNs(Namespace* ns_) { ns = ns_; }
     Namespace* Ns() const { return ns; }
     void Add(ParsingObject* object);
+    void Remove(ParsingObject* object);
     void AddNamespace(Namespace* ns);
     ParsingObject* Get(const std::u32string& objectName) const;
+    ParsingObject* Get(Symbol objectName) const;
     Namespace* GetNamespace(const std::u32string& fullNamespaceName) const;
+    Namespace* GetNamespace(Symbol fullNamespaceName) const;
 private:
     Namespace* ns;
     mutable bool fullNameComputed;
     mutable std::u32string fullName;
-    typedef std::unordered_map<std::u32string, ParsingObject*> FullNameMap;
+    typedef std::unordered_map<Symbol, ParsingObject*> FullNameMap;
     typedef FullNameMap::const_iterator FullNameMapIt;
     FullNameMap fullNameMap;
-    typedef std::unordered_map<std::u32string, ParsingObject*> ShortNameMap;
+    typedef std::unordered_map<Symbol, ParsingObject*> ShortNameMap;
     typedef ShortNameMap::const_iterator ShortNameMapIt;
     ShortNameMap shortNameMap;
-    ParsingObject* GetQualifiedObject(const std::u32string& qualifiedObjectName) const;
+    ParsingObject* GetQualifiedObject(Symbol qualifiedObjectName) const;
     Scope* GetGlobalScope() const;
 };
 
@@ -0,0 +1,118 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <soul_u32/parsing/Symbol.hpp>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace soul { namespace parsing {
+
+SymbolData::SymbolData(const std::u32string& name_, uint32_t id_) : name(name_), id(id_)
+{
+    components.push_back(this);
+}
+
+const SymbolData emptySymbolData(U"", 0);
+
+class SymbolTable
+{
+public:
+    static void Init();
+    static void Done();
+    static SymbolTable& Instance();
+    const SymbolData* Intern(const std::u32string& name);
+private:
+    SymbolTable();
+    static std::unique_ptr<SymbolTable> instance;
+    static int initCount;
+    std::mutex mtx;
+    typedef std::unordered_map<std::u32string, std::unique_ptr<SymbolData>> SymbolMap;
+    typedef SymbolMap::const_iterator SymbolMapIt;
+    SymbolMap symbolMap;
+    uint32_t nextId;
+    const SymbolData* InternUnlocked(const std::u32string& name);
+};
+
+SymbolTable::SymbolTable() : nextId(1)
+{
+}
+
+int SymbolTable::initCount = 0;
+
+std::unique_ptr<SymbolTable> SymbolTable::instance;
+
+void SymbolTable::Init()
+{
+    if (initCount++ == 0)
+    {
+        instance.reset(new SymbolTable());
+    }
+}
+
+void SymbolTable::Done()
+{
+    if (--initCount == 0)
+    {
+        instance.reset();
+    }
+}
+
+SymbolTable& SymbolTable::Instance()
+{
+    return *instance;
+}
+
+const SymbolData* SymbolTable::Intern(const std::u32string& name)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    return InternUnlocked(name);
+}
+
+const SymbolData* SymbolTable::InternUnlocked(const std::u32string& name)
+{
+    if (name.empty())
+    {
+        return &emptySymbolData;
+    }
+    SymbolMapIt i = symbolMap.find(name);
+    if (i != symbolMap.cend())
+    {
+        return i->second.get();
+    }
+    std::unique_ptr<SymbolData> data(new SymbolData(name, nextId++));
+    std::u32string::size_type dotPos = name.find('.');
+    if (dotPos != std::u32string::npos)
+    {
+        data->components.clear();
+        std::u32string::size_type start = 0;
+        while (dotPos != std::u32string::npos)
+        {
+            data->components.push_back(InternUnlocked(name.substr(start, dotPos - start)));
+            start = dotPos + 1;
+            dotPos = name.find('.', start);
+        }
+        data->components.push_back(InternUnlocked(name.substr(start)));
+    }
+    const SymbolData* result = data.get();
+    symbolMap[name] = std::move(data);
+    return result;
+}
+
+Symbol::Symbol(const std::u32string& name) : data(SymbolTable::Instance().Intern(name))
+{
+}
+
+void SymbolInit()
+{
+    SymbolTable::Init();
+}
+
+void SymbolDone()
+{
+    SymbolTable::Done();
+}
+
+} } // namespace soul::parsing
@@ -0,0 +1,79 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#ifndef SOUL_PARSING_SYMBOL_INCLUDED
+#define SOUL_PARSING_SYMBOL_INCLUDED
+#include <string>
+#include <vector>
+#include <functional>
+#include <stdint.h>
+
+namespace soul { namespace parsing {
+
+struct SymbolData
+{
+    SymbolData(const std::u32string& name_, uint32_t id_);
+    std::u32string name;
+    uint32_t id;
+    std::vector<const SymbolData*> components;
+};
+
+extern const SymbolData emptySymbolData;
+
+//  Symbol is an interned name: equal names are interned to the same symbol, so comparing and hashing symbols are integer operations.
+//  When a dotted name is interned its components are interned too, so qualified lookups do not split or concatenate strings.
+//  Interned names live until the parsing library is shut down.
+
+class Symbol
+{
+public:
+    Symbol() : data(&emptySymbolData) {}
+    explicit Symbol(const std::u32string& name);
+    const std::u32string& Name() const { return data->name; }
+    uint32_t Id() const { return data->id; }
+    bool IsEmpty() const { return data == &emptySymbolData; }
+    int NumComponents() const { return int(data->components.size()); }
+    Symbol Component(int index) const { return Symbol(data->components[index]); }
+    Symbol Prefix() const { return Symbol(data->components.front()); }
+    Symbol CommonName() const { return Symbol(data->components.back()); }
+private:
+    explicit Symbol(const SymbolData* data_) : data(data_) {}
+    const SymbolData* data;
+};
+
+inline bool operator==(Symbol left, Symbol right)
+{
+    return left.Id() == right.Id();
+}
+
+inline bool operator!=(Symbol left, Symbol right)
+{
+    return left.Id() != right.Id();
+}
+
+inline bool operator<(Symbol left, Symbol right)
+{
+    return left.Id() < right.Id();
+}
+
+void SymbolInit();
+void SymbolDone();
+
+} } // namespace soul::parsing
+
+namespace std {
+
+template<>
+struct hash<soul::parsing::Symbol>
+{
+    size_t operator()(soul::parsing::Symbol symbol) const
+    {
+        return symbol.Id();
+    }
+};
+
+} // namespace std
+
+#endif // SOUL_PARSING_SYMBOL_INCLUDED
@@ -0,0 +1,153 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <soul_u32/syntax/BuildCache.hpp>
+#include <soul_u32/util/MappedInputFile.hpp>
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <stdexcept>
+#include <stdint.h>
+
+namespace soul { namespace syntax {
+
+using namespace soul::util;
+
+const char* cacheHeader = "soulpg build cache ";
+
+std::string GetContentHash(const std::string& content)
+{
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : content)
+    {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ull;
+    }
+    const char* hexDigits = "0123456789abcdef";
+    std::string s(16, '0');
+    for (int i = 15; i >= 0; --i)
+    {
+        s[i] = hexDigits[hash & 0xF];
+        hash >>= 4;
+    }
+    return s;
+}
+
+BuildCache::BuildCache(const std::string& cacheFilePath_, const std::string& generatorVersion_) : 
+    cacheFilePath(cacheFilePath_), baseDirectory(boost::filesystem::path(cacheFilePath).parent_path().lexically_normal().generic_string()), generatorVersion(generatorVersion_)
+{
+}
+
+//  The cache keys are the relative paths, so the entries read from the cache file match the files of the current build wherever the checkout is.
+//  A file on another root than the cache file keeps its absolute path.
+
+std::string BuildCache::RelativePath(const std::string& filePath) const
+{
+    boost::filesystem::path normalPath = boost::filesystem::path(filePath).lexically_normal();
+    boost::filesystem::path relativePath = normalPath.lexically_relative(baseDirectory);
+    if (relativePath.empty())
+    {
+        return normalPath.generic_string();
+    }
+    return relativePath.generic_string();
+}
+
+void BuildCache::Read()
+{
+    entries.clear();
+    if (!boost::filesystem::exists(cacheFilePath)) return;
+    std::ifstream cacheFile(cacheFilePath.c_str());
+    std::string line;
+    if (!std::getline(cacheFile, line) || line != cacheHeader + generatorVersion) return;
+    Entry* entry = nullptr;
+    while (std::getline(cacheFile, line))
+    {
+        std::string::size_type firstSpace = line.find(' ');
+        if (firstSpace == std::string::npos) continue;
+        std::string::size_type secondSpace = line.find(' ', firstSpace + 1);
+        if (secondSpace == std::string::npos) continue;
+        std::string kind = line.substr(0, firstSpace);
+        std::string hash = line.substr(firstSpace + 1, secondSpace - firstSpace - 1);
+        std::string filePath = line.substr(secondSpace + 1);
+        if (kind == "file")
+        {
+            entry = &entries[filePath];
+            entry->hash = hash;
+            entry->dependencies.clear();
+        }
+        else if (kind == "dep" && entry)
+        {
+            entry->dependencies.push_back(std::make_pair(filePath, hash));
+        }
+    }
+}
+
+void BuildCache::Write() const
+{
+    std::ofstream cacheFile(cacheFilePath.c_str());
+    cacheFile << cacheHeader << generatorVersion << "\n";
+    for (const auto& p : entries)
+    {
+        if (currentHashes.find(p.first) == currentHashes.cend()) continue;
+        const Entry& entry = p.second;
+        cacheFile << "file " << entry.hash << " " << p.first << "\n";
+        for (const auto& dependency : entry.dependencies)
+        {
+            cacheFile << "dep " << dependency.second << " " << dependency.first << "\n";
+        }
+    }
+}
+
+void BuildCache::AddFile(const std::string& filePath)
+{
+    currentHashes[RelativePath(filePath)] = GetContentHash(ReadFile(filePath));
+}
+
+const std::string* BuildCache::GetCurrentHash(const std::string& filePath) const
+{
+    std::unordered_map<std::string, std::string>::const_iterator i = currentHashes.find(RelativePath(filePath));
+    if (i != currentHashes.cend())
+    {
+        return &i->second;
+    }
+    return nullptr;
+}
+
+bool BuildCache::IsUpToDate(const std::string& filePath) const
+{
+    std::map<std::string, Entry>::const_iterator i = entries.find(RelativePath(filePath));
+    if (i == entries.cend()) return false;
+    const Entry& entry = i->second;
+    const std::string* hash = GetCurrentHash(filePath);
+    if (!hash || *hash != entry.hash) return false;
+    for (const auto& dependency : entry.dependencies)
+    {
+        std::unordered_map<std::string, std::string>::const_iterator d = currentHashes.find(dependency.first);
+        if (d == currentHashes.cend() || d->second != dependency.second) return false;
+    }
+    return true;
+}
+
+void BuildCache::Update(const std::string& filePath, const std::set<std::string>& dependencies)
+{
+    const std::string* hash = GetCurrentHash(filePath);
+    if (!hash)
+    {
+        throw std::runtime_error("build cache: content hash of '" + filePath + "' not computed");
+    }
+    Entry& entry = entries[RelativePath(filePath)];
+    entry.hash = *hash;
+    entry.dependencies.clear();
+    for (const std::string& dependency : dependencies)
+    {
+        const std::string* dependencyHash = GetCurrentHash(dependency);
+        if (!dependencyHash)
+        {
+            throw std::runtime_error("build cache: content hash of '" + dependency + "' not computed");
+        }
+        entry.dependencies.push_back(std::make_pair(RelativePath(dependency), *dependencyHash));
+    }
+}
+
+} } // namespace soul::syntax
@@ -0,0 +1,51 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#ifndef SOUL_SYNTAX_BUILD_CACHE_INCLUDED
+#define SOUL_SYNTAX_BUILD_CACHE_INCLUDED
+
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace soul { namespace syntax {
+
+std::string GetContentHash(const std::string& content);
+
+//  BuildCache records for each generated file the content hash of its source and the content hashes of the files it depends on.
+//  A source file is up to date if neither its own content nor the content of any of its dependencies has changed since the cache was written,
+//  so touching a file does not cause regeneration but editing a referenced library does.
+//  The cache is discarded as a whole if it was written by a different version of soulpg.
+//  The paths are stored relative to the directory of the cache file, so a checkout can be moved or copied without invalidating the cache.
+
+class BuildCache
+{
+public:
+    BuildCache(const std::string& cacheFilePath_, const std::string& generatorVersion_);
+    void Read();
+    void Write() const;
+    void AddFile(const std::string& filePath);
+    const std::string* GetCurrentHash(const std::string& filePath) const;
+    bool IsUpToDate(const std::string& filePath) const;
+    void Update(const std::string& filePath, const std::set<std::string>& dependencies);
+private:
+    struct Entry
+    {
+        std::string hash;
+        std::vector<std::pair<std::string, std::string>> dependencies;
+    };
+    std::string cacheFilePath;
+    std::string baseDirectory;
+    std::string generatorVersion;
+    std::unordered_map<std::string, std::string> currentHashes;
+    std::map<std::string, Entry> entries;
+    std::string RelativePath(const std::string& filePath) const;
+};
+
+} } // namespace soul::syntax
+
+#endif // SOUL_SYNTAX_BUILD_CACHE_INCLUDED
@@ -14,7 +14,11 @@
 #include <soul_u32/util/Unicode.hpp>
 #include <boost/filesystem.hpp>
 #include <unordered_map>
+#include <algorithm>
 #include <fstream>
+#include <sstream>
+#include <iterator>
+#include <stdexcept>
 #include <iostream>
 #include <stdlib.h>
 
@@ -76,23 +80,162 @@ private:
     NamespaceContentMap nsContentMap;
 };
 
-bool Changed(const std::string& parserFilePath, const std::string& cppFilePath, const std::string& hppFilePath)
+bool forceCodeGen = false;
+
+void SetForceCodeGen(bool force)
+{
+    forceCodeGen = force;
+}
+
+bool ForceCodeGen()
+{
+    return forceCodeGen;
+}
+
+int rulesPerFile = 0;
+
+void SetRulesPerFile(int rulesPerFile_)
+{
+    rulesPerFile = rulesPerFile_;
+}
+
+int RulesPerFile()
+{
+    return rulesPerFile;
+}
+
+bool OutputFilesExist(ParserFileContent* parserFile)
+{
+    const std::string& filePath = parserFile->FilePath();
+    return boost::filesystem::exists(boost::filesystem::path(filePath).replace_extension(".cpp")) && boost::filesystem::exists(boost::filesystem::path(filePath).replace_extension(".hpp"));
+}
+
+bool WriteFileIfChanged(const std::string& filePath, const std::string& content)
 {
-    if (!boost::filesystem::exists(cppFilePath)) return true;
-    if (!boost::filesystem::exists(hppFilePath)) return true;
-    if ((boost::filesystem::last_write_time(cppFilePath) < boost::filesystem::last_write_time(parserFilePath)) || 
-        (boost::filesystem::last_write_time(hppFilePath) < boost::filesystem::last_write_time(parserFilePath)))
+    if (boost::filesystem::exists(filePath))
     {
-        return true;
+        std::ifstream existingFile(filePath.c_str());
+        std::string existingContent((std::istreambuf_iterator<char>(existingFile)), std::istreambuf_iterator<char>());
+        if (existingContent == content)
+        {
+            return false;
+        }
+    }
+    std::string tempFilePath = filePath + ".tmp";
+    {
+        std::ofstream tempFile(tempFilePath.c_str());
+        tempFile << content;
+        if (!tempFile.flush())
+        {
+            throw std::runtime_error("could not write to '" + tempFilePath + "'");
+        }
     }
-    return false;
+    boost::filesystem::rename(tempFilePath, filePath);
+    return true;
 }
 
-bool forceCodeGen = false;
+void WriteGeneratedFile(const std::string& filePath, const std::string& content)
+{
+    if (WriteFileIfChanged(filePath, content))
+    {
+        std::cout << "=> " << filePath << std::endl;
+    }
+    else
+    {
+        std::cout << "=> " << filePath << " (unchanged)" << std::endl;
+    }
+}
 
-void SetForceCodeGen(bool force)
+//  The include guard of an existing header is kept, so that regenerating a header whose content has not changed produces the same file.
+
+std::string GetIncludeGuard(const std::string& hppFilePath, const std::string& hppFileName)
 {
-    forceCodeGen = force;
+    std::string includeGuardPrefix = Replace(hppFileName, '.', '_') + "_";
+    if (boost::filesystem::exists(hppFilePath))
+    {
+        std::ifstream hppFile(hppFilePath.c_str());
+        std::string firstLine;
+        if (std::getline(hppFile, firstLine) && StartsWith(firstLine, "#ifndef " + includeGuardPrefix))
+        {
+            return Trim(firstLine.substr(8));
+        }
+    }
+#ifdef _MSC_VER
+#pragma warning(disable: 4244)
+#endif
+    srand(time(0));
+#ifdef _MSC_VER
+#pragma warning(default: 4244)
+#endif
+    int r = rand();
+    std::string random = std::to_string(r);
+    return includeGuardPrefix + random;
+}
+
+//  When rule classes are split off, the rule classes of a parser file are written to files <name>_1.cpp, <name>_2.cpp, ..., rulesPerFile classes in each.
+//  Every such file gets the same includes, namespaces and using declarations as the main file, so the rule actions compile as they would in the main file.
+//  Rule class files left over from an earlier build with more files, or with splitting enabled, are removed.
+
+struct RuleClassText
+{
+    RuleClassText(int nsIndex_, const std::string& text_) : nsIndex(nsIndex_), text(text_) {}
+    int nsIndex;
+    std::string text;
+};
+
+struct NamespaceText
+{
+    std::string begin;
+    std::string usings;
+    std::string end;
+};
+
+std::string GetRuleClassFilePath(const std::string& filePath, int fileNumber)
+{
+    path p(filePath);
+    return (p.parent_path() / path(p.stem().string() + "_" + std::to_string(fileNumber) + ".cpp")).generic_string();
+}
+
+void WriteRuleClassFiles(const std::string& filePath, const std::string& includes, const std::vector<NamespaceText>& namespaces, 
+    const std::vector<RuleClassText>& ruleClasses)
+{
+    int fileNumber = 0;
+    int n = rulesPerFile > 0 ? int(ruleClasses.size()) : 0;
+    for (int first = 0; first < n; first += rulesPerFile)
+    {
+        ++fileNumber;
+        std::ostringstream ruleClassFile;
+        ruleClassFile << includes << "\n";
+        int last = std::min(first + rulesPerFile, n);
+        int i = first;
+        while (i < last)
+        {
+            const NamespaceText& ns = namespaces[ruleClasses[i].nsIndex];
+            ruleClassFile << ns.begin << ns.usings;
+            int nsIndex = ruleClasses[i].nsIndex;
+            while (i < last && ruleClasses[i].nsIndex == nsIndex)
+            {
+                ruleClassFile << ruleClasses[i].text;
+                ++i;
+            }
+            ruleClassFile << ns.end;
+        }
+        WriteGeneratedFile(GetRuleClassFilePath(filePath, fileNumber), ruleClassFile.str());
+    }
+    while (true)
+    {
+        ++fileNumber;
+        std::string staleFilePath = GetRuleClassFilePath(filePath, fileNumber);
+        if (!boost::filesystem::exists(staleFilePath)) break;
+        std::string staleFileStart(includes.length(), '\0');
+        {
+            std::ifstream staleFile(staleFilePath.c_str());
+            staleFile.read(&staleFileStart[0], includes.length());
+        }
+        if (staleFileStart != includes) break;
+        boost::filesystem::remove(staleFilePath);
+        std::cout << "=> " << staleFilePath << " (removed)" << std::endl;
+    }
 }
 
 void GenerateCode(ParserFileContent* parserFile)
@@ -100,41 +243,34 @@ void GenerateCode(ParserFileContent* parserFile)
     const std::string& filePath = parserFile->FilePath();
     std::string cppFilePath = boost::filesystem::path(filePath).replace_extension(".cpp").generic_string();
     std::string hppFilePath = boost::filesystem::path(filePath).replace_extension(".hpp").generic_string();
-    if (!forceCodeGen && !Changed(filePath, cppFilePath, hppFilePath))
-    {
-        return;
-    }
-    std::ofstream cppFile(cppFilePath.c_str());
+    std::ostringstream cppFile;
     CodeFormatter cppFormatter(cppFile);
-    std::ofstream hppFile(hppFilePath.c_str());
+    std::ostringstream hppFile;
     CodeFormatter hppFormatter(hppFile);
     path hppPath(hppFilePath);
     std::string hppFileName = hppPath.filename().string();
-#pragma warning(disable: 4244)
-    srand(time(0));
-#pragma warning(default: 4244)
-    int r = rand();
-    std::string random = std::to_string(r);
-    std::string includeGuard = Replace(hppFileName, '.', '_') + "_" + random;
+    std::string includeGuard = GetIncludeGuard(hppFilePath, hppFileName);
     hppFormatter.WriteLine("#ifndef " + includeGuard);
     hppFormatter.WriteLine("#define " + includeGuard);
     hppFormatter.WriteLine();
     hppFormatter.WriteLine("#include <soul_u32/parsing/Grammar.hpp>");
     hppFormatter.WriteLine("#include <soul_u32/parsing/Keyword.hpp>");
+    std::ostringstream includes;
+    CodeFormatter includeFormatter(includes);
     if (hppFileName != "StdLib.hpp")
     {
-        cppFormatter.WriteLine("#include \"" + hppFileName + "\"");
+        includeFormatter.WriteLine("#include \"" + hppFileName + "\"");
     }
-    cppFormatter.WriteLine("#include <soul_u32/parsing/Action.hpp>");
-    cppFormatter.WriteLine("#include <soul_u32/parsing/Rule.hpp>");
-    cppFormatter.WriteLine("#include <soul_u32/parsing/ParsingDomain.hpp>");
-    cppFormatter.WriteLine("#include <soul_u32/parsing/Primitive.hpp>");
-    cppFormatter.WriteLine("#include <soul_u32/parsing/Composite.hpp>");
-    cppFormatter.WriteLine("#include <soul_u32/parsing/Nonterminal.hpp>");
-    cppFormatter.WriteLine("#include <soul_u32/parsing/Exception.hpp>");
-    cppFormatter.WriteLine("#include <soul_u32/parsing/StdLib.hpp>");
-    cppFormatter.WriteLine("#include <soul_u32/parsing/XmlLog.hpp>");
-    cppFormatter.WriteLine("#include <soul_u32/util/Unicode.hpp>");
+    includeFormatter.WriteLine("#include <soul_u32/parsing/Action.hpp>");
+    includeFormatter.WriteLine("#include <soul_u32/parsing/Rule.hpp>");
+    includeFormatter.WriteLine("#include <soul_u32/parsing/ParsingDomain.hpp>");
+    includeFormatter.WriteLine("#include <soul_u32/parsing/Primitive.hpp>");
+    includeFormatter.WriteLine("#include <soul_u32/parsing/Composite.hpp>");
+    includeFormatter.WriteLine("#include <soul_u32/parsing/Nonterminal.hpp>");
+    includeFormatter.WriteLine("#include <soul_u32/parsing/Exception.hpp>");
+    includeFormatter.WriteLine("#include <soul_u32/parsing/StdLib.hpp>");
+    includeFormatter.WriteLine("#include <soul_u32/parsing/XmlLog.hpp>");
+    includeFormatter.WriteLine("#include <soul_u32/util/Unicode.hpp>");
 
     int n = int(parserFile->IncludeDirectives().size());
     for (int i = 0; i < n; ++i)
@@ -142,9 +278,10 @@ void GenerateCode(ParserFileContent* parserFile)
         const std::pair<std::string, std::string>& includeDirective = parserFile->IncludeDirectives()[i];
         const std::string& includeFileName = includeDirective.first;
         const std::string& fileAttribute = includeDirective.second;
-        CodeFormatter& formatter = fileAttribute == "hpp" ? hppFormatter : cppFormatter;
+        CodeFormatter& formatter = fileAttribute == "hpp" ? hppFormatter : includeFormatter;
         formatter.WriteLine("#include " + includeFileName);
     }
+    cppFormatter.Write(includes.str());
     cppFormatter.WriteLine();
     hppFormatter.WriteLine();
 
@@ -157,12 +294,23 @@ void GenerateCode(ParserFileContent* parserFile)
     }
     parserFile->ParsingDomain()->GlobalNamespace()->Accept(selectorVisitor);
     const NamespaceContentMap& nsContent = selectorVisitor.NsContentMap();
+    std::vector<NamespaceContentMapIt> nsContentItems;
     NamespaceContentMapIt e = nsContent.end();
     for (NamespaceContentMapIt i = nsContent.begin(); i != e; ++i)
+    {
+        nsContentItems.push_back(i);
+    }
+    std::sort(nsContentItems.begin(), nsContentItems.end(), [](NamespaceContentMapIt left, NamespaceContentMapIt right) { return left->first->FullName() < right->first->FullName(); });
+    std::vector<NamespaceText> namespaces;
+    std::vector<RuleClassText> ruleClasses;
+    for (NamespaceContentMapIt i : nsContentItems)
     {
         Namespace* ns = i->first;
         std::u32string nsFullName = ns->FullName();
         std::vector<std::u32string> nsComponents;
+        NamespaceText nsText;
+        std::ostringstream nsBegin;
+        CodeFormatter nsBeginFormatter(nsBegin);
         if (!nsFullName.empty())
         {
             nsComponents = Split(nsFullName, '.');
@@ -171,17 +319,20 @@ void GenerateCode(ParserFileContent* parserFile)
             {
                 if (i > 0)
                 {
-                    cppFormatter.Write(" ");
+                    nsBeginFormatter.Write(" ");
                     hppFormatter.Write(" ");
                 }
-                cppFormatter.Write("namespace " + ToUtf8(nsComponents[i]) + " {");
+                nsBeginFormatter.Write("namespace " + ToUtf8(nsComponents[i]) + " {");
                 hppFormatter.Write("namespace " + ToUtf8(nsComponents[i]) + " {");
             }
-            cppFormatter.WriteLine();
-            cppFormatter.WriteLine();
+            nsBeginFormatter.WriteLine();
+            nsBeginFormatter.WriteLine();
             hppFormatter.WriteLine();
             hppFormatter.WriteLine();
         }
+        nsText.begin = nsBegin.str();
+        std::ostringstream usings;
+        CodeFormatter usingFormatter(usings);
         const NamespaceContent& content = i->second;
         if (!content.UsingObjects().empty())
         {
@@ -196,24 +347,43 @@ void GenerateCode(ParserFileContent* parserFile)
                 }
                 else
                 {
-                    subject->Print(cppFormatter);
+                    subject->Print(usingFormatter);
                 }
             }
         }
-        cppFormatter.WriteLine("using namespace soul::parsing;");
-        cppFormatter.WriteLine("using namespace soul::util;");
-        cppFormatter.WriteLine("using namespace soul::unicode;");
-        cppFormatter.WriteLine();
+        usingFormatter.WriteLine("using namespace soul::parsing;");
+        usingFormatter.WriteLine("using namespace soul::util;");
+        usingFormatter.WriteLine("using namespace soul::unicode;");
+        usingFormatter.WriteLine();
+        nsText.usings = usings.str();
+        cppFormatter.Write(nsText.begin + nsText.usings);
         if (!content.Grammars().empty())
         {
-            int n = int(content.Grammars().size());
+            std::vector<Grammar*> grammars = content.Grammars();
+            std::sort(grammars.begin(), grammars.end(), [](Grammar* left, Grammar* right) { return left->GetSpan().Start() < right->GetSpan().Start(); });
+            int n = int(grammars.size());
             for (int i = 0; i < n; ++i)
             {
-                Grammar* grammar = content.Grammars()[i];
-                CodeGeneratorVisitor visitor(cppFormatter, hppFormatter);
-                grammar->Accept(visitor);
+                Grammar* grammar = grammars[i];
+                if (rulesPerFile > 0)
+                {
+                    std::vector<std::string> grammarRuleClasses;
+                    CodeGeneratorVisitor visitor(cppFormatter, hppFormatter, grammarRuleClasses);
+                    grammar->Accept(visitor);
+                    for (const std::string& ruleClass : grammarRuleClasses)
+                    {
+                        ruleClasses.push_back(RuleClassText(int(namespaces.size()), ruleClass));
+                    }
+                }
+                else
+                {
+                    CodeGeneratorVisitor visitor(cppFormatter, hppFormatter);
+                    grammar->Accept(visitor);
+                }
             }
         }
+        std::ostringstream nsEnd;
+        CodeFormatter nsEndFormatter(nsEnd);
         if (!nsFullName.empty())
         {
             int n = int(nsComponents.size());
@@ -221,20 +391,24 @@ void GenerateCode(ParserFileContent* parserFile)
             {
                 if (i > 0)
                 {
-                    cppFormatter.Write(" ");
+                    nsEndFormatter.Write(" ");
                     hppFormatter.Write(" ");
                 }
-                cppFormatter.Write("}");
+                nsEndFormatter.Write("}");
                 hppFormatter.Write("}");
             }
-            cppFormatter.WriteLine(" // namespace " + ToUtf8(nsFullName));
+            nsEndFormatter.WriteLine(" // namespace " + ToUtf8(nsFullName));
             hppFormatter.WriteLine(" // namespace " + ToUtf8(nsFullName));
             hppFormatter.WriteLine();
         }
+        nsText.end = nsEnd.str();
+        cppFormatter.Write(nsText.end);
+        namespaces.push_back(nsText);
     }
     hppFormatter.WriteLine("#endif // " + includeGuard);
-    std::cout << "=> " << cppFilePath << std::endl;
-    std::cout << "=> " << hppFilePath << std::endl;
+    WriteGeneratedFile(cppFilePath, cppFile.str());
+    WriteGeneratedFile(hppFilePath, hppFile.str());
+    WriteRuleClassFiles(filePath, includes.str(), namespaces, ruleClasses);
 }
 
 void GenerateCode(const std::vector<std::unique_ptr<ParserFileContent>>& parserFiles)
@@ -10,7 +10,18 @@
 
 namespace soul { namespace syntax {
 
+//  WriteFileIfChanged replaces the file atomically with the given content unless the file already has that content.
+//  Unchanged generated files keep their timestamps, so they do not cause recompilation.
+
+bool WriteFileIfChanged(const std::string& filePath, const std::string& content);
+void WriteGeneratedFile(const std::string& filePath, const std::string& content);
 void SetForceCodeGen(bool force);
+bool ForceCodeGen();
+//  If rulesPerFile is positive, the rule classes of each grammar are generated to separate source files, rulesPerFile rule classes per file.
+void SetRulesPerFile(int rulesPerFile_);
+int RulesPerFile();
+bool OutputFilesExist(ParserFileContent* parserFile);
+void GenerateCode(ParserFileContent* parserFile);
 void GenerateCode(const std::vector<std::unique_ptr<ParserFileContent>>& parserFiles);
 
 } } // namespace soul::syntax
@@ -12,6 +12,9 @@
 #include <soul_u32/parsing/Action.hpp>
 #include <soul_u32/parsing/Nonterminal.hpp>
 #include <soul_u32/parsing/Namespace.hpp>
+#include <soul_u32/codedom/Expression.hpp>
+#include <algorithm>
+#include <sstream>
 
 namespace soul { namespace syntax {
 
@@ -50,10 +53,24 @@ private:
 };
 
 CodeGeneratorVisitor::CodeGeneratorVisitor(CodeFormatter& cppFormatter_, CodeFormatter& hppFormatter_): 
-    cppFormatter(cppFormatter_), hppFormatter(hppFormatter_)
+    cppFormatter(cppFormatter_), hppFormatter(hppFormatter_), ruleClasses(nullptr)
 {
 }
 
+CodeGeneratorVisitor::CodeGeneratorVisitor(CodeFormatter& cppFormatter_, CodeFormatter& hppFormatter_, std::vector<std::string>& ruleClasses_) :
+    cppFormatter(cppFormatter_), hppFormatter(hppFormatter_), ruleClasses(&ruleClasses_)
+{
+}
+
+std::string CodeGeneratorVisitor::RuleClassCreator(Rule& rule) const
+{
+    if (ruleClasses)
+    {
+        return "New" + ToUtf8(rule.SpecializedTypeName());
+    }
+    return "new " + ToUtf8(rule.SpecializedTypeName());
+}
+
 void CodeGeneratorVisitor::BeginVisit(Grammar& grammar)
 {
     std::string grammarPtrType = ToUtf8(grammar.Name()) + "*";
@@ -66,6 +83,7 @@ void CodeGeneratorVisitor::BeginVisit(Grammar& grammar)
 
     std::string valueTypeName;
     std::string parameters;
+    std::string arguments;
     if (grammar.StartRule())
     {
         valueTypeName = !grammar.StartRule()->ValueTypeName().empty() ? ToUtf8(grammar.StartRule()->ValueTypeName()) : "void";
@@ -77,8 +95,11 @@ void CodeGeneratorVisitor::BeginVisit(Grammar& grammar)
             {
                 const AttrOrVariable& attr = grammar.StartRule()->InheritedAttributes()[i];
                 parameters.append(", " + ToUtf8(attr.TypeName()) + " " + ToUtf8(attr.Name()));
+                arguments.append(", " + ToUtf8(attr.Name()));
             }
             hppFormatter.WriteLine(valueTypeName + " Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName" + parameters + ");");
+            hppFormatter.WriteLine(valueTypeName + " Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, const soul::parsing::ParsingLimits* limits" + 
+                parameters + ");");
         }
     }
     hppFormatter.DecIndent();
@@ -131,6 +152,14 @@ void CodeGeneratorVisitor::BeginVisit(Grammar& grammar)
                 "::Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName" + parameters + ")");
             cppFormatter.WriteLine("{");
             cppFormatter.IncIndent();
+            cppFormatter.WriteLine(std::string(valueTypeName != "void" ? "return " : "") + "Parse(start, end, fileIndex, fileName, nullptr" + arguments + ");");
+            cppFormatter.DecIndent();
+            cppFormatter.WriteLine("}");
+            cppFormatter.NewLine();
+            cppFormatter.WriteLine(valueTypeName + " " + ToUtf8(grammar.Name()) + 
+                "::Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, const soul::parsing::ParsingLimits* limits" + parameters + ")");
+            cppFormatter.WriteLine("{");
+            cppFormatter.IncIndent();
             cppFormatter.WriteLine("soul::parsing::Scanner scanner(start, end, fileName, fileIndex, SkipRule());");
             cppFormatter.WriteLine("std::unique_ptr<soul::parsing::XmlLog> xmlLog;");
             cppFormatter.WriteLine("if (Log())");
@@ -149,10 +178,10 @@ void CodeGeneratorVisitor::BeginVisit(Grammar& grammar)
             for (int i = 0; i < n; ++i)
             {
                 const AttrOrVariable& attr = grammar.StartRule()->InheritedAttributes()[i];
-                cppFormatter.WriteLine("stack.push(std::unique_ptr<soul::parsing::Object>(new ValueObject<" + ToUtf8(attr.TypeName()) + ">(" + ToUtf8(attr.Name()) + ")));");
+                cppFormatter.WriteLine("soul::parsing::PushValue<" + ToUtf8(attr.TypeName()) + ">(stack, " + ToUtf8(attr.Name()) + ");");
             }
 
-            cppFormatter.WriteLine("soul::parsing::Match match = soul::parsing::Grammar::Parse(scanner, stack, parsingData.get());");
+            cppFormatter.WriteLine("soul::parsing::Match match = soul::parsing::Grammar::Parse(scanner, stack, parsingData.get(), limits);");
             cppFormatter.WriteLine("soul::parsing::Span stop = scanner.GetSpan();");
             cppFormatter.WriteLine("if (Log())");
             cppFormatter.WriteLine("{");
@@ -180,10 +209,7 @@ void CodeGeneratorVisitor::BeginVisit(Grammar& grammar)
 
             if (valueTypeName != "void")
             {
-                cppFormatter.WriteLine("std::unique_ptr<soul::parsing::Object> value = std::move(stack.top());");
-                cppFormatter.WriteLine(valueTypeName + " result = *static_cast<soul::parsing::ValueObject<" + valueTypeName + ">*>(value.get());");
-                cppFormatter.WriteLine("stack.pop();");
-                cppFormatter.WriteLine("return result;");
+                cppFormatter.WriteLine("return soul::parsing::PopValue<" + valueTypeName + ">(stack);");
             }
             cppFormatter.DecIndent();
             cppFormatter.WriteLine("}");
@@ -196,243 +222,26 @@ void CodeGeneratorVisitor::BeginVisit(Grammar& grammar)
         Rule* rule = grammar.Rules()[i];
         if (rule->Specialized())
         {
-            cppFormatter.WriteLine("class " + ToUtf8(grammar.Name()) + "::" + ToUtf8(rule->SpecializedTypeName()) + " : public soul::parsing::Rule");
-            cppFormatter.WriteLine("{");
-            cppFormatter.WriteLine("public:");
-            cppFormatter.IncIndent();
-            // constructor:
-            cppFormatter.WriteLine(ToUtf8(rule->SpecializedTypeName()) + "(const std::u32string& name_, Scope* enclosingScope_, int id_, Parser* definition_):");
-            cppFormatter.IncIndent();
-            cppFormatter.WriteLine("soul::parsing::Rule(name_, enclosingScope_, id_, definition_)");
-            cppFormatter.DecIndent();
-            cppFormatter.WriteLine("{");
-            cppFormatter.IncIndent();
-            int m = int(rule->InheritedAttributes().size());
-            for (int i = 0; i < m; ++i)
-            {
-                const AttrOrVariable& attr = rule->InheritedAttributes()[i];
-                cppFormatter.WriteLine("AddInheritedAttribute(AttrOrVariable(ToUtf32(\"" + ToUtf8(attr.TypeName()) + "\"), ToUtf32(\"" + ToUtf8(attr.Name()) + "\")));");
-            }
-            if (!rule->ValueTypeName().empty())
-            {
-                cppFormatter.WriteLine("SetValueTypeName(ToUtf32(\"" + ToUtf8(rule->ValueTypeName()) + "\"));");
-            }
-            m = int(rule->LocalVariables().size());
-            for (int i = 0; i < m; ++i)
-            {
-                const AttrOrVariable& var = rule->LocalVariables()[i];
-                cppFormatter.WriteLine("AddLocalVariable(AttrOrVariable(ToUtf32(\"" + ToUtf8(var.TypeName()) + "\"), ToUtf32(\"" + ToUtf8(var.Name()) + "\")));");
-            }
-            cppFormatter.DecIndent();
-            cppFormatter.WriteLine("}");
-
-            // enter:
-            cppFormatter.WriteLine("virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)");
-            cppFormatter.WriteLine("{");
-            cppFormatter.IncIndent();
-            cppFormatter.WriteLine("parsingData->PushContext(Id(), new Context());");
-            cppFormatter.WriteLine("Context* context = static_cast<Context*>(parsingData->GetContext(Id()));");
-            m = int(rule->InheritedAttributes().size());
-            for (int i = m - 1; i >= 0; --i)
-            {
-                const AttrOrVariable& attr = rule->InheritedAttributes()[i];
-                cppFormatter.WriteLine("std::unique_ptr<soul::parsing::Object> " + ToUtf8(attr.Name()) + "_value = std::move(stack.top());");
-                cppFormatter.WriteLine("context->" + ToUtf8(attr.Name()) + " = *static_cast<soul::parsing::ValueObject<" + ToUtf8(attr.TypeName()) + ">*>(" + ToUtf8(attr.Name()) + "_value.get());");
-                cppFormatter.WriteLine("stack.pop();");
-            }
-            cppFormatter.DecIndent();
-            cppFormatter.WriteLine("}");
-            // leave:
-            cppFormatter.WriteLine("virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)");
-            cppFormatter.WriteLine("{");
-            cppFormatter.IncIndent();
-            if (!rule->ValueTypeName().empty())
-            {
-                cppFormatter.WriteLine("Context* context = static_cast<Context*>(parsingData->GetContext(Id()));");
-                cppFormatter.WriteLine("if (matched)");
-                cppFormatter.WriteLine("{");
-                cppFormatter.IncIndent();
-                cppFormatter.WriteLine("stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<" + ToUtf8(rule->ValueTypeName()) + ">(context->value)));");
-                cppFormatter.DecIndent();
-                cppFormatter.WriteLine("}");
-            }
-            cppFormatter.WriteLine("parsingData->PopContext(Id());");
-            cppFormatter.DecIndent();
-            cppFormatter.WriteLine("}");
-
-            // link:
-            cppFormatter.WriteLine("virtual void Link()");
-            cppFormatter.WriteLine("{");
-            cppFormatter.IncIndent();
-            m = int(rule->Actions().size());
-            for (int i = 0; i < m; ++i)
+            if (ruleClasses)
             {
-                ActionParser* action = rule->Actions()[i];
-                cppFormatter.WriteLine("soul::parsing::ActionParser* " + ToUtf8(action->VariableName()) + " = GetAction(ToUtf32(\"" + ToUtf8(action->Name()) + "\"));");
-                cppFormatter.WriteLine(ToUtf8(action->VariableName()) + "->SetAction(new soul::parsing::MemberParsingAction<" + ToUtf8(rule->SpecializedTypeName()) + ">(this, &" + 
-                    ToUtf8(rule->SpecializedTypeName()) + "::" + ToUtf8(action->MethodName()) + "));");
-                if (action->FailCode())
-                {
-                    cppFormatter.WriteLine(ToUtf8(action->VariableName()) + "->SetFailureAction(new soul::parsing::MemberFailureAction<" + ToUtf8(rule->SpecializedTypeName()) + ">(this, &" + 
-                        ToUtf8(rule->SpecializedTypeName()) + "::" + ToUtf8(action->MethodName()) + "Fail));");
-                }
-            }
-            m = int(rule->Nonterminals().size());
-            for (int i = 0; i < m; ++i)
-            {
-                NonterminalParser* nonterminal = rule->Nonterminals()[i];
-                if (nonterminal->Specialized())
-                {
-                    cppFormatter.WriteLine("soul::parsing::NonterminalParser* " + ToUtf8(nonterminal->VariableName()) + " = GetNonterminal(ToUtf32(\"" + ToUtf8(nonterminal->Name()) + "\"));");
-                    if (!nonterminal->Arguments().empty())
-                    {
-                        cppFormatter.WriteLine(ToUtf8(nonterminal->VariableName()) + "->SetPreCall(new soul::parsing::MemberPreCall<" + ToUtf8(rule->SpecializedTypeName()) + ">(this, &" + 
-                            ToUtf8(rule->SpecializedTypeName()) + "::" + ToUtf8(nonterminal->PreCallMethodName()) + "));");
-                    }
-                    if (!nonterminal->GetRule()->ValueTypeName().empty())
-                    {
-                        cppFormatter.WriteLine(ToUtf8(nonterminal->VariableName()) + "->SetPostCall(new soul::parsing::MemberPostCall<" + ToUtf8(rule->SpecializedTypeName()) + ">(this, &" + 
-                            ToUtf8(rule->SpecializedTypeName()) + "::" + ToUtf8(nonterminal->PostCallMethodName()) + "));");
-                    }
-                }
+                std::ostringstream ruleClass;
+                CodeFormatter ruleClassFormatter(ruleClass);
+                GenerateRuleClass(grammar, rule, ruleClassFormatter);
+                std::string ruleClassName = ToUtf8(rule->SpecializedTypeName());
+                ruleClassFormatter.WriteLine("soul::parsing::Rule* " + ToUtf8(grammar.Name()) + "::New" + ruleClassName + 
+                    "(const std::u32string& ruleName, soul::parsing::Scope* enclosingScope, int ruleId, soul::parsing::Parser* definition)");
+                ruleClassFormatter.WriteLine("{");
+                ruleClassFormatter.IncIndent();
+                ruleClassFormatter.WriteLine("return new " + ruleClassName + "(ruleName, enclosingScope, ruleId, definition);");
+                ruleClassFormatter.DecIndent();
+                ruleClassFormatter.WriteLine("}");
+                ruleClassFormatter.NewLine();
+                ruleClasses->push_back(ruleClass.str());
             }
-            cppFormatter.DecIndent();
-            cppFormatter.WriteLine("}");
-
-            // action methods:
-            m = int(rule->Actions().size());
-            for (int i = 0; i < m; ++i)
+            else
             {
-                ActionParser* action = rule->Actions()[i];
-                cppFormatter.WriteLine("void " + ToUtf8(action->MethodName()) +
-                    "(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)");
-                cppFormatter.SetStart();
-                cppFormatter.SetStartText("Context* context = static_cast<Context*>(parsingData->GetContext(Id()));");
-                action->SuccessCode()->Print(cppFormatter);
-                if (action->FailCode())
-                {
-                    cppFormatter.WriteLine("void " + ToUtf8(action->MethodName()) + "Fail(ParsingData* parsingData)");
-                    cppFormatter.SetStart();
-                    cppFormatter.SetStartText("Context* context = static_cast<Context*>(parsingData->GetContext(Id()));");
-                    action->FailCode()->Print(cppFormatter);
-                }
+                GenerateRuleClass(grammar, rule, cppFormatter);
             }
-
-            // pre-post calls:
-            m = int(rule->Nonterminals().size());
-            for (int i = 0; i < m; ++i)
-            {
-                NonterminalParser* nonterminal = rule->Nonterminals()[i];
-                if (nonterminal->Specialized())
-                {
-                    if (!nonterminal->Arguments().empty())
-                    {
-                        cppFormatter.WriteLine("void " + ToUtf8(nonterminal->PreCallMethodName()) + "(soul::parsing::ObjectStack& stack, ParsingData* parsingData)");
-                        cppFormatter.WriteLine("{");
-                        cppFormatter.IncIndent();
-                        cppFormatter.WriteLine("Context* context = static_cast<Context*>(parsingData->GetContext(Id()));");
-                        int p = int(nonterminal->Arguments().size());
-                        for (int j = 0; j < p; ++j)
-                        {
-                            soul::codedom::CppObject* argument = nonterminal->Arguments()[j];
-                            std::string argumentTypeName = ToUtf8(nonterminal->GetRule()->InheritedAttributes()[j].TypeName());
-                            cppFormatter.Write("stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<" + argumentTypeName + ">(");
-                            argument->Print(cppFormatter);
-                            cppFormatter.WriteLine(")));");
-                        }
-                        cppFormatter.DecIndent();
-                        cppFormatter.WriteLine("}");
-                    }
-                    if (!nonterminal->GetRule()->ValueTypeName().empty())
-                    {
-                        cppFormatter.WriteLine("void " + ToUtf8(nonterminal->PostCallMethodName()) + "(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)");
-                        cppFormatter.WriteLine("{");
-                        cppFormatter.IncIndent();
-                        cppFormatter.WriteLine("Context* context = static_cast<Context*>(parsingData->GetContext(Id()));");
-                        cppFormatter.WriteLine("if (matched)");
-                        cppFormatter.WriteLine("{");
-                        cppFormatter.IncIndent();
-                        cppFormatter.WriteLine("std::unique_ptr<soul::parsing::Object> " + ToUtf8(nonterminal->ValueFieldName()) + "_value = std::move(stack.top());");
-                        cppFormatter.WriteLine("context->" + ToUtf8(nonterminal->ValueFieldName()) + " = *static_cast<soul::parsing::ValueObject<" + 
-                            ToUtf8(nonterminal->GetRule()->ValueTypeName()) + ">*>(" + ToUtf8(nonterminal->ValueFieldName()) + "_value.get());");
-                        cppFormatter.WriteLine("stack.pop();");
-                        cppFormatter.DecIndent();
-                        cppFormatter.WriteLine("}");
-                        cppFormatter.DecIndent();
-                        cppFormatter.WriteLine("}");
-                    }
-                }
-            }
-            cppFormatter.DecIndent();
-            cppFormatter.WriteLine("private:");
-            cppFormatter.IncIndent();
-
-            // Context:
-            cppFormatter.WriteLine("struct Context : soul::parsing::Context");
-            cppFormatter.WriteLine("{");
-            cppFormatter.IncIndent();
-            cppFormatter.Write("Context(): ");
-            bool first = true;
-            m = int(rule->InheritedAttributes().size());
-            for (int j = 0; j < m; ++j)
-            {
-                if (first) { first = false; } else { cppFormatter.Write(", "); }
-                const AttrOrVariable& attr = rule->InheritedAttributes()[j];
-                cppFormatter.Write(ToUtf8(attr.Name()) + "()");
-            }
-            if (!rule->ValueTypeName().empty())
-            {
-                if (first) { first = false; } else { cppFormatter.Write(", "); }
-                cppFormatter.Write("value()");
-            }
-            m = int(rule->LocalVariables().size());
-            for (int j = 0; j < m; ++j)
-            {
-                if (first) { first = false; } else { cppFormatter.Write(", "); }
-                const AttrOrVariable& var = rule->LocalVariables()[j];
-                cppFormatter.Write(ToUtf8(var.Name()) + "()");
-            }
-            m = int(rule->Nonterminals().size());
-            for (int j = 0; j < m; ++j)
-            {
-                NonterminalParser* nonterminal = rule->Nonterminals()[j];
-                if (!nonterminal->GetRule()->ValueTypeName().empty())
-                {
-                    if (first) { first = false; } else { cppFormatter.Write(", "); }
-                    cppFormatter.Write(ToUtf8(nonterminal->ValueFieldName()) + "()");
-                }
-            }
-            cppFormatter.WriteLine(" {}");
-            m = int(rule->InheritedAttributes().size());
-            for (int j = 0; j < m; ++j)
-            {
-                const AttrOrVariable& attr = rule->InheritedAttributes()[j];
-                cppFormatter.WriteLine(ToUtf8(attr.TypeName()) + " " + ToUtf8(attr.Name()) + ";");
-            }
-            if (!rule->ValueTypeName().empty())
-            {
-                cppFormatter.WriteLine(ToUtf8(rule->ValueTypeName()) + " value;");
-            }
-            m = int(rule->LocalVariables().size());
-            for (int j = 0; j < m; ++j)
-            {
-                const AttrOrVariable& var = rule->LocalVariables()[j];
-                cppFormatter.WriteLine(ToUtf8(var.TypeName()) + " " + ToUtf8(var.Name()) + ";");
-            }
-            m = int(rule->Nonterminals().size());
-            for (int j = 0; j < m; ++j)
-            {
-                NonterminalParser* nonterminal = rule->Nonterminals()[j];
-                if (!nonterminal->GetRule()->ValueTypeName().empty())
-                {
-                    cppFormatter.WriteLine(ToUtf8(nonterminal->GetRule()->ValueTypeName()) + " " + ToUtf8(nonterminal->ValueFieldName()) + ";");
-                }
-            }
-            cppFormatter.DecIndent();
-            cppFormatter.WriteLine("};");
-            cppFormatter.DecIndent();
-            cppFormatter.WriteLine("};");
-            cppFormatter.NewLine();
         }
     }
 
@@ -443,10 +252,10 @@ void CodeGeneratorVisitor::BeginVisit(Grammar& grammar)
     if (!grammar.GrammarReferences().empty())
     {
         cppFormatter.WriteLine("soul::parsing::ParsingDomain* pd = GetParsingDomain();");
-        GrammarSetIt e = grammar.GrammarReferences().cend();
-        for (GrammarSetIt i = grammar.GrammarReferences().cbegin(); i != e; ++i)
+        std::vector<Grammar*> grammarReferences(grammar.GrammarReferences().cbegin(), grammar.GrammarReferences().cend());
+        std::sort(grammarReferences.begin(), grammarReferences.end(), [](Grammar* left, Grammar* right) { return left->FullName() < right->FullName(); });
+        for (Grammar* grammarReference : grammarReferences)
         {
-            Grammar* grammarReference = *i;
             std::string grammarReferenceName = ToUtf8(grammarReference->FullName());
             std::string grammarVar = "grammar" + std::to_string(grammarIndex);
             ++grammarIndex;
@@ -468,6 +277,248 @@ void CodeGeneratorVisitor::BeginVisit(Grammar& grammar)
     cppFormatter.IncIndent();
 }
 
+void CodeGeneratorVisitor::GenerateRuleClass(Grammar& grammar, Rule* rule, CodeFormatter& formatter)
+{
+    formatter.WriteLine("class " + ToUtf8(grammar.Name()) + "::" + ToUtf8(rule->SpecializedTypeName()) + " : public soul::parsing::Rule");
+    formatter.WriteLine("{");
+    formatter.WriteLine("public:");
+    formatter.IncIndent();
+    // constructor:
+    formatter.WriteLine(ToUtf8(rule->SpecializedTypeName()) + "(const std::u32string& name_, Scope* enclosingScope_, int id_, Parser* definition_):");
+    formatter.IncIndent();
+    formatter.WriteLine("soul::parsing::Rule(name_, enclosingScope_, id_, definition_)");
+    formatter.DecIndent();
+    formatter.WriteLine("{");
+    formatter.IncIndent();
+    int m = int(rule->InheritedAttributes().size());
+    for (int i = 0; i < m; ++i)
+    {
+        const AttrOrVariable& attr = rule->InheritedAttributes()[i];
+        formatter.WriteLine("AddInheritedAttribute(AttrOrVariable(ToUtf32(\"" + ToUtf8(attr.TypeName()) + "\"), ToUtf32(\"" + ToUtf8(attr.Name()) + "\")));");
+    }
+    if (!rule->ValueTypeName().empty())
+    {
+        formatter.WriteLine("SetValueTypeName(ToUtf32(\"" + ToUtf8(rule->ValueTypeName()) + "\"));");
+    }
+    m = int(rule->LocalVariables().size());
+    for (int i = 0; i < m; ++i)
+    {
+        const AttrOrVariable& var = rule->LocalVariables()[i];
+        formatter.WriteLine("AddLocalVariable(AttrOrVariable(ToUtf32(\"" + ToUtf8(var.TypeName()) + "\"), ToUtf32(\"" + ToUtf8(var.Name()) + "\")));");
+    }
+    formatter.DecIndent();
+    formatter.WriteLine("}");
+
+    // enter:
+    formatter.WriteLine("virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)");
+    formatter.WriteLine("{");
+    formatter.IncIndent();
+    m = int(rule->InheritedAttributes().size());
+    if (m > 0)
+    {
+        formatter.WriteLine("Context* context = soul::parsing::PushContext<Context>(parsingData, Id());");
+    }
+    else
+    {
+        formatter.WriteLine("soul::parsing::PushContext<Context>(parsingData, Id());");
+    }
+    for (int i = m - 1; i >= 0; --i)
+    {
+        const AttrOrVariable& attr = rule->InheritedAttributes()[i];
+        formatter.WriteLine("context->" + ToUtf8(attr.Name()) + " = soul::parsing::PopValue<" + ToUtf8(attr.TypeName()) + ">(stack);");
+    }
+    formatter.DecIndent();
+    formatter.WriteLine("}");
+    // leave:
+    formatter.WriteLine("virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)");
+    formatter.WriteLine("{");
+    formatter.IncIndent();
+    if (!rule->ValueTypeName().empty())
+    {
+        formatter.WriteLine("if (matched)");
+        formatter.WriteLine("{");
+        formatter.IncIndent();
+        formatter.WriteLine("soul::parsing::PushValue<" + ToUtf8(rule->ValueTypeName()) + ">(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);");
+        formatter.DecIndent();
+        formatter.WriteLine("}");
+    }
+    formatter.WriteLine("parsingData->PopContext(Id());");
+    formatter.DecIndent();
+    formatter.WriteLine("}");
+
+    // link:
+    formatter.WriteLine("virtual void Link()");
+    formatter.WriteLine("{");
+    formatter.IncIndent();
+    m = int(rule->Actions().size());
+    for (int i = 0; i < m; ++i)
+    {
+        ActionParser* action = rule->Actions()[i];
+        formatter.WriteLine("soul::parsing::ActionParser* " + ToUtf8(action->VariableName()) + " = GetAction(ToUtf32(\"" + ToUtf8(action->Name()) + "\"));");
+        formatter.WriteLine(ToUtf8(action->VariableName()) + "->SetAction(new soul::parsing::MemberParsingAction<" + ToUtf8(rule->SpecializedTypeName()) + ">(this, &" + 
+            ToUtf8(rule->SpecializedTypeName()) + "::" + ToUtf8(action->MethodName()) + "));");
+        if (action->FailCode())
+        {
+            formatter.WriteLine(ToUtf8(action->VariableName()) + "->SetFailureAction(new soul::parsing::MemberFailureAction<" + ToUtf8(rule->SpecializedTypeName()) + ">(this, &" + 
+                ToUtf8(rule->SpecializedTypeName()) + "::" + ToUtf8(action->MethodName()) + "Fail));");
+        }
+    }
+    m = int(rule->Nonterminals().size());
+    for (int i = 0; i < m; ++i)
+    {
+        NonterminalParser* nonterminal = rule->Nonterminals()[i];
+        if (nonterminal->Specialized())
+        {
+            formatter.WriteLine("soul::parsing::NonterminalParser* " + ToUtf8(nonterminal->VariableName()) + " = GetNonterminal(ToUtf32(\"" + ToUtf8(nonterminal->Name()) + "\"));");
+            if (!nonterminal->Arguments().empty())
+            {
+                formatter.WriteLine(ToUtf8(nonterminal->VariableName()) + "->SetPreCall(new soul::parsing::MemberPreCall<" + ToUtf8(rule->SpecializedTypeName()) + ">(this, &" + 
+                    ToUtf8(rule->SpecializedTypeName()) + "::" + ToUtf8(nonterminal->PreCallMethodName()) + "));");
+            }
+            if (!nonterminal->GetRule()->ValueTypeName().empty())
+            {
+                formatter.WriteLine(ToUtf8(nonterminal->VariableName()) + "->SetPostCall(new soul::parsing::MemberPostCall<" + ToUtf8(rule->SpecializedTypeName()) + ">(this, &" + 
+                    ToUtf8(rule->SpecializedTypeName()) + "::" + ToUtf8(nonterminal->PostCallMethodName()) + "));");
+            }
+        }
+    }
+    formatter.DecIndent();
+    formatter.WriteLine("}");
+
+    // action methods:
+    m = int(rule->Actions().size());
+    for (int i = 0; i < m; ++i)
+    {
+        ActionParser* action = rule->Actions()[i];
+        formatter.WriteLine("void " + ToUtf8(action->MethodName()) +
+            "(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)");
+        formatter.SetStart();
+        formatter.SetStartText("Context* context = soul::parsing::GetContext<Context>(parsingData, Id());");
+        action->SuccessCode()->Print(formatter);
+        if (action->FailCode())
+        {
+            formatter.WriteLine("void " + ToUtf8(action->MethodName()) + "Fail(ParsingData* parsingData)");
+            formatter.SetStart();
+            formatter.SetStartText("Context* context = soul::parsing::GetContext<Context>(parsingData, Id());");
+            action->FailCode()->Print(formatter);
+        }
+    }
+
+    // pre-post calls:
+    m = int(rule->Nonterminals().size());
+    for (int i = 0; i < m; ++i)
+    {
+        NonterminalParser* nonterminal = rule->Nonterminals()[i];
+        if (nonterminal->Specialized())
+        {
+            if (!nonterminal->Arguments().empty())
+            {
+                formatter.WriteLine("void " + ToUtf8(nonterminal->PreCallMethodName()) + "(soul::parsing::ObjectStack& stack, ParsingData* parsingData)");
+                formatter.WriteLine("{");
+                formatter.IncIndent();
+                formatter.WriteLine("Context* context = soul::parsing::GetContext<Context>(parsingData, Id());");
+                int p = int(nonterminal->Arguments().size());
+                for (int j = 0; j < p; ++j)
+                {
+                    soul::codedom::CppObject* argument = nonterminal->Arguments()[j];
+                    std::string argumentTypeName = ToUtf8(nonterminal->GetRule()->InheritedAttributes()[j].TypeName());
+                    formatter.Write("soul::parsing::PushValue<" + argumentTypeName + ">(stack, ");
+                    soul::codedom::PrintOperand(argument, soul::codedom::assignmentPrecedence, formatter);
+                    formatter.WriteLine(");");
+                }
+                formatter.DecIndent();
+                formatter.WriteLine("}");
+            }
+            if (!nonterminal->GetRule()->ValueTypeName().empty())
+            {
+                formatter.WriteLine("void " + ToUtf8(nonterminal->PostCallMethodName()) + "(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)");
+                formatter.WriteLine("{");
+                formatter.IncIndent();
+                formatter.WriteLine("Context* context = soul::parsing::GetContext<Context>(parsingData, Id());");
+                formatter.WriteLine("if (matched)");
+                formatter.WriteLine("{");
+                formatter.IncIndent();
+                formatter.WriteLine("context->" + ToUtf8(nonterminal->ValueFieldName()) + " = soul::parsing::PopValue<" + ToUtf8(nonterminal->GetRule()->ValueTypeName()) + ">(stack);");
+                formatter.DecIndent();
+                formatter.WriteLine("}");
+                formatter.DecIndent();
+                formatter.WriteLine("}");
+            }
+        }
+    }
+    formatter.DecIndent();
+    formatter.WriteLine("private:");
+    formatter.IncIndent();
+
+    // Context:
+    formatter.WriteLine("struct Context : soul::parsing::Context");
+    formatter.WriteLine("{");
+    formatter.IncIndent();
+    formatter.Write("Context(): ");
+    bool first = true;
+    m = int(rule->InheritedAttributes().size());
+    for (int j = 0; j < m; ++j)
+    {
+        if (first) { first = false; } else { formatter.Write(", "); }
+        const AttrOrVariable& attr = rule->InheritedAttributes()[j];
+        formatter.Write(attr.Name());
+        formatter.Write("()");
+    }
+    if (!rule->ValueTypeName().empty())
+    {
+        if (first) { first = false; } else { formatter.Write(", "); }
+        formatter.Write("value()");
+    }
+    m = int(rule->LocalVariables().size());
+    for (int j = 0; j < m; ++j)
+    {
+        if (first) { first = false; } else { formatter.Write(", "); }
+        const AttrOrVariable& var = rule->LocalVariables()[j];
+        formatter.Write(ToUtf8(var.Name()) + "()");
+    }
+    m = int(rule->Nonterminals().size());
+    for (int j = 0; j < m; ++j)
+    {
+        NonterminalParser* nonterminal = rule->Nonterminals()[j];
+        if (!nonterminal->GetRule()->ValueTypeName().empty())
+        {
+            if (first) { first = false; } else { formatter.Write(", "); }
+            formatter.Write(ToUtf8(nonterminal->ValueFieldName()) + "()");
+        }
+    }
+    formatter.WriteLine(" {}");
+    m = int(rule->InheritedAttributes().size());
+    for (int j = 0; j < m; ++j)
+    {
+        const AttrOrVariable& attr = rule->InheritedAttributes()[j];
+        formatter.WriteLine(ToUtf8(attr.TypeName()) + " " + ToUtf8(attr.Name()) + ";");
+    }
+    if (!rule->ValueTypeName().empty())
+    {
+        formatter.WriteLine(ToUtf8(rule->ValueTypeName()) + " value;");
+    }
+    m = int(rule->LocalVariables().size());
+    for (int j = 0; j < m; ++j)
+    {
+        const AttrOrVariable& var = rule->LocalVariables()[j];
+        formatter.WriteLine(ToUtf8(var.TypeName()) + " " + ToUtf8(var.Name()) + ";");
+    }
+    m = int(rule->Nonterminals().size());
+    for (int j = 0; j < m; ++j)
+    {
+        NonterminalParser* nonterminal = rule->Nonterminals()[j];
+        if (!nonterminal->GetRule()->ValueTypeName().empty())
+        {
+            formatter.WriteLine(ToUtf8(nonterminal->GetRule()->ValueTypeName()) + " " + ToUtf8(nonterminal->ValueFieldName()) + ";");
+        }
+    }
+    formatter.DecIndent();
+    formatter.WriteLine("};");
+    formatter.DecIndent();
+    formatter.WriteLine("};");
+    formatter.NewLine();
+}
+
 void CodeGeneratorVisitor::EndVisit(Grammar& grammar)
 {
     if (!grammar.StartRuleName().empty())
@@ -493,6 +544,11 @@ void CodeGeneratorVisitor::EndVisit(Grammar& grammar)
         if (rule->Specialized())
         {
             hppFormatter.WriteLine("class " + ToUtf8(rule->SpecializedTypeName()) + ";");
+            if (ruleClasses)
+            {
+                hppFormatter.WriteLine("static soul::parsing::Rule* New" + ToUtf8(rule->SpecializedTypeName()) + 
+                    "(const std::u32string& ruleName, soul::parsing::Scope* enclosingScope, int ruleId, soul::parsing::Parser* definition);");
+            }
         }
     }
 
@@ -803,7 +859,7 @@ void CodeGeneratorVisitor::BeginVisit(Rule& rule)
 {
     if (rule.Specialized())
     {
-        cppFormatter.Write("AddRule(new " + ToUtf8(rule.SpecializedTypeName()) + "(ToUtf32(\"" + ToUtf8(rule.Name()) + "\"), GetScope(), GetParsingDomain()->GetNextRuleId(),");
+        cppFormatter.Write("AddRule(" + RuleClassCreator(rule) + "(ToUtf32(\"" + ToUtf8(rule.Name()) + "\"), GetScope(), GetParsingDomain()->GetNextRuleId(),");
     }
     else
     {
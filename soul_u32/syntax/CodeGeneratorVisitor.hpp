@@ -21,6 +21,9 @@ class CodeGeneratorVisitor : public soul::parsing::Visitor
 {
 public:
     CodeGeneratorVisitor(CodeFormatter& cppFormatter_, CodeFormatter& hppFormatter_);
+    //  Writes each rule class to its own entry of ruleClasses instead of the cpp formatter, so that the rule classes can be compiled in separate translation units.
+    //  The grammar then creates its rules through static factory functions that are defined next to the rule classes.
+    CodeGeneratorVisitor(CodeFormatter& cppFormatter_, CodeFormatter& hppFormatter_, std::vector<std::string>& ruleClasses_);
     virtual void BeginVisit(Grammar& grammar);
     virtual void EndVisit(Grammar& grammar);
     virtual void Visit(CharParser& parser);
@@ -114,7 +117,10 @@ public:
 private:
     CodeFormatter& cppFormatter;
     CodeFormatter& hppFormatter;
+    std::vector<std::string>* ruleClasses;
     std::string CharSetStr();
+    std::string RuleClassCreator(Rule& rule) const;
+    void GenerateRuleClass(Grammar& grammar, Rule* rule, CodeFormatter& formatter);
 };
 
 } } // namespace soul::syntax
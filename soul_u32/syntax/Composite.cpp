@@ -39,6 +39,11 @@ CompositeGrammar::CompositeGrammar(soul::parsing::ParsingDomain* parsingDomain_)
 }
 
 soul::parsing::Parser* CompositeGrammar::Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, soul::parsing::Scope* enclosingScope)
+{
+    return Parse(start, end, fileIndex, fileName, nullptr, enclosingScope);
+}
+
+soul::parsing::Parser* CompositeGrammar::Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, const soul::parsing::ParsingLimits* limits, soul::parsing::Scope* enclosingScope)
 {
     soul::parsing::Scanner scanner(start, end, fileName, fileIndex, SkipRule());
     std::unique_ptr<soul::parsing::XmlLog> xmlLog;
@@ -51,8 +56,8 @@ soul::parsing::Parser* CompositeGrammar::Parse(const char32_t* start, const char
     soul::parsing::ObjectStack stack;
     std::unique_ptr<soul::parsing::ParsingData> parsingData(new soul::parsing::ParsingData(GetParsingDomain()->GetNumRules()));
     scanner.SetParsingData(parsingData.get());
-    stack.push(std::unique_ptr<soul::parsing::Object>(new ValueObject<soul::parsing::Scope*>(enclosingScope)));
-    soul::parsing::Match match = soul::parsing::Grammar::Parse(scanner, stack, parsingData.get());
+    soul::parsing::PushValue<soul::parsing::Scope*>(stack, enclosingScope);
+    soul::parsing::Match match = soul::parsing::Grammar::Parse(scanner, stack, parsingData.get(), limits);
     soul::parsing::Span stop = scanner.GetSpan();
     if (Log())
     {
@@ -69,10 +74,7 @@ soul::parsing::Parser* CompositeGrammar::Parse(const char32_t* start, const char
             throw soul::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<soul::parsing::Object> value = std::move(stack.top());
-    soul::parsing::Parser* result = *static_cast<soul::parsing::ValueObject<soul::parsing::Parser*>*>(value.get());
-    stack.pop();
-    return result;
+    return soul::parsing::PopValue<soul::parsing::Parser*>(stack);
 }
 
 class CompositeGrammar::AlternativeRule : public soul::parsing::Rule
@@ -86,18 +88,14 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> enclosingScope_value = std::move(stack.top());
-        context->enclosingScope = *static_cast<soul::parsing::ValueObject<soul::parsing::Scope*>*>(enclosingScope_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->enclosingScope = soul::parsing::PopValue<soul::parsing::Scope*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Parser*>(context->value)));
+            soul::parsing::PushValue<soul::parsing::Parser*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -116,42 +114,38 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromleft;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new AlternativeParser(context->value, context->fromright);
     }
     void Preleft(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Scope*>(context->enclosingScope)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::parsing::Scope*>(stack, context->enclosingScope);
     }
     void Postleft(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<soul::parsing::ValueObject<soul::parsing::Parser*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = soul::parsing::PopValue<soul::parsing::Parser*>(stack);
         }
     }
     void Preright(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Scope*>(context->enclosingScope)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::parsing::Scope*>(stack, context->enclosingScope);
     }
     void Postright(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<soul::parsing::ValueObject<soul::parsing::Parser*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = soul::parsing::PopValue<soul::parsing::Parser*>(stack);
         }
     }
 private:
@@ -176,18 +170,14 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> enclosingScope_value = std::move(stack.top());
-        context->enclosingScope = *static_cast<soul::parsing::ValueObject<soul::parsing::Scope*>*>(enclosingScope_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->enclosingScope = soul::parsing::PopValue<soul::parsing::Scope*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Parser*>(context->value)));
+            soul::parsing::PushValue<soul::parsing::Parser*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -206,42 +196,38 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromleft;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new SequenceParser(context->value, context->fromright);
     }
     void Preleft(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Scope*>(context->enclosingScope)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::parsing::Scope*>(stack, context->enclosingScope);
     }
     void Postleft(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<soul::parsing::ValueObject<soul::parsing::Parser*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = soul::parsing::PopValue<soul::parsing::Parser*>(stack);
         }
     }
     void Preright(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Scope*>(context->enclosingScope)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::parsing::Scope*>(stack, context->enclosingScope);
     }
     void Postright(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<soul::parsing::ValueObject<soul::parsing::Parser*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = soul::parsing::PopValue<soul::parsing::Parser*>(stack);
         }
     }
 private:
@@ -266,18 +252,14 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> enclosingScope_value = std::move(stack.top());
-        context->enclosingScope = *static_cast<soul::parsing::ValueObject<soul::parsing::Scope*>*>(enclosingScope_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->enclosingScope = soul::parsing::PopValue<soul::parsing::Scope*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Parser*>(context->value)));
+            soul::parsing::PushValue<soul::parsing::Parser*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -296,42 +278,38 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromleft;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new DifferenceParser(context->value, context->fromright);
     }
     void Preleft(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Scope*>(context->enclosingScope)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::parsing::Scope*>(stack, context->enclosingScope);
     }
     void Postleft(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<soul::parsing::ValueObject<soul::parsing::Parser*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = soul::parsing::PopValue<soul::parsing::Parser*>(stack);
         }
     }
     void Preright(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Scope*>(context->enclosingScope)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::parsing::Scope*>(stack, context->enclosingScope);
     }
     void Postright(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<soul::parsing::ValueObject<soul::parsing::Parser*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = soul::parsing::PopValue<soul::parsing::Parser*>(stack);
         }
     }
 private:
@@ -356,18 +334,14 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> enclosingScope_value = std::move(stack.top());
-        context->enclosingScope = *static_cast<soul::parsing::ValueObject<soul::parsing::Scope*>*>(enclosingScope_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->enclosingScope = soul::parsing::PopValue<soul::parsing::Scope*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Parser*>(context->value)));
+            soul::parsing::PushValue<soul::parsing::Parser*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -386,42 +360,38 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromleft;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new ExclusiveOrParser(context->value, context->fromright);
     }
     void Preleft(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Scope*>(context->enclosingScope)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::parsing::Scope*>(stack, context->enclosingScope);
     }
     void Postleft(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<soul::parsing::ValueObject<soul::parsing::Parser*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = soul::parsing::PopValue<soul::parsing::Parser*>(stack);
         }
     }
     void Preright(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Scope*>(context->enclosingScope)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::parsing::Scope*>(stack, context->enclosingScope);
     }
     void Postright(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<soul::parsing::ValueObject<soul::parsing::Parser*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = soul::parsing::PopValue<soul::parsing::Parser*>(stack);
         }
     }
 private:
@@ -446,18 +416,14 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> enclosingScope_value = std::move(stack.top());
-        context->enclosingScope = *static_cast<soul::parsing::ValueObject<soul::parsing::Scope*>*>(enclosingScope_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->enclosingScope = soul::parsing::PopValue<soul::parsing::Scope*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Parser*>(context->value)));
+            soul::parsing::PushValue<soul::parsing::Parser*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -476,42 +442,38 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromleft;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new IntersectionParser(context->value, context->fromright);
     }
     void Preleft(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Scope*>(context->enclosingScope)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::parsing::Scope*>(stack, context->enclosingScope);
     }
     void Postleft(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<soul::parsing::ValueObject<soul::parsing::Parser*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = soul::parsing::PopValue<soul::parsing::Parser*>(stack);
         }
     }
     void Preright(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Scope*>(context->enclosingScope)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::parsing::Scope*>(stack, context->enclosingScope);
     }
     void Postright(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<soul::parsing::ValueObject<soul::parsing::Parser*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = soul::parsing::PopValue<soul::parsing::Parser*>(stack);
         }
     }
 private:
@@ -536,18 +498,14 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> enclosingScope_value = std::move(stack.top());
-        context->enclosingScope = *static_cast<soul::parsing::ValueObject<soul::parsing::Scope*>*>(enclosingScope_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->enclosingScope = soul::parsing::PopValue<soul::parsing::Scope*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Parser*>(context->value)));
+            soul::parsing::PushValue<soul::parsing::Parser*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -566,42 +524,38 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromleft;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new ListParser(context->value, context->fromright);
     }
     void Preleft(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Scope*>(context->enclosingScope)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::parsing::Scope*>(stack, context->enclosingScope);
     }
     void Postleft(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<soul::parsing::ValueObject<soul::parsing::Parser*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = soul::parsing::PopValue<soul::parsing::Parser*>(stack);
         }
     }
     void Preright(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Scope*>(context->enclosingScope)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::parsing::Scope*>(stack, context->enclosingScope);
     }
     void Postright(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<soul::parsing::ValueObject<soul::parsing::Parser*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = soul::parsing::PopValue<soul::parsing::Parser*>(stack);
         }
     }
 private:
@@ -626,18 +580,14 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> enclosingScope_value = std::move(stack.top());
-        context->enclosingScope = *static_cast<soul::parsing::ValueObject<soul::parsing::Scope*>*>(enclosingScope_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->enclosingScope = soul::parsing::PopValue<soul::parsing::Scope*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Parser*>(context->value)));
+            soul::parsing::PushValue<soul::parsing::Parser*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -657,37 +607,35 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromPrimary;
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new KleeneStarParser(context->value);
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new PositiveParser(context->value);
     }
     void A3Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new OptionalParser(context->value);
     }
     void PrePrimary(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Scope*>(context->enclosingScope)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::parsing::Scope*>(stack, context->enclosingScope);
     }
     void PostPrimary(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromPrimary_value = std::move(stack.top());
-            context->fromPrimary = *static_cast<soul::parsing::ValueObject<soul::parsing::Parser*>*>(fromPrimary_value.get());
-            stack.pop();
+            context->fromPrimary = soul::parsing::PopValue<soul::parsing::Parser*>(stack);
         }
     }
 private:
@@ -98,6 +98,11 @@ ElementGrammar::ElementGrammar(soul::parsing::ParsingDomain* parsingDomain_): so
 }
 
 void ElementGrammar::Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, soul::parsing::Grammar* grammar)
+{
+    Parse(start, end, fileIndex, fileName, nullptr, grammar);
+}
+
+void ElementGrammar::Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, const soul::parsing::ParsingLimits* limits, soul::parsing::Grammar* grammar)
 {
     soul::parsing::Scanner scanner(start, end, fileName, fileIndex, SkipRule());
     std::unique_ptr<soul::parsing::XmlLog> xmlLog;
@@ -110,8 +115,8 @@ void ElementGrammar::Parse(const char32_t* start, const char32_t* end, int fileI
     soul::parsing::ObjectStack stack;
     std::unique_ptr<soul::parsing::ParsingData> parsingData(new soul::parsing::ParsingData(GetParsingDomain()->GetNumRules()));
     scanner.SetParsingData(parsingData.get());
-    stack.push(std::unique_ptr<soul::parsing::Object>(new ValueObject<soul::parsing::Grammar*>(grammar)));
-    soul::parsing::Match match = soul::parsing::Grammar::Parse(scanner, stack, parsingData.get());
+    soul::parsing::PushValue<soul::parsing::Grammar*>(stack, grammar);
+    soul::parsing::Match match = soul::parsing::Grammar::Parse(scanner, stack, parsingData.get(), limits);
     soul::parsing::Span stop = scanner.GetSpan();
     if (Log())
     {
@@ -140,11 +145,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> grammar_value = std::move(stack.top());
-        context->grammar = *static_cast<soul::parsing::ValueObject<soul::parsing::Grammar*>*>(grammar_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->grammar = soul::parsing::PopValue<soul::parsing::Grammar*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -165,46 +167,40 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         RuleLink * link(new RuleLink(context->fromaliasName, context->grammar, context->fromruleName));
         link->SetSpan(span);
         context->grammar->AddRuleLink(link);
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         RuleLink * link(new RuleLink(context->grammar, context->fromqualified_id));
         link->SetSpan(span);
         context->grammar->AddRuleLink(link);
     }
     void PostaliasName(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromaliasName_value = std::move(stack.top());
-            context->fromaliasName = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromaliasName_value.get());
-            stack.pop();
+            context->fromaliasName = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
     void PostruleName(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromruleName_value = std::move(stack.top());
-            context->fromruleName = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromruleName_value.get());
-            stack.pop();
+            context->fromruleName = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
     void Postqualified_id(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromqualified_id_value = std::move(stack.top());
-            context->fromqualified_id = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromqualified_id_value.get());
-            stack.pop();
+            context->fromqualified_id = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
 private:
@@ -228,11 +224,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> rule_value = std::move(stack.top());
-        context->rule = *static_cast<soul::parsing::ValueObject<soul::parsing::Rule*>*>(rule_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->rule = soul::parsing::PopValue<soul::parsing::Rule*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -247,13 +240,13 @@ public:
     }
     void PreParameterList(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Rule*>(context->rule)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::parsing::Rule*>(stack, context->rule);
     }
     void PreReturnType(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Rule*>(context->rule)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::parsing::Rule*>(stack, context->rule);
     }
 private:
     struct Context : soul::parsing::Context
@@ -273,11 +266,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> rule_value = std::move(stack.top());
-        context->rule = *static_cast<soul::parsing::ValueObject<soul::parsing::Rule*>*>(rule_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->rule = soul::parsing::PopValue<soul::parsing::Rule*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -292,13 +282,13 @@ public:
     }
     void PreVariable(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Rule*>(context->rule)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::parsing::Rule*>(stack, context->rule);
     }
     void PreParameter(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Rule*>(context->rule)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::parsing::Rule*>(stack, context->rule);
     }
 private:
     struct Context : soul::parsing::Context
@@ -318,11 +308,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> rule_value = std::move(stack.top());
-        context->rule = *static_cast<soul::parsing::ValueObject<soul::parsing::Rule*>*>(rule_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->rule = soul::parsing::PopValue<soul::parsing::Rule*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -339,28 +326,24 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->rule->AddLocalVariable(AttrOrVariable(context->fromTypeId->ToString(), context->fromDeclarator));
         delete context->fromTypeId;
     }
     void PostTypeId(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromTypeId_value = std::move(stack.top());
-            context->fromTypeId = *static_cast<soul::parsing::ValueObject<soul::codedom::TypeId*>*>(fromTypeId_value.get());
-            stack.pop();
+            context->fromTypeId = soul::parsing::PopValue<soul::codedom::TypeId*>(stack);
         }
     }
     void PostDeclarator(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromDeclarator_value = std::move(stack.top());
-            context->fromDeclarator = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromDeclarator_value.get());
-            stack.pop();
+            context->fromDeclarator = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
 private:
@@ -383,11 +366,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> rule_value = std::move(stack.top());
-        context->rule = *static_cast<soul::parsing::ValueObject<soul::parsing::Rule*>*>(rule_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->rule = soul::parsing::PopValue<soul::parsing::Rule*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -404,28 +384,24 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->rule->AddInheritedAttribute(AttrOrVariable(context->fromTypeId->ToString(), context->fromDeclarator));
         delete context->fromTypeId;
     }
     void PostTypeId(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromTypeId_value = std::move(stack.top());
-            context->fromTypeId = *static_cast<soul::parsing::ValueObject<soul::codedom::TypeId*>*>(fromTypeId_value.get());
-            stack.pop();
+            context->fromTypeId = soul::parsing::PopValue<soul::codedom::TypeId*>(stack);
         }
     }
     void PostDeclarator(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromDeclarator_value = std::move(stack.top());
-            context->fromDeclarator = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromDeclarator_value.get());
-            stack.pop();
+            context->fromDeclarator = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
 private:
@@ -448,11 +424,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> rule_value = std::move(stack.top());
-        context->rule = *static_cast<soul::parsing::ValueObject<soul::parsing::Rule*>*>(rule_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->rule = soul::parsing::PopValue<soul::parsing::Rule*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -467,18 +440,16 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->rule->SetValueTypeName(context->fromTypeId->ToString());
         delete context->fromTypeId;
     }
     void PostTypeId(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromTypeId_value = std::move(stack.top());
-            context->fromTypeId = *static_cast<soul::parsing::ValueObject<soul::codedom::TypeId*>*>(fromTypeId_value.get());
-            stack.pop();
+            context->fromTypeId = soul::parsing::PopValue<soul::codedom::TypeId*>(stack);
         }
     }
 private:
@@ -500,15 +471,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<std::u32string>(context->value)));
+            soul::parsing::PushValue<std::u32string>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -521,17 +490,15 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = std::u32string(matchBegin, matchEnd);
     }
     void Postidentifier(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromidentifier_value = std::move(stack.top());
-            context->fromidentifier = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromidentifier_value.get());
-            stack.pop();
+            context->fromidentifier = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
 private:
@@ -553,15 +520,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<std::u32string>(context->value)));
+            soul::parsing::PushValue<std::u32string>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -576,27 +541,23 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = std::u32string(matchBegin, matchEnd);
     }
     void Postfirst(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromfirst_value = std::move(stack.top());
-            context->fromfirst = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromfirst_value.get());
-            stack.pop();
+            context->fromfirst = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
     void Postrest(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromrest_value = std::move(stack.top());
-            context->fromrest = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromrest_value.get());
-            stack.pop();
+            context->fromrest = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
 private:
@@ -619,11 +580,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> array_value = std::move(stack.top());
-        context->array = *static_cast<soul::parsing::ValueObject<std::vector<std::u32string>*>*>(array_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->array = soul::parsing::PopValue<std::vector<std::u32string>*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -638,17 +596,15 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->array->push_back(context->fromstr);
     }
     void Poststr(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromstr_value = std::move(stack.top());
-            context->fromstr = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromstr_value.get());
-            stack.pop();
+            context->fromstr = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
 private:
@@ -663,16 +619,16 @@ private:
 void ElementGrammar::GetReferencedGrammars()
 {
     soul::parsing::ParsingDomain* pd = GetParsingDomain();
-    soul::parsing::Grammar* grammar0 = pd->GetGrammar(ToUtf32("soul.parsing.stdlib"));
+    soul::parsing::Grammar* grammar0 = pd->GetGrammar(ToUtf32("soul.code.DeclaratorGrammar"));
     if (!grammar0)
     {
-        grammar0 = soul::parsing::stdlib::Create(pd);
+        grammar0 = soul::code::DeclaratorGrammar::Create(pd);
     }
     AddGrammarReference(grammar0);
-    soul::parsing::Grammar* grammar1 = pd->GetGrammar(ToUtf32("soul.code.DeclaratorGrammar"));
+    soul::parsing::Grammar* grammar1 = pd->GetGrammar(ToUtf32("soul.parsing.stdlib"));
     if (!grammar1)
     {
-        grammar1 = soul::code::DeclaratorGrammar::Create(pd);
+        grammar1 = soul::parsing::stdlib::Create(pd);
     }
     AddGrammarReference(grammar1);
 }
@@ -680,10 +636,10 @@ void ElementGrammar::GetReferencedGrammars()
 void ElementGrammar::CreateRules()
 {
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("qualified_id"), this, ToUtf32("soul.parsing.stdlib.qualified_id")));
-    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("TypeId"), this, ToUtf32("soul.code.DeclaratorGrammar.TypeId")));
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("identifier"), this, ToUtf32("soul.parsing.stdlib.identifier")));
-    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("Declarator"), this, ToUtf32("soul.code.DeclaratorGrammar.Declarator")));
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("string"), this, ToUtf32("soul.parsing.stdlib.string")));
+    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("TypeId"), this, ToUtf32("soul.code.DeclaratorGrammar.TypeId")));
+    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("Declarator"), this, ToUtf32("soul.code.DeclaratorGrammar.Declarator")));
     AddRule(new RuleLinkRule(ToUtf32("RuleLink"), GetScope(), GetParsingDomain()->GetNextRuleId(),
         new soul::parsing::AlternativeParser(
             new soul::parsing::ActionParser(ToUtf32("A0"),
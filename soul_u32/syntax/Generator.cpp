@@ -9,14 +9,25 @@
 #include <soul_u32/syntax/ParserFile.hpp>
 #include <soul_u32/syntax/Library.hpp>
 #include <soul_u32/syntax/CodeGenerator.hpp>
+#include <soul_u32/syntax/BuildCache.hpp>
+#include <soul_u32/codedom/Arena.hpp>
 #include <soul_u32/util/TextUtils.hpp>
 #include <soul_u32/util/MappedInputFile.hpp>
 #include <soul_u32/util/Unicode.hpp>
 #include <soul_u32/parsing/Linking.hpp>
 #include <soul_u32/parsing/ParsingDomain.hpp>
 #include <soul_u32/parsing/Exception.hpp>
+#include <soul_u32/parsing/Grammar.hpp>
+#include <soul_u32/parsing/Rule.hpp>
+#include <soul_u32/parsing/Nonterminal.hpp>
+#include <soul_u32/parsing/Keyword.hpp>
+#include <soul_u32/parsing/Namespace.hpp>
+#include <soul_u32/parsing/Visitor.hpp>
 #include <boost/filesystem.hpp>
 #include <iostream>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace soul { namespace syntax {
 
@@ -46,51 +57,259 @@ std::string ResolveReferenceFilePath(const std::string& relativeReferenceFilePat
     throw std::runtime_error("library file path '" + relativeReferenceFilePath + "' not found");
 }
 
-void Generate(const std::string& projectFilePath, const std::vector<std::string>& libraryDirectories)
+//  Collects the grammars that the grammars of a parser file refer to through rule links, nonterminals and keyword rules.
+
+class ReferencedGrammarCollectorVisitor : public soul::parsing::Visitor
+{
+public:
+    ReferencedGrammarCollectorVisitor(int id_) : id(id_), currentGrammar(nullptr)
+    {
+    }
+    virtual void BeginVisit(soul::parsing::Grammar& grammar)
+    {
+        if (!grammar.IsExternal() && grammar.Owner() == id)
+        {
+            currentGrammar = &grammar;
+        }
+        else
+        {
+            currentGrammar = nullptr;
+        }
+    }
+    virtual void EndVisit(soul::parsing::Grammar&)
+    {
+        currentGrammar = nullptr;
+    }
+    virtual void Visit(soul::parsing::RuleLink& link)
+    {
+        AddReference(link.GetRule());
+    }
+    virtual void Visit(soul::parsing::NonterminalParser& parser)
+    {
+        AddReference(parser.GetRule());
+    }
+    virtual void Visit(soul::parsing::KeywordParser& parser)
+    {
+        if (!parser.ContinuationRuleName().empty())
+        {
+            AddReference(parser.ContinuationRule());
+        }
+    }
+    virtual void Visit(soul::parsing::KeywordListParser& parser)
+    {
+        AddReference(parser.SelectorRule());
+    }
+    const std::unordered_set<soul::parsing::Grammar*>& ReferencedGrammars() const { return referencedGrammars; }
+private:
+    int id;
+    soul::parsing::Grammar* currentGrammar;
+    std::unordered_set<soul::parsing::Grammar*> referencedGrammars;
+    void AddReference(soul::parsing::Rule* rule)
+    {
+        if (currentGrammar && rule && rule->GetGrammar() && rule->GetGrammar() != currentGrammar)
+        {
+            referencedGrammars.insert(rule->GetGrammar());
+        }
+    }
+};
+
+//  Maps the grammars declared by a library file to the library file path.
+
+class LibraryGrammarCollectorVisitor : public soul::parsing::Visitor
+{
+public:
+    LibraryGrammarCollectorVisitor(const std::string& libraryFilePath_, std::unordered_map<soul::parsing::Grammar*, std::string>& libraryGrammarMap_) : 
+        libraryFilePath(libraryFilePath_), libraryGrammarMap(libraryGrammarMap_)
+    {
+    }
+    virtual void BeginVisit(soul::parsing::Grammar& grammar)
+    {
+        if (grammar.IsExternal())
+        {
+            libraryGrammarMap.insert(std::make_pair(&grammar, libraryFilePath));
+        }
+    }
+private:
+    const std::string& libraryFilePath;
+    std::unordered_map<soul::parsing::Grammar*, std::string>& libraryGrammarMap;
+};
+
+//  Collects the grammars parsed from source files.
+
+class SourceGrammarCollectorVisitor : public soul::parsing::Visitor
+{
+public:
+    virtual void BeginVisit(soul::parsing::Grammar& grammar)
+    {
+        if (!grammar.IsExternal())
+        {
+            sourceGrammars.push_back(&grammar);
+        }
+    }
+    const std::vector<soul::parsing::Grammar*>& SourceGrammars() const { return sourceGrammars; }
+private:
+    std::vector<soul::parsing::Grammar*> sourceGrammars;
+};
+
+struct LibraryDomain
+{
+    std::vector<std::pair<std::string, std::string>> libraryFiles;
+    std::unique_ptr<soul::parsing::ParsingDomain> parsingDomain;
+    std::unordered_map<soul::parsing::Grammar*, std::string> libraryGrammarMap;
+};
+
+GeneratorContext::GeneratorContext() : projectParsingDomain(new soul::parsing::ParsingDomain())
 {
-    std::cout << "Parsing project file " << projectFilePath << "...\n";
-    std::unique_ptr<soul::parsing::ParsingDomain> projectParsingDomain(new soul::parsing::ParsingDomain());
     projectParsingDomain->SetOwned();
-    ProjectFileGrammar* projectFileGrammar = ProjectFileGrammar::Create(projectParsingDomain.get());
-    LibraryFileGrammar* libraryFileGrammar = LibraryFileGrammar::Create(projectParsingDomain.get());
-    ParserFileGrammar* parserFileGrammar = ParserFileGrammar::Create(projectParsingDomain.get());
+    projectFileGrammar = ProjectFileGrammar::Create(projectParsingDomain.get());
+    libraryFileGrammar = LibraryFileGrammar::Create(projectParsingDomain.get());
+    parserFileGrammar = ParserFileGrammar::Create(projectParsingDomain.get());
+}
+
+GeneratorContext::~GeneratorContext()
+{
+}
+
+LibraryDomain* GeneratorContext::GetLibraryDomain(const std::string& projectFilePath, const std::vector<std::pair<std::string, std::string>>& libraryFiles)
+{
+    std::unique_ptr<LibraryDomain>& libraryDomain = libraryDomains[projectFilePath];
+    if (libraryDomain && libraryDomain->libraryFiles == libraryFiles)
+    {
+        std::cout << "Using parsed library files...\n";
+        return libraryDomain.get();
+    }
+    libraryDomain.reset(new LibraryDomain());
+    libraryDomain->libraryFiles = libraryFiles;
+    libraryDomain->parsingDomain.reset(new soul::parsing::ParsingDomain());
+    libraryDomain->parsingDomain->SetOwned();
+    std::cout << "Parsing library files...\n";
+    int n = int(libraryFiles.size());
+    for (int i = 0; i < n; ++i)
+    {
+        const std::string& libraryFilePath = libraryFiles[i].first;
+        std::cout << "> " << libraryFilePath << "\n";
+        std::u32string libraryFileContent = ToUtf32(ReadFile(libraryFilePath));
+        libraryFileGrammar->Parse(&libraryFileContent[0], &libraryFileContent[0] + libraryFileContent.length(), i, libraryFilePath, libraryDomain->parsingDomain.get());
+        LibraryGrammarCollectorVisitor libraryGrammarCollector(libraryFilePath, libraryDomain->libraryGrammarMap);
+        libraryDomain->parsingDomain->GlobalNamespace()->Accept(libraryGrammarCollector);
+    }
+    return libraryDomain.get();
+}
+
+void GeneratorContext::Generate(const std::string& projectFilePath, const std::vector<std::string>& libraryDirectories, const std::string& generatorVersion)
+{
+    std::cout << "Parsing project file " << projectFilePath << "...\n";
     std::u32string projectFileContent = ToUtf32(ReadFile(projectFilePath));
     std::unique_ptr<Project> project(projectFileGrammar->Parse(&projectFileContent[0], &projectFileContent[0] + projectFileContent.length(), 0, projectFilePath));
     std::cout << "Compiling project '" << project->Name() << "'...\n";
-    std::unique_ptr<soul::parsing::ParsingDomain> parsingDomain(new soul::parsing::ParsingDomain());
-    parsingDomain->SetOwned();
-    std::cout << "Parsing library files...\n";
+    BuildCache buildCache(path(project->FilePath()).replace_extension(".cache").generic_string(), generatorVersion);
+    buildCache.Read();
+    buildCache.AddFile(project->FilePath());
+    std::vector<std::pair<std::string, std::string>> libraryFiles;
     const std::vector<std::string>& referenceFiles = project->ReferenceFiles();
     int nr = int(referenceFiles.size());
     for (int i = 0; i < nr; ++i)
     {
-        std::string relativeReferenceFilePath = referenceFiles[i];
-        std::string referenceFilePath = ResolveReferenceFilePath(relativeReferenceFilePath, project->BasePath(), libraryDirectories);
-        std::cout << "> " << referenceFilePath << "\n";
-        std::u32string libraryFileContent = ToUtf32(ReadFile(referenceFilePath));
-        libraryFileGrammar->Parse(&libraryFileContent[0], &libraryFileContent[0] + libraryFileContent.length(), i, referenceFilePath, parsingDomain.get());
+        std::string referenceFilePath = ResolveReferenceFilePath(referenceFiles[i], project->BasePath(), libraryDirectories);
+        buildCache.AddFile(referenceFilePath);
+        libraryFiles.push_back(std::make_pair(referenceFilePath, *buildCache.GetCurrentHash(referenceFilePath)));
     }
-    std::cout << "Parsing source files...\n";
-    std::vector<std::unique_ptr<ParserFileContent>> parserFiles;
     const std::vector<std::string>& sourceFiles = project->SourceFiles();
-    soul::parsing::SetFileInfo(sourceFiles);
     int n = int(sourceFiles.size());
     for (int i = 0; i < n; ++i)
     {
-        std::string sourceFilePath = sourceFiles[i];
-        std::cout << "> " << sourceFilePath << "\n";
-        std::u32string sourceFileContent = ToUtf32(ReadFile(sourceFilePath));
-        std::unique_ptr<ParserFileContent> parserFileContent(parserFileGrammar->Parse(&sourceFileContent[0], &sourceFileContent[0] + sourceFileContent.length(), i, sourceFilePath, i, parsingDomain.get()));
-        parserFiles.push_back(std::move(parserFileContent));
-    }
-    std::cout << "Linking...\n";
-    soul::parsing::Link(parsingDomain.get());
-    std::cout << "Expanding code...\n";
-    soul::parsing::ExpandCode(parsingDomain.get());
-    std::cout << "Generating source code...\n";
-    GenerateCode(parserFiles);
-    std::cout << "Generating library file...\n";
-    GenerateLibraryFile(project.get(), parsingDomain.get());
+        buildCache.AddFile(sourceFiles[i]);
+    }
+    std::string projectLibraryFilePath = path(project->FilePath()).replace_extension(".pl").generic_string();
+    bool projectUpToDate = !ForceCodeGen() && buildCache.IsUpToDate(project->FilePath()) && exists(projectLibraryFilePath);
+    std::vector<bool> sourceFileUpToDate;
+    for (int i = 0; i < n; ++i)
+    {
+        bool upToDate = !ForceCodeGen() && buildCache.IsUpToDate(sourceFiles[i]);
+        sourceFileUpToDate.push_back(upToDate);
+        if (!upToDate)
+        {
+            projectUpToDate = false;
+        }
+    }
+    if (projectUpToDate)
+    {
+        std::cout << "Project '" << project->Name() << "' is up to date.\n";
+        return;
+    }
+    LibraryDomain* libraryDomain = GetLibraryDomain(project->FilePath(), libraryFiles);
+    soul::parsing::ParsingDomain* parsingDomain = libraryDomain->parsingDomain.get();
+    //  The code of the semantic actions is parsed into an arena that is freed in one go after the build.
+    //  It is declared outside the try block, because the grammars referring to it are removed in the handler on failure.
+    soul::codedom::Arena codeArena;
+    try
+    {
+        soul::codedom::ArenaScope codeArenaScope(&codeArena);
+        std::cout << "Parsing source files...\n";
+        std::vector<std::unique_ptr<ParserFileContent>> parserFiles;
+        soul::parsing::SetFileInfo(sourceFiles);
+        for (int i = 0; i < n; ++i)
+        {
+            std::string sourceFilePath = sourceFiles[i];
+            std::cout << "> " << sourceFilePath << "\n";
+            std::u32string sourceFileContent = ToUtf32(ReadFile(sourceFilePath));
+            std::unique_ptr<ParserFileContent> parserFileContent(parserFileGrammar->Parse(&sourceFileContent[0], &sourceFileContent[0] + sourceFileContent.length(), i, sourceFilePath, i, parsingDomain));
+            parserFiles.push_back(std::move(parserFileContent));
+        }
+        std::cout << "Linking...\n";
+        soul::parsing::Link(parsingDomain);
+        std::cout << "Expanding code...\n";
+        soul::parsing::ExpandCode(parsingDomain);
+        std::cout << "Generating source code...\n";
+        for (int i = 0; i < n; ++i)
+        {
+            ParserFileContent* parserFile = parserFiles[i].get();
+            if (!sourceFileUpToDate[i] || !OutputFilesExist(parserFile))
+            {
+                GenerateCode(parserFile);
+            }
+            ReferencedGrammarCollectorVisitor referencedGrammarCollector(parserFile->Id());
+            parsingDomain->GlobalNamespace()->Accept(referencedGrammarCollector);
+            std::set<std::string> dependencies;
+            for (soul::parsing::Grammar* grammar : referencedGrammarCollector.ReferencedGrammars())
+            {
+                if (grammar->IsExternal())
+                {
+                    std::unordered_map<soul::parsing::Grammar*, std::string>::const_iterator it = libraryDomain->libraryGrammarMap.find(grammar);
+                    if (it != libraryDomain->libraryGrammarMap.cend())
+                    {
+                        dependencies.insert(it->second);
+                    }
+                }
+                else if (grammar->Owner() >= 0 && grammar->Owner() < n && grammar->Owner() != parserFile->Id())
+                {
+                    dependencies.insert(sourceFiles[grammar->Owner()]);
+                }
+            }
+            buildCache.Update(sourceFiles[i], dependencies);
+        }
+        std::cout << "Generating library file...\n";
+        GenerateLibraryFile(project.get(), parsingDomain);
+        buildCache.Update(project->FilePath(), std::set<std::string>(sourceFiles.cbegin(), sourceFiles.cend()));
+        buildCache.Write();
+        SourceGrammarCollectorVisitor sourceGrammarCollector;
+        parsingDomain->GlobalNamespace()->Accept(sourceGrammarCollector);
+        for (soul::parsing::Grammar* grammar : sourceGrammarCollector.SourceGrammars())
+        {
+            parsingDomain->RemoveGrammar(grammar);
+        }
+    }
+    catch (...)
+    {
+        libraryDomains.erase(project->FilePath());
+        throw;
+    }
+}
+
+void Generate(const std::string& projectFilePath, const std::vector<std::string>& libraryDirectories, const std::string& generatorVersion)
+{
+    GeneratorContext context;
+    context.Generate(projectFilePath, libraryDirectories, generatorVersion);
 }
 
 } } // namespace soul::syntax
@@ -6,12 +6,41 @@
 #ifndef SOUL_SYNTAX_COMPILER_INCLUDED
 #define SOUL_SYNTAX_COMPILER_INCLUDED
 
+#include <soul_u32/parsing/ParsingDomain.hpp>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace soul { namespace syntax {
 
-void Generate(const std::string& projectFilePath, const std::vector<std::string>& libraryDirectories);
+class ProjectFileGrammar;
+class LibraryFileGrammar;
+class ParserFileGrammar;
+struct LibraryDomain;
+
+//  GeneratorContext holds the grammars for project, library and parser files, and for each project the parsing domain containing its parsed library files.
+//  A library domain is reused by later builds of the same project as long as the content of the library files has not changed;
+//  the grammars of the source files are removed from it after each build.
+
+class GeneratorContext
+{
+public:
+    GeneratorContext();
+    ~GeneratorContext();
+    GeneratorContext(const GeneratorContext&) = delete;
+    GeneratorContext& operator=(const GeneratorContext&) = delete;
+    void Generate(const std::string& projectFilePath, const std::vector<std::string>& libraryDirectories, const std::string& generatorVersion);
+private:
+    std::unique_ptr<soul::parsing::ParsingDomain> projectParsingDomain;
+    ProjectFileGrammar* projectFileGrammar;
+    LibraryFileGrammar* libraryFileGrammar;
+    ParserFileGrammar* parserFileGrammar;
+    std::unordered_map<std::string, std::unique_ptr<LibraryDomain>> libraryDomains;
+    LibraryDomain* GetLibraryDomain(const std::string& projectFilePath, const std::vector<std::pair<std::string, std::string>>& libraryFiles);
+};
+
+void Generate(const std::string& projectFilePath, const std::vector<std::string>& libraryDirectories, const std::string& generatorVersion);
 
 } } // namespace soul::syntax
 
@@ -39,6 +39,11 @@ GrammarGrammar::GrammarGrammar(soul::parsing::ParsingDomain* parsingDomain_): so
 }
 
 soul::parsing::Grammar* GrammarGrammar::Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, soul::parsing::Scope* enclosingScope)
+{
+    return Parse(start, end, fileIndex, fileName, nullptr, enclosingScope);
+}
+
+soul::parsing::Grammar* GrammarGrammar::Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, const soul::parsing::ParsingLimits* limits, soul::parsing::Scope* enclosingScope)
 {
     soul::parsing::Scanner scanner(start, end, fileName, fileIndex, SkipRule());
     std::unique_ptr<soul::parsing::XmlLog> xmlLog;
@@ -51,8 +56,8 @@ soul::parsing::Grammar* GrammarGrammar::Parse(const char32_t* start, const char3
     soul::parsing::ObjectStack stack;
     std::unique_ptr<soul::parsing::ParsingData> parsingData(new soul::parsing::ParsingData(GetParsingDomain()->GetNumRules()));
     scanner.SetParsingData(parsingData.get());
-    stack.push(std::unique_ptr<soul::parsing::Object>(new ValueObject<soul::parsing::Scope*>(enclosingScope)));
-    soul::parsing::Match match = soul::parsing::Grammar::Parse(scanner, stack, parsingData.get());
+    soul::parsing::PushValue<soul::parsing::Scope*>(stack, enclosingScope);
+    soul::parsing::Match match = soul::parsing::Grammar::Parse(scanner, stack, parsingData.get(), limits);
     soul::parsing::Span stop = scanner.GetSpan();
     if (Log())
     {
@@ -69,10 +74,7 @@ soul::parsing::Grammar* GrammarGrammar::Parse(const char32_t* start, const char3
             throw soul::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<soul::parsing::Object> value = std::move(stack.top());
-    soul::parsing::Grammar* result = *static_cast<soul::parsing::ValueObject<soul::parsing::Grammar*>*>(value.get());
-    stack.pop();
-    return result;
+    return soul::parsing::PopValue<soul::parsing::Grammar*>(stack);
 }
 
 class GrammarGrammar::GrammarRule : public soul::parsing::Rule
@@ -86,18 +88,14 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> enclosingScope_value = std::move(stack.top());
-        context->enclosingScope = *static_cast<soul::parsing::ValueObject<soul::parsing::Scope*>*>(enclosingScope_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->enclosingScope = soul::parsing::PopValue<soul::parsing::Scope*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Grammar*>(context->value)));
+            soul::parsing::PushValue<soul::parsing::Grammar*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -112,25 +110,23 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new Grammar(context->fromname, context->enclosingScope);
         context->value->SetSpan(span);
         context->value->SetNs(context->enclosingScope->Ns());
     }
     void Postname(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromname_value = std::move(stack.top());
-            context->fromname = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromname_value.get());
-            stack.pop();
+            context->fromname = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
     void PreGrammarContent(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Grammar*>(context->value)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::parsing::Grammar*>(stack, context->value);
     }
 private:
     struct Context : soul::parsing::Context
@@ -152,11 +148,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> grammar_value = std::move(stack.top());
-        context->grammar = *static_cast<soul::parsing::ValueObject<soul::parsing::Grammar*>*>(grammar_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->grammar = soul::parsing::PopValue<soul::parsing::Grammar*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -178,37 +171,35 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->grammar->AddRule(context->fromRule);
     }
     void PreStartClause(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Grammar*>(context->grammar)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::parsing::Grammar*>(stack, context->grammar);
     }
     void PreSkipClause(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Grammar*>(context->grammar)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::parsing::Grammar*>(stack, context->grammar);
     }
     void PreRuleLink(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Grammar*>(context->grammar)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::parsing::Grammar*>(stack, context->grammar);
     }
     void PreRule(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Scope*>(context->grammar->GetScope())));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::parsing::Scope*>(stack, context->grammar->GetScope());
     }
     void PostRule(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromRule_value = std::move(stack.top());
-            context->fromRule = *static_cast<soul::parsing::ValueObject<soul::parsing::Rule*>*>(fromRule_value.get());
-            stack.pop();
+            context->fromRule = soul::parsing::PopValue<soul::parsing::Rule*>(stack);
         }
     }
 private:
@@ -230,11 +221,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> grammar_value = std::move(stack.top());
-        context->grammar = *static_cast<soul::parsing::ValueObject<soul::parsing::Grammar*>*>(grammar_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->grammar = soul::parsing::PopValue<soul::parsing::Grammar*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -249,17 +237,15 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->grammar->SetStartRuleName(context->fromstrt);
     }
     void Poststrt(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromstrt_value = std::move(stack.top());
-            context->fromstrt = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromstrt_value.get());
-            stack.pop();
+            context->fromstrt = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
 private:
@@ -281,11 +267,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> grammar_value = std::move(stack.top());
-        context->grammar = *static_cast<soul::parsing::ValueObject<soul::parsing::Grammar*>*>(grammar_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->grammar = soul::parsing::PopValue<soul::parsing::Grammar*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -300,17 +283,15 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->grammar->SetSkipRuleName(context->fromskp);
     }
     void Postskp(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromskp_value = std::move(stack.top());
-            context->fromskp = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromskp_value.get());
-            stack.pop();
+            context->fromskp = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
 private:
@@ -325,16 +306,16 @@ private:
 void GrammarGrammar::GetReferencedGrammars()
 {
     soul::parsing::ParsingDomain* pd = GetParsingDomain();
-    soul::parsing::Grammar* grammar0 = pd->GetGrammar(ToUtf32("soul.syntax.ElementGrammar"));
+    soul::parsing::Grammar* grammar0 = pd->GetGrammar(ToUtf32("soul.parsing.stdlib"));
     if (!grammar0)
     {
-        grammar0 = soul::syntax::ElementGrammar::Create(pd);
+        grammar0 = soul::parsing::stdlib::Create(pd);
     }
     AddGrammarReference(grammar0);
-    soul::parsing::Grammar* grammar1 = pd->GetGrammar(ToUtf32("soul.parsing.stdlib"));
+    soul::parsing::Grammar* grammar1 = pd->GetGrammar(ToUtf32("soul.syntax.ElementGrammar"));
     if (!grammar1)
     {
-        grammar1 = soul::parsing::stdlib::Create(pd);
+        grammar1 = soul::syntax::ElementGrammar::Create(pd);
     }
     AddGrammarReference(grammar1);
     soul::parsing::Grammar* grammar2 = pd->GetGrammar(ToUtf32("soul.syntax.RuleGrammar"));
@@ -348,11 +329,11 @@ void GrammarGrammar::GetReferencedGrammars()
 void GrammarGrammar::CreateRules()
 {
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("Identifier"), this, ToUtf32("ElementGrammar.Identifier")));
-    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("Signature"), this, ToUtf32("ElementGrammar.Signature")));
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("QualifiedId"), this, ToUtf32("ElementGrammar.QualifiedId")));
-    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("char"), this, ToUtf32("soul.parsing.stdlib.char")));
+    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("Signature"), this, ToUtf32("ElementGrammar.Signature")));
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("RuleLink"), this, ToUtf32("ElementGrammar.RuleLink")));
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("Rule"), this, ToUtf32("RuleGrammar.Rule")));
+    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("char"), this, ToUtf32("soul.parsing.stdlib.char")));
     AddRule(new GrammarRule(ToUtf32("Grammar"), GetScope(), GetParsingDomain()->GetNextRuleId(),
         new soul::parsing::SequenceParser(
             new soul::parsing::SequenceParser(
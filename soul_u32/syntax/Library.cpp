@@ -8,6 +8,7 @@
  ========================================================================*/
 
 #include <soul_u32/syntax/Library.hpp>
+#include <soul_u32/syntax/CodeGenerator.hpp>
 #include <soul_u32/parsing/Visitor.hpp>
 #include <soul_u32/parsing/Rule.hpp>
 #include <soul_u32/parsing/Grammar.hpp>
@@ -16,8 +17,9 @@
 #include <soul_u32/util/TextUtils.hpp>
 #include <soul_u32/util/Unicode.hpp>
 #include <unordered_map>
+#include <algorithm>
 #include <iostream>
-#include <fstream>
+#include <sstream>
 
 namespace soul { namespace syntax {
 
@@ -41,11 +43,18 @@ public:
     }
     void GenerateLibraryFile()
     {
+        std::vector<NamespaceGrammarMapIt> nsGrammarItems;
         NamespaceGrammarMapIt e = nsGrammarMap.end();
         for (NamespaceGrammarMapIt i = nsGrammarMap.begin(); i != e; ++i)
+        {
+            nsGrammarItems.push_back(i);
+        }
+        std::sort(nsGrammarItems.begin(), nsGrammarItems.end(), [](NamespaceGrammarMapIt left, NamespaceGrammarMapIt right) { return left->first->FullName() < right->first->FullName(); });
+        for (NamespaceGrammarMapIt i : nsGrammarItems)
         {
             Namespace* ns = i->first;
-            const std::vector<Grammar*>& grammars = i->second;
+            std::vector<Grammar*> grammars = i->second;
+            std::sort(grammars.begin(), grammars.end(), [](Grammar* left, Grammar* right) { return left->Name() < right->Name(); });
             if (!ns->FullName().empty())
             {
                 formatter.WriteLine("namespace " + ToUtf8(ns->FullName()));
@@ -126,12 +135,12 @@ private:
 void GenerateLibraryFile(Project* project, ParsingDomain* parsingDomain)
 {
     std::string libraryFilePath = boost::filesystem::path(project->FilePath()).replace_extension(".pl").generic_string();
-    std::ofstream libraryFile(libraryFilePath.c_str());
+    std::ostringstream libraryFile;
     CodeFormatter formatter(libraryFile);
     LibraryFileGeneratorVisitor visitor(formatter);
     parsingDomain->GlobalNamespace()->Accept(visitor);
     visitor.GenerateLibraryFile();
-    std::cout << "=> " << libraryFilePath << std::endl;
+    WriteGeneratedFile(libraryFilePath, libraryFile.str());
 }
 
 } } // namespace soul::syntax
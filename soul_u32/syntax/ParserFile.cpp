@@ -42,6 +42,11 @@ ParserFileGrammar::ParserFileGrammar(soul::parsing::ParsingDomain* parsingDomain
 }
 
 ParserFileContent* ParserFileGrammar::Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, int id_, soul::parsing::ParsingDomain* parsingDomain_)
+{
+    return Parse(start, end, fileIndex, fileName, nullptr, id_, parsingDomain_);
+}
+
+ParserFileContent* ParserFileGrammar::Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, const soul::parsing::ParsingLimits* limits, int id_, soul::parsing::ParsingDomain* parsingDomain_)
 {
     soul::parsing::Scanner scanner(start, end, fileName, fileIndex, SkipRule());
     std::unique_ptr<soul::parsing::XmlLog> xmlLog;
@@ -54,9 +59,9 @@ ParserFileContent* ParserFileGrammar::Parse(const char32_t* start, const char32_
     soul::parsing::ObjectStack stack;
     std::unique_ptr<soul::parsing::ParsingData> parsingData(new soul::parsing::ParsingData(GetParsingDomain()->GetNumRules()));
     scanner.SetParsingData(parsingData.get());
-    stack.push(std::unique_ptr<soul::parsing::Object>(new ValueObject<int>(id_)));
-    stack.push(std::unique_ptr<soul::parsing::Object>(new ValueObject<soul::parsing::ParsingDomain*>(parsingDomain_)));
-    soul::parsing::Match match = soul::parsing::Grammar::Parse(scanner, stack, parsingData.get());
+    soul::parsing::PushValue<int>(stack, id_);
+    soul::parsing::PushValue<soul::parsing::ParsingDomain*>(stack, parsingDomain_);
+    soul::parsing::Match match = soul::parsing::Grammar::Parse(scanner, stack, parsingData.get(), limits);
     soul::parsing::Span stop = scanner.GetSpan();
     if (Log())
     {
@@ -73,10 +78,7 @@ ParserFileContent* ParserFileGrammar::Parse(const char32_t* start, const char32_
             throw soul::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<soul::parsing::Object> value = std::move(stack.top());
-    ParserFileContent* result = *static_cast<soul::parsing::ValueObject<ParserFileContent*>*>(value.get());
-    stack.pop();
-    return result;
+    return soul::parsing::PopValue<ParserFileContent*>(stack);
 }
 
 class ParserFileGrammar::ParserFileRule : public soul::parsing::Rule
@@ -91,21 +93,15 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> parsingDomain__value = std::move(stack.top());
-        context->parsingDomain_ = *static_cast<soul::parsing::ValueObject<soul::parsing::ParsingDomain*>*>(parsingDomain__value.get());
-        stack.pop();
-        std::unique_ptr<soul::parsing::Object> id__value = std::move(stack.top());
-        context->id_ = *static_cast<soul::parsing::ValueObject<int>*>(id__value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->parsingDomain_ = soul::parsing::PopValue<soul::parsing::ParsingDomain*>(stack);
+        context->id_ = soul::parsing::PopValue<int>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<ParserFileContent*>(context->value)));
+            soul::parsing::PushValue<ParserFileContent*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -120,19 +116,19 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new ParserFileContent(context->id_, context->parsingDomain_);
         context->value->SetFilePath(fileName);
     }
     void PreIncludeDirectives(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<ParserFileContent*>(context->value)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<ParserFileContent*>(stack, context->value);
     }
     void PreNamespaceContent(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<ParserFileContent*>(context->value)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<ParserFileContent*>(stack, context->value);
     }
 private:
     struct Context : soul::parsing::Context
@@ -154,11 +150,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> parserFileContent_value = std::move(stack.top());
-        context->parserFileContent = *static_cast<soul::parsing::ValueObject<ParserFileContent*>*>(parserFileContent_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->parserFileContent = soul::parsing::PopValue<ParserFileContent*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -171,8 +164,8 @@ public:
     }
     void PreIncludeDirective(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<ParserFileContent*>(context->parserFileContent)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<ParserFileContent*>(stack, context->parserFileContent);
     }
 private:
     struct Context : soul::parsing::Context
@@ -192,11 +185,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> parserFileContent_value = std::move(stack.top());
-        context->parserFileContent = *static_cast<soul::parsing::ValueObject<ParserFileContent*>*>(parserFileContent_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->parserFileContent = soul::parsing::PopValue<ParserFileContent*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -213,27 +203,23 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->parserFileContent->AddIncludeDirective(ToUtf8(context->fromIncludeFileName), ToUtf8(context->fromFileAttribute));
     }
     void PostFileAttribute(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromFileAttribute_value = std::move(stack.top());
-            context->fromFileAttribute = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromFileAttribute_value.get());
-            stack.pop();
+            context->fromFileAttribute = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
     void PostIncludeFileName(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromIncludeFileName_value = std::move(stack.top());
-            context->fromIncludeFileName = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromIncludeFileName_value.get());
-            stack.pop();
+            context->fromIncludeFileName = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
 private:
@@ -256,15 +242,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<std::u32string>(context->value)));
+            soul::parsing::PushValue<std::u32string>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -275,7 +259,7 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = std::u32string(matchBegin, matchEnd);
     }
 private:
@@ -296,15 +280,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<std::u32string>(context->value)));
+            soul::parsing::PushValue<std::u32string>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -315,7 +297,7 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = std::u32string(matchBegin, matchEnd);
     }
 private:
@@ -336,11 +318,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> parserFileContent_value = std::move(stack.top());
-        context->parserFileContent = *static_cast<soul::parsing::ValueObject<ParserFileContent*>*>(parserFileContent_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->parserFileContent = soul::parsing::PopValue<ParserFileContent*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -372,86 +351,76 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->fromUsingDeclaration->SetFileAttr(context->fromFileAttribute);
         context->parserFileContent->AddUsingObject(context->fromUsingDeclaration);
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->fromUsingDirective->SetFileAttr(context->fromFileAttribute);
         context->parserFileContent->AddUsingObject(context->fromUsingDirective);
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->fromNamespaceAliasDefinition->SetFileAttr(context->fromFileAttribute);
         context->parserFileContent->AddUsingObject(context->fromNamespaceAliasDefinition);
     }
     void A3Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->parserFileContent->AddGrammar(context->fromGrammar);
     }
     void PostFileAttribute(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromFileAttribute_value = std::move(stack.top());
-            context->fromFileAttribute = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromFileAttribute_value.get());
-            stack.pop();
+            context->fromFileAttribute = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
     void PostUsingDeclaration(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromUsingDeclaration_value = std::move(stack.top());
-            context->fromUsingDeclaration = *static_cast<soul::parsing::ValueObject<soul::codedom::UsingObject*>*>(fromUsingDeclaration_value.get());
-            stack.pop();
+            context->fromUsingDeclaration = soul::parsing::PopValue<soul::codedom::UsingObject*>(stack);
         }
     }
     void PostUsingDirective(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromUsingDirective_value = std::move(stack.top());
-            context->fromUsingDirective = *static_cast<soul::parsing::ValueObject<soul::codedom::UsingObject*>*>(fromUsingDirective_value.get());
-            stack.pop();
+            context->fromUsingDirective = soul::parsing::PopValue<soul::codedom::UsingObject*>(stack);
         }
     }
     void PostNamespaceAliasDefinition(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromNamespaceAliasDefinition_value = std::move(stack.top());
-            context->fromNamespaceAliasDefinition = *static_cast<soul::parsing::ValueObject<soul::codedom::UsingObject*>*>(fromNamespaceAliasDefinition_value.get());
-            stack.pop();
+            context->fromNamespaceAliasDefinition = soul::parsing::PopValue<soul::codedom::UsingObject*>(stack);
         }
     }
     void PreGrammar(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Scope*>(context->parserFileContent->CurrentScope())));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::parsing::Scope*>(stack, context->parserFileContent->CurrentScope());
     }
     void PostGrammar(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromGrammar_value = std::move(stack.top());
-            context->fromGrammar = *static_cast<soul::parsing::ValueObject<soul::parsing::Grammar*>*>(fromGrammar_value.get());
-            stack.pop();
+            context->fromGrammar = soul::parsing::PopValue<soul::parsing::Grammar*>(stack);
         }
     }
     void PreNamespace(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<ParserFileContent*>(context->parserFileContent)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<ParserFileContent*>(stack, context->parserFileContent);
     }
 private:
     struct Context : soul::parsing::Context
@@ -476,11 +445,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> parserFileContent_value = std::move(stack.top());
-        context->parserFileContent = *static_cast<soul::parsing::ValueObject<ParserFileContent*>*>(parserFileContent_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->parserFileContent = soul::parsing::PopValue<ParserFileContent*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -499,28 +465,26 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->parserFileContent->BeginNamespace(context->fromns);
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->parserFileContent->EndNamespace();
     }
     void Postns(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromns_value = std::move(stack.top());
-            context->fromns = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromns_value.get());
-            stack.pop();
+            context->fromns = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
     void PreNamespaceContent(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<ParserFileContent*>(context->parserFileContent)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<ParserFileContent*>(stack, context->parserFileContent);
     }
 private:
     struct Context : soul::parsing::Context
@@ -534,16 +498,16 @@ private:
 void ParserFileGrammar::GetReferencedGrammars()
 {
     soul::parsing::ParsingDomain* pd = GetParsingDomain();
-    soul::parsing::Grammar* grammar0 = pd->GetGrammar(ToUtf32("soul.parsing.stdlib"));
+    soul::parsing::Grammar* grammar0 = pd->GetGrammar(ToUtf32("soul.code.DeclarationGrammar"));
     if (!grammar0)
     {
-        grammar0 = soul::parsing::stdlib::Create(pd);
+        grammar0 = soul::code::DeclarationGrammar::Create(pd);
     }
     AddGrammarReference(grammar0);
-    soul::parsing::Grammar* grammar1 = pd->GetGrammar(ToUtf32("soul.code.DeclarationGrammar"));
+    soul::parsing::Grammar* grammar1 = pd->GetGrammar(ToUtf32("soul.parsing.stdlib"));
     if (!grammar1)
     {
-        grammar1 = soul::code::DeclarationGrammar::Create(pd);
+        grammar1 = soul::parsing::stdlib::Create(pd);
     }
     AddGrammarReference(grammar1);
     soul::parsing::Grammar* grammar2 = pd->GetGrammar(ToUtf32("soul.syntax.GrammarGrammar"));
@@ -558,11 +522,11 @@ void ParserFileGrammar::CreateRules()
 {
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("spaces_and_comments"), this, ToUtf32("soul.parsing.stdlib.spaces_and_comments")));
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("newline"), this, ToUtf32("soul.parsing.stdlib.newline")));
-    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("NamespaceAliasDefinition"), this, ToUtf32("soul.code.DeclarationGrammar.NamespaceAliasDefinition")));
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("qualified_id"), this, ToUtf32("soul.parsing.stdlib.qualified_id")));
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("Grammar"), this, ToUtf32("GrammarGrammar.Grammar")));
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("UsingDeclaration"), this, ToUtf32("soul.code.DeclarationGrammar.UsingDeclaration")));
     AddRuleLink(new soul::parsing::RuleLink(ToUtf32("UsingDirective"), this, ToUtf32("soul.code.DeclarationGrammar.UsingDirective")));
+    AddRuleLink(new soul::parsing::RuleLink(ToUtf32("NamespaceAliasDefinition"), this, ToUtf32("soul.code.DeclarationGrammar.NamespaceAliasDefinition")));
     AddRule(new ParserFileRule(ToUtf32("ParserFile"), GetScope(), GetParsingDomain()->GetNextRuleId(),
         new soul::parsing::SequenceParser(
             new soul::parsing::SequenceParser(
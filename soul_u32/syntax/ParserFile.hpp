@@ -13,6 +13,7 @@ public:
     static ParserFileGrammar* Create();
     static ParserFileGrammar* Create(soul::parsing::ParsingDomain* parsingDomain);
     ParserFileContent* Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, int id_, soul::parsing::ParsingDomain* parsingDomain_);
+    ParserFileContent* Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, const soul::parsing::ParsingLimits* limits, int id_, soul::parsing::ParsingDomain* parsingDomain_);
 private:
     ParserFileGrammar(soul::parsing::ParsingDomain* parsingDomain_);
     virtual void CreateRules();
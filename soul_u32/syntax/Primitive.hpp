@@ -14,6 +14,7 @@ public:
     static PrimitiveGrammar* Create();
     static PrimitiveGrammar* Create(soul::parsing::ParsingDomain* parsingDomain);
     soul::parsing::Parser* Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName);
+    soul::parsing::Parser* Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, const soul::parsing::ParsingLimits* limits);
 private:
     PrimitiveGrammar(soul::parsing::ParsingDomain* parsingDomain_);
     virtual void CreateRules();
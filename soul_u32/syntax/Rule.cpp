@@ -39,6 +39,11 @@ RuleGrammar::RuleGrammar(soul::parsing::ParsingDomain* parsingDomain_): soul::pa
 }
 
 soul::parsing::Rule* RuleGrammar::Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, soul::parsing::Scope* enclosingScope)
+{
+    return Parse(start, end, fileIndex, fileName, nullptr, enclosingScope);
+}
+
+soul::parsing::Rule* RuleGrammar::Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, const soul::parsing::ParsingLimits* limits, soul::parsing::Scope* enclosingScope)
 {
     soul::parsing::Scanner scanner(start, end, fileName, fileIndex, SkipRule());
     std::unique_ptr<soul::parsing::XmlLog> xmlLog;
@@ -51,8 +56,8 @@ soul::parsing::Rule* RuleGrammar::Parse(const char32_t* start, const char32_t* e
     soul::parsing::ObjectStack stack;
     std::unique_ptr<soul::parsing::ParsingData> parsingData(new soul::parsing::ParsingData(GetParsingDomain()->GetNumRules()));
     scanner.SetParsingData(parsingData.get());
-    stack.push(std::unique_ptr<soul::parsing::Object>(new ValueObject<soul::parsing::Scope*>(enclosingScope)));
-    soul::parsing::Match match = soul::parsing::Grammar::Parse(scanner, stack, parsingData.get());
+    soul::parsing::PushValue<soul::parsing::Scope*>(stack, enclosingScope);
+    soul::parsing::Match match = soul::parsing::Grammar::Parse(scanner, stack, parsingData.get(), limits);
     soul::parsing::Span stop = scanner.GetSpan();
     if (Log())
     {
@@ -69,10 +74,7 @@ soul::parsing::Rule* RuleGrammar::Parse(const char32_t* start, const char32_t* e
             throw soul::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<soul::parsing::Object> value = std::move(stack.top());
-    soul::parsing::Rule* result = *static_cast<soul::parsing::ValueObject<soul::parsing::Rule*>*>(value.get());
-    stack.pop();
-    return result;
+    return soul::parsing::PopValue<soul::parsing::Rule*>(stack);
 }
 
 class RuleGrammar::RuleRule : public soul::parsing::Rule
@@ -86,18 +88,14 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> enclosingScope_value = std::move(stack.top());
-        context->enclosingScope = *static_cast<soul::parsing::ValueObject<soul::parsing::Scope*>*>(enclosingScope_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->enclosingScope = soul::parsing::PopValue<soul::parsing::Scope*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Rule*>(context->value)));
+            soul::parsing::PushValue<soul::parsing::Rule*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -113,28 +111,26 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromRuleHeader;
     }
     void PreRuleHeader(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Scope*>(context->enclosingScope)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::parsing::Scope*>(stack, context->enclosingScope);
     }
     void PostRuleHeader(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromRuleHeader_value = std::move(stack.top());
-            context->fromRuleHeader = *static_cast<soul::parsing::ValueObject<soul::parsing::Rule*>*>(fromRuleHeader_value.get());
-            stack.pop();
+            context->fromRuleHeader = soul::parsing::PopValue<soul::parsing::Rule*>(stack);
         }
     }
     void PreRuleBody(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Rule*>(context->value)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::parsing::Rule*>(stack, context->value);
     }
 private:
     struct Context : soul::parsing::Context
@@ -157,18 +153,14 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> enclosingScope_value = std::move(stack.top());
-        context->enclosingScope = *static_cast<soul::parsing::ValueObject<soul::parsing::Scope*>*>(enclosingScope_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->enclosingScope = soul::parsing::PopValue<soul::parsing::Scope*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Rule*>(context->value)));
+            soul::parsing::PushValue<soul::parsing::Rule*>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -183,24 +175,22 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = new Rule(context->fromname, context->enclosingScope);
         context->value->SetSpan(span);
     }
     void Postname(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromname_value = std::move(stack.top());
-            context->fromname = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromname_value.get());
-            stack.pop();
+            context->fromname = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
     void PreSignature(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Rule*>(context->value)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::parsing::Rule*>(stack, context->value);
     }
 private:
     struct Context : soul::parsing::Context
@@ -222,11 +212,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> rule_value = std::move(stack.top());
-        context->rule = *static_cast<soul::parsing::ValueObject<soul::parsing::Rule*>*>(rule_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->rule = soul::parsing::PopValue<soul::parsing::Rule*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -242,22 +229,20 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->rule->SetDefinition(context->fromdefinition);
     }
     void Predefinition(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<soul::parsing::Scope*>(context->rule->GetScope())));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<soul::parsing::Scope*>(stack, context->rule->GetScope());
     }
     void Postdefinition(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromdefinition_value = std::move(stack.top());
-            context->fromdefinition = *static_cast<soul::parsing::ValueObject<soul::parsing::Parser*>*>(fromdefinition_value.get());
-            stack.pop();
+            context->fromdefinition = soul::parsing::PopValue<soul::parsing::Parser*>(stack);
         }
     }
 private:
@@ -272,10 +257,10 @@ private:
 void RuleGrammar::GetReferencedGrammars()
 {
     soul::parsing::ParsingDomain* pd = GetParsingDomain();
-    soul::parsing::Grammar* grammar0 = pd->GetGrammar(ToUtf32("soul.syntax.ElementGrammar"));
+    soul::parsing::Grammar* grammar0 = pd->GetGrammar(ToUtf32("soul.parsing.stdlib"));
     if (!grammar0)
     {
-        grammar0 = soul::syntax::ElementGrammar::Create(pd);
+        grammar0 = soul::parsing::stdlib::Create(pd);
     }
     AddGrammarReference(grammar0);
     soul::parsing::Grammar* grammar1 = pd->GetGrammar(ToUtf32("soul.syntax.CompositeGrammar"));
@@ -284,10 +269,10 @@ void RuleGrammar::GetReferencedGrammars()
         grammar1 = soul::syntax::CompositeGrammar::Create(pd);
     }
     AddGrammarReference(grammar1);
-    soul::parsing::Grammar* grammar2 = pd->GetGrammar(ToUtf32("soul.parsing.stdlib"));
+    soul::parsing::Grammar* grammar2 = pd->GetGrammar(ToUtf32("soul.syntax.ElementGrammar"));
     if (!grammar2)
     {
-        grammar2 = soul::parsing::stdlib::Create(pd);
+        grammar2 = soul::syntax::ElementGrammar::Create(pd);
     }
     AddGrammarReference(grammar2);
 }
@@ -18,35 +18,6 @@ namespace soul.code
         UsingDeclaration: soul::codedom::UsingObject*;
         UsingDirective: soul::codedom::UsingObject*;
     }
-    grammar StatementGrammar
-    {
-        Statement: soul::codedom::Statement*;
-        LabeledStatement: soul::codedom::Statement*;
-        Label: std::u32string;
-        EmptyStatement: soul::codedom::Statement*;
-        ExpressionStatement: soul::codedom::Statement*;
-        CompoundStatement(var std::unique_ptr<CompoundStatement> cs): soul::codedom::CompoundStatement*;
-        SelectionStatement: soul::codedom::Statement*;
-        IfStatement: soul::codedom::Statement*;
-        SwitchStatement: soul::codedom::Statement*;
-        IterationStatement: soul::codedom::Statement*;
-        WhileStatement: soul::codedom::Statement*;
-        DoStatement: soul::codedom::Statement*;
-        ForStatement: soul::codedom::Statement*;
-        ForInitStatement: soul::codedom::CppObject*;
-        JumpStatement: soul::codedom::Statement*;
-        BreakStatement: soul::codedom::Statement*;
-        ContinueStatement: soul::codedom::Statement*;
-        ReturnStatement: soul::codedom::Statement*;
-        GotoStatement: soul::codedom::Statement*;
-        GotoTarget: std::u32string;
-        DeclarationStatement: soul::codedom::Statement*;
-        Condition(var std::unique_ptr<TypeId> ti): soul::codedom::CppObject*;
-        TryStatement: soul::codedom::TryStatement*;
-        HandlerSeq(TryStatement* st);
-        Handler: soul::codedom::Handler*;
-        ExceptionDeclaration(var std::unique_ptr<ExceptionDeclaration> ed): soul::codedom::ExceptionDeclaration*;
-    }
     grammar DeclaratorGrammar
     {
         InitDeclaratorList(var std::unique_ptr<InitDeclaratorList> idl): soul::codedom::InitDeclaratorList*;
@@ -109,6 +80,15 @@ namespace soul.code
         OperatorFunctionId;
         Operator;
     }
+    grammar IdentifierGrammar
+    {
+        Identifier: std::u32string;
+        QualifiedId: std::u32string;
+    }
+    grammar KeywordGrammar
+    {
+        Keyword;
+    }
     grammar LiteralGrammar
     {
         Literal: soul::codedom::Literal*;
@@ -144,13 +124,33 @@ namespace soul.code
         BooleanLiteral: soul::codedom::Literal*;
         PointerLiteral: soul::codedom::Literal*;
     }
-    grammar IdentifierGrammar
-    {
-        Identifier: std::u32string;
-        QualifiedId: std::u32string;
-    }
-    grammar KeywordGrammar
+    grammar StatementGrammar
     {
-        Keyword;
+        Statement: soul::codedom::Statement*;
+        LabeledStatement: soul::codedom::Statement*;
+        Label: std::u32string;
+        EmptyStatement: soul::codedom::Statement*;
+        ExpressionStatement: soul::codedom::Statement*;
+        CompoundStatement(var std::unique_ptr<CompoundStatement> cs): soul::codedom::CompoundStatement*;
+        SelectionStatement: soul::codedom::Statement*;
+        IfStatement: soul::codedom::Statement*;
+        SwitchStatement: soul::codedom::Statement*;
+        IterationStatement: soul::codedom::Statement*;
+        WhileStatement: soul::codedom::Statement*;
+        DoStatement: soul::codedom::Statement*;
+        ForStatement: soul::codedom::Statement*;
+        ForInitStatement: soul::codedom::CppObject*;
+        JumpStatement: soul::codedom::Statement*;
+        BreakStatement: soul::codedom::Statement*;
+        ContinueStatement: soul::codedom::Statement*;
+        ReturnStatement: soul::codedom::Statement*;
+        GotoStatement: soul::codedom::Statement*;
+        GotoTarget: std::u32string;
+        DeclarationStatement: soul::codedom::Statement*;
+        Condition(var std::unique_ptr<TypeId> ti): soul::codedom::CppObject*;
+        TryStatement: soul::codedom::TryStatement*;
+        HandlerSeq(TryStatement* st);
+        Handler: soul::codedom::Handler*;
+        ExceptionDeclaration(var std::unique_ptr<ExceptionDeclaration> ed): soul::codedom::ExceptionDeclaration*;
     }
 }
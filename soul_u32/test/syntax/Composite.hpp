@@ -14,6 +14,7 @@ public:
     static CompositeGrammar* Create();
     static CompositeGrammar* Create(soul::parsing::ParsingDomain* parsingDomain);
     soul::parsing::Parser* Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, soul::parsing::Scope* enclosingScope);
+    soul::parsing::Parser* Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, const soul::parsing::ParsingLimits* limits, soul::parsing::Scope* enclosingScope);
 private:
     CompositeGrammar(soul::parsing::ParsingDomain* parsingDomain_);
     virtual void CreateRules();
@@ -14,6 +14,7 @@ public:
     static ElementGrammar* Create();
     static ElementGrammar* Create(soul::parsing::ParsingDomain* parsingDomain);
     void Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, soul::parsing::Grammar* grammar);
+    void Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, const soul::parsing::ParsingLimits* limits, soul::parsing::Grammar* grammar);
 private:
     std::vector<std::u32string> keywords0;
     ElementGrammar(soul::parsing::ParsingDomain* parsingDomain_);
@@ -13,6 +13,7 @@ public:
     static GrammarGrammar* Create();
     static GrammarGrammar* Create(soul::parsing::ParsingDomain* parsingDomain);
     soul::parsing::Grammar* Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, soul::parsing::Scope* enclosingScope);
+    soul::parsing::Grammar* Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, const soul::parsing::ParsingLimits* limits, soul::parsing::Scope* enclosingScope);
 private:
     GrammarGrammar(soul::parsing::ParsingDomain* parsingDomain_);
     virtual void CreateRules();
@@ -13,6 +13,7 @@ public:
     static LibraryFileGrammar* Create();
     static LibraryFileGrammar* Create(soul::parsing::ParsingDomain* parsingDomain);
     void Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, soul::parsing::ParsingDomain* parsingDomain);
+    void Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, const soul::parsing::ParsingLimits* limits, soul::parsing::ParsingDomain* parsingDomain);
 private:
     LibraryFileGrammar(soul::parsing::ParsingDomain* parsingDomain_);
     virtual void CreateRules();
@@ -13,6 +13,7 @@ public:
     static ProjectFileGrammar* Create();
     static ProjectFileGrammar* Create(soul::parsing::ParsingDomain* parsingDomain);
     Project* Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName);
+    Project* Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, const soul::parsing::ParsingLimits* limits);
 private:
     ProjectFileGrammar(soul::parsing::ParsingDomain* parsingDomain_);
     virtual void CreateRules();
@@ -13,6 +13,7 @@ public:
     static RuleGrammar* Create();
     static RuleGrammar* Create(soul::parsing::ParsingDomain* parsingDomain);
     soul::parsing::Rule* Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, soul::parsing::Scope* enclosingScope);
+    soul::parsing::Rule* Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, const soul::parsing::ParsingLimits* limits, soul::parsing::Scope* enclosingScope);
 private:
     RuleGrammar(soul::parsing::ParsingDomain* parsingDomain_);
     virtual void CreateRules();
@@ -10,12 +10,6 @@ namespace soul.syntax
         List(soul::parsing::Scope* enclosingScope): soul::parsing::Parser*;
         Postfix(soul::parsing::Scope* enclosingScope): soul::parsing::Parser*;
     }
-    grammar RuleGrammar
-    {
-        Rule(soul::parsing::Scope* enclosingScope): soul::parsing::Rule*;
-        RuleHeader(soul::parsing::Scope* enclosingScope): soul::parsing::Rule*;
-        RuleBody(soul::parsing::Rule* rule);
-    }
     grammar ElementGrammar
     {
         RuleLink(soul::parsing::Grammar* grammar);
@@ -36,6 +30,15 @@ namespace soul.syntax
         StartClause(soul::parsing::Grammar* grammar);
         SkipClause(soul::parsing::Grammar* grammar);
     }
+    grammar LibraryFileGrammar
+    {
+        LibraryFile(soul::parsing::ParsingDomain* parsingDomain);
+        NamespaceContent(soul::parsing::ParsingDomain* parsingDomain);
+        Namespace(soul::parsing::ParsingDomain* parsingDomain);
+        Grammar(soul::parsing::Scope* enclosingScope): soul::parsing::Grammar*;
+        GrammarContent(soul::parsing::Grammar* grammar);
+        Rule(soul::parsing::Scope* enclosingScope): soul::parsing::Rule*;
+    }
     grammar ParserFileGrammar
     {
         ParserFile(int id_, soul::parsing::ParsingDomain* parsingDomain_): ParserFileContent*;
@@ -46,6 +49,17 @@ namespace soul.syntax
         NamespaceContent(ParserFileContent* parserFileContent);
         Namespace(ParserFileContent* parserFileContent);
     }
+    grammar PrimaryGrammar
+    {
+        Primary(soul::parsing::Scope* enclosingScope): soul::parsing::Parser*;
+        RuleCall: soul::parsing::Parser*;
+        Nonterminal: std::u32string;
+        Alias: std::u32string;
+        Grouping(soul::parsing::Scope* enclosingScope): soul::parsing::Parser*;
+        Token(soul::parsing::Scope* enclosingScope): soul::parsing::Parser*;
+        Expectation(soul::parsing::Parser* child): soul::parsing::Parser*;
+        Action(soul::parsing::Parser* child): soul::parsing::Parser*;
+    }
     grammar PrimitiveGrammar
     {
         Primitive: soul::parsing::Parser*;
@@ -109,26 +123,6 @@ namespace soul.syntax
         IdStart: soul::parsing::Parser*;
         IdCont: soul::parsing::Parser*;
     }
-    grammar LibraryFileGrammar
-    {
-        LibraryFile(soul::parsing::ParsingDomain* parsingDomain);
-        NamespaceContent(soul::parsing::ParsingDomain* parsingDomain);
-        Namespace(soul::parsing::ParsingDomain* parsingDomain);
-        Grammar(soul::parsing::Scope* enclosingScope): soul::parsing::Grammar*;
-        GrammarContent(soul::parsing::Grammar* grammar);
-        Rule(soul::parsing::Scope* enclosingScope): soul::parsing::Rule*;
-    }
-    grammar PrimaryGrammar
-    {
-        Primary(soul::parsing::Scope* enclosingScope): soul::parsing::Parser*;
-        RuleCall: soul::parsing::Parser*;
-        Nonterminal: std::u32string;
-        Alias: std::u32string;
-        Grouping(soul::parsing::Scope* enclosingScope): soul::parsing::Parser*;
-        Token(soul::parsing::Scope* enclosingScope): soul::parsing::Parser*;
-        Expectation(soul::parsing::Parser* child): soul::parsing::Parser*;
-        Action(soul::parsing::Parser* child): soul::parsing::Parser*;
-    }
     grammar ProjectFileGrammar
     {
         ProjectFile: Project*;
@@ -137,4 +131,10 @@ namespace soul.syntax
         Reference: std::u32string;
         FilePath: std::u32string;
     }
+    grammar RuleGrammar
+    {
+        Rule(soul::parsing::Scope* enclosingScope): soul::parsing::Rule*;
+        RuleHeader(soul::parsing::Scope* enclosingScope): soul::parsing::Rule*;
+        RuleBody(soul::parsing::Rule* rule);
+    }
 }
@@ -5,9 +5,12 @@
 #include <soul_u32/util/InitDone.hpp>
 #include <soul_u32/util/Unicode.hpp>
 #include <soul_u32/util/TextUtils.hpp>
+#include <soul_u32/util/UnicodeTables.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/lexical_cast.hpp>
 #include <iostream>
+#include <fstream>
+#include <iomanip>
 #include <sstream>
 #include <stdexcept>
 #include <stdlib.h>
@@ -41,6 +44,7 @@ std::set<std::string> unseenPropertyNames;
 std::vector<std::unique_ptr<Block>> blocks;
 std::map<std::string, Block*>  blockMap;
 std::ofstream iso88591;
+char32_t lastCodePoint = 0;
 
 uint32_t FromHex(const std::string& hex)
 {
@@ -69,6 +73,10 @@ void UnicodeCharacterDatabaseContentHandler::StartElement(const std::u32string&
             std::string hex = ToUtf8(*cp);
             c = FromHex(hex);
             codePoint = c;
+            if (c > lastCodePoint)
+            {
+                lastCodePoint = c;
+            }
             characterInfo = &CreateCharacterInfo(c);
             extendedCharacterInfo = &CreateExtendedCharacterInfo(c);
 /*
@@ -295,7 +303,7 @@ void UnicodeCharacterDatabaseContentHandler::StartElement(const std::u32string&
             }
         }
     }
-    else if (qualifiedName == U"name-alias" && codePoint != -1 && extendedCharacterInfo != nullptr)
+    else if (qualifiedName == U"name-alias" && codePoint != char32_t(-1) && extendedCharacterInfo != nullptr)
     {
         std::string alias;
         std::string type;
@@ -325,6 +333,113 @@ void UnicodeCharacterDatabaseContentHandler::EndElement(const std::u32string& na
     }
 }
 
+uint16_t MakePropertyTableEntry(const CharacterInfo& characterInfo)
+{
+    uint16_t entry = 0;
+    uint32_t generalCategory = static_cast<uint32_t>(characterInfo.GetGeneralCategory());
+    if (generalCategory != 0)
+    {
+        uint16_t generalCategoryNumber = 1;
+        while ((generalCategory & 1) == 0)
+        {
+            generalCategory >>= 1;
+            ++generalCategoryNumber;
+        }
+        entry = generalCategoryNumber;
+    }
+    std::vector<std::pair<BinaryPropertyId, TableProperty>> properties = {
+        { BinaryPropertyId::whiteSpace, TableProperty::whiteSpace },
+        { BinaryPropertyId::alphabetic, TableProperty::alphabetic },
+        { BinaryPropertyId::asciiHexDigit, TableProperty::asciiHexDigit },
+        { BinaryPropertyId::hexDigit, TableProperty::hexDigit },
+        { BinaryPropertyId::idStart, TableProperty::idStart },
+        { BinaryPropertyId::idContinue, TableProperty::idContinue },
+        { BinaryPropertyId::xidStart, TableProperty::xidStart },
+        { BinaryPropertyId::xidContinue, TableProperty::xidContinue },
+        { BinaryPropertyId::lowercase, TableProperty::lowercase },
+        { BinaryPropertyId::uppercase, TableProperty::uppercase },
+        { BinaryPropertyId::math, TableProperty::math }
+    };
+    for (const std::pair<BinaryPropertyId, TableProperty>& property : properties)
+    {
+        if (characterInfo.GetBinaryProperty(property.first))
+        {
+            entry |= static_cast<uint16_t>(property.second);
+        }
+    }
+    return entry;
+}
+
+void WriteTable(std::ofstream& file, const std::string& name, const std::vector<uint16_t>& table)
+{
+    file << "constexpr uint16_t " << name << "[" << table.size() << "] =\n{";
+    for (size_t i = 0; i < table.size(); ++i)
+    {
+        if (i % 16 == 0)
+        {
+            file << "\n    ";
+        }
+        else
+        {
+            file << " ";
+        }
+        file << "0x" << std::hex << std::setw(4) << std::setfill('0') << table[i] << std::dec;
+        if (i < table.size() - 1)
+        {
+            file << ",";
+        }
+    }
+    file << "\n};\n";
+}
+
+void WritePropertyTables(const std::string& fileName)
+{
+    std::vector<uint16_t> stage1;
+    std::vector<uint16_t> stage2;
+    std::map<std::vector<uint16_t>, uint16_t> blockIndexMap;
+    for (uint32_t blockStart = 0; blockStart < 0x110000; blockStart += propertyTableBlockSize)
+    {
+        std::vector<uint16_t> block;
+        for (uint32_t i = 0; i < propertyTableBlockSize; ++i)
+        {
+            char32_t c = blockStart + i;
+            if (c <= lastCodePoint)
+            {
+                block.push_back(MakePropertyTableEntry(GetCharacterInfo(c)));
+            }
+            else
+            {
+                block.push_back(0);
+            }
+        }
+        auto it = blockIndexMap.find(block);
+        if (it != blockIndexMap.cend())
+        {
+            stage1.push_back(it->second);
+        }
+        else
+        {
+            uint16_t blockIndex = static_cast<uint16_t>(stage2.size() / propertyTableBlockSize);
+            blockIndexMap[block] = blockIndex;
+            stage1.push_back(blockIndex);
+            stage2.insert(stage2.end(), block.begin(), block.end());
+        }
+    }
+    std::ofstream file(fileName);
+    file << "// this file has been generated by MakeUcdBin from ucd.all.flat.xml" << std::endl;
+    file << std::endl;
+    file << "#include <soul_u32/util/UnicodeTables.hpp>" << std::endl;
+    file << std::endl;
+    file << "namespace soul { namespace unicode {" << std::endl;
+    file << std::endl;
+    WriteTable(file, "propertyTableStage1", stage1);
+    file << std::endl;
+    WriteTable(file, "propertyTableStage2", stage2);
+    file << std::endl;
+    file << "} } // namespace soul::unicode" << std::endl;
+    std::cout << "==> " << fileName << " (" << stage2.size() / propertyTableBlockSize << " distinct blocks)" << std::endl;
+}
+
 struct InitDone
 {
     InitDone()
@@ -370,6 +485,8 @@ int main(int argc, const char** argv)
         iso88591 << "</ucd>" << std::endl;
 */
         CharacterTable::Instance().Write();
+        std::string tableFileName = (boost::filesystem::path(soul_u32_root) / boost::filesystem::path("util") / boost::filesystem::path("UnicodeTables.cpp")).generic_string();
+        WritePropertyTables(tableFileName);
     }
     catch (const std::exception& ex)
     {
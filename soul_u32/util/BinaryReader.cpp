@@ -11,7 +11,7 @@ namespace soul { namespace util {
 using namespace soul::unicode;
 
 BinaryReader::BinaryReader(const std::string& fileName_) : 
-    fileName(fileName_), file(fileName), begin(reinterpret_cast<const uint8_t*>(file.Begin())), end(reinterpret_cast<const uint8_t*>(file.End()))
+    fileName(fileName_), file(fileName), begin(reinterpret_cast<const uint8_t*>(file.Begin())), end(reinterpret_cast<const uint8_t*>(file.End())), pos(0)
 {
 }
 
@@ -256,6 +256,17 @@ void BinaryReader::Skip(uint32_t size)
     pos += size;
 }
 
+void BinaryReader::Seek(uint32_t pos_)
+{
+    const uint8_t* start = reinterpret_cast<const uint8_t*>(file.Begin());
+    if (pos_ > end - start)
+    {
+        throw std::runtime_error("invalid seek position " + std::to_string(pos_) + " for file '" + fileName + "'");
+    }
+    begin = start + pos_;
+    pos = pos_;
+}
+
 void BinaryReader::CheckEof()
 {
     if (begin == end)
@@ -31,6 +31,7 @@ public:
     uint32_t ReadEncodedUInt();
     uint32_t Pos() const { return pos; }
     void Skip(uint32_t size);
+    void Seek(uint32_t pos_);
 private:
     std::string fileName;
     MappedInputFile file;
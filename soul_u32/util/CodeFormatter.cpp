@@ -4,6 +4,7 @@
 // =================================
 
 #include <soul_u32/util/CodeFormatter.hpp>
+#include <soul_u32/util/Unicode.hpp>
 #include <string>
 
 namespace soul { namespace util {
@@ -27,6 +28,19 @@ void CodeFormatter::WriteLine(const std::string& text)
     NewLine();
 }
 
+void CodeFormatter::Write(const std::u32string& text)
+{
+    utf8Buffer.clear();
+    soul::unicode::AppendUtf8(utf8Buffer, text);
+    Write(utf8Buffer);
+}
+
+void CodeFormatter::WriteLine(const std::u32string& text)
+{
+    Write(text);
+    NewLine();
+}
+
 void CodeFormatter::NewLine()
 {
     stream << "\n";
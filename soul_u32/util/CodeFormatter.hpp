@@ -20,6 +20,9 @@ public:
     int CurrentIndent() const { return indentSize * indent; }
     void Write(const std::string& text);
     void WriteLine(const std::string& text);
+    //  Writes UTF-32 text as UTF-8 without creating a temporary string for each call.
+    void Write(const std::u32string& text);
+    void WriteLine(const std::u32string& text);
     void NewLine();
     void WriteLine() { NewLine(); }
     void IncIndent()
@@ -45,6 +48,7 @@ private:
     int line;
     bool start;
     std::string startText;
+    std::string utf8Buffer;
 };
 
 } } // namespace soul::util
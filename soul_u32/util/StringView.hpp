@@ -0,0 +1,70 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#ifndef SOUL_UTIL_STRING_VIEW_INCLUDED
+#define SOUL_UTIL_STRING_VIEW_INCLUDED
+#include <string>
+#include <algorithm>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace soul { namespace util {
+
+//  U32StringView refers to a range of UTF-32 characters owned by someone else, typically the input buffer of a parser.
+//  It does not allocate. The referred characters must outlive the view.
+
+class U32StringView
+{
+public:
+    typedef const char32_t* const_iterator;
+    U32StringView() : start(nullptr), finish(nullptr) {}
+    U32StringView(const char32_t* start_, const char32_t* finish_) : start(start_), finish(finish_) {}
+    U32StringView(const std::u32string& s) : start(s.c_str()), finish(s.c_str() + s.length()) {}
+    U32StringView(const char32_t* s) : start(s), finish(s + std::char_traits<char32_t>::length(s)) {}
+    const_iterator begin() const { return start; }
+    const_iterator end() const { return finish; }
+    const char32_t* Data() const { return start; }
+    size_t Length() const { return size_t(finish - start); }
+    bool IsEmpty() const { return start == finish; }
+    char32_t operator[](size_t index) const { return start[index]; }
+    U32StringView Substring(size_t pos, size_t length) const { return U32StringView(start + pos, start + pos + length); }
+    U32StringView Substring(size_t pos) const { return U32StringView(start + pos, finish); }
+    size_t Find(char32_t c) const
+    {
+        const char32_t* p = std::find(start, finish, c);
+        return p != finish ? size_t(p - start) : std::u32string::npos;
+    }
+    std::u32string ToString() const { return std::u32string(start, finish); }
+private:
+    const char32_t* start;
+    const char32_t* finish;
+};
+
+inline bool operator==(const U32StringView& left, const U32StringView& right)
+{
+    return left.Length() == right.Length() && (left.Data() == right.Data() || std::equal(left.begin(), left.end(), right.begin()));
+}
+
+inline bool operator!=(const U32StringView& left, const U32StringView& right)
+{
+    return !(left == right);
+}
+
+struct U32StringViewHash
+{
+    size_t operator()(const U32StringView& s) const
+    {
+        uint64_t h = 14695981039346656037ull;
+        for (char32_t c : s)
+        {
+            h = (h ^ uint64_t(c)) * 1099511628211ull;
+        }
+        return size_t(h);
+    }
+};
+
+} } // namespace soul::util
+
+#endif // SOUL_UTIL_STRING_VIEW_INCLUDED
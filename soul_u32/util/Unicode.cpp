@@ -17,8 +17,14 @@ UnicodeException::UnicodeException(const std::string& message_) : std::runtime_e
 std::u32string ToUtf32(const std::string& utf8Str)
 {
     std::u32string result;
-    const char* p = utf8Str.c_str();
-    int bytesRemaining = int(utf8Str.length());
+    AppendUtf32(result, utf8Str.c_str(), utf8Str.c_str() + utf8Str.length());
+    return result;
+}
+
+void AppendUtf32(std::u32string& result, const char* utf8Begin, const char* utf8End)
+{
+    const char* p = utf8Begin;
+    int64_t bytesRemaining = utf8End - utf8Begin;
     while (bytesRemaining > 0)
     {
         char c = *p;
@@ -166,7 +172,6 @@ std::u32string ToUtf32(const std::string& utf8Str)
             throw std::runtime_error("invalid UTF-8 sequence");
         }
     }
-    return result;
 }
 
 std::u32string ToUtf32(const std::u16string& utf16Str)
@@ -261,91 +266,43 @@ std::u16string ToUtf16(const std::string& utf8Str)
 std::string ToUtf8(const std::u32string& utf32Str)
 {
     std::string result;
+    result.reserve(utf32Str.length());
+    AppendUtf8(result, utf32Str);
+    return result;
+}
+
+void AppendUtf8(std::string& utf8Str, const std::u32string& utf32Str)
+{
     for (char32_t c : utf32Str)
     {
         uint32_t x = static_cast<uint32_t>(c);
         if (x < 0x80u)
         {
-            result.append(1, static_cast<char>(x & 0x7Fu));
+            utf8Str.append(1, static_cast<char>(x));
         }
         else if (x < 0x800u)
         {
-            uint8_t b1 = 0x80u;
-            for (uint8_t i = 0u; i < 6u; ++i)
-            {
-                b1 = b1 | (static_cast<uint8_t>(x & 1u) << i);
-                x = x >> 1u;
-            }
-            uint8_t b0 = 0xC0u;
-            for (uint8_t i = 0u; i < 5u; ++i)
-            {
-                b0 = b0 | (static_cast<uint8_t>(x & 1u) << i);
-                x = x >> 1u;
-            }
-            result.append(1, static_cast<char>(b0));
-            result.append(1, static_cast<char>(b1));
+            utf8Str.append(1, static_cast<char>(0xC0u | (x >> 6)));
+            utf8Str.append(1, static_cast<char>(0x80u | (x & 0x3Fu)));
         }
         else if (x < 0x10000u)
         {
-            uint8_t b2 = 0x80u;
-            for (uint8_t i = 0u; i < 6u; ++i)
-            {
-                b2 = b2 | (static_cast<uint8_t>(x & 1u) << i);
-                x = x >> 1u;
-            }
-            uint8_t b1 = 0x80u;
-            for (uint8_t i = 0u; i < 6u; ++i)
-            {
-                b1 = b1 | (static_cast<uint8_t>(x & 1u) << i);
-                x = x >> 1u;
-            }
-            uint8_t b0 = 0xE0u;
-            for (uint8_t i = 0u; i < 4u; ++i)
-            {
-                b0 = b0 | (static_cast<uint8_t>(x & 1u) << i);
-                x = x >> 1u;
-            }
-            result.append(1, static_cast<char>(b0));
-            result.append(1, static_cast<char>(b1));
-            result.append(1, static_cast<char>(b2));
+            utf8Str.append(1, static_cast<char>(0xE0u | (x >> 12)));
+            utf8Str.append(1, static_cast<char>(0x80u | ((x >> 6) & 0x3Fu)));
+            utf8Str.append(1, static_cast<char>(0x80u | (x & 0x3Fu)));
         }
         else if (x < 0x110000u)
         {
-            uint8_t b3 = 0x80u;
-            for (uint8_t i = 0u; i < 6u; ++i)
-            {
-                b3 = b3 | (static_cast<uint8_t>(x & 1u) << i);
-                x = x >> 1u;
-            }
-            uint8_t b2 = 0x80u;
-            for (uint8_t i = 0u; i < 6u; ++i)
-            {
-                b2 = b2 | (static_cast<uint8_t>(x & 1u) << i);
-                x = x >> 1u;
-            }
-            uint8_t b1 = 0x80u;
-            for (uint8_t i = 0u; i < 6u; ++i)
-            {
-                b1 = b1 | (static_cast<uint8_t>(x & 1u) << i);
-                x = x >> 1u;
-            }
-            uint8_t b0 = 0xF0u;
-            for (uint8_t i = 0u; i < 3u; ++i)
-            {
-                b0 = b0 | (static_cast<uint8_t>(x & 1u) << i);
-                x = x >> 1u;
-            }
-            result.append(1, static_cast<char>(b0));
-            result.append(1, static_cast<char>(b1));
-            result.append(1, static_cast<char>(b2));
-            result.append(1, static_cast<char>(b3));
+            utf8Str.append(1, static_cast<char>(0xF0u | (x >> 18)));
+            utf8Str.append(1, static_cast<char>(0x80u | ((x >> 12) & 0x3Fu)));
+            utf8Str.append(1, static_cast<char>(0x80u | ((x >> 6) & 0x3Fu)));
+            utf8Str.append(1, static_cast<char>(0x80u | (x & 0x3Fu)));
         }
         else
         {
             throw std::runtime_error("invalid UTF-32 code point");
         }
     }
-    return result;
 }
 
 std::string ToUtf8(const std::u16string& utf16Str)
@@ -875,7 +832,7 @@ std::unique_ptr<GeneralCategoryTable> GeneralCategoryTable::instance;
 GeneralCategoryTable::GeneralCategoryTable()
 {
     generalCategories.push_back(GeneralCategory(GeneralCategoryId::Lu, "Lu", "Uppercase Letter"));
-    generalCategories.push_back(GeneralCategory(GeneralCategoryId::Lu, "Ll", "Lowercase Letter"));
+    generalCategories.push_back(GeneralCategory(GeneralCategoryId::Ll, "Ll", "Lowercase Letter"));
     generalCategories.push_back(GeneralCategory(GeneralCategoryId::Lt, "Lt", "Titlecase Letter"));
     generalCategories.push_back(GeneralCategory(GeneralCategoryId::LC, "LC", "Cased Letter"));
     generalCategories.push_back(GeneralCategory(GeneralCategoryId::Lm, "Lm", "Modifier Letter"));
@@ -1266,6 +1223,105 @@ void CharacterInfo::Read(BinaryReader& reader)
     script = static_cast<ScriptId>(reader.ReadByte());
 }
 
+CharacterInfo CharacterInfo::MakeRelative(char32_t codePoint) const
+{
+    CharacterInfo info(*this);
+    info.upper = upper == 0 ? noCaseMapping : upper - codePoint;
+    info.lower = lower == 0 ? noCaseMapping : lower - codePoint;
+    info.title = title == 0 ? noCaseMapping : title - codePoint;
+    info.folding = folding == 0 ? noCaseMapping : folding - codePoint;
+    return info;
+}
+
+//  A packed character info stores the general category number, age, script and block in one 32-bit field,
+//  and a two bit kind for each case mapping: no mapping, maps to itself, or maps by an offset stored after the fields.
+
+const int packedAgeShift = 5;
+const int packedScriptShift = 11;
+const int packedBlockShift = 19;
+const uint32_t packedBlockLimit = 1 << 9;
+const uint8_t noCaseMappingKind = 0;
+const uint8_t selfCaseMappingKind = 1;
+const uint8_t offsetCaseMappingKind = 2;
+
+void CharacterInfo::WritePacked(BinaryWriter& writer)
+{
+    uint32_t generalCategoryNumber = 0;
+    uint32_t generalCategoryBits = static_cast<uint32_t>(generalCategory);
+    while (generalCategoryBits != 0)
+    {
+        ++generalCategoryNumber;
+        if ((generalCategoryBits & 1) != 0) break;
+        generalCategoryBits >>= 1;
+    }
+    if (static_cast<uint32_t>(block) >= packedBlockLimit)
+    {
+        throw UnicodeException("block id " + std::to_string(static_cast<int>(block)) + " does not fit in a packed character info");
+    }
+    uint32_t fields = generalCategoryNumber | (static_cast<uint32_t>(age) << packedAgeShift) | (static_cast<uint32_t>(script) << packedScriptShift) | 
+        (static_cast<uint32_t>(block) << packedBlockShift);
+    char32_t caseMappings[4] = { upper, lower, title, folding };
+    uint8_t caseMappingKinds = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        uint8_t kind = offsetCaseMappingKind;
+        if (caseMappings[i] == noCaseMapping)
+        {
+            kind = noCaseMappingKind;
+        }
+        else if (caseMappings[i] == 0)
+        {
+            kind = selfCaseMappingKind;
+        }
+        caseMappingKinds = caseMappingKinds | (kind << (2 * i));
+    }
+    writer.Write(binaryProperties);
+    writer.Write(fields);
+    writer.Write(caseMappingKinds);
+    for (int i = 0; i < 4; ++i)
+    {
+        if (((caseMappingKinds >> (2 * i)) & 3) == offsetCaseMappingKind)
+        {
+            writer.Write(caseMappings[i]);
+        }
+    }
+}
+
+void CharacterInfo::ReadPacked(BinaryReader& reader)
+{
+    binaryProperties = reader.ReadULong();
+    uint32_t fields = reader.ReadUInt();
+    generalCategory = static_cast<GeneralCategoryId>((static_cast<uint32_t>(1) << (fields & 0x1F)) >> 1);
+    age = static_cast<AgeId>((fields >> packedAgeShift) & 0x3F);
+    script = static_cast<ScriptId>((fields >> packedScriptShift) & 0xFF);
+    block = static_cast<BlockId>((fields >> packedBlockShift) & (packedBlockLimit - 1));
+    uint8_t caseMappingKinds = reader.ReadByte();
+    char32_t* caseMappings[4] = { &upper, &lower, &title, &folding };
+    for (int i = 0; i < 4; ++i)
+    {
+        uint8_t kind = (caseMappingKinds >> (2 * i)) & 3;
+        if (kind == noCaseMappingKind)
+        {
+            *caseMappings[i] = noCaseMapping;
+        }
+        else if (kind == selfCaseMappingKind)
+        {
+            *caseMappings[i] = 0;
+        }
+        else
+        {
+            *caseMappings[i] = reader.ReadChar();
+        }
+    }
+}
+
+bool operator==(const CharacterInfo& left, const CharacterInfo& right)
+{
+    return left.BinaryProperties() == right.BinaryProperties() && left.GetGeneralCategory() == right.GetGeneralCategory() && 
+        left.Upper() == right.Upper() && left.Lower() == right.Lower() && left.Title() == right.Title() && left.Folding() == right.Folding() && 
+        left.GetBlock() == right.GetBlock() && left.GetAge() == right.GetAge() && left.GetScript() == right.GetScript();
+}
+
 NumericType::NumericType(NumericTypeId id_, const std::string& shortName_, const std::string& longName_) : id(id_), shortName(shortName_), longName(longName_)
 {
 }
@@ -1566,8 +1622,13 @@ void Alias::Read(BinaryReader& reader)
     name = reader.ReadUtf8String();
 }
 
+bool operator==(const Alias& left, const Alias& right)
+{
+    return left.TypeId() == right.TypeId() && left.Name() == right.Name();
+}
+
 ExtendedCharacterInfo::ExtendedCharacterInfo() : characterName(), canonicalCombiningClass(0), fullUpper(), fullLower(), fullTitle(), fullFolding(), bidiClass(BidiClassId::none), 
-    numericType(NumericTypeId::none), numericValue(), bidiMirroringGlyph(0), bidiPairedBracket(0)
+    numericType(NumericTypeId::none), numericValue(), bidiMirroringGlyph(0), bidiPairedBracketType(BidiPairedBracketTypeId::none), bidiPairedBracket(0)
 {
 }
 
@@ -1664,27 +1725,108 @@ void ExtendedCharacterInfo::Read(BinaryReader& reader)
     bidiPairedBracket = reader.ReadChar();
 }
 
-CharacterInfoPage::CharacterInfoPage()
+bool operator==(const ExtendedCharacterInfo& left, const ExtendedCharacterInfo& right)
+{
+    return left.CharacterName() == right.CharacterName() && left.Unicode1Name() == right.Unicode1Name() && 
+        left.GetCanonicalCombiningClass() == right.GetCanonicalCombiningClass() && left.FullUpper() == right.FullUpper() && left.FullLower() == right.FullLower() && 
+        left.FullTitle() == right.FullTitle() && left.FullFolding() == right.FullFolding() && left.GetBidiClass() == right.GetBidiClass() && 
+        left.GetNumericType() == right.GetNumericType() && left.GetNumericValue() == right.GetNumericValue() && left.Aliases() == right.Aliases() && 
+        left.GetBidiMirroringGlyph() == right.GetBidiMirroringGlyph() && left.GetBidiPairedBracketType() == right.GetBidiPairedBracketType() && 
+        left.GetBidiPairedBracket() == right.GetBidiPairedBracket();
+}
+
+//  Info indices of a packed page are omitted when the page has only one distinct info and stored as bytes when it has at most 256.
+
+void WriteInfoIndices(BinaryWriter& writer, const std::vector<uint16_t>& infoIndices, size_t numInfos)
+{
+    if (numInfos <= 1) return;
+    for (uint16_t infoIndex : infoIndices)
+    {
+        if (numInfos <= 256)
+        {
+            writer.Write(static_cast<uint8_t>(infoIndex));
+        }
+        else
+        {
+            writer.Write(infoIndex);
+        }
+    }
+}
+
+void ReadInfoIndices(BinaryReader& reader, std::vector<uint16_t>& infoIndices, size_t numInfos)
+{
+    infoIndices.resize(numInfosInPage);
+    for (int i = 0; i < numInfosInPage; ++i)
+    {
+        if (numInfos <= 1)
+        {
+            infoIndices[i] = 0;
+        }
+        else if (numInfos <= 256)
+        {
+            infoIndices[i] = reader.ReadByte();
+        }
+        else
+        {
+            infoIndices[i] = reader.ReadUShort();
+        }
+    }
+}
+
+CharacterInfoPage::CharacterInfoPage() : packed(false)
 {
     characterInfos.resize(numInfosInPage);
+    infoIndices.resize(numInfosInPage);
+    for (int i = 0; i < numInfosInPage; ++i)
+    {
+        infoIndices[i] = static_cast<uint16_t>(i);
+    }
+}
+
+CharacterInfoPage::CharacterInfoPage(bool packed_) : packed(packed_)
+{
 }
 
 CharacterInfo& CharacterInfoPage::GetCharacterInfo(int index)
 {
-    if (index < 0 || index > characterInfos.size())
+    if (packed)
+    {
+        throw UnicodeException("packed character info page cannot be modified");
+    }
+    if (index < 0 || index >= characterInfos.size())
     {
         throw UnicodeException("invalid character info index");
     }
     return characterInfos[index];
 }
 
-const CharacterInfo& CharacterInfoPage::GetCharacterInfo(int index) const
+std::unique_ptr<CharacterInfoPage> CharacterInfoPage::MakePacked(int pageIndex) const
 {
-    if (index < 0 || index > characterInfos.size())
+    std::unique_ptr<CharacterInfoPage> packedPage(new CharacterInfoPage(true));
+    packedPage->infoIndices.resize(numInfosInPage);
+    char32_t pageStart = static_cast<char32_t>(pageIndex * numInfosInPage);
+    for (int i = 0; i < numInfosInPage; ++i)
     {
-        throw UnicodeException("invalid character info index");
+        char32_t codePoint = pageStart + i;
+        CharacterInfo info = GetCharacterInfo(codePoint).MakeRelative(codePoint);
+        int n = static_cast<int>(packedPage->characterInfos.size());
+        int infoIndex = 0;
+        while (infoIndex < n && !(packedPage->characterInfos[infoIndex] == info))
+        {
+            ++infoIndex;
+        }
+        if (infoIndex == n)
+        {
+            packedPage->characterInfos.push_back(info);
+        }
+        packedPage->infoIndices[i] = static_cast<uint16_t>(infoIndex);
     }
-    return characterInfos[index];
+    return packedPage;
+}
+
+bool CharacterInfoPage::Equals(const CharacterInfoPage& that) const
+{
+    return packed == that.packed && infoIndices == that.infoIndices && characterInfos == that.characterInfos;
 }
 
 void CharacterInfoPage::Write(BinaryWriter& writer)
@@ -1705,29 +1847,85 @@ void CharacterInfoPage::Read(BinaryReader& reader)
     }
 }
 
-ExtendedCharacterInfoPage::ExtendedCharacterInfoPage()
+void CharacterInfoPage::WritePacked(BinaryWriter& writer)
 {
-    extendedCharacterInfos.resize(numInfosInPage);
+    if (!packed)
+    {
+        throw UnicodeException("character info page not packed");
+    }
+    writer.Write(static_cast<uint16_t>(characterInfos.size()));
+    for (CharacterInfo& info : characterInfos)
+    {
+        info.WritePacked(writer);
+    }
+    WriteInfoIndices(writer, infoIndices, characterInfos.size());
 }
 
-const ExtendedCharacterInfo& ExtendedCharacterInfoPage::GetExtendedCharacterInfo(int index) const
+void CharacterInfoPage::ReadPacked(BinaryReader& reader)
 {
-    if (index < 0 || index > extendedCharacterInfos.size())
+    uint16_t n = reader.ReadUShort();
+    characterInfos.resize(n);
+    for (CharacterInfo& info : characterInfos)
     {
-        throw UnicodeException("invalid extended character info index");
+        info.ReadPacked(reader);
     }
-    return extendedCharacterInfos[index];
+    ReadInfoIndices(reader, infoIndices, n);
+}
+
+ExtendedCharacterInfoPage::ExtendedCharacterInfoPage() : packed(false)
+{
+    extendedCharacterInfos.resize(numInfosInPage);
+    infoIndices.resize(numInfosInPage);
+    for (int i = 0; i < numInfosInPage; ++i)
+    {
+        infoIndices[i] = static_cast<uint16_t>(i);
+    }
+}
+
+ExtendedCharacterInfoPage::ExtendedCharacterInfoPage(bool packed_) : packed(packed_)
+{
 }
 
 ExtendedCharacterInfo& ExtendedCharacterInfoPage::GetExtendedCharacterInfo(int index)
 {
-    if (index < 0 || index > extendedCharacterInfos.size())
+    if (packed)
+    {
+        throw UnicodeException("packed extended character info page cannot be modified");
+    }
+    if (index < 0 || index >= extendedCharacterInfos.size())
     {
         throw UnicodeException("invalid extended character info index");
     }
     return extendedCharacterInfos[index];
 }
 
+std::unique_ptr<ExtendedCharacterInfoPage> ExtendedCharacterInfoPage::MakePacked() const
+{
+    std::unique_ptr<ExtendedCharacterInfoPage> packedPage(new ExtendedCharacterInfoPage(true));
+    packedPage->infoIndices.resize(numInfosInPage);
+    for (int i = 0; i < numInfosInPage; ++i)
+    {
+        const ExtendedCharacterInfo& info = GetExtendedCharacterInfo(i);
+        int n = static_cast<int>(packedPage->extendedCharacterInfos.size());
+        int infoIndex = 0;
+        while (infoIndex < n && !(packedPage->extendedCharacterInfos[infoIndex] == info))
+        {
+            ++infoIndex;
+        }
+        if (infoIndex == n)
+        {
+            packedPage->extendedCharacterInfos.push_back(info);
+        }
+        packedPage->infoIndices[i] = static_cast<uint16_t>(infoIndex);
+    }
+    return packedPage;
+}
+
+bool ExtendedCharacterInfoPage::Equals(const ExtendedCharacterInfoPage& that) const
+{
+    return packed == that.packed && infoIndices == that.infoIndices && extendedCharacterInfos == that.extendedCharacterInfos;
+}
+
 void ExtendedCharacterInfoPage::Write(BinaryWriter& writer)
 {
     int n = extendedCharacterInfos.size();
@@ -1746,6 +1944,31 @@ void ExtendedCharacterInfoPage::Read(BinaryReader& reader)
     }
 }
 
+void ExtendedCharacterInfoPage::WritePacked(BinaryWriter& writer)
+{
+    if (!packed)
+    {
+        throw UnicodeException("extended character info page not packed");
+    }
+    writer.Write(static_cast<uint16_t>(extendedCharacterInfos.size()));
+    for (ExtendedCharacterInfo& info : extendedCharacterInfos)
+    {
+        info.Write(writer);
+    }
+    WriteInfoIndices(writer, infoIndices, extendedCharacterInfos.size());
+}
+
+void ExtendedCharacterInfoPage::ReadPacked(BinaryReader& reader)
+{
+    uint16_t n = reader.ReadUShort();
+    extendedCharacterInfos.resize(n);
+    for (ExtendedCharacterInfo& info : extendedCharacterInfos)
+    {
+        info.Read(reader);
+    }
+    ReadInfoIndices(reader, infoIndices, n);
+}
+
 void ExtendedCharacterInfoHeader::AllocatePages(int numExtendedPages)
 {
     extendedPageStarts.resize(numExtendedPages);
@@ -1827,7 +2050,16 @@ std::string SoulU32UcdFilePath()
     return (boost::filesystem::path(SoulU32Root()) / boost::filesystem::path("unicode") / boost::filesystem::path("soul_ucd.bin")).generic_string();
 }
 
-CharacterTable::CharacterTable() : headerRead(false), extendedHeaderStart(0), extendedHeaderEnd(0), extendedHeaderRead(false)
+CharacterTable::CharacterTable() : headerRead(false), version(current_soul_ucd_version), pageDirectoryRead(false), extendedHeaderStart(0), extendedHeaderEnd(0), extendedHeaderRead(false)
+{
+    for (int i = 0; i < numCharacterInfoPages; ++i)
+    {
+        pages[i].store(nullptr, std::memory_order_relaxed);
+        extendedPages[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+CharacterTable::~CharacterTable()
 {
 }
 
@@ -1836,25 +2068,86 @@ void CharacterTable::Write()
     std::string ucdFilePath = SoulU32UcdFilePath();
     BinaryWriter writer(ucdFilePath);
     WriteHeader(writer);
-    int n = pages.size();
+    int n = numCharacterInfoPages;
+    while (n > 0 && !pages[n - 1].load(std::memory_order_relaxed))
+    {
+        --n;
+    }
+    writer.Write(static_cast<uint32_t>(n));
+    uint32_t pageDirectoryStart = writer.Pos();
+    std::vector<uint32_t> starts(n, 0);
+    for (int i = 0; i < n; ++i)
+    {
+        writer.Write(starts[i]);
+    }
+    CharacterInfoPage emptyPage;
+    std::vector<std::pair<std::unique_ptr<CharacterInfoPage>, uint32_t>> distinctPages;
     for (int i = 0; i < n; ++i)
     {
-        CharacterInfoPage* page = pages[i].get();
-        page->Write(writer);
+        const CharacterInfoPage* page = pages[i].load(std::memory_order_relaxed);
+        if (!page)
+        {
+            page = &emptyPage;
+        }
+        std::unique_ptr<CharacterInfoPage> packedPage = page->MakePacked(i);
+        for (const std::pair<std::unique_ptr<CharacterInfoPage>, uint32_t>& distinctPage : distinctPages)
+        {
+            if (distinctPage.first->Equals(*packedPage))
+            {
+                starts[i] = distinctPage.second;
+                break;
+            }
+        }
+        if (starts[i] == 0)
+        {
+            starts[i] = writer.Pos();
+            packedPage->WritePacked(writer);
+            distinctPages.push_back(std::make_pair(std::move(packedPage), starts[i]));
+        }
     }
     extendedHeaderStart = writer.Pos();
-    int nx = extendedPages.size();
+    int nx = numCharacterInfoPages;
+    while (nx > 0 && !extendedPages[nx - 1].load(std::memory_order_relaxed))
+    {
+        --nx;
+    }
     extendedHeader.AllocatePages(nx);
     extendedHeader.Write(writer);
     extendedHeaderEnd = writer.Pos();
+    ExtendedCharacterInfoPage emptyExtendedPage;
+    std::vector<std::pair<std::unique_ptr<ExtendedCharacterInfoPage>, uint32_t>> distinctExtendedPages;
     for (int i = 0; i < nx; ++i)
     {
-        extendedHeader.SetPageStart(i, writer.Pos());
-        ExtendedCharacterInfoPage* extendedPage = extendedPages[i].get();
-        extendedPage->Write(writer);
+        const ExtendedCharacterInfoPage* extendedPage = extendedPages[i].load(std::memory_order_relaxed);
+        if (!extendedPage)
+        {
+            extendedPage = &emptyExtendedPage;
+        }
+        std::unique_ptr<ExtendedCharacterInfoPage> packedPage = extendedPage->MakePacked();
+        uint32_t start = 0;
+        for (const std::pair<std::unique_ptr<ExtendedCharacterInfoPage>, uint32_t>& distinctPage : distinctExtendedPages)
+        {
+            if (distinctPage.first->Equals(*packedPage))
+            {
+                start = distinctPage.second;
+                break;
+            }
+        }
+        if (start == 0)
+        {
+            start = writer.Pos();
+            packedPage->WritePacked(writer);
+            distinctExtendedPages.push_back(std::make_pair(std::move(packedPage), start));
+        }
+        extendedHeader.SetPageStart(i, start);
     }
     writer.Seek(extendedHeaderStart);
     extendedHeader.Write(writer);
+    writer.Seek(pageDirectoryStart);
+    for (uint32_t start : starts)
+    {
+        writer.Write(start);
+    }
     writer.Seek(0);
     WriteHeader(writer);
 }
@@ -1884,9 +2177,11 @@ void CharacterTable::ReadHeader(BinaryReader& reader)
             throw UnicodeException("invalid soul_ucd.bin header magic: 'SOULUCD' expected");
         }
     }
-    if (magic[7] != headerMagic[7])
+    version = magic[7];
+    if (version != soul_ucd_version_1 && version != soul_ucd_version_2)
     {
-        throw UnicodeException("invalid soul_ucd.bin version: version " + std::string(1, headerMagic[7]) + " expected, version " + std::string(1, magic[7]) + " read");
+        throw UnicodeException("invalid soul_ucd.bin version: version " + std::string(1, soul_ucd_version_1) + " or " + std::string(1, soul_ucd_version_2) + 
+            " expected, version " + std::string(1, magic[7]) + " read");
     }
     extendedHeaderStart = reader.ReadUInt();
     extendedHeaderEnd = reader.ReadUInt();
@@ -1898,54 +2193,103 @@ void CharacterTable::ReadExtendedHeader(BinaryReader& reader)
     extendedHeader.Read(reader);
 }
 
-const CharacterInfo& CharacterTable::GetCharacterInfo(char32_t codePoint)
+void CharacterTable::ReadPageDirectory(BinaryReader& reader)
 {
-    if (codePoint > 0x10FFFF)
+    pageDirectoryRead = true;
+    reader.Seek(static_cast<uint32_t>(headerSize));
+    uint32_t n = reader.ReadUInt();
+    for (uint32_t i = 0; i < n; ++i)
     {
-        throw UnicodeException("invalid Unicode code point " + std::to_string(codePoint));
+        pageStarts.push_back(reader.ReadUInt());
     }
-    int pageIndex = codePoint / numInfosInPage;
-    while (pages.size() <= pageIndex)
+}
+
+BinaryReader& CharacterTable::GetReader()
+{
+    if (!ucdReader)
     {
-        pages.push_back(std::unique_ptr<CharacterInfoPage>());
+        ucdReader.reset(new BinaryReader(SoulU32UcdFilePath()));
+        ReadHeader(*ucdReader);
     }
-    CharacterInfoPage* page = pages[pageIndex].get();
+    return *ucdReader;
+}
+
+void CharacterTable::ThrowInvalidCodePoint(char32_t codePoint)
+{
+    throw UnicodeException("invalid Unicode code point " + std::to_string(codePoint));
+}
+
+const CharacterInfoPage* CharacterTable::LoadPage(int pageIndex)
+{
+    std::lock_guard<std::mutex> lock(loadMutex);
+    CharacterInfoPage* page = pages[pageIndex].load(std::memory_order_acquire);
     if (!page)
     {
-        std::string ucdFilePath = SoulU32UcdFilePath();
-        BinaryReader reader(ucdFilePath);
-        uint32_t pageStart = 0;
-        if (!headerRead)
+        BinaryReader& reader = GetReader();
+        if (version == soul_ucd_version_1)
         {
-            ReadHeader(reader);
-            pageStart = characterInfoPageSize * pageIndex;
+            reader.Seek(static_cast<uint32_t>(headerSize + characterInfoPageSize * pageIndex));
+            std::unique_ptr<CharacterInfoPage> newPage(new CharacterInfoPage());
+            newPage->Read(reader);
+            page = newPage.get();
+            ownedPages.push_back(std::move(newPage));
         }
         else
         {
-            pageStart = headerSize + characterInfoPageSize * pageIndex;
+            if (!pageDirectoryRead)
+            {
+                ReadPageDirectory(reader);
+            }
+            uint32_t pageStart = 0;
+            if (pageIndex < pageStarts.size())
+            {
+                pageStart = pageStarts[pageIndex];
+            }
+            auto it = pageStartMap.find(pageStart);
+            if (it != pageStartMap.cend())
+            {
+                page = it->second;
+            }
+            else
+            {
+                std::unique_ptr<CharacterInfoPage> newPage;
+                if (pageStart != 0)
+                {
+                    reader.Seek(pageStart);
+                    newPage.reset(new CharacterInfoPage(true));
+                    newPage->ReadPacked(reader);
+                }
+                else
+                {
+                    newPage = CharacterInfoPage().MakePacked(pageIndex);
+                }
+                page = newPage.get();
+                pageStartMap[pageStart] = page;
+                ownedPages.push_back(std::move(newPage));
+            }
         }
-        reader.Skip(pageStart);
-        page = new CharacterInfoPage();
-        page->Read(reader);
-        pages[pageIndex] = std::move(std::unique_ptr<CharacterInfoPage>(page));
+        pages[pageIndex].store(page, std::memory_order_release);
     }
-    int infoIndex = codePoint % numInfosInPage;
-    return page->GetCharacterInfo(infoIndex);
+    return page;
 }
 
 CharacterInfo& CharacterTable::CreateCharacterInfo(char32_t codePoint)
 {
     if (codePoint > 0x10FFFF)
     {
-        throw UnicodeException("invalid Unicode code point " + std::to_string(codePoint));
+        ThrowInvalidCodePoint(codePoint);
     }
     int pageIndex = codePoint / numInfosInPage;
-    while (pages.size() <= pageIndex)
+    for (int i = 0; i <= pageIndex; ++i)
     {
-        pages.push_back(std::unique_ptr<CharacterInfoPage>(new CharacterInfoPage()));
+        if (!pages[i].load(std::memory_order_relaxed))
+        {
+            ownedPages.push_back(std::unique_ptr<CharacterInfoPage>(new CharacterInfoPage()));
+            pages[i].store(ownedPages.back().get(), std::memory_order_release);
+        }
     }
     int infoIndex = codePoint % numInfosInPage;
-    CharacterInfoPage* page = pages[pageIndex].get();
+    CharacterInfoPage* page = pages[pageIndex].load(std::memory_order_relaxed);
     return page->GetCharacterInfo(infoIndex);
 }
 
@@ -1953,61 +2297,90 @@ const ExtendedCharacterInfo& CharacterTable::GetExtendedCharacterInfo(char32_t c
 {
     if (codePoint > 0x10FFFF)
     {
-        throw UnicodeException("invalid Unicode code point " + std::to_string(codePoint));
+        ThrowInvalidCodePoint(codePoint);
     }
     int pageIndex = codePoint / numInfosInPage;
-    while (extendedPages.size() <= pageIndex)
+    const ExtendedCharacterInfoPage* extendedPage = extendedPages[pageIndex].load(std::memory_order_acquire);
+    if (!extendedPage)
     {
-        extendedPages.push_back(std::unique_ptr<ExtendedCharacterInfoPage>());
+        extendedPage = LoadExtendedPage(pageIndex);
     }
-    ExtendedCharacterInfoPage* extendedPage = extendedPages[pageIndex].get();
+    int infoIndex = codePoint % numInfosInPage;
+    return extendedPage->GetExtendedCharacterInfo(infoIndex);
+}
+
+const ExtendedCharacterInfoPage* CharacterTable::LoadExtendedPage(int pageIndex)
+{
+    std::lock_guard<std::mutex> lock(loadMutex);
+    ExtendedCharacterInfoPage* extendedPage = extendedPages[pageIndex].load(std::memory_order_acquire);
     if (!extendedPage)
     {
-        std::string ucdFilePath = SoulU32UcdFilePath();
-        BinaryReader reader(ucdFilePath);
-        uint32_t start = 0;
-        uint32_t pageStart = 0;
-        if (!headerRead)
-        {
-            ReadHeader(reader);
-            start = extendedHeaderStart - headerSize;
-        }
-        else
-        {
-            start = extendedHeaderStart;
-        }
+        BinaryReader& reader = GetReader();
         if (!extendedHeaderRead)
         {
-            reader.Skip(start);
+            reader.Seek(extendedHeaderStart);
             ReadExtendedHeader(reader);
-            pageStart = extendedHeader.GetPageStart(pageIndex) - extendedHeaderEnd;
+        }
+        if (version == soul_ucd_version_1)
+        {
+            reader.Seek(extendedHeader.GetPageStart(pageIndex));
+            std::unique_ptr<ExtendedCharacterInfoPage> newPage(new ExtendedCharacterInfoPage());
+            newPage->Read(reader);
+            extendedPage = newPage.get();
+            ownedExtendedPages.push_back(std::move(newPage));
         }
         else
         {
-            pageStart = extendedHeader.GetPageStart(pageIndex);
+            uint32_t pageStart = 0;
+            if (pageIndex < extendedHeader.NumPages())
+            {
+                pageStart = extendedHeader.GetPageStart(pageIndex);
+            }
+            auto it = extendedPageStartMap.find(pageStart);
+            if (it != extendedPageStartMap.cend())
+            {
+                extendedPage = it->second;
+            }
+            else
+            {
+                std::unique_ptr<ExtendedCharacterInfoPage> newPage;
+                if (pageStart != 0)
+                {
+                    reader.Seek(pageStart);
+                    newPage.reset(new ExtendedCharacterInfoPage(true));
+                    newPage->ReadPacked(reader);
+                }
+                else
+                {
+                    newPage = ExtendedCharacterInfoPage().MakePacked();
+                }
+                extendedPage = newPage.get();
+                extendedPageStartMap[pageStart] = extendedPage;
+                ownedExtendedPages.push_back(std::move(newPage));
+            }
         }
-        reader.Skip(pageStart);
-        extendedPage = new ExtendedCharacterInfoPage();
-        extendedPage->Read(reader);
-        extendedPages[pageIndex] = std::move(std::unique_ptr<ExtendedCharacterInfoPage>(extendedPage));
+        extendedPages[pageIndex].store(extendedPage, std::memory_order_release);
     }
-    int infoIndex = codePoint % numInfosInPage;
-    return extendedPage->GetExtendedCharacterInfo(infoIndex);
+    return extendedPage;
 }
 
 ExtendedCharacterInfo& CharacterTable::CreateExtendedCharacterInfo(char32_t codePoint)
 {
     if (codePoint > 0x10FFFF)
     {
-        throw UnicodeException("invalid Unicode code point " + std::to_string(codePoint));
+        ThrowInvalidCodePoint(codePoint);
     }
     int pageIndex = codePoint / numInfosInPage;
-    while (extendedPages.size() <= pageIndex)
+    for (int i = 0; i <= pageIndex; ++i)
     {
-        extendedPages.push_back(std::unique_ptr<ExtendedCharacterInfoPage>(new ExtendedCharacterInfoPage()));
+        if (!extendedPages[i].load(std::memory_order_relaxed))
+        {
+            ownedExtendedPages.push_back(std::unique_ptr<ExtendedCharacterInfoPage>(new ExtendedCharacterInfoPage()));
+            extendedPages[i].store(ownedExtendedPages.back().get(), std::memory_order_release);
+        }
     }
     int infoIndex = codePoint % numInfosInPage;
-    ExtendedCharacterInfoPage* extendedPage = extendedPages[pageIndex].get();
+    ExtendedCharacterInfoPage* extendedPage = extendedPages[pageIndex].load(std::memory_order_relaxed);
     return extendedPage->GetExtendedCharacterInfo(infoIndex);
 }
 
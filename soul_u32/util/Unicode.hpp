@@ -7,10 +7,13 @@
 #define SOUL_UNICODE_UNICODE_INCLUDED
 #include <soul_u32/util/BinaryWriter.hpp>
 #include <soul_u32/util/BinaryReader.hpp>
+#include <soul_u32/util/UnicodeTables.hpp>
 #include <string>
 #include <vector>
 #include <unordered_map>
 #include <memory>
+#include <atomic>
+#include <mutex>
 #include <stdexcept>
 #include <stdint.h>
 #include <cstdio>
@@ -26,10 +29,13 @@ public:
 };
 
 std::u32string ToUtf32(const std::string& utf8Str);
+//  Decodes UTF-8 characters and appends them to result, so that a buffer can be reused for many conversions.
+void AppendUtf32(std::u32string& result, const char* utf8Begin, const char* utf8End);
 std::u32string ToUtf32(const std::u16string& utf16Str);
 std::u16string ToUtf16(const std::u32string& utf32Str);
 std::u16string ToUtf16(const std::string& utf8Str);
 std::string ToUtf8(const std::u32string& utf32Str);
+void AppendUtf8(std::string& utf8Str, const std::u32string& utf32Str);
 std::string ToUtf8(const std::u16string& utf16Str);
 
 std::u32string ToUpper(const std::u32string& s);
@@ -441,10 +447,16 @@ inline const Script& GetScriptByLongName(const std::string& longName)
     return ScriptTable::Instance().GetScriptByLongName(longName);
 }
 
+const char32_t noCaseMapping = 0x80000000;
+
 class CharacterInfo
 {
 public:
     CharacterInfo();
+    uint64_t BinaryProperties() const
+    {
+        return binaryProperties;
+    }
     bool GetBinaryProperty(BinaryPropertyId binaryPropertyId) const
     {
         uint64_t mask = static_cast<uint64_t>(1) << static_cast<uint64_t>(binaryPropertyId);
@@ -530,8 +542,20 @@ public:
     {
         script = script_;
     }
+    CharacterInfo MakeRelative(char32_t codePoint) const;
+    CharacterInfo MakeAbsolute(char32_t codePoint) const
+    {
+        CharacterInfo info(*this);
+        info.upper = upper == noCaseMapping ? 0 : codePoint + upper;
+        info.lower = lower == noCaseMapping ? 0 : codePoint + lower;
+        info.title = title == noCaseMapping ? 0 : codePoint + title;
+        info.folding = folding == noCaseMapping ? 0 : codePoint + folding;
+        return info;
+    }
     void Write(BinaryWriter& writer);
     void Read(BinaryReader& reader);
+    void WritePacked(BinaryWriter& writer);
+    void ReadPacked(BinaryReader& reader);
 private:
     uint64_t binaryProperties;
     GeneralCategoryId generalCategory;
@@ -544,10 +568,13 @@ private:
     ScriptId script;
 };
 
+bool operator==(const CharacterInfo& left, const CharacterInfo& right);
+
 constexpr int numInfosInPage = 1024;
 constexpr size_t characterInfoSize = sizeof(uint64_t) + sizeof(BlockId) + sizeof(GeneralCategoryId) + sizeof(AgeId) + sizeof(uint32_t) + sizeof(uint32_t) + sizeof(uint32_t) + 
     sizeof(uint32_t) + sizeof(ScriptId);
 constexpr size_t characterInfoPageSize = numInfosInPage * characterInfoSize;
+constexpr int numCharacterInfoPages = 0x110000 / numInfosInPage;
 
 enum class NumericTypeId : uint8_t
 {
@@ -766,6 +793,8 @@ private:
     std::string name;
 };
 
+bool operator==(const Alias& left, const Alias& right);
+
 class ExtendedCharacterInfo
 {
 public:
@@ -895,28 +924,60 @@ private:
     char32_t bidiPairedBracket;
 };
 
+bool operator==(const ExtendedCharacterInfo& left, const ExtendedCharacterInfo& right);
+
+//  A page holds the distinct character infos of the page and the index of the info of each character.
+//  A page being built or read from a version 1 file has an info for every character.
+//  A packed page, written to and read from a version 2 file, stores each distinct info once and its case mappings
+//  relative to the code point, so that for example all lowercase letters of a script that map to uppercase by the same offset share an info.
+
 class CharacterInfoPage
 {
 public:
     CharacterInfoPage();
-    const CharacterInfo& GetCharacterInfo(int index) const;
+    explicit CharacterInfoPage(bool packed_);
+    CharacterInfo GetCharacterInfo(char32_t codePoint) const
+    {
+        const CharacterInfo& info = characterInfos[infoIndices[codePoint % numInfosInPage]];
+        if (packed)
+        {
+            return info.MakeAbsolute(codePoint);
+        }
+        return info;
+    }
     CharacterInfo& GetCharacterInfo(int index);
+    std::unique_ptr<CharacterInfoPage> MakePacked(int pageIndex) const;
+    bool Equals(const CharacterInfoPage& that) const;
     void Write(BinaryWriter& writer);
     void Read(BinaryReader& reader);
+    void WritePacked(BinaryWriter& writer);
+    void ReadPacked(BinaryReader& reader);
 private:
+    bool packed;
     std::vector<CharacterInfo> characterInfos;
+    std::vector<uint16_t> infoIndices;
 };
 
 class ExtendedCharacterInfoPage
 {
 public:
     ExtendedCharacterInfoPage();
-    const ExtendedCharacterInfo& GetExtendedCharacterInfo(int index) const;
+    explicit ExtendedCharacterInfoPage(bool packed_);
+    const ExtendedCharacterInfo& GetExtendedCharacterInfo(int index) const
+    {
+        return extendedCharacterInfos[infoIndices[index]];
+    }
     ExtendedCharacterInfo& GetExtendedCharacterInfo(int index);
+    std::unique_ptr<ExtendedCharacterInfoPage> MakePacked() const;
+    bool Equals(const ExtendedCharacterInfoPage& that) const;
     void Write(BinaryWriter& writer);
     void Read(BinaryReader& reader);
+    void WritePacked(BinaryWriter& writer);
+    void ReadPacked(BinaryReader& reader);
 private:
+    bool packed;
     std::vector<ExtendedCharacterInfo> extendedCharacterInfos;
+    std::vector<uint16_t> infoIndices;
 };
 
 class ExtendedCharacterInfoHeader
@@ -925,6 +986,7 @@ public:
     void AllocatePages(int numExtendedPages);
     void Write(BinaryWriter& writer);
     void Read(BinaryReader& reader);
+    int NumPages() const { return static_cast<int>(extendedPageStarts.size()); }
     uint32_t GetPageStart(int pageIndex) const;
     void SetPageStart(int pageIndex, uint32_t extendedPageStart);
 private:
@@ -932,7 +994,14 @@ private:
 };
 
 const uint8_t soul_ucd_version_1 = '1';
-const uint8_t current_soul_ucd_version = soul_ucd_version_1;
+const uint8_t soul_ucd_version_2 = '2';
+const uint8_t current_soul_ucd_version = soul_ucd_version_2;
+
+//  CharacterTable maps soul_ucd.bin once and decodes pages on first use.
+//  Loaded pages are published through atomic pointers, so lookups of warm pages do not take a lock
+//  and the table can be shared by parsers running in several threads.
+//  Version 2 files store identical pages once, and pages that are stored once are also loaded once and shared.
+//  Version 1 files can still be read. Write always writes the current version.
 
 class CharacterTable
 {
@@ -940,7 +1009,21 @@ public:
     static void Init();
     static void Done();
     static CharacterTable& Instance() { return *instance; }
-    const CharacterInfo& GetCharacterInfo(char32_t codePoint);
+    ~CharacterTable();
+    CharacterInfo GetCharacterInfo(char32_t codePoint)
+    {
+        if (codePoint > 0x10FFFF)
+        {
+            ThrowInvalidCodePoint(codePoint);
+        }
+        int pageIndex = codePoint / numInfosInPage;
+        const CharacterInfoPage* page = pages[pageIndex].load(std::memory_order_acquire);
+        if (!page)
+        {
+            page = LoadPage(pageIndex);
+        }
+        return page->GetCharacterInfo(codePoint);
+    }
     CharacterInfo& CreateCharacterInfo(char32_t codePoint);
     const ExtendedCharacterInfo& GetExtendedCharacterInfo(char32_t codePoint);
     ExtendedCharacterInfo& CreateExtendedCharacterInfo(char32_t codePoint);
@@ -948,26 +1031,46 @@ public:
 private:
     static std::unique_ptr<CharacterTable> instance;
     CharacterTable();
+    std::mutex loadMutex;
+    std::unique_ptr<BinaryReader> ucdReader;
     bool headerRead;
-    std::vector<std::unique_ptr<CharacterInfoPage>> pages;
+    uint8_t version;
+    std::atomic<CharacterInfoPage*> pages[numCharacterInfoPages];
+    std::vector<std::unique_ptr<CharacterInfoPage>> ownedPages;
+    bool pageDirectoryRead;
+    std::vector<uint32_t> pageStarts;
+    std::unordered_map<uint32_t, CharacterInfoPage*> pageStartMap;
     uint32_t extendedHeaderStart;
     uint32_t extendedHeaderEnd;
     bool extendedHeaderRead;
     ExtendedCharacterInfoHeader extendedHeader;
-    std::vector<std::unique_ptr<ExtendedCharacterInfoPage>> extendedPages;
+    std::atomic<ExtendedCharacterInfoPage*> extendedPages[numCharacterInfoPages];
+    std::vector<std::unique_ptr<ExtendedCharacterInfoPage>> ownedExtendedPages;
+    std::unordered_map<uint32_t, ExtendedCharacterInfoPage*> extendedPageStartMap;
     void WriteHeader(BinaryWriter& writer);
     void ReadHeader(BinaryReader& reader);
     void ReadExtendedHeader(BinaryReader& reader);
+    void ReadPageDirectory(BinaryReader& reader);
+    BinaryReader& GetReader();
+    const CharacterInfoPage* LoadPage(int pageIndex);
+    const ExtendedCharacterInfoPage* LoadExtendedPage(int pageIndex);
+    void ThrowInvalidCodePoint(char32_t codePoint);
     const size_t headerSize = 16;
 };
 
-inline const CharacterInfo& GetCharacterInfo(char32_t codePoint) { return CharacterTable::Instance().GetCharacterInfo(codePoint); }
+inline CharacterInfo GetCharacterInfo(char32_t codePoint) { return CharacterTable::Instance().GetCharacterInfo(codePoint); }
 inline CharacterInfo& CreateCharacterInfo(char32_t codePoint) { return CharacterTable::Instance().CreateCharacterInfo(codePoint); }
 inline const ExtendedCharacterInfo& GetExtendedCharacterInfo(char32_t codePoint) { return CharacterTable::Instance().GetExtendedCharacterInfo(codePoint); }
 inline ExtendedCharacterInfo& CreateExtendedCharacterInfo(char32_t codePoint) { return CharacterTable::Instance().CreateExtendedCharacterInfo(codePoint); }
 
-inline GeneralCategoryId GetGeneralCategory(char32_t c) { return GetCharacterInfo(c).GetGeneralCategory(); }
-inline bool HasGeneralCategory(char32_t c, GeneralCategoryId generalCategory) { return GetCharacterInfo(c).HasGeneralCategory(generalCategory);  }
+//  General category and binary property checks below use the compiled property table, see UnicodeTables.hpp.
+
+inline GeneralCategoryId GetGeneralCategory(char32_t c)
+{
+    return GeneralCategoryId((uint32_t(1) << (GetPropertyTableEntry(c) & propertyTableGeneralCategoryMask)) >> 1);
+}
+
+inline bool HasGeneralCategory(char32_t c, GeneralCategoryId generalCategory) { return (GetGeneralCategory(c) & generalCategory) != GeneralCategoryId::none; }
 
 inline bool IsUpperLetter(char32_t c)
 {
@@ -1216,39 +1319,39 @@ inline const std::u32string& FullFolding(char32_t c)
 
 inline bool IsWhiteSpace(char32_t c)
 {
-    return GetCharacterInfo(c).GetBinaryProperty(BinaryPropertyId::whiteSpace);
+    return HasTableProperty(c, TableProperty::whiteSpace);
 }
 
 inline bool IsAlphabetic(char32_t c)
 {
-    return GetCharacterInfo(c).GetBinaryProperty(BinaryPropertyId::alphabetic);
+    return HasTableProperty(c, TableProperty::alphabetic);
 }
 
 inline bool IsAsciiHexDigit(char32_t c)
 {
-    return GetCharacterInfo(c).GetBinaryProperty(BinaryPropertyId::asciiHexDigit);
+    return HasTableProperty(c, TableProperty::asciiHexDigit);
 }
 
 bool IsAsciiDigit(char32_t c);
 
 inline bool IsUppercase(char32_t c)
 {
-    GetCharacterInfo(c).GetBinaryProperty(BinaryPropertyId::uppercase);
+    return HasTableProperty(c, TableProperty::uppercase);
 }
 
 inline bool IsLowercase(char32_t c)
 {
-    return GetCharacterInfo(c).GetBinaryProperty(BinaryPropertyId::lowercase);
+    return HasTableProperty(c, TableProperty::lowercase);
 }
 
 inline bool IsIdStart(char32_t c)
 {
-    return GetCharacterInfo(c).GetBinaryProperty(BinaryPropertyId::idStart); 
+    return HasTableProperty(c, TableProperty::idStart);
 }
 
 inline bool IsIdCont(char32_t c)
 {
-    return GetCharacterInfo(c).GetBinaryProperty(BinaryPropertyId::idContinue);
+    return HasTableProperty(c, TableProperty::idContinue);
 }
 
 inline bool IsGraphemeBase(char32_t c)
@@ -0,0 +1,2471 @@
+// this file has been generated by MakeUcdBin from ucd.all.flat.xml
+
+#include <soul_u32/util/UnicodeTables.hpp>
+
+namespace soul { namespace unicode {
+
+constexpr uint16_t propertyTableStage1[8704] =
+{
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f,
+    0x0020, 0x0021, 0x0022, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0022, 0x0022, 0x0022, 0x0028, 0x0029, 0x002a, 0x002b,
+    0x002c, 0x002d, 0x002e, 0x002f, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003a, 0x003b,
+    0x003c, 0x003d, 0x003e, 0x003f, 0x0040, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0045, 0x0048, 0x0049,
+    0x0045, 0x0045, 0x0040, 0x004a, 0x0040, 0x0040, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x0045, 0x0053,
+    0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x0045, 0x0045, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005b, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005c, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x005d, 0x0022, 0x0022, 0x005e, 0x005f, 0x0060, 0x0061,
+    0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x006a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x0022, 0x0022, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0022, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075,
+    0x0076, 0x0077, 0x0078, 0x0079, 0x005a, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x007f, 0x0080, 0x0022, 0x0022, 0x0081, 0x0082,
+    0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x005a, 0x008e, 0x008f, 0x0090, 0x0091,
+    0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x005a, 0x0099, 0x009a, 0x005a, 0x009b, 0x009c, 0x009d, 0x009e, 0x005a,
+    0x009f, 0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x00a4, 0x005a, 0x005a, 0x00a5, 0x00a6, 0x00a7, 0x00a8, 0x005a, 0x00a9, 0x005a, 0x00aa,
+    0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x00ab, 0x00ac, 0x0022, 0x00ad, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x00ae,
+    0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x00af, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x0022, 0x0022, 0x0022, 0x0022, 0x00b0, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x0022, 0x0022, 0x0022, 0x0022, 0x00b1, 0x00b2, 0x00b3, 0x00b4, 0x005a, 0x005a, 0x005a, 0x005a, 0x00b5, 0x00b6, 0x00b7, 0x00b8,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x00b9, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x00ba,
+    0x0022, 0x0022, 0x00bb, 0x0022, 0x0022, 0x00bc, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x00bd, 0x00be, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x00bf, 0x00c0,
+    0x0045, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x005a, 0x00c7, 0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce,
+    0x0045, 0x0045, 0x0045, 0x0045, 0x00cf, 0x00d0, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x00d1, 0x005a,
+    0x00d2, 0x005a, 0x00d3, 0x005a, 0x005a, 0x00d4, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x00d5,
+    0x0022, 0x00d6, 0x00d7, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x00d8, 0x00d9, 0x00da, 0x005a, 0x00db, 0x00dc, 0x005a, 0x005a,
+    0x00dd, 0x00de, 0x00df, 0x00e0, 0x00e1, 0x005a, 0x0045, 0x00e2, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x00e3, 0x00e4, 0x00e5,
+    0x00e6, 0x00e7, 0x0045, 0x0045, 0x00e8, 0x00e9, 0x0045, 0x00ea, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x0022, 0x0022, 0x0022, 0x0022, 0x00eb, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x00ec, 0x005a, 0x00ed, 0x00ee, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+    0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a
+};
+
+constexpr uint16_t propertyTableStage2[30592] =
+{
+    0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x003a, 0x003a, 0x003a, 0x003a, 0x003a, 0x001a, 0x001a,
+    0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a,
+    0x0037, 0x0012, 0x0012, 0x0012, 0x0014, 0x0012, 0x0012, 0x0012, 0x000e, 0x000f, 0x0012, 0x8013, 0x0012, 0x000d, 0x0012, 0x0012,
+    0x1589, 0x1589, 0x1589, 0x1589, 0x1589, 0x1589, 0x1589, 0x1589, 0x1589, 0x1589, 0x0012, 0x0012, 0x8013, 0x8013, 0x8013, 0x0012,
+    0x0012, 0x5fc1, 0x5fc1, 0x5fc1, 0x5fc1, 0x5fc1, 0x5fc1, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x000e, 0x0012, 0x000f, 0x8015, 0x140c,
+    0x0015, 0x3fc2, 0x3fc2, 0x3fc2, 0x3fc2, 0x3fc2, 0x3fc2, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x000e, 0x8013, 0x000f, 0x8013, 0x001a,
+    0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x003a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a,
+    0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a,
+    0x0037, 0x0012, 0x0014, 0x0014, 0x0014, 0x0014, 0x0016, 0x0012, 0x0015, 0x0016, 0x3e45, 0x0010, 0x8013, 0x001b, 0x0016, 0x0015,
+    0x0016, 0x8013, 0x000b, 0x000b, 0x0015, 0x3e42, 0x0012, 0x1412, 0x0015, 0x000b, 0x3e45, 0x0011, 0x000b, 0x000b, 0x000b, 0x0012,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x8013, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x8013, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41,
+    0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x3e42,
+    0x3e42, 0x5e41, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x5e41, 0x3e42, 0x5e41, 0x5e41, 0x5e41, 0x3e42, 0x3e42, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x3e42, 0x5e41, 0x5e41, 0x3e42, 0x5e41, 0x5e41, 0x5e41, 0x3e42, 0x3e42, 0x3e42, 0x5e41, 0x5e41, 0x3e42, 0x5e41,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x5e41,
+    0x3e42, 0x5e41, 0x5e41, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x5e41, 0x3e42, 0x3e42, 0x1e45, 0x5e41, 0x3e42, 0x3e42, 0x3e42,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x5e41, 0x1e43, 0x3e42, 0x5e41, 0x1e43, 0x3e42, 0x5e41, 0x1e43, 0x3e42, 0x5e41, 0x3e42, 0x5e41,
+    0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x3e42, 0x5e41, 0x1e43, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x5e41, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x5e41, 0x5e41, 0x3e42, 0x5e41, 0x5e41, 0x3e42,
+    0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x1e45, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44,
+    0x3e44, 0x3e44, 0x0015, 0x0015, 0x0015, 0x0015, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44,
+    0x1e44, 0x1e44, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015,
+    0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x1e44, 0x0015, 0x1e44, 0x0015,
+    0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x3446, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x1e44, 0x0015, 0x5e41, 0x3e42, 0x0000, 0x0000, 0x2644, 0x3e42, 0x3e42, 0x3e42, 0x0012, 0x5e41,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0015, 0x0015, 0x5e41, 0x1412, 0x5e41, 0x5e41, 0x5e41, 0x0000, 0x5e41, 0x0000, 0x5e41, 0x5e41,
+    0x3e42, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x0000, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x5e41,
+    0xbe42, 0xbe42, 0xde41, 0x5e41, 0x5e41, 0xbe42, 0x3e42, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0xbe42, 0xbe42, 0x3e42, 0x3e42, 0xde41, 0xbe42, 0x8013, 0x5e41, 0x3e42, 0x5e41, 0x5e41, 0x3e42, 0x3e42, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x0016, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x0008, 0x0008, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x0000, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x0000, 0x0000, 0x1e44, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x0012, 0x000d, 0x0000, 0x0000, 0x0016, 0x0016, 0x0014,
+    0x0000, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x000d, 0x1446,
+    0x0012, 0x1446, 0x1446, 0x0012, 0x1446, 0x1446, 0x0012, 0x1446, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x0012, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x8013, 0x8013, 0x8013, 0x0012, 0x0012, 0x0014, 0x0012, 0x0012, 0x0016, 0x0016,
+    0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x0012, 0x001b, 0x0012, 0x0012, 0x0012,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e44, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446,
+    0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1406, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0012, 0x0012, 0x0012, 0x0012, 0x1e45, 0x1e45,
+    0x1446, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0012, 0x1e45, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x001b, 0x0016, 0x1406,
+    0x1406, 0x1446, 0x1446, 0x1446, 0x1446, 0x1e44, 0x1e44, 0x1446, 0x1446, 0x0016, 0x1406, 0x1406, 0x1406, 0x1446, 0x1e45, 0x1e45,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1e45, 0x1e45, 0x1e45, 0x0016, 0x0016, 0x1e45,
+    0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0000, 0x001b,
+    0x1e45, 0x1446, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446,
+    0x1446, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1e44, 0x1e44, 0x0016, 0x0012, 0x0012, 0x0012, 0x1e44, 0x0000, 0x0000, 0x1406, 0x0014, 0x0014,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1446, 0x1446, 0x1406, 0x1406, 0x1e44, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446,
+    0x1446, 0x1446, 0x1446, 0x1446, 0x1e44, 0x1446, 0x1446, 0x1446, 0x1e44, 0x1446, 0x1446, 0x1446, 0x1446, 0x1406, 0x0000, 0x0000,
+    0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1406, 0x1406, 0x1406, 0x0000, 0x0000, 0x0012, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0015, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000,
+    0x001b, 0x001b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e44, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446,
+    0x1406, 0x1406, 0x001b, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446,
+    0x1446, 0x1446, 0x1446, 0x1447, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1446, 0x1447, 0x1406, 0x1e45, 0x1447, 0x1447,
+    0x1447, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1447, 0x1447, 0x1447, 0x1447, 0x1406, 0x1447, 0x1447,
+    0x1e45, 0x1406, 0x1406, 0x1406, 0x1406, 0x1446, 0x1446, 0x1446, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1446, 0x1446, 0x0012, 0x0012, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409,
+    0x0012, 0x1e44, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1446, 0x1447, 0x1447, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x1e45,
+    0x1e45, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x0000, 0x1e45, 0x0000, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x1406, 0x1e45, 0x1447, 0x1447,
+    0x1447, 0x1446, 0x1446, 0x1446, 0x1446, 0x0000, 0x0000, 0x1447, 0x1447, 0x0000, 0x0000, 0x1447, 0x1447, 0x1406, 0x1e45, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1447, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x0000, 0x1e45,
+    0x1e45, 0x1e45, 0x1446, 0x1446, 0x0000, 0x0000, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409,
+    0x1e45, 0x1e45, 0x0014, 0x0014, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x0016, 0x0014, 0x1e45, 0x0012, 0x1406, 0x0000,
+    0x0000, 0x1446, 0x1446, 0x1447, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e45,
+    0x1e45, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x0000, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x1406, 0x0000, 0x1447, 0x1447,
+    0x1447, 0x1446, 0x1446, 0x0000, 0x0000, 0x0000, 0x0000, 0x1446, 0x1446, 0x0000, 0x0000, 0x1446, 0x1446, 0x1406, 0x0000, 0x0000,
+    0x0000, 0x1446, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409,
+    0x1446, 0x1446, 0x1e45, 0x1e45, 0x1e45, 0x1446, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1446, 0x1446, 0x1447, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45,
+    0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x0000, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x1406, 0x1e45, 0x1447, 0x1447,
+    0x1447, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x0000, 0x1446, 0x1446, 0x1447, 0x0000, 0x1447, 0x1447, 0x1406, 0x0000, 0x0000,
+    0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1446, 0x1446, 0x0000, 0x0000, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409,
+    0x0012, 0x0014, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e45, 0x1446, 0x1446, 0x1446, 0x1406, 0x1406, 0x1406,
+    0x0000, 0x1446, 0x1447, 0x1447, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x1e45,
+    0x1e45, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x0000, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x1406, 0x1e45, 0x1447, 0x1446,
+    0x1447, 0x1446, 0x1446, 0x1446, 0x1446, 0x0000, 0x0000, 0x1447, 0x1447, 0x0000, 0x0000, 0x1447, 0x1447, 0x1406, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1406, 0x1446, 0x1447, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x0000, 0x1e45,
+    0x1e45, 0x1e45, 0x1446, 0x1446, 0x0000, 0x0000, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409,
+    0x0016, 0x1e45, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1446, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x1e45, 0x1e45,
+    0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x0000, 0x1e45, 0x1e45,
+    0x0000, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x1447, 0x1447,
+    0x1446, 0x1447, 0x1447, 0x0000, 0x0000, 0x0000, 0x1447, 0x1447, 0x1447, 0x0000, 0x1447, 0x1447, 0x1447, 0x1406, 0x0000, 0x0000,
+    0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1447, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409,
+    0x000b, 0x000b, 0x000b, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0014, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1446, 0x1447, 0x1447, 0x1447, 0x1406, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45,
+    0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x1406, 0x1e45, 0x1446, 0x1446,
+    0x1446, 0x1447, 0x1447, 0x1447, 0x1447, 0x0000, 0x1446, 0x1446, 0x1446, 0x0000, 0x1446, 0x1446, 0x1446, 0x1406, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1446, 0x1446, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x1e45, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1446, 0x1446, 0x0000, 0x0000, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0012, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x0016,
+    0x1e45, 0x1446, 0x1447, 0x1447, 0x0012, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45,
+    0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x1406, 0x1e45, 0x1447, 0x1446,
+    0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x0000, 0x1446, 0x1447, 0x1447, 0x0000, 0x1447, 0x1447, 0x1446, 0x1406, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1447, 0x1447, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x0000,
+    0x1e45, 0x1e45, 0x1446, 0x1446, 0x0000, 0x0000, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409,
+    0x0000, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1446, 0x1446, 0x1447, 0x1447, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45,
+    0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1406, 0x1406, 0x1e45, 0x1447, 0x1447,
+    0x1447, 0x1446, 0x1446, 0x1446, 0x1446, 0x0000, 0x1447, 0x1447, 0x1447, 0x0000, 0x1447, 0x1447, 0x1447, 0x1406, 0x1e45, 0x0016,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1447, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x1e45,
+    0x1e45, 0x1e45, 0x1446, 0x1446, 0x0000, 0x0000, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x0016, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x0000, 0x1446, 0x1447, 0x1447, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x1406, 0x0000, 0x0000, 0x0000, 0x0000, 0x1447,
+    0x1447, 0x1447, 0x1446, 0x1446, 0x1446, 0x0000, 0x1446, 0x0000, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409,
+    0x0000, 0x0000, 0x1447, 0x1447, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1446, 0x1e45, 0x1645, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x0000, 0x0000, 0x0000, 0x0000, 0x0014,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e44, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1446, 0x1406, 0x0012,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0012, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1446, 0x1e45, 0x1645, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1406, 0x1446, 0x1446, 0x1e45, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e44, 0x0000, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1446, 0x0000, 0x0000,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x0016, 0x0016, 0x0016, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+    0x0012, 0x0012, 0x0012, 0x0016, 0x0012, 0x0016, 0x0016, 0x0016, 0x1406, 0x1406, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x0016, 0x1406, 0x0016, 0x1406, 0x0016, 0x1406, 0x000e, 0x000f, 0x000e, 0x000f, 0x1407, 0x1407,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1447,
+    0x1446, 0x1446, 0x1406, 0x1406, 0x1406, 0x0012, 0x1406, 0x1406, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1446, 0x1446, 0x1446,
+    0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x0000, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446,
+    0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446,
+    0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x0000, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x1406, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0016, 0x0016,
+    0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0016, 0x0016, 0x0016, 0x0016, 0x0012, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1447, 0x1447, 0x1446, 0x1446, 0x1446,
+    0x1446, 0x1447, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1406, 0x1447, 0x1406, 0x1406, 0x1447, 0x1447, 0x1446, 0x1446, 0x1e45,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1447, 0x1447, 0x1446, 0x1446, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1446, 0x1446,
+    0x1446, 0x1e45, 0x1447, 0x1447, 0x1447, 0x1e45, 0x1e45, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1e45, 0x1e45,
+    0x1e45, 0x1446, 0x1446, 0x1446, 0x1446, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1446, 0x1447, 0x1447, 0x1446, 0x1446, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1446, 0x1e45, 0x1447,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1447, 0x1447, 0x1447, 0x1446, 0x0016, 0x0016,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x0000, 0x5e41, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5e41, 0x0000, 0x0000,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x0012, 0x1e44, 0x3e42, 0x3e42, 0x3e42,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000,
+    0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x1406, 0x1406, 0x1406,
+    0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x140b, 0x140b, 0x140b, 0x140b, 0x140b, 0x140b, 0x140b,
+    0x140b, 0x140b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x0000, 0x0000, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x0000, 0x0000,
+    0x000d, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0016, 0x0012, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x0037, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x000e, 0x000f, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0012, 0x0012, 0x0012, 0x1e4a, 0x1e4a,
+    0x1e4a, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1446, 0x1446, 0x1406, 0x1407, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1446, 0x1446, 0x1407, 0x0012, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1446, 0x1446, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45,
+    0x1e45, 0x0000, 0x1446, 0x1446, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1406, 0x1406, 0x1447, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1447, 0x1447,
+    0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1446, 0x1447, 0x1447, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x0012, 0x0012, 0x0012, 0x1e44, 0x0012, 0x0012, 0x0012, 0x0014, 0x1e45, 0x1406, 0x0000, 0x0000,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x000d, 0x0012, 0x0012, 0x0012, 0x0012, 0x1406, 0x1406, 0x1406, 0x001b, 0x1406,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e44, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e46, 0x1e46, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1446, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000,
+    0x1446, 0x1446, 0x1446, 0x1447, 0x1447, 0x1447, 0x1447, 0x1446, 0x1446, 0x1447, 0x1447, 0x1447, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1447, 0x1447, 0x1446, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1406, 0x1406, 0x1406, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0000, 0x0000, 0x0000, 0x0012, 0x0012, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x140b, 0x0000, 0x0000, 0x0000, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1446, 0x1446, 0x1447, 0x1447, 0x1446, 0x0000, 0x0000, 0x0012, 0x0012,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1447, 0x1446, 0x1447, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x0000,
+    0x1406, 0x1447, 0x1446, 0x1447, 0x1447, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1447, 0x1447, 0x1447,
+    0x1447, 0x1447, 0x1447, 0x1446, 0x1446, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x0000, 0x0000, 0x1406,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x1e44, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0000, 0x0000,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x0008, 0x1446,
+    0x1446, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1446, 0x1446, 0x1446, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1446, 0x1446, 0x1446, 0x1446, 0x1447, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1406, 0x1447, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1447, 0x1446, 0x1447, 0x1447, 0x1447,
+    0x1447, 0x1447, 0x1446, 0x1447, 0x1407, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+    0x0012, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0012, 0x0012, 0x0000,
+    0x1446, 0x1446, 0x1447, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1447, 0x1446, 0x1446, 0x1446, 0x1446, 0x1447, 0x1447, 0x1446, 0x1446, 0x1407, 0x1406, 0x1446, 0x1446, 0x1e45, 0x1e45,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1406, 0x1447, 0x1446, 0x1446, 0x1447, 0x1447, 0x1447, 0x1446, 0x1447, 0x1446,
+    0x1446, 0x1446, 0x1407, 0x1407, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0012, 0x0012, 0x0012, 0x0012,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1446, 0x1446, 0x1446, 0x1446,
+    0x1446, 0x1446, 0x1446, 0x1446, 0x1447, 0x1447, 0x1446, 0x1406, 0x0000, 0x0000, 0x0000, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0000, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x0012, 0x0012,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x0000, 0x0000, 0x5e41, 0x5e41, 0x5e41,
+    0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1406, 0x1406, 0x1406, 0x0012, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1407, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1406, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1406, 0x1e45, 0x1e45, 0x1407, 0x1406, 0x1406, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e44, 0x3e44, 0x3e44, 0x3e44,
+    0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44,
+    0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44,
+    0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44,
+    0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e44, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44,
+    0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44,
+    0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446,
+    0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x0000, 0x0000, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x0000, 0x0000,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x0000, 0x0000, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x0000, 0x0000,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x0000, 0x5e41, 0x0000, 0x5e41, 0x0000, 0x5e41, 0x0000, 0x5e41,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x0000, 0x0000,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x1e43, 0x1e43, 0x1e43, 0x1e43, 0x1e43, 0x1e43, 0x1e43, 0x1e43,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x1e43, 0x1e43, 0x1e43, 0x1e43, 0x1e43, 0x1e43, 0x1e43, 0x1e43,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x1e43, 0x1e43, 0x1e43, 0x1e43, 0x1e43, 0x1e43, 0x1e43, 0x1e43,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x0000, 0x3e42, 0x3e42, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x1e43, 0x0015, 0x3e42, 0x0015,
+    0x0015, 0x0015, 0x3e42, 0x3e42, 0x3e42, 0x0000, 0x3e42, 0x3e42, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x1e43, 0x0015, 0x0015, 0x0015,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x0000, 0x0000, 0x3e42, 0x3e42, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x0000, 0x0015, 0x0015, 0x0015,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x0015, 0x0015, 0x0015,
+    0x0000, 0x0000, 0x3e42, 0x3e42, 0x3e42, 0x0000, 0x3e42, 0x3e42, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x1e43, 0x0015, 0x0015, 0x0000,
+    0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b,
+    0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x8012, 0x0012, 0x0010, 0x0011, 0x000e, 0x0010, 0x0010, 0x0011, 0x000e, 0x0010,
+    0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0038, 0x0039, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x0037,
+    0x0012, 0x0012, 0x8012, 0x8012, 0x8012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0010, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x140c,
+    0x940c, 0x0012, 0x0012, 0x0012, 0x8013, 0x000e, 0x000f, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+    0x0012, 0x0012, 0x8013, 0x0012, 0x140c, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0037,
+    0x001b, 0x801b, 0x801b, 0x801b, 0x801b, 0x0000, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b,
+    0x000b, 0x3e44, 0x0000, 0x0000, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x8013, 0x8013, 0x8013, 0x800e, 0x800f, 0x3e44,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x8013, 0x8013, 0x8013, 0x800e, 0x800f, 0x0000,
+    0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x0000, 0x0000, 0x0000,
+    0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014,
+    0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014,
+    0x0014, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x9406, 0x9406, 0x9406, 0x9406, 0x9406, 0x9406, 0x9406, 0x9406, 0x9406, 0x9406, 0x9406, 0x9406, 0x9406, 0x0008, 0x0008, 0x0008,
+    0x0008, 0x9406, 0x0008, 0x0008, 0x0008, 0x9406, 0x9406, 0x1406, 0x1406, 0x1406, 0x1406, 0x9406, 0x9406, 0x9406, 0x9406, 0x9406,
+    0x1406, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0xde41, 0x0016, 0x0016, 0x0016, 0x0016, 0xde41, 0x0016, 0x0016, 0xbe42, 0xde41, 0xde41, 0xde41, 0xbe42, 0xbe42,
+    0xde41, 0xde41, 0xde41, 0xbe42, 0x0016, 0xde41, 0x0016, 0x0016, 0x9e13, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0xde41, 0x0016, 0x5e41, 0x0016, 0xde41, 0x8016, 0x5e41, 0x5e41, 0xde41, 0xde41, 0x1e16, 0xbe42,
+    0xde41, 0xde41, 0x5e41, 0xde41, 0xbe42, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x3e42, 0x0016, 0x0016, 0xbe42, 0xbe42, 0xde41, 0xde41,
+    0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0xde41, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0x0016, 0x8013, 0x0016, 0x0016, 0x3e42, 0x0016,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x5e4a, 0x5e4a, 0x5e4a, 0x5e4a, 0x5e4a, 0x5e4a, 0x5e4a, 0x5e4a, 0x5e4a, 0x5e4a, 0x5e4a, 0x5e4a, 0x5e4a, 0x5e4a, 0x5e4a, 0x5e4a,
+    0x3e4a, 0x3e4a, 0x3e4a, 0x3e4a, 0x3e4a, 0x3e4a, 0x3e4a, 0x3e4a, 0x3e4a, 0x3e4a, 0x3e4a, 0x3e4a, 0x3e4a, 0x3e4a, 0x3e4a, 0x3e4a,
+    0x1e4a, 0x1e4a, 0x1e4a, 0x5e41, 0x3e42, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x000b, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8016, 0x8016, 0x8016, 0x8016, 0x8016, 0x8013, 0x8013, 0x8016, 0x8016, 0x8016, 0x8016,
+    0x8013, 0x8016, 0x8016, 0x8013, 0x8016, 0x8016, 0x8013, 0x8016, 0x0016, 0x8016, 0x8016, 0x8016, 0x8016, 0x8016, 0x8013, 0x0016,
+    0x8016, 0x8016, 0x0016, 0x0016, 0x0016, 0x0016, 0x8016, 0x8016, 0x0016, 0x0016, 0x0016, 0x0016, 0x8016, 0x8016, 0x8016, 0x8016,
+    0x8016, 0x8016, 0x8016, 0x8016, 0x8016, 0x8016, 0x8016, 0x8016, 0x8016, 0x8016, 0x8016, 0x8016, 0x8016, 0x8016, 0x8013, 0x8013,
+    0x8016, 0x8016, 0x8013, 0x8016, 0x8013, 0x8016, 0x8016, 0x8016, 0x8016, 0x8016, 0x8016, 0x8016, 0x0016, 0x8016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x8016, 0x8016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013,
+    0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013,
+    0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013,
+    0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013,
+    0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013,
+    0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013,
+    0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013,
+    0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013,
+    0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x800e, 0x800f, 0x800e, 0x800f, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x8013, 0x8013, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x000e, 0x000f, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x8013, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013,
+    0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013,
+    0x8013, 0x8013, 0x8013, 0x8013, 0x8016, 0x8016, 0x0016, 0x8016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x8016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x8013, 0x8013, 0x8013, 0x8013,
+    0x8013, 0x8013, 0x8016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056,
+    0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056,
+    0x2056, 0x2056, 0x2056, 0x2056, 0x2056, 0x2056, 0x2056, 0x2056, 0x2056, 0x2056, 0x2056, 0x2056, 0x2056, 0x2056, 0x2056, 0x2056,
+    0x2056, 0x2056, 0x2056, 0x2056, 0x2056, 0x2056, 0x2056, 0x2056, 0x2056, 0x2056, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x8016, 0x8016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x8016, 0x8016,
+    0x8016, 0x8016, 0x8016, 0x8016, 0x8016, 0x8016, 0x8016, 0x8013, 0x0016, 0x0016, 0x0016, 0x0016, 0x8016, 0x8016, 0x8016, 0x8016,
+    0x8016, 0x8013, 0x0016, 0x0016, 0x0016, 0x0016, 0x8016, 0x8016, 0x0016, 0x0016, 0x8016, 0x8016, 0x0016, 0x0016, 0x0016, 0x8016,
+    0x8016, 0x8016, 0x8016, 0x8016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x8016, 0x0016, 0x8016, 0x0016, 0x0016, 0x8016, 0x8016, 0x8016, 0x8016, 0x8016, 0x8016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x8016, 0x8016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x8016, 0x0016, 0x8016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x8016, 0x8016, 0x8016, 0x8016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x8016, 0x8016, 0x8013,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x000e, 0x000f, 0x000e, 0x000f, 0x000e, 0x000f, 0x000e, 0x000f,
+    0x000e, 0x000f, 0x000e, 0x000f, 0x000e, 0x000f, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x800e, 0x800f, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013,
+    0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013,
+    0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x800e, 0x800f, 0x800e, 0x800f, 0x800e, 0x800f, 0x800e, 0x800f, 0x800e, 0x800f,
+    0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013,
+    0x8013, 0x8013, 0x8013, 0x800e, 0x800f, 0x800e, 0x800f, 0x800e, 0x800f, 0x800e, 0x800f, 0x800e, 0x800f, 0x800e, 0x800f, 0x800e,
+    0x800f, 0x800e, 0x800f, 0x800e, 0x800f, 0x800e, 0x800f, 0x800e, 0x800f, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013,
+    0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013,
+    0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013,
+    0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013,
+    0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x800e, 0x800f, 0x800e, 0x800f, 0x8013, 0x8013, 0x8013, 0x8013,
+    0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013,
+    0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x800e, 0x800f, 0x8013, 0x8013,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013,
+    0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x0016, 0x0016, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x5e41, 0x5e41, 0x3e42, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x3e42, 0x5e41, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e44, 0x3e44, 0x5e41, 0x5e41,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x3e42, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x1406,
+    0x1406, 0x1406, 0x5e41, 0x3e42, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0012, 0x0012, 0x0012, 0x0012, 0x000b, 0x0012, 0x0012,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x0000, 0x3e42, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e42, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e44,
+    0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1406,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000,
+    0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446,
+    0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446,
+    0x0012, 0x0012, 0x0010, 0x0011, 0x0010, 0x0011, 0x0012, 0x0012, 0x0012, 0x0010, 0x0011, 0x0012, 0x0010, 0x0011, 0x0012, 0x0012,
+    0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x000d, 0x0012, 0x0012, 0x000d, 0x0012, 0x0010, 0x0011, 0x0012, 0x0012,
+    0x0010, 0x0011, 0x000e, 0x000f, 0x000e, 0x000f, 0x000e, 0x000f, 0x000e, 0x000f, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0044,
+    0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x000d, 0x000d, 0x0012, 0x0012, 0x0012, 0x0012,
+    0x000d, 0x0012, 0x000e, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+    0x0016, 0x0016, 0x0012, 0x0012, 0x0012, 0x000e, 0x000f, 0x000e, 0x000f, 0x000e, 0x000f, 0x000e, 0x000f, 0x000d, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0037, 0x0012, 0x0012, 0x0012, 0x0016, 0x1e44, 0x1e45, 0x1e4a, 0x000e, 0x000f, 0x000e, 0x000f, 0x000e, 0x000f, 0x000e, 0x000f,
+    0x000e, 0x000f, 0x0016, 0x0016, 0x000e, 0x000f, 0x000e, 0x000f, 0x000e, 0x000f, 0x000e, 0x000f, 0x000d, 0x000e, 0x000f, 0x000f,
+    0x0016, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1406, 0x1406, 0x1406, 0x1406, 0x1407, 0x1407,
+    0x000d, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x0016, 0x0016, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e44, 0x1e45, 0x0012, 0x0016, 0x0016,
+    0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x1406, 0x1406, 0x0615, 0x0615, 0x1e44, 0x1e44, 0x1e45,
+    0x000d, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0012, 0x1e44, 0x1e44, 0x1e44, 0x1e45,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000,
+    0x0016, 0x0016, 0x000b, 0x000b, 0x000b, 0x000b, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x0016, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e44, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x0012, 0x0012,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e44, 0x0012, 0x0012, 0x0012,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x1e45, 0x1406,
+    0x0008, 0x0008, 0x0008, 0x0012, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1406, 0x1406, 0x0012, 0x1e44,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x3e44, 0x3e44, 0x1446, 0x1446,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a,
+    0x1406, 0x1406, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015,
+    0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44,
+    0x0015, 0x0015, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x3e42, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x3e44, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x1e44, 0x0015, 0x0015, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x1e45,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x3e42, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x3e42,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42,
+    0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5e41, 0x3e42, 0x0000, 0x3e42, 0x0000, 0x3e42, 0x5e41, 0x3e42, 0x5e41, 0x3e42, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1e44, 0x1e44, 0x1e44, 0x5e41, 0x3e42, 0x1e45, 0x3e44, 0x3e44, 0x3e42, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1446, 0x1e45, 0x1e45, 0x1e45, 0x1406, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1446, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1447, 0x1447, 0x1446, 0x1446, 0x1447, 0x0016, 0x0016, 0x0016, 0x0016, 0x1406, 0x0000, 0x0000, 0x0000,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x0016, 0x0016, 0x0014, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0012, 0x0012, 0x0012, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1447, 0x1447, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447,
+    0x1447, 0x1447, 0x1447, 0x1447, 0x1406, 0x1446, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0012, 0x0012,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0012, 0x0012, 0x0012, 0x1e45, 0x0012, 0x1e45, 0x1e45, 0x1446,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1406, 0x1406, 0x1406, 0x0012, 0x0012,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446,
+    0x1446, 0x1446, 0x1447, 0x1407, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0012,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000,
+    0x1446, 0x1446, 0x1446, 0x1447, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1406, 0x1447, 0x1447, 0x1446, 0x1446, 0x1446, 0x1446, 0x1447, 0x1447, 0x1446, 0x1446, 0x1447, 0x1447,
+    0x1407, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0000, 0x1e44,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0000, 0x0000, 0x0000, 0x0000, 0x0012, 0x0012,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1446, 0x1e44, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1447,
+    0x1447, 0x1446, 0x1446, 0x1447, 0x1447, 0x1446, 0x1446, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1446, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1446, 0x1447, 0x0000, 0x0000,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0000, 0x0000, 0x0012, 0x0012, 0x0012, 0x0012,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e44, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0016, 0x0016, 0x0016, 0x1e45, 0x1447, 0x1446, 0x1447, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1446, 0x1e45, 0x1446, 0x1446, 0x1446, 0x1e45, 0x1e45, 0x1446, 0x1446, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1446, 0x1406,
+    0x1e45, 0x1406, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e44, 0x0012, 0x0012,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1447, 0x1446, 0x1446, 0x1447, 0x1447,
+    0x0012, 0x0012, 0x1e45, 0x1e44, 0x1e44, 0x1447, 0x1406, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000,
+    0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x0015, 0x3e44, 0x3e44, 0x3e44, 0x3e44,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x1e44, 0x0015, 0x0015, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1447, 0x1447, 0x1446, 0x1447, 0x1447, 0x1446, 0x1447, 0x1447, 0x0012, 0x1407, 0x1406, 0x0000, 0x0000,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e45, 0x1446, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x8013, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x0000,
+    0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015,
+    0x0015, 0x0015, 0x0015, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0645, 0x0645,
+    0x0645, 0x0645, 0x0645, 0x0645, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x000f, 0x000e,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0016,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0645, 0x0645, 0x0014, 0x0016, 0x0016, 0x0016,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x000e, 0x000f, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x0012, 0x000d, 0x000d, 0x140c, 0x140c, 0x000e, 0x000f, 0x000e, 0x000f, 0x000e, 0x000f, 0x000e, 0x000f, 0x000e, 0x000f, 0x000e,
+    0x000f, 0x000e, 0x000f, 0x000e, 0x000f, 0x0012, 0x0012, 0x000e, 0x000f, 0x0012, 0x0012, 0x0012, 0x0012, 0x140c, 0x140c, 0x140c,
+    0x0012, 0x0012, 0x0012, 0x0000, 0x0012, 0x0012, 0x0012, 0x0012, 0x000d, 0x000e, 0x000f, 0x000e, 0x000f, 0x000e, 0x000f, 0x0012,
+    0x0012, 0x8012, 0x8013, 0x800d, 0x8013, 0x8013, 0x8013, 0x0000, 0x8012, 0x0014, 0x0012, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0645, 0x1e45, 0x0645, 0x1e45, 0x0645, 0x0000, 0x0645, 0x1e45, 0x0645, 0x1e45, 0x0645, 0x1e45, 0x0645, 0x1e45, 0x0645, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x001b,
+    0x0000, 0x0012, 0x0012, 0x0012, 0x0014, 0x0012, 0x0012, 0x0012, 0x000e, 0x000f, 0x0012, 0x8013, 0x0012, 0x000d, 0x0012, 0x0012,
+    0x1509, 0x1509, 0x1509, 0x1509, 0x1509, 0x1509, 0x1509, 0x1509, 0x1509, 0x1509, 0x0012, 0x0012, 0x8013, 0x8013, 0x8013, 0x0012,
+    0x0012, 0x5f41, 0x5f41, 0x5f41, 0x5f41, 0x5f41, 0x5f41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x000e, 0x8012, 0x000f, 0x8015, 0x140c,
+    0x0015, 0x3f42, 0x3f42, 0x3f42, 0x3f42, 0x3f42, 0x3f42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x000e, 0x8013, 0x000f, 0x8013, 0x000e,
+    0x000f, 0x0012, 0x000e, 0x000f, 0x0012, 0x0012, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e44, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1644, 0x1644,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000,
+    0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000,
+    0x0014, 0x0014, 0x8013, 0x0015, 0x0016, 0x0014, 0x0014, 0x0000, 0x0016, 0x8013, 0x8013, 0x8013, 0x8013, 0x0016, 0x0016, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001b, 0x001b, 0x001b, 0x0016, 0x0016, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x0000, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0012, 0x0012, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x0000, 0x0000, 0x0000, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a,
+    0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a,
+    0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a,
+    0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x000b, 0x000b, 0x000b, 0x000b, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x000b, 0x000b, 0x0016, 0x0016, 0x0016, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x1406, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1406, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e4a, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e4a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0012,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x0012, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0012,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x0000, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x0000, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x0000, 0x5e41, 0x5e41, 0x0000, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x0000, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x0000, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x0000, 0x3e42, 0x3e42, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x3e44, 0x1e44, 0x1e44, 0x3e44, 0x3e44, 0x3e44, 0x0000, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44,
+    0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44,
+    0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44,
+    0x3e44, 0x0000, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x3e44, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x1e45, 0x0000, 0x0000, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0012, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0016, 0x0016, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x0000, 0x0000, 0x0000, 0x0012,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0012,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x000b, 0x000b, 0x1e45, 0x1e45,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x0000, 0x0000, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x1e45, 0x1446, 0x1446, 0x1446, 0x0000, 0x1446, 0x1446, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1446, 0x1446, 0x1446, 0x1446,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x1406, 0x1406, 0x1406, 0x0000, 0x0000, 0x0000, 0x0000, 0x1406,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x000b, 0x000b, 0x0012,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x000b, 0x000b, 0x000b,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0016, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1406, 0x1406, 0x0000, 0x0000, 0x0000, 0x0000, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0012, 0x0012, 0x0012, 0x0012, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1446, 0x1446, 0x1446, 0x1446, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1446, 0x1446, 0x000d, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x000b, 0x000b, 0x000b,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x000b, 0x000b, 0x000b, 0x000b, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1406, 0x1406, 0x1406, 0x1406, 0x0012, 0x0012, 0x0012, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1447, 0x1446, 0x1447, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446,
+    0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1406, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409,
+    0x1406, 0x1e45, 0x1e45, 0x1446, 0x1446, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1406,
+    0x1406, 0x1406, 0x1447, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1447, 0x1447, 0x1447, 0x1446, 0x1446, 0x1446, 0x1446, 0x1447, 0x1447, 0x1406, 0x1406, 0x0012, 0x0012, 0x001b, 0x0012, 0x0012,
+    0x0012, 0x0012, 0x1446, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001b, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1446, 0x1446, 0x1446, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1447, 0x1446, 0x1446, 0x1446,
+    0x1446, 0x1446, 0x1446, 0x1406, 0x1406, 0x0000, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409,
+    0x0012, 0x0012, 0x0012, 0x0012, 0x1e45, 0x1447, 0x1447, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1406, 0x0012, 0x0012, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1446, 0x1446, 0x1447, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1447, 0x1447, 0x1447, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1447,
+    0x1407, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0012, 0x0012, 0x0012, 0x0012, 0x1406, 0x1406, 0x1406, 0x1406, 0x0012, 0x1447, 0x1446,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1e45, 0x0012, 0x1e45, 0x0012, 0x0012, 0x0012,
+    0x0000, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1447, 0x1447, 0x1447, 0x1446,
+    0x1446, 0x1446, 0x1447, 0x1447, 0x1446, 0x1407, 0x1406, 0x1446, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x1446, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1446,
+    0x1447, 0x1447, 0x1447, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1406, 0x1406, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1446, 0x1446, 0x1447, 0x1447, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x1e45,
+    0x1e45, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x0000, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1406, 0x1406, 0x1e45, 0x1447, 0x1447,
+    0x1446, 0x1447, 0x1447, 0x1447, 0x1447, 0x0000, 0x0000, 0x1447, 0x1447, 0x0000, 0x0000, 0x1447, 0x1447, 0x1407, 0x0000, 0x0000,
+    0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1447, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1447, 0x1447, 0x0000, 0x0000, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x0000, 0x0000, 0x0000,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1447, 0x1447, 0x1447, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446,
+    0x1447, 0x1447, 0x1406, 0x1446, 0x1446, 0x1447, 0x1406, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0012, 0x0012, 0x0000, 0x0012, 0x1406, 0x1e45,
+    0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1447, 0x1447, 0x1447, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1447, 0x1446, 0x1447, 0x1447, 0x1447, 0x1447, 0x1446,
+    0x1446, 0x1447, 0x1406, 0x1406, 0x1e45, 0x1e45, 0x0012, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1447,
+    0x1447, 0x1447, 0x1446, 0x1446, 0x1446, 0x1446, 0x0000, 0x0000, 0x1447, 0x1447, 0x1447, 0x1447, 0x1446, 0x1446, 0x1447, 0x1406,
+    0x1406, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+    0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1446, 0x1446, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1447, 0x1447, 0x1447, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1447, 0x1447, 0x1446, 0x1447, 0x1406,
+    0x1446, 0x0012, 0x0012, 0x0012, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1446, 0x1447, 0x1446, 0x1447, 0x1447,
+    0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1407, 0x1406, 0x1e45, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x1446, 0x1446, 0x1446,
+    0x1447, 0x1447, 0x1446, 0x1446, 0x1446, 0x1446, 0x1447, 0x1446, 0x1446, 0x1446, 0x1446, 0x1406, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x000b, 0x000b, 0x0012, 0x0012, 0x0012, 0x0016,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1447, 0x1447, 0x1447, 0x1446,
+    0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1447, 0x1406, 0x1406, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x000b, 0x000b, 0x000b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x1e45, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x0000, 0x1447, 0x1447, 0x0000, 0x0000, 0x1446, 0x1446, 0x1407, 0x1406, 0x1e45,
+    0x1447, 0x1e45, 0x1447, 0x1406, 0x0012, 0x0012, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1447, 0x1447, 0x1447, 0x1446, 0x1446, 0x1446, 0x1446, 0x0000, 0x0000, 0x1446, 0x1446, 0x1447, 0x1447, 0x1447, 0x1447,
+    0x1406, 0x1e45, 0x0012, 0x1e45, 0x1447, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1406, 0x1406, 0x1446, 0x1446, 0x1446, 0x1446, 0x1447, 0x1e45, 0x1446, 0x1446, 0x1446, 0x1446, 0x0012,
+    0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x1406, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1447, 0x1447, 0x1446, 0x1446, 0x1446, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446,
+    0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1447, 0x1406, 0x1406, 0x0012, 0x0012, 0x0012, 0x1e45, 0x0012, 0x0012,
+    0x0012, 0x0012, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1447,
+    0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x0000, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1447, 0x1406,
+    0x1e45, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x0000, 0x0000, 0x0000,
+    0x0012, 0x0012, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x0000, 0x0000, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446,
+    0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x0000, 0x1447, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446,
+    0x1446, 0x1447, 0x1446, 0x1446, 0x1447, 0x1446, 0x1446, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x0000, 0x0000, 0x0000, 0x1446, 0x0000, 0x1446, 0x1446, 0x0000, 0x1446,
+    0x1446, 0x1446, 0x1406, 0x1446, 0x1406, 0x1406, 0x1e45, 0x1446, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x0000,
+    0x1446, 0x1446, 0x0000, 0x1447, 0x1447, 0x1446, 0x1447, 0x1406, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1446, 0x1446, 0x1447, 0x1447, 0x0012, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0014, 0x0014, 0x0014,
+    0x0014, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0012,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a,
+    0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a,
+    0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a,
+    0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a,
+    0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a,
+    0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a,
+    0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x1e4a, 0x0000,
+    0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x0012, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000,
+    0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0000, 0x0000, 0x0000, 0x0000, 0x0012, 0x0012,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x0012, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0000, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x000b, 0x000b, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x0012, 0x0012, 0x0012, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x1446,
+    0x1e45, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447,
+    0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447,
+    0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447,
+    0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x1447, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1446,
+    0x1446, 0x1446, 0x1446, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e44, 0x1e44, 0x0012, 0x1e44, 0x1406, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1447, 0x1447, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x0000, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x0000, 0x1e44, 0x1e44, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0016, 0x1406, 0x1446, 0x0012,
+    0x001b, 0x001b, 0x001b, 0x001b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x0000, 0x0000,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x1407, 0x1407, 0x1406, 0x1406, 0x1406, 0x0016, 0x0016, 0x0016, 0x1407, 0x1407, 0x1407,
+    0x1407, 0x1407, 0x1407, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x0016, 0x0016, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x1406, 0x1406, 0x1406, 0x1406, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x1406, 0x1406, 0x1406, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41,
+    0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42,
+    0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42,
+    0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41,
+    0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xbe42, 0xbe42,
+    0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0x0000, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42,
+    0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41,
+    0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41,
+    0xde41, 0xde41, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42,
+    0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xde41, 0x0000, 0xde41, 0xde41,
+    0x0000, 0x0000, 0xde41, 0x0000, 0x0000, 0xde41, 0xde41, 0x0000, 0x0000, 0xde41, 0xde41, 0xde41, 0xde41, 0x0000, 0xde41, 0xde41,
+    0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0x0000, 0xbe42, 0x0000, 0xbe42, 0xbe42, 0xbe42,
+    0xbe42, 0xbe42, 0xbe42, 0xbe42, 0x0000, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42,
+    0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41,
+    0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42,
+    0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42,
+    0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xde41, 0xde41, 0x0000, 0xde41, 0xde41, 0xde41, 0xde41, 0x0000, 0x0000, 0xde41, 0xde41, 0xde41,
+    0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0x0000, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0x0000, 0xbe42, 0xbe42,
+    0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42,
+    0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xde41, 0xde41, 0x0000, 0xde41, 0xde41, 0xde41, 0xde41, 0x0000,
+    0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0x0000, 0xde41, 0x0000, 0x0000, 0x0000, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41,
+    0xde41, 0x0000, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42,
+    0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xde41, 0xde41, 0xde41, 0xde41,
+    0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41,
+    0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42,
+    0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42,
+    0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41,
+    0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42,
+    0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42,
+    0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41,
+    0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xbe42, 0xbe42,
+    0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42,
+    0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41,
+    0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41,
+    0xde41, 0xde41, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42,
+    0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xde41, 0xde41, 0xde41, 0xde41,
+    0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41,
+    0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42,
+    0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42,
+    0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41,
+    0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42,
+    0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42,
+    0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0x0000, 0x0000, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41,
+    0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41,
+    0xde41, 0x8013, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42,
+    0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0x8013, 0xbe42, 0xbe42, 0xbe42, 0xbe42,
+    0xbe42, 0xbe42, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41,
+    0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0x8013, 0xbe42, 0xbe42, 0xbe42, 0xbe42,
+    0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42,
+    0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0x8013, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xde41, 0xde41, 0xde41, 0xde41,
+    0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41,
+    0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0x8013, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42,
+    0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0x8013,
+    0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41,
+    0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0x8013,
+    0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42,
+    0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0x8013, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42,
+    0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41,
+    0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0xde41, 0x8013, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42,
+    0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42,
+    0xbe42, 0xbe42, 0xbe42, 0x8013, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xbe42, 0xde41, 0xbe42, 0x0000, 0x0000, 0x9409, 0x9409,
+    0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409,
+    0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409,
+    0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409, 0x9409,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x0016, 0x0016, 0x0016, 0x0016, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x1406, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x1406, 0x0016, 0x0016, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x0000, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x1e45, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x0000, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446,
+    0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x0000, 0x0000, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446,
+    0x1446, 0x1446, 0x0000, 0x1446, 0x1446, 0x0000, 0x1446, 0x1446, 0x1446, 0x1446, 0x1446, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x0000,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x1e44, 0x0000, 0x0000,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e45, 0x0016,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1406, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0014,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x1e45, 0x1e45, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41, 0x5e41,
+    0x5e41, 0x5e41, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x3e42,
+    0x3e42, 0x3e42, 0x3e42, 0x3e42, 0x1406, 0x1406, 0x1406, 0x1446, 0x1406, 0x1406, 0x1406, 0x1e44, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0000, 0x0000, 0x0000, 0x0000, 0x0012, 0x0012,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x0016, 0x000b, 0x000b, 0x000b,
+    0x0014, 0x000b, 0x000b, 0x000b, 0x000b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x0016, 0x000b,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x0000, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45,
+    0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45,
+    0x0000, 0x9e45, 0x9e45, 0x0000, 0x9e45, 0x0000, 0x0000, 0x9e45, 0x0000, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45,
+    0x9e45, 0x9e45, 0x9e45, 0x0000, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x0000, 0x9e45, 0x0000, 0x9e45, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x9e45, 0x0000, 0x0000, 0x0000, 0x0000, 0x9e45, 0x0000, 0x9e45, 0x0000, 0x9e45, 0x0000, 0x9e45, 0x9e45, 0x9e45,
+    0x0000, 0x9e45, 0x9e45, 0x0000, 0x9e45, 0x0000, 0x0000, 0x9e45, 0x0000, 0x9e45, 0x0000, 0x9e45, 0x0000, 0x9e45, 0x0000, 0x9e45,
+    0x0000, 0x9e45, 0x9e45, 0x0000, 0x9e45, 0x0000, 0x0000, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x0000, 0x9e45, 0x9e45, 0x9e45, 0x9e45,
+    0x9e45, 0x9e45, 0x9e45, 0x0000, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x0000, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x0000, 0x9e45, 0x0000,
+    0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x0000, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45,
+    0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x9e45, 0x9e45, 0x9e45, 0x0000, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x0000, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45,
+    0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x9e45, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x8013, 0x8013, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000,
+    0x0000, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0000, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0000, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056,
+    0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056,
+    0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056,
+    0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x4056, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0000, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45,
+    0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x1e45, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x001b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b,
+    0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b,
+    0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b,
+    0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b,
+    0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b,
+    0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+
+} } // namespace soul::unicode
@@ -0,0 +1,57 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#ifndef SOUL_UNICODE_UNICODE_TABLES_INCLUDED
+#define SOUL_UNICODE_UNICODE_TABLES_INCLUDED
+#include <stdint.h>
+
+namespace soul { namespace unicode {
+
+//  Two-stage lookup table for the general category and the most commonly used binary properties.
+//  The first stage maps a block of code points to a block of the second stage, identical blocks are stored only once.
+//  An entry contains the general category number in its low bits and a bit for each TableProperty.
+//  The table data in UnicodeTables.cpp is generated by unicode/MakeUcdBin from the same database as soul_ucd.bin.
+//  It is compiled into the library, so these lookups need neither the character table file nor SOUL_U32_ROOT.
+
+const int propertyTableBlockShift = 7;
+const uint32_t propertyTableBlockSize = 1 << propertyTableBlockShift;
+const uint32_t propertyTableBlockMask = propertyTableBlockSize - 1;
+const uint32_t numPropertyTableBlocks = 0x110000 >> propertyTableBlockShift;
+
+const uint16_t propertyTableGeneralCategoryMask = 0x001F;
+
+enum class TableProperty : uint16_t
+{
+    whiteSpace = 1 << 5,
+    alphabetic = 1 << 6,
+    asciiHexDigit = 1 << 7,
+    hexDigit = 1 << 8,
+    idStart = 1 << 9,
+    idContinue = 1 << 10,
+    xidStart = 1 << 11,
+    xidContinue = 1 << 12,
+    lowercase = 1 << 13,
+    uppercase = 1 << 14,
+    math = 1 << 15
+};
+
+extern const uint16_t propertyTableStage1[numPropertyTableBlocks];
+extern const uint16_t propertyTableStage2[];
+
+inline uint16_t GetPropertyTableEntry(char32_t c)
+{
+    if (c > 0x10FFFF) return 0;
+    uint32_t block = propertyTableStage1[c >> propertyTableBlockShift];
+    return propertyTableStage2[(block << propertyTableBlockShift) | (c & propertyTableBlockMask)];
+}
+
+inline bool HasTableProperty(char32_t c, TableProperty property)
+{
+    return (GetPropertyTableEntry(c) & static_cast<uint16_t>(property)) != 0;
+}
+
+} } // namespace soul::unicode
+
+#endif // SOUL_UNICODE_UNICODE_TABLES_INCLUDED
@@ -0,0 +1,260 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <soul_u32/xml/XmlBatchParser.hpp>
+#include <soul_u32/xml/XmlParser.hpp>
+#include <soul_u32/xml/XmlGrammar.hpp>
+#include <soul_u32/parsing/ParsingDomain.hpp>
+#include <soul_u32/util/Unicode.hpp>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace soul { namespace xml {
+
+using namespace soul::parsing;
+using namespace soul::unicode;
+
+XmlBatchHandler::~XmlBatchHandler()
+{
+}
+
+//  The next document of a range is taken with an atomic increment both by the owner of the range and by the workers that steal from it.
+
+struct DocumentRange
+{
+    DocumentRange() : next(0), end(0) {}
+    std::atomic<int> next;
+    int end;
+};
+
+class XmlBatchParser::Pool
+{
+public:
+    Pool(int numThreads);
+    ~Pool();
+    int NumWorkers() const { return int(threads.size()); }
+    void Parse(const std::vector<XmlBatchInput>& inputs, const XmlLimits* limits, XmlBatchHandler* handler, std::vector<XmlBatchResult>& results);
+private:
+    struct Worker
+    {
+        Worker() : processor(nullptr, nullptr, static_cast<XmlViewHandler*>(nullptr)) {}
+        std::unique_ptr<ParsingData> parsingData;
+        XmlProcessor processor;
+        std::u32string content;
+        std::string systemId;
+    };
+    std::vector<std::thread> threads;
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::unique_ptr<DocumentRange>> ranges;
+    std::mutex mtx;
+    std::condition_variable batchStarted;
+    std::condition_variable batchDone;
+    int batchNumber;
+    int activeWorkers;
+    bool exiting;
+    const std::vector<XmlBatchInput>* inputs;
+    const XmlLimits* limits;
+    XmlBatchHandler* handler;
+    std::vector<XmlBatchResult>* results;
+    void Run(int workerIndex);
+    int TakeDocument(int workerIndex);
+    void ParseDocument(int documentIndex, int workerIndex);
+    std::unique_ptr<ParsingData> CreateParsingData() const;
+};
+
+XmlBatchParser::Pool::Pool(int numThreads) : batchNumber(0), activeWorkers(0), exiting(false), inputs(nullptr), limits(nullptr), handler(nullptr), results(nullptr)
+{
+    GetXmlGrammar();
+    for (int i = 0; i < numThreads; ++i)
+    {
+        workers.push_back(std::unique_ptr<Worker>(new Worker()));
+        workers.back()->parsingData = CreateParsingData();
+        ranges.push_back(std::unique_ptr<DocumentRange>(new DocumentRange()));
+    }
+    for (int i = 0; i < numThreads; ++i)
+    {
+        threads.push_back(std::thread(&Pool::Run, this, i));
+    }
+}
+
+XmlBatchParser::Pool::~Pool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        exiting = true;
+    }
+    batchStarted.notify_all();
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+void XmlBatchParser::Pool::Parse(const std::vector<XmlBatchInput>& inputs_, const XmlLimits* limits_, XmlBatchHandler* handler_, std::vector<XmlBatchResult>& results_)
+{
+    int numDocuments = int(inputs_.size());
+    int numWorkers = NumWorkers();
+    for (int i = 0; i < numWorkers; ++i)
+    {
+        ranges[i]->next = int(int64_t(numDocuments) * i / numWorkers);
+        ranges[i]->end = int(int64_t(numDocuments) * (i + 1) / numWorkers);
+    }
+    std::unique_lock<std::mutex> lock(mtx);
+    inputs = &inputs_;
+    limits = limits_;
+    handler = handler_;
+    results = &results_;
+    activeWorkers = numWorkers;
+    ++batchNumber;
+    batchStarted.notify_all();
+    batchDone.wait(lock, [this] { return activeWorkers == 0; });
+    inputs = nullptr;
+    limits = nullptr;
+    handler = nullptr;
+    results = nullptr;
+}
+
+void XmlBatchParser::Pool::Run(int workerIndex)
+{
+    int lastBatchNumber = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            batchStarted.wait(lock, [this, lastBatchNumber] { return exiting || batchNumber != lastBatchNumber; });
+            if (exiting)
+            {
+                return;
+            }
+            lastBatchNumber = batchNumber;
+        }
+        int documentIndex = TakeDocument(workerIndex);
+        while (documentIndex != -1)
+        {
+            ParseDocument(documentIndex, workerIndex);
+            documentIndex = TakeDocument(workerIndex);
+        }
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            --activeWorkers;
+        }
+        batchDone.notify_one();
+    }
+}
+
+//  Takes the next document of the worker's own range, or steals one from the other ranges when the own range is exhausted.
+
+int XmlBatchParser::Pool::TakeDocument(int workerIndex)
+{
+    int numWorkers = NumWorkers();
+    for (int i = 0; i < numWorkers; ++i)
+    {
+        DocumentRange& range = *ranges[(workerIndex + i) % numWorkers];
+        if (range.next.load(std::memory_order_relaxed) < range.end)
+        {
+            int documentIndex = range.next.fetch_add(1);
+            if (documentIndex < range.end)
+            {
+                return documentIndex;
+            }
+        }
+    }
+    return -1;
+}
+
+//  Called in a catch block. Exceptions that are not std::exceptions come from the handler, as the parser throws only std::exceptions.
+
+std::string CurrentExceptionMessage(const std::string& systemId)
+{
+    try
+    {
+        throw;
+    }
+    catch (const std::exception& ex)
+    {
+        return ex.what();
+    }
+    catch (...)
+    {
+        return "error in '" + systemId + "': the handler threw an exception that is not a std::exception";
+    }
+}
+
+void XmlBatchParser::Pool::ParseDocument(int documentIndex, int workerIndex)
+{
+    Worker& worker = *workers[workerIndex];
+    const XmlBatchInput& input = (*inputs)[documentIndex];
+    XmlBatchResult& result = (*results)[documentIndex];
+    if (input.systemId)
+    {
+        worker.systemId.assign(input.systemId);
+    }
+    else
+    {
+        worker.systemId.assign("document ").append(std::to_string(documentIndex));
+    }
+    try
+    {
+        XmlViewHandler* viewHandler = handler->BeginDocument(documentIndex, workerIndex);
+        CheckXmlDocumentSize(input.content, input.content + input.length, limits, worker.systemId);
+        worker.content.clear();
+        AppendUtf32(worker.content, input.content, input.content + input.length);
+        worker.processor.Reset(worker.content.c_str(), worker.content.c_str() + worker.content.length(), viewHandler);
+        worker.processor.SetLimits(limits);
+        ParseXmlContent(worker.processor, worker.systemId, worker.parsingData.get());
+        result.succeeded = true;
+    }
+    catch (...)
+    {
+        result.succeeded = false;
+        result.error = CurrentExceptionMessage(worker.systemId);
+        worker.parsingData = CreateParsingData();
+    }
+    try
+    {
+        handler->EndDocument(documentIndex, workerIndex, result);
+    }
+    catch (...)
+    {
+        result.succeeded = false;
+        result.error = CurrentExceptionMessage(worker.systemId);
+    }
+}
+
+std::unique_ptr<ParsingData> XmlBatchParser::Pool::CreateParsingData() const
+{
+    return std::unique_ptr<ParsingData>(new ParsingData(GetXmlGrammar()->GetParsingDomain()->GetNumRules()));
+}
+
+XmlBatchParser::XmlBatchParser(int numThreads) : pool(new Pool(numThreads > 0 ? numThreads : std::max(1, int(std::thread::hardware_concurrency()))))
+{
+}
+
+XmlBatchParser::~XmlBatchParser()
+{
+}
+
+int XmlBatchParser::NumWorkers() const
+{
+    return pool->NumWorkers();
+}
+
+std::vector<XmlBatchResult> XmlBatchParser::Parse(const std::vector<XmlBatchInput>& inputs, XmlBatchHandler* handler)
+{
+    return Parse(inputs, nullptr, handler);
+}
+
+std::vector<XmlBatchResult> XmlBatchParser::Parse(const std::vector<XmlBatchInput>& inputs, const XmlLimits* limits, XmlBatchHandler* handler)
+{
+    std::vector<XmlBatchResult> results(inputs.size());
+    pool->Parse(inputs, limits, handler, results);
+    return results;
+}
+
+} } // namespace soul::xml
@@ -0,0 +1,79 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#ifndef SOUL_XML_XML_BATCH_PARSER
+#define SOUL_XML_XML_BATCH_PARSER
+#include <soul_u32/xml/XmlViewHandler.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace soul { namespace xml {
+
+class XmlLimits;
+
+//  ==================================================================================
+//  XmlBatchParser parses many small UTF-8 encoded documents on a pool of worker
+//  threads. The threads are created with the parser and reused for all batches.
+//  Each worker keeps its parsing data, XML processor and decoding buffer from
+//  document to document, so the fixed cost of parsing a document is small.
+//
+//  The documents of a batch are divided between the workers in contiguous ranges.
+//  A worker that has parsed its range steals documents from the ranges of others.
+//
+//  An exception thrown by the handler, also one that is not a std::exception,
+//  fails the document like an error in the document does, and the worker goes on
+//  with the next document. If EndDocument throws, the result of the document is
+//  changed to failed with the error of the exception after the call.
+//  ==================================================================================
+
+struct XmlBatchInput
+{
+    XmlBatchInput() : content(nullptr), length(0), systemId(nullptr) {}
+    XmlBatchInput(const char* content_, size_t length_) : content(content_), length(length_), systemId(nullptr) {}
+    const char* content;
+    size_t length;
+    //  Used for error messages. If null, the index of the document is used.
+    const char* systemId;
+};
+
+struct XmlBatchResult
+{
+    XmlBatchResult() : succeeded(false) {}
+    bool succeeded;
+    std::string error;
+};
+
+class XmlBatchHandler
+{
+public:
+    virtual ~XmlBatchHandler();
+    //  Called on the worker thread before a document is parsed. Returns the handler for the events of the document.
+    //  A worker parses one document at a time, so a handler per worker needs no locking.
+    virtual XmlViewHandler* BeginDocument(int documentIndex, int workerIndex) = 0;
+    virtual void EndDocument(int, int, const XmlBatchResult&) {}
+};
+
+class XmlBatchParser
+{
+public:
+    //  Zero threads means the number of hardware threads.
+    XmlBatchParser(int numThreads);
+    ~XmlBatchParser();
+    XmlBatchParser(const XmlBatchParser&) = delete;
+    XmlBatchParser& operator=(const XmlBatchParser&) = delete;
+    int NumWorkers() const;
+    //  Parses the documents and returns their results in input order. One batch is parsed at a time.
+    std::vector<XmlBatchResult> Parse(const std::vector<XmlBatchInput>& inputs, XmlBatchHandler* handler);
+    //  Applies given limits to each document of the batch. Null limits means no limits.
+    std::vector<XmlBatchResult> Parse(const std::vector<XmlBatchInput>& inputs, const XmlLimits* limits, XmlBatchHandler* handler);
+private:
+    class Pool;
+    std::unique_ptr<Pool> pool;
+};
+
+} } // namespace soul::xml
+
+#endif // SOUL_XML_XML_BATCH_PARSER
@@ -12,21 +12,48 @@ Attribute::Attribute(const std::u32string& namespaceUri_, const std::u32string&
 {
 }
 
+Attributes::Attributes() : count(0)
+{
+}
+
 void Attributes::Add(const Attribute& attribute)
 {
-    attributes.push_back(attribute);
+    if (count < int(attributes.size()))
+    {
+        attributes[count] = attribute;
+    }
+    else
+    {
+        attributes.push_back(attribute);
+    }
+    ++count;
+}
+
+void Attributes::Add(const soul::util::U32StringView& namespaceUri, const soul::util::U32StringView& localName, const soul::util::U32StringView& qualifiedName, 
+    const soul::util::U32StringView& value)
+{
+    if (count == int(attributes.size()))
+    {
+        attributes.push_back(Attribute(std::u32string(), std::u32string(), std::u32string(), std::u32string()));
+    }
+    Attribute& attribute = attributes[count];
+    attribute.namespaceUri.assign(namespaceUri.begin(), namespaceUri.end());
+    attribute.localName.assign(localName.begin(), localName.end());
+    attribute.qualifiedName.assign(qualifiedName.begin(), qualifiedName.end());
+    attribute.value.assign(value.begin(), value.end());
+    ++count;
 }
 
 void Attributes::Clear()
 {
-    attributes.clear();
+    count = 0;
 }
 
 const std::u32string* Attributes::GetAttributeValue(const std::u32string& namespaceUri, const std::u32string& localName) const
 {
-    for (const Attribute& attribute : attributes)
+    for (const Attribute& attribute : *this)
     {
-        if (attribute.NamespaceUri() == namespaceUri && attribute.LocalName() == localName)
+        if (attribute.LocalName() == localName && attribute.NamespaceUri() == namespaceUri)
         {
             return &attribute.Value();
         }
@@ -36,7 +63,7 @@ const std::u32string* Attributes::GetAttributeValue(const std::u32string& namesp
 
 const std::u32string* Attributes::GetAttributeValue(const std::u32string& qualifiedName) const
 {
-    for (const Attribute& attribute : attributes)
+    for (const Attribute& attribute : *this)
     {
         if (attribute.QualifiedName() == qualifiedName)
         {
@@ -46,6 +73,10 @@ const std::u32string* Attributes::GetAttributeValue(const std::u32string& qualif
     return nullptr;
 }
 
+XmlContentHandler::XmlContentHandler() : skipSubtree(false), coalesceText(false), ignoreWhitespaceText(false)
+{
+}
+
 XmlContentHandler::~XmlContentHandler()
 {
 }
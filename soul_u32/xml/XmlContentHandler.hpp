@@ -5,6 +5,7 @@
 
 #ifndef SOUL_XML_XML_CONTENT_HANDLER
 #define SOUL_XML_XML_CONTENT_HANDLER
+#include <soul_u32/util/StringView.hpp>
 #include <string>
 #include <vector>
 
@@ -19,31 +20,40 @@ public:
     const std::u32string& QualifiedName() const { return qualifiedName; }
     const std::u32string& Value() const { return value; }
 private:
+    friend class Attributes;
     std::u32string namespaceUri;
     std::u32string localName;
     std::u32string qualifiedName;
     std::u32string value;
 };
 
+//  Clear() keeps the attribute objects, so that the next Add() calls can reuse the memory of their strings.
+
 class Attributes
 {
 public:
     typedef std::vector<Attribute>::const_iterator const_iterator;
+    Attributes();
     const_iterator begin() const { return attributes.begin(); }
-    const_iterator end() const { return attributes.end(); }
+    const_iterator end() const { return attributes.begin() + count; }
     const_iterator cbegin() const { return attributes.cbegin(); }
-    const_iterator cend() const { return attributes.cend(); }
+    const_iterator cend() const { return attributes.cbegin() + count; }
+    int Count() const { return count; }
     void Add(const Attribute& attribute);
+    void Add(const soul::util::U32StringView& namespaceUri, const soul::util::U32StringView& localName, const soul::util::U32StringView& qualifiedName, 
+        const soul::util::U32StringView& value);
     void Clear();
     const std::u32string* GetAttributeValue(const std::u32string& namespaceUri, const std::u32string& localName) const;
     const std::u32string* GetAttributeValue(const std::u32string& qualifiedName) const;
 private:
     std::vector<Attribute> attributes;
+    int count;
 };
 
 class XmlContentHandler
 {
 public:
+    XmlContentHandler();
     virtual ~XmlContentHandler();
     virtual void StartDocument() {}
     virtual void EndDocument() {}
@@ -56,6 +66,21 @@ public:
     virtual void StartElement(const std::u32string& namespaceUri, const std::u32string& localName, const std::u32string& qualifiedName, const Attributes& attributes) {}
     virtual void EndElement(const std::u32string& namespaceUri, const std::u32string& localName, const std::u32string& qualifiedName) {}
     virtual void SkippedEntity(const std::u32string& entityName) {}
+    //  StartElement can call SkipSubtree() to make the parser skip the content of the element.
+    //  The skipped content is only checked for balanced tags: no events are delivered for it. EndElement is delivered for the element itself.
+    void SkipSubtree() { skipSubtree = true; }
+    bool TakeSkipSubtree() { bool skip = skipSubtree; skipSubtree = false; return skip; }
+    //  With CoalesceText, adjacent character data, CDATA sections and references are delivered as a single Text event.
+    //  With IgnoreWhitespaceText, text that consists of whitespace only is not delivered, unless it is the whole content of an element.
+    //  Set these before parsing.
+    void SetCoalesceText(bool coalesceText_) { coalesceText = coalesceText_; }
+    bool CoalesceText() const { return coalesceText; }
+    void SetIgnoreWhitespaceText(bool ignoreWhitespaceText_) { ignoreWhitespaceText = ignoreWhitespaceText_; }
+    bool IgnoreWhitespaceText() const { return ignoreWhitespaceText; }
+private:
+    bool skipSubtree;
+    bool coalesceText;
+    bool ignoreWhitespaceText;
 };
 
 } } // namespace soul::xml
@@ -0,0 +1,437 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <soul_u32/xml/XmlDocument.hpp>
+#include <soul_u32/xml/XmlParser.hpp>
+#include <soul_u32/util/Unicode.hpp>
+#include <soul_u32/util/MappedInputFile.hpp>
+
+namespace soul { namespace xml {
+
+using namespace soul::util;
+using namespace soul::unicode;
+
+XmlNodeKind XmlNode::Kind() const
+{
+    return document->nodes[index].kind;
+}
+
+int XmlNode::NameId() const
+{
+    return document->nodes[index].nameId;
+}
+
+U32StringView XmlNode::NamespaceUri() const
+{
+    int nameId = NameId();
+    return nameId != -1 ? document->NamespaceUri(nameId) : U32StringView();
+}
+
+U32StringView XmlNode::LocalName() const
+{
+    int nameId = NameId();
+    return nameId != -1 ? document->LocalName(nameId) : U32StringView();
+}
+
+U32StringView XmlNode::QualifiedName() const
+{
+    int nameId = NameId();
+    return nameId != -1 ? document->QualifiedName(nameId) : U32StringView();
+}
+
+U32StringView XmlNode::Text() const
+{
+    return document->GetText(document->nodes[index].text);
+}
+
+XmlNode XmlNode::Parent() const
+{
+    return XmlNode(document, document->nodes[index].parent);
+}
+
+XmlNode XmlNode::FirstChild() const
+{
+    return XmlNode(document, document->nodes[index].firstChild);
+}
+
+XmlNode XmlNode::NextSibling() const
+{
+    return XmlNode(document, document->nodes[index].nextSibling);
+}
+
+XmlNode XmlNode::FirstChildElement(const U32StringView& qualifiedName) const
+{
+    for (XmlNode child = FirstChild(); child; child = child.NextSibling())
+    {
+        if (child.Kind() == XmlNodeKind::element && child.QualifiedName() == qualifiedName)
+        {
+            return child;
+        }
+    }
+    return XmlNode();
+}
+
+int XmlNode::AttributeCount() const
+{
+    return document->nodes[index].attributeCount;
+}
+
+XmlAttribute XmlNode::GetAttribute(int i) const
+{
+    return XmlAttribute(document, document->nodes[index].firstAttribute + i);
+}
+
+int XmlNode::FindAttribute(const U32StringView& qualifiedName) const
+{
+    int n = AttributeCount();
+    for (int i = 0; i < n; ++i)
+    {
+        if (GetAttribute(i).QualifiedName() == qualifiedName)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+//  The nodes are in document order, so the subtree of a node is the range of nodes that follow it and whose parent is the node or a node of its subtree.
+
+std::u32string XmlNode::InnerText() const
+{
+    std::u32string text;
+    int n = document->NodeCount();
+    for (int i = index + 1; i < n && document->nodes[i].parent >= index; ++i)
+    {
+        if (document->nodes[i].kind == XmlNodeKind::text)
+        {
+            U32StringView nodeText = document->GetText(document->nodes[i].text);
+            text.append(nodeText.begin(), nodeText.end());
+        }
+    }
+    return text;
+}
+
+int XmlAttribute::NameId() const
+{
+    return document->attributes[index].nameId;
+}
+
+U32StringView XmlAttribute::NamespaceUri() const
+{
+    return document->NamespaceUri(NameId());
+}
+
+U32StringView XmlAttribute::LocalName() const
+{
+    return document->LocalName(NameId());
+}
+
+U32StringView XmlAttribute::QualifiedName() const
+{
+    return document->QualifiedName(NameId());
+}
+
+U32StringView XmlAttribute::Value() const
+{
+    return document->GetText(document->attributes[index].value);
+}
+
+XmlDocument::XmlDocument(std::u32string&& content_, const XmlDocumentOptions& options_) : content(std::move(content_)), options(options_), standalone(false)
+{
+    Node root;
+    root.kind = XmlNodeKind::document;
+    root.nameId = -1;
+    root.parent = -1;
+    root.firstChild = -1;
+    root.nextSibling = -1;
+    root.firstAttribute = 0;
+    root.attributeCount = 0;
+    nodes.push_back(root);
+}
+
+XmlNode XmlDocument::DocumentElement() const
+{
+    for (XmlNode child = Root().FirstChild(); child; child = child.NextSibling())
+    {
+        if (child.Kind() == XmlNodeKind::element)
+        {
+            return child;
+        }
+    }
+    return XmlNode();
+}
+
+int XmlDocument::FindName(const U32StringView& namespaceUri, const U32StringView& localName) const
+{
+    int n = NameCount();
+    for (int nameId = 0; nameId < n; ++nameId)
+    {
+        if (LocalName(nameId) == localName && NamespaceUri(nameId) == namespaceUri)
+        {
+            return nameId;
+        }
+    }
+    return -1;
+}
+
+int XmlDocument::FindName(const U32StringView& qualifiedName) const
+{
+    int n = NameCount();
+    for (int nameId = 0; nameId < n; ++nameId)
+    {
+        if (QualifiedName(nameId) == qualifiedName)
+        {
+            return nameId;
+        }
+    }
+    return -1;
+}
+
+XmlNodeList XmlDocument::ElementsByName(int nameId) const
+{
+    if (int(nameIndexStarts.size()) != NameCount() + 1)
+    {
+        BuildNameIndex();
+    }
+    const int* data = nameIndex.data();
+    return XmlNodeList(this, data + nameIndexStarts[nameId], data + nameIndexStarts[nameId + 1]);
+}
+
+//  Counting sort of the elements by name id: the elements of each name stay in document order.
+
+void XmlDocument::BuildNameIndex() const
+{
+    nameIndexStarts.assign(NameCount() + 1, 0);
+    for (const Node& node : nodes)
+    {
+        if (node.kind == XmlNodeKind::element)
+        {
+            ++nameIndexStarts[node.nameId + 1];
+        }
+    }
+    for (int i = 1; i <= NameCount(); ++i)
+    {
+        nameIndexStarts[i] += nameIndexStarts[i - 1];
+    }
+    nameIndex.resize(nameIndexStarts.back());
+    std::vector<int> next(nameIndexStarts.begin(), nameIndexStarts.end() - 1);
+    int n = NodeCount();
+    for (int i = 0; i < n; ++i)
+    {
+        if (nodes[i].kind == XmlNodeKind::element)
+        {
+            nameIndex[next[nodes[i].nameId]++] = i;
+        }
+    }
+}
+
+size_t XmlDocument::MemoryUsage() const
+{
+    size_t usage = (content.capacity() + pool.capacity()) * sizeof(char32_t) + nodes.capacity() * sizeof(Node) + attributes.capacity() * sizeof(Attribute) +
+        names.capacity() * sizeof(Name) + (nameIndex.capacity() + nameIndexStarts.capacity()) * sizeof(int);
+    for (int i = 0; i < namespaceUris.Count(); ++i)
+    {
+        usage += namespaceUris.Get(i).Length() * sizeof(char32_t);
+    }
+    for (int i = 0; i < qualifiedNames.Count(); ++i)
+    {
+        usage += qualifiedNames.Get(i).Length() * sizeof(char32_t);
+    }
+    return usage;
+}
+
+//  Builds a document from the events of the XML processor that parses the content of the document.
+//  Views into the content are stored as offsets, other views are copied to the pool.
+//  Adjacent text events, for example the text before, in and after an entity reference, make up a single text node.
+
+class XmlDocumentBuilder : public XmlViewHandler
+{
+public:
+    XmlDocumentBuilder(XmlDocument& document_) : document(document_), contentStart(document.content.c_str()), contentEnd(contentStart + document.content.length())
+    {
+        openNodes.push_back(0);
+        lastChildren.push_back(-1);
+        SetIgnoreWhitespaceText(!document.options.keepWhitespaceText);
+    }
+    void EndDocument() override
+    {
+        document.nodes.shrink_to_fit();
+        document.attributes.shrink_to_fit();
+        document.pool.shrink_to_fit();
+        if (document.options.indexByName)
+        {
+            document.BuildNameIndex();
+        }
+    }
+    void Version(const U32StringView& xmlVersion) override
+    {
+        document.version = Ref(xmlVersion);
+    }
+    void Standalone(bool standalone) override
+    {
+        document.standalone = standalone;
+    }
+    void Encoding(const U32StringView& encoding) override
+    {
+        document.encoding = Ref(encoding);
+    }
+    void Text(const U32StringView& text) override
+    {
+        if (text.IsEmpty())
+        {
+            return;
+        }
+        int lastChild = lastChildren.back();
+        if (lastChild != -1 && document.nodes[lastChild].kind == XmlNodeKind::text)
+        {
+            XmlDocument::TextRef& ref = document.nodes[lastChild].text;
+            if (ref.start >= document.content.length() || document.GetText(ref).end() != text.begin() || text.end() > contentEnd)
+            {
+                if (ref.start < document.content.length() || ref.start + ref.length != document.content.length() + document.pool.length())
+                {
+                    ref = Copy(document.GetText(ref));
+                }
+                document.pool.append(text.begin(), text.end());
+            }
+            ref.length += uint32_t(text.Length());
+        }
+        else
+        {
+            AddNode(XmlNodeKind::text, -1, Ref(text));
+        }
+    }
+    void Comment(const U32StringView& comment) override
+    {
+        if (document.options.keepComments)
+        {
+            AddNode(XmlNodeKind::comment, -1, Ref(comment));
+        }
+    }
+    void PI(const U32StringView& target, const U32StringView& data) override
+    {
+        AddNode(XmlNodeKind::pi, InternName(U32StringView(), target, target), Ref(data));
+    }
+    void StartElement(const U32StringView& namespaceUri, const U32StringView& localName, const U32StringView& qualifiedName, const AttributeViews& attributes) override
+    {
+        int index = AddNode(XmlNodeKind::element, InternName(namespaceUri, localName, qualifiedName), XmlDocument::TextRef());
+        XmlDocument::Node& node = document.nodes[index];
+        node.firstAttribute = int(document.attributes.size());
+        node.attributeCount = attributes.Count();
+        for (const AttributeView& attribute : attributes)
+        {
+            XmlDocument::Attribute documentAttribute;
+            documentAttribute.nameId = InternName(attribute.NamespaceUri(), attribute.LocalName(), attribute.QualifiedName());
+            documentAttribute.value = Ref(attribute.Value());
+            document.attributes.push_back(documentAttribute);
+        }
+        openNodes.push_back(index);
+        lastChildren.push_back(-1);
+    }
+    void EndElement(const U32StringView&, const U32StringView&, const U32StringView&) override
+    {
+        openNodes.pop_back();
+        lastChildren.pop_back();
+    }
+private:
+    XmlDocument& document;
+    const char32_t* contentStart;
+    const char32_t* contentEnd;
+    std::vector<int> openNodes;
+    std::vector<int> lastChildren;
+    int AddNode(XmlNodeKind kind, int nameId, const XmlDocument::TextRef& text)
+    {
+        int index = int(document.nodes.size());
+        XmlDocument::Node node;
+        node.kind = kind;
+        node.nameId = nameId;
+        node.parent = openNodes.back();
+        node.firstChild = -1;
+        node.nextSibling = -1;
+        node.firstAttribute = 0;
+        node.attributeCount = 0;
+        node.text = text;
+        document.nodes.push_back(node);
+        int& lastChild = lastChildren.back();
+        if (lastChild == -1)
+        {
+            document.nodes[node.parent].firstChild = index;
+        }
+        else
+        {
+            document.nodes[lastChild].nextSibling = index;
+        }
+        lastChild = index;
+        return index;
+    }
+    XmlDocument::TextRef Ref(const U32StringView& text)
+    {
+        if (text.begin() >= contentStart && text.end() <= contentEnd)
+        {
+            XmlDocument::TextRef ref;
+            ref.start = uint32_t(text.begin() - contentStart);
+            ref.length = uint32_t(text.Length());
+            return ref;
+        }
+        return Copy(text);
+    }
+    XmlDocument::TextRef Copy(const U32StringView& text)
+    {
+        XmlDocument::TextRef ref;
+        ref.start = uint32_t(document.content.length() + document.pool.length());
+        ref.length = uint32_t(text.Length());
+        const char32_t* poolStart = document.pool.c_str();
+        if (text.begin() >= poolStart && text.end() <= poolStart + document.pool.length())
+        {
+            document.pool.append(document.pool, text.begin() - poolStart, text.Length());
+        }
+        else
+        {
+            document.pool.append(text.begin(), text.Length());
+        }
+        return ref;
+    }
+    int InternName(const U32StringView& namespaceUri, const U32StringView& localName, const U32StringView& qualifiedName)
+    {
+        int namespaceId = document.namespaceUris.Intern(namespaceUri);
+        int qualifiedNameId = document.qualifiedNames.Intern(qualifiedName);
+        uint64_t key = (uint64_t(namespaceId) << 32) | uint64_t(qualifiedNameId);
+        auto it = document.nameMap.find(key);
+        if (it != document.nameMap.cend())
+        {
+            return it->second;
+        }
+        int nameId = int(document.names.size());
+        XmlDocument::Name name;
+        name.namespaceId = namespaceId;
+        name.qualifiedNameId = qualifiedNameId;
+        name.localNameStart = int(qualifiedName.Length() - localName.Length());
+        document.names.push_back(name);
+        document.nameMap[key] = nameId;
+        return nameId;
+    }
+};
+
+std::unique_ptr<XmlDocument> ParseXmlDocument(std::u32string&& xmlContent, const std::string& systemId, const XmlDocumentOptions& options)
+{
+    std::unique_ptr<XmlDocument> document(new XmlDocument(std::move(xmlContent), options));
+    XmlDocumentBuilder builder(*document);
+    ParseXmlContent(document->Content(), systemId, options.limits, &builder);
+    return document;
+}
+
+std::unique_ptr<XmlDocument> ParseXmlDocument(const std::string& xmlContent, const std::string& systemId, const XmlDocumentOptions& options)
+{
+    CheckXmlDocumentSize(xmlContent.c_str(), xmlContent.c_str() + xmlContent.length(), options.limits, systemId);
+    return ParseXmlDocument(ToUtf32(xmlContent), systemId, options);
+}
+
+std::unique_ptr<XmlDocument> ParseXmlDocumentFile(const std::string& xmlFileName, const XmlDocumentOptions& options)
+{
+    std::string xmlContent = ReadFile(xmlFileName);
+    CheckXmlDocumentSize(xmlContent.c_str(), xmlContent.c_str() + xmlContent.length(), options.limits, xmlFileName);
+    return ParseXmlDocument(ToUtf32(xmlContent), xmlFileName, options);
+}
+
+} } // namespace soul::xml
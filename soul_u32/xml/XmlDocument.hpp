@@ -0,0 +1,212 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#ifndef SOUL_XML_XML_DOCUMENT
+#define SOUL_XML_XML_DOCUMENT
+#include <soul_u32/xml/XmlProcessor.hpp>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <stdint.h>
+
+namespace soul { namespace xml {
+
+//  ==================================================================================
+//  XmlDocument is a compact read-only document tree. The nodes and the attributes
+//  are kept in two contiguous arrays and refer to each other by index. The names
+//  are interned: each distinct combination of a namespace URI and a qualified name
+//  has a name id. The document keeps the parsed content, and text, attribute values
+//  and comments refer to it by offset. Only text that contains entity or character
+//  references is copied to a pool owned by the document.
+//
+//  XmlNode and XmlAttribute are small handles to a node or an attribute of a
+//  document. They and the views they return are valid as long as the document is.
+//  ==================================================================================
+
+enum class XmlNodeKind : uint8_t
+{
+    document, element, text, comment, pi
+};
+
+struct XmlDocumentOptions
+{
+    XmlDocumentOptions() : indexByName(false), keepComments(true), keepWhitespaceText(true), limits(nullptr) {}
+    //  Builds the index of elements by name while parsing. Otherwise ElementsByName() builds it on first use, which must not happen concurrently.
+    bool indexByName;
+    bool keepComments;
+    //  If false, text nodes that consist of whitespace only are left out, unless they are the whole content of an element.
+    bool keepWhitespaceText;
+    //  The limits of the parse that builds the document. Null means no limits.
+    const XmlLimits* limits;
+};
+
+class XmlDocument;
+class XmlAttribute;
+
+class XmlNode
+{
+public:
+    XmlNode() : document(nullptr), index(-1) {}
+    XmlNode(const XmlDocument* document_, int index_) : document(document_), index(index_) {}
+    explicit operator bool() const { return index != -1; }
+    int Index() const { return index; }
+    XmlNodeKind Kind() const;
+    //  Name id of an element or the target of a PI.
+    int NameId() const;
+    U32StringView NamespaceUri() const;
+    U32StringView LocalName() const;
+    U32StringView QualifiedName() const;
+    //  Text of a text or comment node, data of a PI.
+    U32StringView Text() const;
+    XmlNode Parent() const;
+    XmlNode FirstChild() const;
+    XmlNode NextSibling() const;
+    //  Returns the first child element with given qualified name.
+    XmlNode FirstChildElement(const U32StringView& qualifiedName) const;
+    int AttributeCount() const;
+    XmlAttribute GetAttribute(int i) const;
+    //  Returns the index of the attribute with given qualified name or -1 if the element has no such attribute.
+    int FindAttribute(const U32StringView& qualifiedName) const;
+    //  Concatenated text of the text nodes of the subtree.
+    std::u32string InnerText() const;
+private:
+    const XmlDocument* document;
+    int index;
+};
+
+inline bool operator==(const XmlNode& left, const XmlNode& right)
+{
+    return left.Index() == right.Index();
+}
+
+inline bool operator!=(const XmlNode& left, const XmlNode& right)
+{
+    return left.Index() != right.Index();
+}
+
+class XmlAttribute
+{
+public:
+    XmlAttribute(const XmlDocument* document_, int index_) : document(document_), index(index_) {}
+    int NameId() const;
+    U32StringView NamespaceUri() const;
+    U32StringView LocalName() const;
+    U32StringView QualifiedName() const;
+    U32StringView Value() const;
+private:
+    const XmlDocument* document;
+    int index;
+};
+
+//  Elements selected from a document, in document order.
+
+class XmlNodeList
+{
+public:
+    XmlNodeList(const XmlDocument* document_, const int* begin_, const int* end_) : document(document_), begin(begin_), end(end_) {}
+    int Count() const { return int(end - begin); }
+    XmlNode operator[](int i) const { return XmlNode(document, begin[i]); }
+private:
+    const XmlDocument* document;
+    const int* begin;
+    const int* end;
+};
+
+class XmlDocument
+{
+public:
+    XmlDocument(std::u32string&& content_, const XmlDocumentOptions& options_);
+    XmlDocument(const XmlDocument&) = delete;
+    XmlDocument& operator=(const XmlDocument&) = delete;
+    const std::u32string& Content() const { return content; }
+    //  The root node is the document node: the document element, comments and PIs of the prolog and epilog are its children.
+    XmlNode Root() const { return XmlNode(this, 0); }
+    XmlNode DocumentElement() const;
+    U32StringView Version() const { return GetText(version); }
+    U32StringView Encoding() const { return GetText(encoding); }
+    bool Standalone() const { return standalone; }
+    int NodeCount() const { return int(nodes.size()); }
+    int AttributeCount() const { return int(attributes.size()); }
+    int NameCount() const { return int(names.size()); }
+    U32StringView NamespaceUri(int nameId) const { return namespaceUris.Get(names[nameId].namespaceId); }
+    U32StringView QualifiedName(int nameId) const { return qualifiedNames.Get(names[nameId].qualifiedNameId); }
+    U32StringView LocalName(int nameId) const { return QualifiedName(nameId).Substring(names[nameId].localNameStart); }
+    //  Returns the name id of given name or -1 if no element or attribute of the document has the name. Linear in the number of distinct names.
+    int FindName(const U32StringView& namespaceUri, const U32StringView& localName) const;
+    int FindName(const U32StringView& qualifiedName) const;
+    XmlNodeList ElementsByName(int nameId) const;
+    //  Approximate number of bytes allocated by the document, including the content.
+    size_t MemoryUsage() const;
+private:
+    friend class XmlNode;
+    friend class XmlAttribute;
+    friend class XmlDocumentBuilder;
+    //  A text reference whose start is past the end of the content refers to the pool, so the content can have at most 2^32 characters.
+    struct TextRef
+    {
+        TextRef() : start(0), length(0) {}
+        uint32_t start;
+        uint32_t length;
+    };
+    struct Name
+    {
+        int namespaceId;
+        int qualifiedNameId;
+        int localNameStart;
+    };
+    struct Node
+    {
+        XmlNodeKind kind;
+        int nameId;
+        int parent;
+        int firstChild;
+        int nextSibling;
+        int firstAttribute;
+        int attributeCount;
+        TextRef text;
+    };
+    struct Attribute
+    {
+        int nameId;
+        TextRef value;
+    };
+    std::u32string content;
+    std::u32string pool;
+    XmlDocumentOptions options;
+    TextRef version;
+    TextRef encoding;
+    bool standalone;
+    std::vector<Node> nodes;
+    std::vector<Attribute> attributes;
+    std::vector<Name> names;
+    StringTable namespaceUris;
+    StringTable qualifiedNames;
+    std::unordered_map<uint64_t, int> nameMap;
+    //  The elements of name id i are nameIndex[nameIndexStarts[i], nameIndexStarts[i + 1]).
+    mutable std::vector<int> nameIndex;
+    mutable std::vector<int> nameIndexStarts;
+    U32StringView GetText(const TextRef& ref) const
+    {
+        const char32_t* start = ref.start < content.length() ? content.c_str() + ref.start : pool.c_str() + (ref.start - content.length());
+        return U32StringView(start, start + ref.length);
+    }
+    void BuildNameIndex() const;
+};
+
+//  Parses given UTF-32 encoded XML content to a document. The document takes over the content.
+//  Throws XmlProcessingException or soul::parsing::ExpectationFailure for invalid content.
+
+std::unique_ptr<XmlDocument> ParseXmlDocument(std::u32string&& xmlContent, const std::string& systemId, const XmlDocumentOptions& options = XmlDocumentOptions());
+
+//  Parses given UTF-8 encoded XML content to a document.
+
+std::unique_ptr<XmlDocument> ParseXmlDocument(const std::string& xmlContent, const std::string& systemId, const XmlDocumentOptions& options = XmlDocumentOptions());
+
+std::unique_ptr<XmlDocument> ParseXmlDocumentFile(const std::string& xmlFileName, const XmlDocumentOptions& options = XmlDocumentOptions());
+
+} } // namespace soul::xml
+
+#endif // SOUL_XML_XML_DOCUMENT
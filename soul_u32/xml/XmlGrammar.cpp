@@ -37,6 +37,11 @@ XmlGrammar::XmlGrammar(soul::parsing::ParsingDomain* parsingDomain_): soul::pars
 }
 
 void XmlGrammar::Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, XmlProcessor* processor)
+{
+    Parse(start, end, fileIndex, fileName, nullptr, processor);
+}
+
+void XmlGrammar::Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, const soul::parsing::ParsingLimits* limits, XmlProcessor* processor)
 {
     soul::parsing::Scanner scanner(start, end, fileName, fileIndex, SkipRule());
     std::unique_ptr<soul::parsing::XmlLog> xmlLog;
@@ -49,8 +54,8 @@ void XmlGrammar::Parse(const char32_t* start, const char32_t* end, int fileIndex
     soul::parsing::ObjectStack stack;
     std::unique_ptr<soul::parsing::ParsingData> parsingData(new soul::parsing::ParsingData(GetParsingDomain()->GetNumRules()));
     scanner.SetParsingData(parsingData.get());
-    stack.push(std::unique_ptr<soul::parsing::Object>(new ValueObject<XmlProcessor*>(processor)));
-    soul::parsing::Match match = soul::parsing::Grammar::Parse(scanner, stack, parsingData.get());
+    soul::parsing::PushValue<XmlProcessor*>(stack, processor);
+    soul::parsing::Match match = soul::parsing::Grammar::Parse(scanner, stack, parsingData.get(), limits);
     soul::parsing::Span stop = scanner.GetSpan();
     if (Log())
     {
@@ -79,11 +84,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -104,28 +106,28 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->processor->StartDocument();
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->processor->EndDocument();
     }
     void PreProlog(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void PreElement(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void PreMisc(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
 private:
     struct Context : soul::parsing::Context
@@ -141,19 +143,17 @@ public:
     NameRule(const std::u32string& name_, Scope* enclosingScope_, int id_, Parser* definition_):
         soul::parsing::Rule(name_, enclosingScope_, id_, definition_)
     {
-        SetValueTypeName(ToUtf32("std::u32string"));
+        SetValueTypeName(ToUtf32("soul::util::U32StringView"));
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<std::u32string>(context->value)));
+            soul::parsing::PushValue<soul::util::U32StringView>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -164,14 +164,14 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        context->value = std::u32string(matchBegin, matchEnd);
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        context->value = soul::util::U32StringView(matchBegin, matchEnd);
     }
 private:
     struct Context : soul::parsing::Context
     {
         Context(): value() {}
-        std::u32string value;
+        soul::util::U32StringView value;
     };
 };
 
@@ -186,18 +186,14 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<std::u32string>(context->value)));
+            soul::parsing::PushValue<std::u32string>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -226,53 +222,53 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        context->value.append(1, *matchBegin);
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        context->value.append(matchBegin, matchEnd);
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value.append(std::u32string(matchBegin, matchEnd));
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value.append(std::u32string(matchBegin, matchEnd));
     }
     void A3Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        context->value.append(1, *matchBegin);
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        context->value.append(matchBegin, matchEnd);
     }
     void A4Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value.append(std::u32string(matchBegin, matchEnd));
     }
     void A5Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value.append(std::u32string(matchBegin, matchEnd));
     }
     void Prepr1(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void Preref1(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void Prepr2(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void Preref2(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
 private:
     struct Context : soul::parsing::Context
@@ -290,22 +286,18 @@ public:
         soul::parsing::Rule(name_, enclosingScope_, id_, definition_)
     {
         AddInheritedAttribute(AttrOrVariable(ToUtf32("XmlProcessor*"), ToUtf32("processor")));
-        SetValueTypeName(ToUtf32("std::u32string"));
+        SetValueTypeName(ToUtf32("soul::util::U32StringView"));
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<std::u32string>(context->value)));
+            soul::parsing::PushValue<soul::util::U32StringView>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -330,50 +322,50 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        context->processor->BeginAttributeValue(&context->value);
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        context->processor->BeginAttributeValue();
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        context->value.append(1, *matchBegin);
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        context->processor->AttributeValueChars(matchBegin, matchEnd);
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        context->processor->EndAttributeValue();
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        context->value = context->processor->EndAttributeValue();
     }
     void A3Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        context->processor->BeginAttributeValue(&context->value);
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        context->processor->BeginAttributeValue();
     }
     void A4Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        context->value.append(1, *matchBegin);
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        context->processor->AttributeValueChars(matchBegin, matchEnd);
     }
     void A5Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        context->processor->EndAttributeValue();
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        context->value = context->processor->EndAttributeValue();
     }
     void Preref1(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void Preref2(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
 private:
     struct Context : soul::parsing::Context
     {
         Context(): processor(), value() {}
         XmlProcessor* processor;
-        std::u32string value;
+        soul::util::U32StringView value;
     };
 };
 
@@ -383,19 +375,17 @@ public:
     SystemLiteralRule(const std::u32string& name_, Scope* enclosingScope_, int id_, Parser* definition_):
         soul::parsing::Rule(name_, enclosingScope_, id_, definition_)
     {
-        SetValueTypeName(ToUtf32("std::u32string"));
+        SetValueTypeName(ToUtf32("soul::util::U32StringView"));
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<std::u32string>(context->value)));
+            soul::parsing::PushValue<soul::util::U32StringView>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -408,19 +398,19 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        context->value = std::u32string(matchBegin, matchEnd);
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        context->value = soul::util::U32StringView(matchBegin, matchEnd);
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        context->value = std::u32string(matchBegin, matchEnd);
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        context->value = soul::util::U32StringView(matchBegin, matchEnd);
     }
 private:
     struct Context : soul::parsing::Context
     {
         Context(): value() {}
-        std::u32string value;
+        soul::util::U32StringView value;
     };
 };
 
@@ -430,19 +420,17 @@ public:
     PubidLiteralRule(const std::u32string& name_, Scope* enclosingScope_, int id_, Parser* definition_):
         soul::parsing::Rule(name_, enclosingScope_, id_, definition_)
     {
-        SetValueTypeName(ToUtf32("std::u32string"));
+        SetValueTypeName(ToUtf32("soul::util::U32StringView"));
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<std::u32string>(context->value)));
+            soul::parsing::PushValue<soul::util::U32StringView>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -455,19 +443,19 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        context->value = std::u32string(matchBegin, matchEnd);
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        context->value = soul::util::U32StringView(matchBegin, matchEnd);
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        context->value = std::u32string(matchBegin, matchEnd);
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        context->value = soul::util::U32StringView(matchBegin, matchEnd);
     }
 private:
     struct Context : soul::parsing::Context
     {
         Context(): value() {}
-        std::u32string value;
+        soul::util::U32StringView value;
     };
 };
 
@@ -481,11 +469,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -498,8 +483,8 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        context->processor->Text(std::u32string(matchBegin, matchEnd));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        context->processor->Text(soul::util::U32StringView(matchBegin, matchEnd));
     }
 private:
     struct Context : soul::parsing::Context
@@ -519,11 +504,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -536,8 +518,8 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        context->processor->Comment(std::u32string(matchBegin, matchEnd));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        context->processor->Comment(soul::util::U32StringView(matchBegin, matchEnd));
     }
 private:
     struct Context : soul::parsing::Context
@@ -557,11 +539,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -576,17 +555,15 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        context->processor->PI(context->fromtarget, std::u32string(matchBegin, matchEnd));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        context->processor->PI(context->fromtarget, soul::util::U32StringView(matchBegin, matchEnd));
     }
     void Posttarget(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromtarget_value = std::move(stack.top());
-            context->fromtarget = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromtarget_value.get());
-            stack.pop();
+            context->fromtarget = soul::parsing::PopValue<soul::util::U32StringView>(stack);
         }
     }
 private:
@@ -594,7 +571,7 @@ private:
     {
         Context(): processor(), fromtarget() {}
         XmlProcessor* processor;
-        std::u32string fromtarget;
+        soul::util::U32StringView fromtarget;
     };
 };
 
@@ -604,19 +581,17 @@ public:
     PITargetRule(const std::u32string& name_, Scope* enclosingScope_, int id_, Parser* definition_):
         soul::parsing::Rule(name_, enclosingScope_, id_, definition_)
     {
-        SetValueTypeName(ToUtf32("std::u32string"));
+        SetValueTypeName(ToUtf32("soul::util::U32StringView"));
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<std::u32string>(context->value)));
+            soul::parsing::PushValue<soul::util::U32StringView>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -629,25 +604,23 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = context->fromName;
     }
     void PostName(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromName_value = std::move(stack.top());
-            context->fromName = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromName_value.get());
-            stack.pop();
+            context->fromName = soul::parsing::PopValue<soul::util::U32StringView>(stack);
         }
     }
 private:
     struct Context : soul::parsing::Context
     {
         Context(): value(), fromName() {}
-        std::u32string value;
-        std::u32string fromName;
+        soul::util::U32StringView value;
+        soul::util::U32StringView fromName;
     };
 };
 
@@ -661,11 +634,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -680,17 +650,15 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->processor->Text(context->fromCData);
     }
     void PostCData(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromCData_value = std::move(stack.top());
-            context->fromCData = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromCData_value.get());
-            stack.pop();
+            context->fromCData = soul::parsing::PopValue<soul::util::U32StringView>(stack);
         }
     }
 private:
@@ -698,7 +666,7 @@ private:
     {
         Context(): processor(), fromCData() {}
         XmlProcessor* processor;
-        std::u32string fromCData;
+        soul::util::U32StringView fromCData;
     };
 };
 
@@ -708,19 +676,17 @@ public:
     CDataRule(const std::u32string& name_, Scope* enclosingScope_, int id_, Parser* definition_):
         soul::parsing::Rule(name_, enclosingScope_, id_, definition_)
     {
-        SetValueTypeName(ToUtf32("std::u32string"));
+        SetValueTypeName(ToUtf32("soul::util::U32StringView"));
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<std::u32string>(context->value)));
+            soul::parsing::PushValue<soul::util::U32StringView>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -731,14 +697,14 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        context->value = std::u32string(matchBegin, matchEnd);
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        context->value = soul::util::U32StringView(matchBegin, matchEnd);
     }
 private:
     struct Context : soul::parsing::Context
     {
         Context(): value() {}
-        std::u32string value;
+        soul::util::U32StringView value;
     };
 };
 
@@ -752,11 +718,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -775,23 +738,23 @@ public:
     }
     void PreXMLDecl(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void Prem1(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void PreDocTypeDecl(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void Prem2(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
 private:
     struct Context : soul::parsing::Context
@@ -811,11 +774,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -832,18 +792,18 @@ public:
     }
     void PreVersionInfo(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void PreEncodingDecl(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void PreSDDecl(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
 private:
     struct Context : soul::parsing::Context
@@ -863,11 +823,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -882,13 +839,13 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        context->processor->Version(std::u32string(matchBegin, matchEnd));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        context->processor->Version(soul::util::U32StringView(matchBegin, matchEnd));
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        context->processor->Version(std::u32string(matchBegin, matchEnd));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        context->processor->Version(soul::util::U32StringView(matchBegin, matchEnd));
     }
 private:
     struct Context : soul::parsing::Context
@@ -908,11 +865,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -927,13 +881,13 @@ public:
     }
     void PreComment(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void PrePI(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
 private:
     struct Context : soul::parsing::Context
@@ -953,11 +907,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -972,25 +923,23 @@ public:
     }
     void PostrootElementName(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromrootElementName_value = std::move(stack.top());
-            context->fromrootElementName = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromrootElementName_value.get());
-            stack.pop();
+            context->fromrootElementName = soul::parsing::PopValue<soul::util::U32StringView>(stack);
         }
     }
     void PreIntSubset(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
 private:
     struct Context : soul::parsing::Context
     {
         Context(): processor(), fromrootElementName() {}
         XmlProcessor* processor;
-        std::u32string fromrootElementName;
+        soul::util::U32StringView fromrootElementName;
     };
 };
 
@@ -1004,11 +953,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -1021,8 +967,8 @@ public:
     }
     void PrePEReference(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
 private:
     struct Context : soul::parsing::Context
@@ -1042,11 +988,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -1061,13 +1004,13 @@ public:
     }
     void PreMarkupDecl(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void PreDeclSep(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
 private:
     struct Context : soul::parsing::Context
@@ -1087,11 +1030,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -1114,33 +1054,33 @@ public:
     }
     void PreElementDecl(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void PreAttlistDecl(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void PreEntityDecl(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void PreNotationDecl(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void PrePI(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void PreComment(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
 private:
     struct Context : soul::parsing::Context
@@ -1160,11 +1100,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -1179,13 +1116,13 @@ public:
     }
     void PreTextDecl(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void PreExtSubsetDecl(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
 private:
     struct Context : soul::parsing::Context
@@ -1205,11 +1142,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -1226,18 +1160,18 @@ public:
     }
     void PreMarkupDecl(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void PreConditionalSect(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void PreDeclSep(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
 private:
     struct Context : soul::parsing::Context
@@ -1258,11 +1192,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -1283,27 +1214,27 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->processor->Standalone(context->standalone);
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->standalone = true;
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->standalone = false;
     }
     void A3Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->standalone = true;
     }
     void A4Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->standalone = false;
     }
 private:
@@ -1322,15 +1253,12 @@ public:
         soul::parsing::Rule(name_, enclosingScope_, id_, definition_)
     {
         AddInheritedAttribute(AttrOrVariable(ToUtf32("XmlProcessor*"), ToUtf32("processor")));
-        AddLocalVariable(AttrOrVariable(ToUtf32("std::u32string"), ToUtf32("tagName")));
+        AddLocalVariable(AttrOrVariable(ToUtf32("soul::util::U32StringView"), ToUtf32("tagName")));
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -1346,8 +1274,12 @@ public:
         a2ActionParser->SetAction(new soul::parsing::MemberParsingAction<ElementRule>(this, &ElementRule::A2Action));
         soul::parsing::NonterminalParser* nameNonterminalParser = GetNonterminal(ToUtf32("Name"));
         nameNonterminalParser->SetPostCall(new soul::parsing::MemberPostCall<ElementRule>(this, &ElementRule::PostName));
+        soul::parsing::NonterminalParser* skippedElementNonterminalParser = GetNonterminal(ToUtf32("SkippedElement"));
+        skippedElementNonterminalParser->SetPreCall(new soul::parsing::MemberPreCall<ElementRule>(this, &ElementRule::PreSkippedElement));
         soul::parsing::NonterminalParser* attributeNonterminalParser = GetNonterminal(ToUtf32("Attribute"));
         attributeNonterminalParser->SetPreCall(new soul::parsing::MemberPreCall<ElementRule>(this, &ElementRule::PreAttribute));
+        soul::parsing::NonterminalParser* skippedContentNonterminalParser = GetNonterminal(ToUtf32("SkippedContent"));
+        skippedContentNonterminalParser->SetPreCall(new soul::parsing::MemberPreCall<ElementRule>(this, &ElementRule::PreSkippedContent));
         soul::parsing::NonterminalParser* contentNonterminalParser = GetNonterminal(ToUtf32("Content"));
         contentNonterminalParser->SetPreCall(new soul::parsing::MemberPreCall<ElementRule>(this, &ElementRule::PreContent));
         soul::parsing::NonterminalParser* eTagNonterminalParser = GetNonterminal(ToUtf32("ETag"));
@@ -1355,53 +1287,152 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->tagName = context->fromName;
         context->processor->BeginStartTag(context->tagName);
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->processor->EndStartTag(span, fileName);
         context->processor->EndTag(context->tagName, span, fileName);
     }
     void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->processor->EndStartTag(span, fileName);
     }
     void PostName(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromName_value = std::move(stack.top());
-            context->fromName = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromName_value.get());
-            stack.pop();
+            context->fromName = soul::parsing::PopValue<soul::util::U32StringView>(stack);
         }
     }
+    void PreSkippedElement(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
+    {
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
+    }
     void PreAttribute(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
+    }
+    void PreSkippedContent(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
+    {
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void PreContent(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void PreETag(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
 private:
     struct Context : soul::parsing::Context
     {
         Context(): processor(), tagName(), fromName() {}
         XmlProcessor* processor;
-        std::u32string tagName;
-        std::u32string fromName;
+        soul::util::U32StringView tagName;
+        soul::util::U32StringView fromName;
+    };
+};
+
+class XmlGrammar::SkippedElementRule : public soul::parsing::Rule
+{
+public:
+    SkippedElementRule(const std::u32string& name_, Scope* enclosingScope_, int id_, Parser* definition_):
+        soul::parsing::Rule(name_, enclosingScope_, id_, definition_)
+    {
+        AddInheritedAttribute(AttrOrVariable(ToUtf32("XmlProcessor*"), ToUtf32("processor")));
+    }
+    virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
+    {
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
+    }
+    virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
+    {
+        parsingData->PopContext(Id());
+    }
+    virtual void Link()
+    {
+        soul::parsing::ActionParser* a0ActionParser = GetAction(ToUtf32("A0"));
+        a0ActionParser->SetAction(new soul::parsing::MemberParsingAction<SkippedElementRule>(this, &SkippedElementRule::A0Action));
+        soul::parsing::ActionParser* a1ActionParser = GetAction(ToUtf32("A1"));
+        a1ActionParser->SetAction(new soul::parsing::MemberParsingAction<SkippedElementRule>(this, &SkippedElementRule::A1Action));
+        soul::parsing::ActionParser* a2ActionParser = GetAction(ToUtf32("A2"));
+        a2ActionParser->SetAction(new soul::parsing::MemberParsingAction<SkippedElementRule>(this, &SkippedElementRule::A2Action));
+    }
+    void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
+    {
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        context->processor->EndSkippedElement();
+    }
+    void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
+    {
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        pass = context->processor->BeginSkipElement(matchBegin, span, fileName);
+    }
+    void A2Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
+    {
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        pass = context->processor->InSkippedContent(matchBegin);
+    }
+private:
+    struct Context : soul::parsing::Context
+    {
+        Context(): processor() {}
+        XmlProcessor* processor;
+    };
+};
+
+class XmlGrammar::SkippedContentRule : public soul::parsing::Rule
+{
+public:
+    SkippedContentRule(const std::u32string& name_, Scope* enclosingScope_, int id_, Parser* definition_):
+        soul::parsing::Rule(name_, enclosingScope_, id_, definition_)
+    {
+        AddInheritedAttribute(AttrOrVariable(ToUtf32("XmlProcessor*"), ToUtf32("processor")));
+    }
+    virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
+    {
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
+    }
+    virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
+    {
+        parsingData->PopContext(Id());
+    }
+    virtual void Link()
+    {
+        soul::parsing::ActionParser* a0ActionParser = GetAction(ToUtf32("A0"));
+        a0ActionParser->SetAction(new soul::parsing::MemberParsingAction<SkippedContentRule>(this, &SkippedContentRule::A0Action));
+        soul::parsing::ActionParser* a1ActionParser = GetAction(ToUtf32("A1"));
+        a1ActionParser->SetAction(new soul::parsing::MemberParsingAction<SkippedContentRule>(this, &SkippedContentRule::A1Action));
+    }
+    void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
+    {
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        pass = context->processor->BeginSkip(matchBegin, span, fileName);
+    }
+    void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
+    {
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        pass = context->processor->InSkippedContent(matchBegin);
+    }
+private:
+    struct Context : soul::parsing::Context
+    {
+        Context(): processor() {}
+        XmlProcessor* processor;
     };
 };
 
@@ -1415,11 +1446,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -1437,32 +1465,28 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->processor->AddAttribute(context->fromattName, context->fromattValue, span, fileName);
     }
     void PostattName(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromattName_value = std::move(stack.top());
-            context->fromattName = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromattName_value.get());
-            stack.pop();
+            context->fromattName = soul::parsing::PopValue<soul::util::U32StringView>(stack);
         }
     }
     void PreattValue(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void PostattValue(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromattValue_value = std::move(stack.top());
-            context->fromattValue = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromattValue_value.get());
-            stack.pop();
+            context->fromattValue = soul::parsing::PopValue<soul::util::U32StringView>(stack);
         }
     }
 private:
@@ -1470,8 +1494,8 @@ private:
     {
         Context(): processor(), fromattName(), fromattValue() {}
         XmlProcessor* processor;
-        std::u32string fromattName;
-        std::u32string fromattValue;
+        soul::util::U32StringView fromattName;
+        soul::util::U32StringView fromattValue;
     };
 };
 
@@ -1485,11 +1509,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -1504,17 +1525,15 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->processor->EndTag(context->fromName, span, fileName);
     }
     void PostName(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromName_value = std::move(stack.top());
-            context->fromName = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromName_value.get());
-            stack.pop();
+            context->fromName = soul::parsing::PopValue<soul::util::U32StringView>(stack);
         }
     }
 private:
@@ -1522,7 +1541,7 @@ private:
     {
         Context(): processor(), fromName() {}
         XmlProcessor* processor;
-        std::u32string fromName;
+        soul::util::U32StringView fromName;
     };
 };
 
@@ -1536,11 +1555,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -1565,38 +1581,38 @@ public:
     }
     void Precd1(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void PreElement(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void PreReference(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void PreCDSect(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void PrePI(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void PreComment(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void Precd2(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
 private:
     struct Context : soul::parsing::Context
@@ -1616,11 +1632,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -1633,12 +1646,10 @@ public:
     }
     void PostelementName(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromelementName_value = std::move(stack.top());
-            context->fromelementName = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromelementName_value.get());
-            stack.pop();
+            context->fromelementName = soul::parsing::PopValue<soul::util::U32StringView>(stack);
         }
     }
 private:
@@ -1646,7 +1657,7 @@ private:
     {
         Context(): processor(), fromelementName() {}
         XmlProcessor* processor;
-        std::u32string fromelementName;
+        soul::util::U32StringView fromelementName;
     };
 };
 
@@ -1660,11 +1671,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -1679,25 +1687,23 @@ public:
     }
     void PostName(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromName_value = std::move(stack.top());
-            context->fromName = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromName_value.get());
-            stack.pop();
+            context->fromName = soul::parsing::PopValue<soul::util::U32StringView>(stack);
         }
     }
     void PreAttDef(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
 private:
     struct Context : soul::parsing::Context
     {
         Context(): processor(), fromName() {}
         XmlProcessor* processor;
-        std::u32string fromName;
+        soul::util::U32StringView fromName;
     };
 };
 
@@ -1711,11 +1717,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -1730,25 +1733,23 @@ public:
     }
     void PostName(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromName_value = std::move(stack.top());
-            context->fromName = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromName_value.get());
-            stack.pop();
+            context->fromName = soul::parsing::PopValue<soul::util::U32StringView>(stack);
         }
     }
     void PreDefaultDecl(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
 private:
     struct Context : soul::parsing::Context
     {
         Context(): processor(), fromName() {}
         XmlProcessor* processor;
-        std::u32string fromName;
+        soul::util::U32StringView fromName;
     };
 };
 
@@ -1762,11 +1763,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -1780,17 +1778,15 @@ public:
     }
     void PreAttValue(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void PostAttValue(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromAttValue_value = std::move(stack.top());
-            context->fromAttValue = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromAttValue_value.get());
-            stack.pop();
+            context->fromAttValue = soul::parsing::PopValue<soul::util::U32StringView>(stack);
         }
     }
 private:
@@ -1798,7 +1794,7 @@ private:
     {
         Context(): processor(), fromAttValue() {}
         XmlProcessor* processor;
-        std::u32string fromAttValue;
+        soul::util::U32StringView fromAttValue;
     };
 };
 
@@ -1812,11 +1808,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -1829,8 +1822,8 @@ public:
     }
     void PreIncludeSect(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
 private:
     struct Context : soul::parsing::Context
@@ -1850,11 +1843,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -1867,8 +1857,8 @@ public:
     }
     void PreExtSubsetDecl(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
 private:
     struct Context : soul::parsing::Context
@@ -1888,15 +1878,13 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<char32_t>(context->value)));
+            soul::parsing::PushValue<char32_t>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1913,32 +1901,28 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = static_cast<char32_t>(context->fromdcr);
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->value = static_cast<char32_t>(context->fromhcr);
     }
     void Postdcr(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromdcr_value = std::move(stack.top());
-            context->fromdcr = *static_cast<soul::parsing::ValueObject<uint32_t>*>(fromdcr_value.get());
-            stack.pop();
+            context->fromdcr = soul::parsing::PopValue<uint32_t>(stack);
         }
     }
     void Posthcr(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromhcr_value = std::move(stack.top());
-            context->fromhcr = *static_cast<soul::parsing::ValueObject<uint32_t>*>(fromhcr_value.get());
-            stack.pop();
+            context->fromhcr = soul::parsing::PopValue<uint32_t>(stack);
         }
     }
 private:
@@ -1961,11 +1945,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -1982,22 +1963,20 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        context->processor->Text(std::u32string(1, context->fromCharRef));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        context->processor->CharRef(context->fromCharRef);
     }
     void PreEntityRef(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void PostCharRef(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromCharRef_value = std::move(stack.top());
-            context->fromCharRef = *static_cast<soul::parsing::ValueObject<char32_t>*>(fromCharRef_value.get());
-            stack.pop();
+            context->fromCharRef = soul::parsing::PopValue<char32_t>(stack);
         }
     }
 private:
@@ -2019,11 +1998,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -2038,17 +2014,15 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->processor->EntityRef(context->fromName, span, fileName);
     }
     void PostName(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromName_value = std::move(stack.top());
-            context->fromName = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromName_value.get());
-            stack.pop();
+            context->fromName = soul::parsing::PopValue<soul::util::U32StringView>(stack);
         }
     }
 private:
@@ -2056,7 +2030,7 @@ private:
     {
         Context(): processor(), fromName() {}
         XmlProcessor* processor;
-        std::u32string fromName;
+        soul::util::U32StringView fromName;
     };
 };
 
@@ -2070,11 +2044,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -2087,12 +2058,10 @@ public:
     }
     void PostName(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromName_value = std::move(stack.top());
-            context->fromName = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromName_value.get());
-            stack.pop();
+            context->fromName = soul::parsing::PopValue<soul::util::U32StringView>(stack);
         }
     }
 private:
@@ -2100,7 +2069,7 @@ private:
     {
         Context(): processor(), fromName() {}
         XmlProcessor* processor;
-        std::u32string fromName;
+        soul::util::U32StringView fromName;
     };
 };
 
@@ -2114,11 +2083,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -2133,13 +2099,13 @@ public:
     }
     void PreGEDecl(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void PrePEDecl(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
 private:
     struct Context : soul::parsing::Context
@@ -2159,11 +2125,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -2178,25 +2141,23 @@ public:
     }
     void PostentityName(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromentityName_value = std::move(stack.top());
-            context->fromentityName = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromentityName_value.get());
-            stack.pop();
+            context->fromentityName = soul::parsing::PopValue<soul::util::U32StringView>(stack);
         }
     }
     void PreentityValue(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
 private:
     struct Context : soul::parsing::Context
     {
         Context(): processor(), fromentityName() {}
         XmlProcessor* processor;
-        std::u32string fromentityName;
+        soul::util::U32StringView fromentityName;
     };
 };
 
@@ -2210,11 +2171,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -2229,25 +2187,23 @@ public:
     }
     void PostpeName(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> frompeName_value = std::move(stack.top());
-            context->frompeName = *static_cast<soul::parsing::ValueObject<std::u32string>*>(frompeName_value.get());
-            stack.pop();
+            context->frompeName = soul::parsing::PopValue<soul::util::U32StringView>(stack);
         }
     }
     void PrepeValue(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
 private:
     struct Context : soul::parsing::Context
     {
         Context(): processor(), frompeName() {}
         XmlProcessor* processor;
-        std::u32string frompeName;
+        soul::util::U32StringView frompeName;
     };
 };
 
@@ -2261,11 +2217,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -2279,17 +2232,15 @@ public:
     }
     void PreEntityValue(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void PostEntityValue(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromEntityValue_value = std::move(stack.top());
-            context->fromEntityValue = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromEntityValue_value.get());
-            stack.pop();
+            context->fromEntityValue = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
 private:
@@ -2311,11 +2262,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -2329,17 +2277,15 @@ public:
     }
     void PreEntityValue(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void PostEntityValue(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromEntityValue_value = std::move(stack.top());
-            context->fromEntityValue = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromEntityValue_value.get());
-            stack.pop();
+            context->fromEntityValue = soul::parsing::PopValue<std::u32string>(stack);
         }
     }
 private:
@@ -2361,11 +2307,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -2380,13 +2323,13 @@ public:
     }
     void PreVersionInfo(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void PreEncodingDecl(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
 private:
     struct Context : soul::parsing::Context
@@ -2406,11 +2349,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -2425,13 +2365,13 @@ public:
     }
     void PreTextDecl(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
     void PreContent(soul::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        soul::parsing::PushValue<XmlProcessor*>(stack, context->processor);
     }
 private:
     struct Context : soul::parsing::Context
@@ -2451,11 +2391,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -2474,32 +2411,28 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->processor->Encoding(context->fromen1);
     }
     void A1Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         context->processor->Encoding(context->fromen2);
     }
     void Posten1(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromen1_value = std::move(stack.top());
-            context->fromen1 = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromen1_value.get());
-            stack.pop();
+            context->fromen1 = soul::parsing::PopValue<soul::util::U32StringView>(stack);
         }
     }
     void Posten2(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromen2_value = std::move(stack.top());
-            context->fromen2 = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromen2_value.get());
-            stack.pop();
+            context->fromen2 = soul::parsing::PopValue<soul::util::U32StringView>(stack);
         }
     }
 private:
@@ -2507,8 +2440,8 @@ private:
     {
         Context(): processor(), fromen1(), fromen2() {}
         XmlProcessor* processor;
-        std::u32string fromen1;
-        std::u32string fromen2;
+        soul::util::U32StringView fromen1;
+        soul::util::U32StringView fromen2;
     };
 };
 
@@ -2518,19 +2451,17 @@ public:
     EncNameRule(const std::u32string& name_, Scope* enclosingScope_, int id_, Parser* definition_):
         soul::parsing::Rule(name_, enclosingScope_, id_, definition_)
     {
-        SetValueTypeName(ToUtf32("std::u32string"));
+        SetValueTypeName(ToUtf32("soul::util::U32StringView"));
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        soul::parsing::PushContext<Context>(parsingData, Id());
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<soul::parsing::Object>(new soul::parsing::ValueObject<std::u32string>(context->value)));
+            soul::parsing::PushValue<soul::util::U32StringView>(stack, soul::parsing::GetContext<Context>(parsingData, Id())->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2541,14 +2472,14 @@ public:
     }
     void A0Action(const char32_t* matchBegin, const char32_t* matchEnd, const Span& span, const std::string& fileName, ParsingData* parsingData, bool& pass)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        context->value = std::u32string(matchBegin, matchEnd);
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
+        context->value = soul::util::U32StringView(matchBegin, matchEnd);
     }
 private:
     struct Context : soul::parsing::Context
     {
         Context(): value() {}
-        std::u32string value;
+        soul::util::U32StringView value;
     };
 };
 
@@ -2562,11 +2493,8 @@ public:
     }
     virtual void Enter(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData)
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<soul::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<soul::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = soul::parsing::PushContext<Context>(parsingData, Id());
+        context->processor = soul::parsing::PopValue<XmlProcessor*>(stack);
     }
     virtual void Leave(soul::parsing::ObjectStack& stack, soul::parsing::ParsingData* parsingData, bool matched)
     {
@@ -2579,12 +2507,10 @@ public:
     }
     void PostName(soul::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        Context* context = soul::parsing::GetContext<Context>(parsingData, Id());
         if (matched)
         {
-            std::unique_ptr<soul::parsing::Object> fromName_value = std::move(stack.top());
-            context->fromName = *static_cast<soul::parsing::ValueObject<std::u32string>*>(fromName_value.get());
-            stack.pop();
+            context->fromName = soul::parsing::PopValue<soul::util::U32StringView>(stack);
         }
     }
 private:
@@ -2592,7 +2518,7 @@ private:
     {
         Context(): processor(), fromName() {}
         XmlProcessor* processor;
-        std::u32string fromName;
+        soul::util::U32StringView fromName;
     };
 };
 
@@ -2703,7 +2629,8 @@ void XmlGrammar::CreateRules()
                         new soul::parsing::AlternativeParser(
                             new soul::parsing::AlternativeParser(
                                 new soul::parsing::ActionParser(ToUtf32("A0"),
-                                    new soul::parsing::CharSetParser(ToUtf32("%&\""), true)),
+                                    new soul::parsing::PositiveParser(
+                                        new soul::parsing::CharSetParser(ToUtf32("%&\""), true))),
                                 new soul::parsing::ActionParser(ToUtf32("A1"),
                                     new soul::parsing::NonterminalParser(ToUtf32("pr1"), ToUtf32("PEReference"), 1))),
                             new soul::parsing::ActionParser(ToUtf32("A2"),
@@ -2716,7 +2643,8 @@ void XmlGrammar::CreateRules()
                         new soul::parsing::AlternativeParser(
                             new soul::parsing::AlternativeParser(
                                 new soul::parsing::ActionParser(ToUtf32("A3"),
-                                    new soul::parsing::CharSetParser(ToUtf32("%&\'"), true)),
+                                    new soul::parsing::PositiveParser(
+                                        new soul::parsing::CharSetParser(ToUtf32("%&\'"), true))),
                                 new soul::parsing::ActionParser(ToUtf32("A4"),
                                     new soul::parsing::NonterminalParser(ToUtf32("pr2"), ToUtf32("PEReference"), 1))),
                             new soul::parsing::ActionParser(ToUtf32("A5"),
@@ -2731,7 +2659,8 @@ void XmlGrammar::CreateRules()
                     new soul::parsing::KleeneStarParser(
                         new soul::parsing::AlternativeParser(
                             new soul::parsing::ActionParser(ToUtf32("A1"),
-                                new soul::parsing::CharSetParser(ToUtf32("<&\""), true)),
+                                new soul::parsing::PositiveParser(
+                                    new soul::parsing::CharSetParser(ToUtf32("<&\""), true))),
                             new soul::parsing::NonterminalParser(ToUtf32("ref1"), ToUtf32("Reference"), 1)))),
                 new soul::parsing::ActionParser(ToUtf32("A2"),
                     new soul::parsing::CharParser('\"'))),
@@ -2742,7 +2671,8 @@ void XmlGrammar::CreateRules()
                     new soul::parsing::KleeneStarParser(
                         new soul::parsing::AlternativeParser(
                             new soul::parsing::ActionParser(ToUtf32("A4"),
-                                new soul::parsing::CharSetParser(ToUtf32("<&\'"), true)),
+                                new soul::parsing::PositiveParser(
+                                    new soul::parsing::CharSetParser(ToUtf32("<&\'"), true))),
                             new soul::parsing::NonterminalParser(ToUtf32("ref2"), ToUtf32("Reference"), 1)))),
                 new soul::parsing::ActionParser(ToUtf32("A5"),
                     new soul::parsing::CharParser('\''))))));
@@ -2788,16 +2718,13 @@ void XmlGrammar::CreateRules()
             new soul::parsing::CharSetParser(ToUtf32("-\'()+,./:=?;!*#@$_%")))));
     AddRule(new CharDataRule(ToUtf32("CharData"), GetScope(), GetParsingDomain()->GetNextRuleId(),
         new soul::parsing::ActionParser(ToUtf32("A0"),
-            new soul::parsing::DifferenceParser(
-                new soul::parsing::KleeneStarParser(
-                    new soul::parsing::CharSetParser(ToUtf32("<&"), true)),
-                new soul::parsing::SequenceParser(
-                    new soul::parsing::SequenceParser(
-                        new soul::parsing::KleeneStarParser(
-                            new soul::parsing::CharSetParser(ToUtf32("<&"), true)),
-                        new soul::parsing::StringParser(ToUtf32("]]>"))),
-                    new soul::parsing::KleeneStarParser(
-                        new soul::parsing::CharSetParser(ToUtf32("<&"), true)))))));
+            new soul::parsing::PositiveParser(
+                new soul::parsing::AlternativeParser(
+                    new soul::parsing::PositiveParser(
+                        new soul::parsing::CharSetParser(ToUtf32("<&]"), true)),
+                    new soul::parsing::DifferenceParser(
+                        new soul::parsing::CharParser(']'),
+                        new soul::parsing::StringParser(ToUtf32("]]>"))))))));
     AddRule(new CommentRule(ToUtf32("Comment"), GetScope(), GetParsingDomain()->GetNextRuleId(),
         new soul::parsing::SequenceParser(
             new soul::parsing::SequenceParser(
@@ -2805,14 +2732,11 @@ void XmlGrammar::CreateRules()
                 new soul::parsing::ActionParser(ToUtf32("A0"),
                     new soul::parsing::KleeneStarParser(
                         new soul::parsing::AlternativeParser(
+                            new soul::parsing::PositiveParser(
+                                new soul::parsing::CharSetParser(ToUtf32("-\x1-\b\v\f\xe-\x1f"), true)),
                             new soul::parsing::DifferenceParser(
-                                new soul::parsing::NonterminalParser(ToUtf32("Char"), ToUtf32("Char"), 0),
-                                new soul::parsing::CharParser('-')),
-                            new soul::parsing::SequenceParser(
                                 new soul::parsing::CharParser('-'),
-                                new soul::parsing::DifferenceParser(
-                                    new soul::parsing::NonterminalParser(ToUtf32("Char"), ToUtf32("Char"), 0),
-                                    new soul::parsing::CharParser('-'))))))),
+                                new soul::parsing::StringParser(ToUtf32("--"))))))),
             new soul::parsing::StringParser(ToUtf32("-->")))));
     AddRule(new PIRule(ToUtf32("PI"), GetScope(), GetParsingDomain()->GetNextRuleId(),
         new soul::parsing::SequenceParser(
@@ -2824,16 +2748,13 @@ void XmlGrammar::CreateRules()
                     new soul::parsing::OptionalParser(
                         new soul::parsing::SequenceParser(
                             new soul::parsing::NonterminalParser(ToUtf32("S"), ToUtf32("S"), 0),
-                            new soul::parsing::DifferenceParser(
-                                new soul::parsing::KleeneStarParser(
-                                    new soul::parsing::NonterminalParser(ToUtf32("Char"), ToUtf32("Char"), 0)),
-                                new soul::parsing::SequenceParser(
-                                    new soul::parsing::SequenceParser(
-                                        new soul::parsing::KleeneStarParser(
-                                            new soul::parsing::NonterminalParser(ToUtf32("Char"), ToUtf32("Char"), 0)),
-                                        new soul::parsing::StringParser(ToUtf32("?>"))),
-                                    new soul::parsing::KleeneStarParser(
-                                        new soul::parsing::NonterminalParser(ToUtf32("Char"), ToUtf32("Char"), 0)))))))),
+                            new soul::parsing::KleeneStarParser(
+                                new soul::parsing::AlternativeParser(
+                                    new soul::parsing::PositiveParser(
+                                        new soul::parsing::CharSetParser(ToUtf32("?\x1-\b\v\f\xe-\x1f"), true)),
+                                    new soul::parsing::DifferenceParser(
+                                        new soul::parsing::CharParser('?'),
+                                        new soul::parsing::StringParser(ToUtf32("?>"))))))))),
             new soul::parsing::StringParser(ToUtf32("?>")))));
     AddRule(new PITargetRule(ToUtf32("PITarget"), GetScope(), GetParsingDomain()->GetNextRuleId(),
         new soul::parsing::ActionParser(ToUtf32("A0"),
@@ -2861,16 +2782,13 @@ void XmlGrammar::CreateRules()
         new soul::parsing::StringParser(ToUtf32("<![CDATA["))));
     AddRule(new CDataRule(ToUtf32("CData"), GetScope(), GetParsingDomain()->GetNextRuleId(),
         new soul::parsing::ActionParser(ToUtf32("A0"),
-            new soul::parsing::DifferenceParser(
-                new soul::parsing::KleeneStarParser(
-                    new soul::parsing::NonterminalParser(ToUtf32("Char"), ToUtf32("Char"), 0)),
-                new soul::parsing::SequenceParser(
-                    new soul::parsing::SequenceParser(
-                        new soul::parsing::KleeneStarParser(
-                            new soul::parsing::NonterminalParser(ToUtf32("Char"), ToUtf32("Char"), 0)),
-                        new soul::parsing::StringParser(ToUtf32("]]>"))),
-                    new soul::parsing::KleeneStarParser(
-                        new soul::parsing::NonterminalParser(ToUtf32("Char"), ToUtf32("Char"), 0)))))));
+            new soul::parsing::KleeneStarParser(
+                new soul::parsing::AlternativeParser(
+                    new soul::parsing::PositiveParser(
+                        new soul::parsing::CharSetParser(ToUtf32("]\x1-\b\v\f\xe-\x1f"), true)),
+                    new soul::parsing::DifferenceParser(
+                        new soul::parsing::CharParser(']'),
+                        new soul::parsing::StringParser(ToUtf32("]]>"))))))));
     AddRule(new soul::parsing::Rule(ToUtf32("CDEnd"), GetScope(), GetParsingDomain()->GetNextRuleId(),
         new soul::parsing::StringParser(ToUtf32("]]>"))));
     AddRule(new PrologRule(ToUtf32("Prolog"), GetScope(), GetParsingDomain()->GetNextRuleId(),
@@ -3028,26 +2946,51 @@ void XmlGrammar::CreateRules()
     AddRule(new ElementRule(ToUtf32("Element"), GetScope(), GetParsingDomain()->GetNextRuleId(),
         new soul::parsing::SequenceParser(
             new soul::parsing::SequenceParser(
+                new soul::parsing::CharParser('<'),
+                new soul::parsing::ActionParser(ToUtf32("A0"),
+                    new soul::parsing::NonterminalParser(ToUtf32("Name"), ToUtf32("Name"), 0))),
+            new soul::parsing::AlternativeParser(
+                new soul::parsing::NonterminalParser(ToUtf32("SkippedElement"), ToUtf32("SkippedElement"), 1),
                 new soul::parsing::SequenceParser(
                     new soul::parsing::SequenceParser(
-                        new soul::parsing::CharParser('<'),
-                        new soul::parsing::ActionParser(ToUtf32("A0"),
-                            new soul::parsing::NonterminalParser(ToUtf32("Name"), ToUtf32("Name"), 0))),
-                    new soul::parsing::KleeneStarParser(
+                        new soul::parsing::KleeneStarParser(
+                            new soul::parsing::SequenceParser(
+                                new soul::parsing::NonterminalParser(ToUtf32("S"), ToUtf32("S"), 0),
+                                new soul::parsing::NonterminalParser(ToUtf32("Attribute"), ToUtf32("Attribute"), 1))),
+                        new soul::parsing::OptionalParser(
+                            new soul::parsing::NonterminalParser(ToUtf32("S"), ToUtf32("S"), 0))),
+                    new soul::parsing::AlternativeParser(
+                        new soul::parsing::ActionParser(ToUtf32("A1"),
+                            new soul::parsing::StringParser(ToUtf32("/>"))),
                         new soul::parsing::SequenceParser(
-                            new soul::parsing::NonterminalParser(ToUtf32("S"), ToUtf32("S"), 0),
-                            new soul::parsing::NonterminalParser(ToUtf32("Attribute"), ToUtf32("Attribute"), 1)))),
-                new soul::parsing::OptionalParser(
-                    new soul::parsing::NonterminalParser(ToUtf32("S"), ToUtf32("S"), 0))),
-            new soul::parsing::AlternativeParser(
+                            new soul::parsing::SequenceParser(
+                                new soul::parsing::ActionParser(ToUtf32("A2"),
+                                    new soul::parsing::CharParser('>')),
+                                new soul::parsing::AlternativeParser(
+                                    new soul::parsing::NonterminalParser(ToUtf32("SkippedContent"), ToUtf32("SkippedContent"), 1),
+                                    new soul::parsing::NonterminalParser(ToUtf32("Content"), ToUtf32("Content"), 1))),
+                            new soul::parsing::NonterminalParser(ToUtf32("ETag"), ToUtf32("ETag"), 1))))))));
+    AddRule(new SkippedElementRule(ToUtf32("SkippedElement"), GetScope(), GetParsingDomain()->GetNextRuleId(),
+        new soul::parsing::ActionParser(ToUtf32("A0"),
+            new soul::parsing::SequenceParser(
                 new soul::parsing::ActionParser(ToUtf32("A1"),
-                    new soul::parsing::StringParser(ToUtf32("/>"))),
-                new soul::parsing::SequenceParser(
-                    new soul::parsing::SequenceParser(
-                        new soul::parsing::ActionParser(ToUtf32("A2"),
-                            new soul::parsing::CharParser('>')),
-                        new soul::parsing::NonterminalParser(ToUtf32("Content"), ToUtf32("Content"), 1)),
-                    new soul::parsing::NonterminalParser(ToUtf32("ETag"), ToUtf32("ETag"), 1))))));
+                    new soul::parsing::EmptyParser()),
+                new soul::parsing::KleeneStarParser(
+                    new soul::parsing::ActionParser(ToUtf32("A2"),
+                        new soul::parsing::AlternativeParser(
+                            new soul::parsing::PositiveParser(
+                                new soul::parsing::CharSetParser(ToUtf32("<>"), true)),
+                            new soul::parsing::CharSetParser(ToUtf32("<>")))))))));
+    AddRule(new SkippedContentRule(ToUtf32("SkippedContent"), GetScope(), GetParsingDomain()->GetNextRuleId(),
+        new soul::parsing::SequenceParser(
+            new soul::parsing::ActionParser(ToUtf32("A0"),
+                new soul::parsing::EmptyParser()),
+            new soul::parsing::KleeneStarParser(
+                new soul::parsing::ActionParser(ToUtf32("A1"),
+                    new soul::parsing::AlternativeParser(
+                        new soul::parsing::PositiveParser(
+                            new soul::parsing::CharSetParser(ToUtf32("<"), true)),
+                        new soul::parsing::CharParser('<')))))));
     AddRule(new AttributeRule(ToUtf32("Attribute"), GetScope(), GetParsingDomain()->GetNextRuleId(),
         new soul::parsing::SequenceParser(
             new soul::parsing::SequenceParser(
@@ -3372,18 +3315,17 @@ void XmlGrammar::CreateRules()
                         new soul::parsing::StringParser(ToUtf32("]]>"))),
                     new soul::parsing::NonterminalParser(ToUtf32("Ignore"), ToUtf32("Ignore"), 0))))));
     AddRule(new soul::parsing::Rule(ToUtf32("Ignore"), GetScope(), GetParsingDomain()->GetNextRuleId(),
-        new soul::parsing::DifferenceParser(
-            new soul::parsing::KleeneStarParser(
-                new soul::parsing::NonterminalParser(ToUtf32("Char"), ToUtf32("Char"), 0)),
-            new soul::parsing::SequenceParser(
-                new soul::parsing::SequenceParser(
-                    new soul::parsing::KleeneStarParser(
-                        new soul::parsing::NonterminalParser(ToUtf32("Char"), ToUtf32("Char"), 0)),
-                    new soul::parsing::AlternativeParser(
-                        new soul::parsing::StringParser(ToUtf32("<![")),
-                        new soul::parsing::StringParser(ToUtf32("]]>")))),
-                new soul::parsing::KleeneStarParser(
-                    new soul::parsing::NonterminalParser(ToUtf32("Char"), ToUtf32("Char"), 0))))));
+        new soul::parsing::KleeneStarParser(
+            new soul::parsing::AlternativeParser(
+                new soul::parsing::AlternativeParser(
+                    new soul::parsing::PositiveParser(
+                        new soul::parsing::CharSetParser(ToUtf32("<]\x1-\b\v\f\xe-\x1f"), true)),
+                    new soul::parsing::DifferenceParser(
+                        new soul::parsing::CharParser('<'),
+                        new soul::parsing::StringParser(ToUtf32("<![")))),
+                new soul::parsing::DifferenceParser(
+                    new soul::parsing::CharParser(']'),
+                    new soul::parsing::StringParser(ToUtf32("]]>")))))));
     AddRule(new CharRefRule(ToUtf32("CharRef"), GetScope(), GetParsingDomain()->GetNextRuleId(),
         new soul::parsing::AlternativeParser(
             new soul::parsing::SequenceParser(
@@ -13,6 +13,7 @@ public:
     static XmlGrammar* Create();
     static XmlGrammar* Create(soul::parsing::ParsingDomain* parsingDomain);
     void Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, XmlProcessor* processor);
+    void Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName, const soul::parsing::ParsingLimits* limits, XmlProcessor* processor);
 private:
     XmlGrammar(soul::parsing::ParsingDomain* parsingDomain_);
     virtual void CreateRules();
@@ -41,6 +42,8 @@ private:
     class ExtSubsetDeclRule;
     class SDDeclRule;
     class ElementRule;
+    class SkippedElementRule;
+    class SkippedContentRule;
     class AttributeRule;
     class ETagRule;
     class ContentRule;
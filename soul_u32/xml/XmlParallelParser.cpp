@@ -0,0 +1,727 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <soul_u32/xml/XmlParallelParser.hpp>
+#include <soul_u32/xml/XmlParser.hpp>
+#include <soul_u32/xml/XmlGrammar.hpp>
+#include <soul_u32/xml/XmlReader.hpp>
+#include <soul_u32/parsing/Rule.hpp>
+#include <soul_u32/parsing/ParsingDomain.hpp>
+#include <soul_u32/parsing/Exception.hpp>
+#include <soul_u32/util/Unicode.hpp>
+#include <soul_u32/util/MappedInputFile.hpp>
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace soul { namespace xml {
+
+using namespace soul::parsing;
+using namespace soul::util;
+using namespace soul::unicode;
+
+struct NamespaceDeclaration
+{
+    U32StringView prefix;
+    U32StringView namespaceUri;
+};
+
+//  A chunk is a run of sibling elements at split depth, from the '<' of the first element to the '>' of the last one.
+//  The namespace declarations of the ancestors of the elements are in declaration order, so the later ones override the earlier ones.
+
+struct XmlChunk
+{
+    const char32_t* start;
+    const char32_t* end;
+    int lineNumber;
+    std::vector<NamespaceDeclaration> namespaces;
+};
+
+//  The pre-scan only balances the tags and skips comments, CDATA sections, processing instructions and quoted attribute values.
+//  It returns false if the document cannot be split. Errors in the document are left to the parser to report.
+
+class ChunkScanner
+{
+public:
+    ChunkScanner(const char32_t* start_, const char32_t* end_, int splitDepth_, int64_t chunkSize_, int64_t minChunkSize_) :
+        start(start_), end(end_), splitDepth(splitDepth_), chunkSize(chunkSize_), minChunkSize(minChunkSize_), chunkStart(nullptr), lastElementEnd(nullptr),
+        lineNumberPos(start_), lineNumber(1)
+    {
+    }
+    bool Scan(std::vector<XmlChunk>& chunks);
+private:
+    const char32_t* start;
+    const char32_t* end;
+    int splitDepth;
+    int64_t chunkSize;
+    int64_t minChunkSize;
+    const char32_t* chunkStart;
+    const char32_t* lastElementEnd;
+    const char32_t* lineNumberPos;
+    int lineNumber;
+    XmlChunk chunk;
+    std::vector<NamespaceDeclaration> declarations;
+    std::vector<int> declarationCounts;
+    void BeginChunk(const char32_t* tagStart);
+    void EndChunk(std::vector<XmlChunk>& chunks);
+    const char32_t* SkipPast(const char32_t* p, const char32_t* terminator) const;
+    const char32_t* SkipTag(const char32_t* p) const;
+    const char32_t* SkipDocTypeDecl(const char32_t* p) const;
+    const char32_t* ScanNamespaceDeclarations(const char32_t* p);
+};
+
+bool ChunkScanner::Scan(std::vector<XmlChunk>& chunks)
+{
+    const char32_t* p = start;
+    int depth = 0;
+    while (true)
+    {
+        p = std::find(p, end, '<');
+        if (p == end)
+        {
+            break;
+        }
+        const char32_t* tagStart = p;
+        ++p;
+        if (p == end)
+        {
+            return false;
+        }
+        const char32_t* cdataStart = U"![CDATA[";
+        const char32_t* docTypeStart = U"!DOCTYPE";
+        if (end - p >= 3 && p[0] == '!' && p[1] == '-' && p[2] == '-')
+        {
+            p = SkipPast(p + 3, U"-->");
+        }
+        else if (end - p >= 8 && std::equal(cdataStart, cdataStart + 8, p))
+        {
+            p = SkipPast(p + 8, U"]]>");
+        }
+        else if (end - p >= 8 && std::equal(docTypeStart, docTypeStart + 8, p))
+        {
+            p = SkipDocTypeDecl(p + 8);
+        }
+        else if (*p == '?')
+        {
+            p = SkipPast(p + 1, U"?>");
+        }
+        else if (*p == '/')
+        {
+            p = SkipTag(p);
+            --depth;
+            if (!p || depth < 0)
+            {
+                return false;
+            }
+            if (depth == splitDepth)
+            {
+                lastElementEnd = p;
+            }
+            else if (depth == splitDepth - 1)
+            {
+                EndChunk(chunks);
+            }
+            if (depth < splitDepth)
+            {
+                declarations.resize(declarationCounts.back());
+                declarationCounts.pop_back();
+            }
+        }
+        else
+        {
+            if (depth == splitDepth)
+            {
+                if (chunkStart && lastElementEnd - chunkStart >= chunkSize)
+                {
+                    EndChunk(chunks);
+                }
+                if (!chunkStart)
+                {
+                    BeginChunk(tagStart);
+                }
+            }
+            if (depth < splitDepth)
+            {
+                declarationCounts.push_back(int(declarations.size()));
+                p = ScanNamespaceDeclarations(p);
+            }
+            else
+            {
+                p = SkipTag(p);
+            }
+            if (p && p[-2] == '/')
+            {
+                if (depth == splitDepth)
+                {
+                    lastElementEnd = p;
+                }
+                else if (depth < splitDepth)
+                {
+                    declarations.resize(declarationCounts.back());
+                    declarationCounts.pop_back();
+                }
+            }
+            else
+            {
+                ++depth;
+            }
+        }
+        if (!p || depth < 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void ChunkScanner::BeginChunk(const char32_t* tagStart)
+{
+    lineNumber += int(std::count(lineNumberPos, tagStart, '\n'));
+    lineNumberPos = tagStart;
+    chunkStart = tagStart;
+    lastElementEnd = tagStart;
+    chunk.start = tagStart;
+    chunk.lineNumber = lineNumber;
+    chunk.namespaces = declarations;
+}
+
+void ChunkScanner::EndChunk(std::vector<XmlChunk>& chunks)
+{
+    if (chunkStart && lastElementEnd - chunkStart >= minChunkSize)
+    {
+        chunk.end = lastElementEnd;
+        chunks.push_back(chunk);
+    }
+    chunkStart = nullptr;
+}
+
+const char32_t* ChunkScanner::SkipPast(const char32_t* p, const char32_t* terminator) const
+{
+    const char32_t* terminatorEnd = terminator + std::char_traits<char32_t>::length(terminator);
+    const char32_t* t = std::search(p, end, terminator, terminatorEnd);
+    if (t == end)
+    {
+        return nullptr;
+    }
+    return t + (terminatorEnd - terminator);
+}
+
+const char32_t* ChunkScanner::SkipTag(const char32_t* p) const
+{
+    while (p != end && *p != '>')
+    {
+        if (*p == '"' || *p == '\'')
+        {
+            p = std::find(p + 1, end, *p);
+            if (p == end)
+            {
+                return nullptr;
+            }
+        }
+        ++p;
+    }
+    if (p == end)
+    {
+        return nullptr;
+    }
+    return p + 1;
+}
+
+//  A document type declaration with an internal subset may declare entities, so the document is not split.
+
+const char32_t* ChunkScanner::SkipDocTypeDecl(const char32_t* p) const
+{
+    while (p != end && *p != '>')
+    {
+        if (*p == '[')
+        {
+            return nullptr;
+        }
+        if (*p == '"' || *p == '\'')
+        {
+            p = std::find(p + 1, end, *p);
+            if (p == end)
+            {
+                return nullptr;
+            }
+        }
+        ++p;
+    }
+    if (p == end)
+    {
+        return nullptr;
+    }
+    return p + 1;
+}
+
+//  Scans the start tag of an ancestor of the chunks for namespace declarations. A namespace URI with references is not supported.
+
+const char32_t* ChunkScanner::ScanNamespaceDeclarations(const char32_t* p)
+{
+    while (p != end && *p != '>' && *p != '/' && *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n')
+    {
+        ++p;
+    }
+    while (true)
+    {
+        while (p != end && (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n'))
+        {
+            ++p;
+        }
+        if (p == end)
+        {
+            return nullptr;
+        }
+        if (*p == '>')
+        {
+            return p + 1;
+        }
+        if (*p == '/')
+        {
+            return end - p >= 2 && p[1] == '>' ? p + 2 : nullptr;
+        }
+        const char32_t* nameStart = p;
+        while (p != end && *p != '=' && *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n')
+        {
+            ++p;
+        }
+        U32StringView name(nameStart, p);
+        while (p != end && (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n' || *p == '='))
+        {
+            ++p;
+        }
+        if (p == end || (*p != '"' && *p != '\''))
+        {
+            return nullptr;
+        }
+        const char32_t* valueStart = p + 1;
+        p = std::find(valueStart, end, *p);
+        if (p == end)
+        {
+            return nullptr;
+        }
+        U32StringView value(valueStart, p);
+        ++p;
+        if (name == U"xmlns" || (name.Length() > 6 && name.Substring(0, 6) == U"xmlns:"))
+        {
+            if (value.Find('&') != std::u32string::npos)
+            {
+                return nullptr;
+            }
+            NamespaceDeclaration declaration;
+            declaration.prefix = name.Length() > 6 ? name.Substring(6) : U32StringView();
+            declaration.namespaceUri = value;
+            declarations.push_back(declaration);
+        }
+    }
+}
+
+//  Records the events of a chunk for delivery in document order. Views into the content are kept as they are, other views are copied to a pool.
+//  The namespace URIs are interned strings of the processor of the chunk, so each of them is copied once.
+
+class XmlEventBuffer : public XmlViewHandler
+{
+public:
+    XmlEventBuffer(const char32_t* contentStart_, const char32_t* contentEnd_) : contentStart(contentStart_), contentEnd(contentEnd_)
+    {
+    }
+    void Text(const U32StringView& text) override
+    {
+        AddEvent(XmlEventKind::text, Ref(text));
+    }
+    void Comment(const U32StringView& comment) override
+    {
+        AddEvent(XmlEventKind::comment, Ref(comment));
+    }
+    void PI(const U32StringView& target, const U32StringView& data) override
+    {
+        AddEvent(XmlEventKind::pi, Ref(target), Ref(data));
+    }
+    void StartElement(const U32StringView& namespaceUri, const U32StringView& localName, const U32StringView& qualifiedName, const AttributeViews& attributeViews) override
+    {
+        Event& event = AddEvent(XmlEventKind::startElement, NamespaceUriRef(namespaceUri), Ref(localName), Ref(qualifiedName));
+        event.firstAttribute = int(attributes.size());
+        event.attributeCount = attributeViews.Count();
+        for (const AttributeView& attributeView : attributeViews)
+        {
+            Attribute attribute;
+            attribute.namespaceUri = NamespaceUriRef(attributeView.NamespaceUri());
+            attribute.localName = Ref(attributeView.LocalName());
+            attribute.qualifiedName = Ref(attributeView.QualifiedName());
+            attribute.value = Ref(attributeView.Value());
+            attributes.push_back(attribute);
+        }
+    }
+    void EndElement(const U32StringView& namespaceUri, const U32StringView& localName, const U32StringView& qualifiedName) override
+    {
+        AddEvent(XmlEventKind::endElement, NamespaceUriRef(namespaceUri), Ref(localName), Ref(qualifiedName));
+    }
+    void SkippedEntity(const U32StringView& entityName) override
+    {
+        AddEvent(XmlEventKind::skippedEntity, Ref(entityName));
+    }
+    //  A subtree whose skipping the handler requests is left out of the replay, except for the end element.
+    void Replay(XmlViewHandler* handler)
+    {
+        int skipDepth = 0;
+        for (const Event& event : events)
+        {
+            if (skipDepth > 0)
+            {
+                if (event.kind == XmlEventKind::startElement)
+                {
+                    ++skipDepth;
+                }
+                else if (event.kind == XmlEventKind::endElement)
+                {
+                    --skipDepth;
+                }
+                if (skipDepth > 0 || event.kind != XmlEventKind::endElement)
+                {
+                    continue;
+                }
+            }
+            switch (event.kind)
+            {
+                case XmlEventKind::text: handler->Text(View(event.first)); break;
+                case XmlEventKind::comment: handler->Comment(View(event.first)); break;
+                case XmlEventKind::pi: handler->PI(View(event.first), View(event.second)); break;
+                case XmlEventKind::skippedEntity: handler->SkippedEntity(View(event.first)); break;
+                case XmlEventKind::startElement:
+                {
+                    attributeViews.Clear();
+                    for (int i = event.firstAttribute; i < event.firstAttribute + event.attributeCount; ++i)
+                    {
+                        const Attribute& attribute = attributes[i];
+                        attributeViews.Add(AttributeView(View(attribute.namespaceUri), View(attribute.localName), View(attribute.qualifiedName), View(attribute.value)));
+                    }
+                    handler->StartElement(View(event.first), View(event.second), View(event.third), attributeViews);
+                    if (handler->TakeSkipSubtree())
+                    {
+                        skipDepth = 1;
+                    }
+                    break;
+                }
+                case XmlEventKind::endElement: handler->EndElement(View(event.first), View(event.second), View(event.third)); break;
+                default: break;
+            }
+        }
+    }
+private:
+    //  A text reference with null data refers to the pool.
+    struct TextRef
+    {
+        TextRef() : data(nullptr), poolOffset(0), length(0) {}
+        const char32_t* data;
+        size_t poolOffset;
+        size_t length;
+    };
+    struct Event
+    {
+        XmlEventKind kind;
+        TextRef first;
+        TextRef second;
+        TextRef third;
+        int firstAttribute;
+        int attributeCount;
+    };
+    struct Attribute
+    {
+        TextRef namespaceUri;
+        TextRef localName;
+        TextRef qualifiedName;
+        TextRef value;
+    };
+    const char32_t* contentStart;
+    const char32_t* contentEnd;
+    std::vector<Event> events;
+    std::vector<Attribute> attributes;
+    std::u32string pool;
+    std::unordered_map<const char32_t*, TextRef> namespaceUriRefs;
+    AttributeViews attributeViews;
+    Event& AddEvent(XmlEventKind kind, const TextRef& first = TextRef(), const TextRef& second = TextRef(), const TextRef& third = TextRef())
+    {
+        Event event;
+        event.kind = kind;
+        event.first = first;
+        event.second = second;
+        event.third = third;
+        event.firstAttribute = 0;
+        event.attributeCount = 0;
+        events.push_back(event);
+        return events.back();
+    }
+    TextRef Ref(const U32StringView& text)
+    {
+        TextRef ref;
+        ref.length = text.Length();
+        if (text.begin() >= contentStart && text.end() <= contentEnd)
+        {
+            ref.data = text.Data();
+        }
+        else
+        {
+            ref.poolOffset = pool.length();
+            pool.append(text.begin(), text.Length());
+        }
+        return ref;
+    }
+    TextRef NamespaceUriRef(const U32StringView& namespaceUri)
+    {
+        auto it = namespaceUriRefs.find(namespaceUri.Data());
+        if (it != namespaceUriRefs.cend())
+        {
+            return it->second;
+        }
+        TextRef ref = Ref(namespaceUri);
+        namespaceUriRefs[namespaceUri.Data()] = ref;
+        return ref;
+    }
+    U32StringView View(const TextRef& ref) const
+    {
+        const char32_t* data = ref.data ? ref.data : pool.c_str() + ref.poolOffset;
+        return U32StringView(data, data + ref.length);
+    }
+};
+
+//  The calling thread parses the document and takes the chunks in document order, waiting for the workers if needed.
+//  In ordered mode the workers parse at most a window of chunks ahead of the calling thread, which bounds the memory of the buffered events.
+
+class ParallelParser : public XmlChunkSource
+{
+public:
+    ParallelParser(const std::u32string& content, const std::string& systemId_, const XmlParallelOptions& options_, XmlViewHandler* viewHandler_,
+        std::vector<XmlChunk>&& chunks_);
+    ~ParallelParser();
+    void Start(int numThreads);
+    const char32_t* TakeChunk(const char32_t* tagStart) override;
+    void SkipChunks(const char32_t* skipEnd) override;
+    bool AllChunksTaken() const { return nextChunkToTake == int(chunks.size()); }
+private:
+    struct ChunkResult
+    {
+        ChunkResult() : done(false) {}
+        bool done;
+        std::exception_ptr error;
+        std::unique_ptr<XmlEventBuffer> events;
+    };
+    const char32_t* contentStart;
+    const char32_t* contentEnd;
+    std::string systemId;
+    XmlParallelOptions options;
+    XmlViewHandler* viewHandler;
+    XmlGrammar* grammar;
+    Rule* contentRule;
+    std::vector<XmlChunk> chunks;
+    std::vector<ChunkResult> results;
+    std::mutex mtx;
+    std::condition_variable chunkDone;
+    std::condition_variable windowOpen;
+    int window;
+    int nextChunkToParse;
+    int nextChunkToTake;
+    bool cancelled;
+    std::vector<std::thread> threads;
+    void Work();
+    std::unique_ptr<ParsingData> CreateParsingData() const;
+    void ParseChunk(const XmlChunk& chunk, XmlViewHandler* chunkHandler, ParsingData* parsingData);
+};
+
+ParallelParser::ParallelParser(const std::u32string& content, const std::string& systemId_, const XmlParallelOptions& options_, XmlViewHandler* viewHandler_,
+    std::vector<XmlChunk>&& chunks_) :
+    contentStart(content.c_str()), contentEnd(content.c_str() + content.length()), systemId(systemId_), options(options_), viewHandler(viewHandler_),
+    grammar(GetXmlGrammar()), contentRule(grammar->GetRule(U"Content")), chunks(std::move(chunks_)), results(chunks.size()), window(0), nextChunkToParse(0),
+    nextChunkToTake(0), cancelled(false)
+{
+}
+
+ParallelParser::~ParallelParser()
+{
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        cancelled = true;
+    }
+    windowOpen.notify_all();
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+void ParallelParser::Start(int numThreads)
+{
+    window = 4 * numThreads;
+    for (int i = 0; i < numThreads; ++i)
+    {
+        threads.push_back(std::thread(&ParallelParser::Work, this));
+    }
+}
+
+const char32_t* ParallelParser::TakeChunk(const char32_t* tagStart)
+{
+    if (nextChunkToTake == int(chunks.size()) || chunks[nextChunkToTake].start != tagStart)
+    {
+        return nullptr;
+    }
+    int index = nextChunkToTake;
+    ChunkResult result;
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        chunkDone.wait(lock, [this, index] { return results[index].done; });
+        result = std::move(results[index]);
+        ++nextChunkToTake;
+    }
+    windowOpen.notify_all();
+    if (result.events)
+    {
+        result.events->Replay(viewHandler);
+    }
+    if (result.error)
+    {
+        std::rethrow_exception(result.error);
+    }
+    return chunks[index].end;
+}
+
+//  The chunks in a subtree that the handler skips are not delivered, and those that no worker has started are not parsed at all.
+//  Errors in them are not reported either, as the sequential parse only balances the tags of skipped content.
+
+void ParallelParser::SkipChunks(const char32_t* skipEnd)
+{
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        while (nextChunkToTake < int(chunks.size()) && chunks[nextChunkToTake].start < skipEnd)
+        {
+            results[nextChunkToTake].events.reset();
+            ++nextChunkToTake;
+        }
+        nextChunkToParse = std::max(nextChunkToParse, nextChunkToTake);
+    }
+    windowOpen.notify_all();
+}
+
+void ParallelParser::Work()
+{
+    std::unique_ptr<ParsingData> parsingData = CreateParsingData();
+    while (true)
+    {
+        int index = 0;
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            windowOpen.wait(lock, [this] { return cancelled || nextChunkToParse == int(chunks.size()) || !options.ordered || nextChunkToParse < nextChunkToTake + window; });
+            if (cancelled || nextChunkToParse == int(chunks.size()))
+            {
+                return;
+            }
+            index = nextChunkToParse++;
+        }
+        ChunkResult result;
+        try
+        {
+            if (options.ordered)
+            {
+                result.events.reset(new XmlEventBuffer(contentStart, contentEnd));
+                result.events->SetCoalesceText(viewHandler->CoalesceText());
+                result.events->SetIgnoreWhitespaceText(viewHandler->IgnoreWhitespaceText());
+                ParseChunk(chunks[index], result.events.get(), parsingData.get());
+            }
+            else
+            {
+                ParseChunk(chunks[index], viewHandler, parsingData.get());
+            }
+        }
+        catch (...)
+        {
+            //  The events buffered before the error are kept, so that the handler receives them as in a sequential parse.
+            result.error = std::current_exception();
+            parsingData = CreateParsingData();
+        }
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            result.done = true;
+            results[index] = std::move(result);
+        }
+        chunkDone.notify_all();
+    }
+}
+
+std::unique_ptr<ParsingData> ParallelParser::CreateParsingData() const
+{
+    std::unique_ptr<ParsingData> parsingData(new ParsingData(grammar->GetParsingDomain()->GetNumRules()));
+    if (grammar->RulesPerSegment() > 0)
+    {
+        parsingData->SetStackSegmentation(grammar->RulesPerSegment(), grammar->SegmentSize());
+    }
+    return parsingData;
+}
+
+//  The chunk is parsed with the Content rule. The scanner starts at the chunk with the line number found by the pre-scan, so the spans and the error
+//  locations are those of the whole document. The splitDepth ancestors of the chunk count in its element depth.
+
+void ParallelParser::ParseChunk(const XmlChunk& chunk, XmlViewHandler* chunkHandler, ParsingData* parsingData)
+{
+    XmlProcessor processor(contentStart, chunk.end, chunkHandler);
+    processor.SetLimits(options.limits);
+    processor.SetBaseDepth(options.splitDepth);
+    parsingData->SetLimits(processor.GetParsingLimits());
+    for (const NamespaceDeclaration& declaration : chunk.namespaces)
+    {
+        processor.InheritNamespace(declaration.prefix, declaration.namespaceUri);
+    }
+    Scanner scanner(contentStart, chunk.end, systemId, 0, grammar->SkipRule());
+    int chunkStart = int(chunk.start - contentStart);
+    scanner.SetSpan(Span(0, chunk.lineNumber, chunkStart, chunkStart));
+    scanner.SetParsingData(parsingData);
+    ObjectStack stack;
+    PushValue<XmlProcessor*>(stack, &processor);
+    Match match = contentRule->Parse(scanner, stack, parsingData);
+    Span stop = scanner.GetSpan();
+    if (!match.Hit() || stop.Start() != int(chunk.end - contentStart))
+    {
+        throw ExpectationFailure(contentRule->Info(), systemId, stop, contentStart, contentEnd);
+    }
+}
+
+void ParseXmlContentParallel(const std::u32string& xmlContent, const std::string& systemId, const XmlParallelOptions& options, XmlViewHandler* viewHandler)
+{
+    XmlProcessor xmlProcessor(xmlContent.c_str(), xmlContent.c_str() + xmlContent.length(), viewHandler);
+    xmlProcessor.SetLimits(options.limits);
+    xmlProcessor.CheckDocumentSize(systemId);
+    int numThreads = options.numThreads > 0 ? options.numThreads : std::max(1, int(std::thread::hardware_concurrency()));
+    int64_t chunkSize = std::max(int64_t(options.minChunkSize), int64_t(xmlContent.length()) / (8 * numThreads));
+    std::vector<XmlChunk> chunks;
+    ChunkScanner chunkScanner(xmlContent.c_str(), xmlContent.c_str() + xmlContent.length(), options.splitDepth, chunkSize, options.minChunkSize);
+    if (numThreads == 1 || options.splitDepth < 1 || !chunkScanner.Scan(chunks) || chunks.size() < 2)
+    {
+        ParseXmlContent(xmlProcessor, systemId);
+        return;
+    }
+    ParallelParser parallelParser(xmlContent, systemId, options, viewHandler, std::move(chunks));
+    xmlProcessor.SetChunkSource(&parallelParser);
+    parallelParser.Start(numThreads);
+    ParseXmlContent(xmlProcessor, systemId);
+    if (!parallelParser.AllChunksTaken())
+    {
+        throw XmlProcessingException("error in '" + systemId + "': the document was not parsed as split by the pre-scan");
+    }
+}
+
+void ParseXmlContentParallel(const std::string& xmlContent, const std::string& systemId, const XmlParallelOptions& options, XmlViewHandler* viewHandler)
+{
+    CheckXmlDocumentSize(xmlContent.c_str(), xmlContent.c_str() + xmlContent.length(), options.limits, systemId);
+    ParseXmlContentParallel(ToUtf32(xmlContent), systemId, options, viewHandler);
+}
+
+void ParseXmlFileParallel(const std::string& xmlFileName, const XmlParallelOptions& options, XmlViewHandler* viewHandler)
+{
+    std::string xmlContent = ReadFile(xmlFileName);
+    CheckXmlDocumentSize(xmlContent.c_str(), xmlContent.c_str() + xmlContent.length(), options.limits, xmlFileName);
+    ParseXmlContentParallel(ToUtf32(xmlContent), xmlFileName, options, viewHandler);
+}
+
+} } // namespace soul::xml
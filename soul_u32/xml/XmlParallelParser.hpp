@@ -0,0 +1,53 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#ifndef SOUL_XML_XML_PARALLEL_PARSER
+#define SOUL_XML_XML_PARALLEL_PARSER
+#include <soul_u32/xml/XmlViewHandler.hpp>
+#include <string>
+
+namespace soul { namespace xml {
+
+class XmlLimits;
+
+//  ==================================================================================
+//  ParseXmlContentParallel parses a large document on several threads. A pre-scan
+//  finds the elements at split depth and groups runs of sibling elements to chunks.
+//  Worker threads parse the chunks with their own parsing data and processors that
+//  inherit the namespace declarations of the ancestors of the chunk, while the
+//  calling thread parses the rest of the document and skips the chunks.
+//
+//  In ordered mode the events of a chunk are buffered and delivered by the calling
+//  thread in document order, so the handler sees the same events as with
+//  ParseXmlContent, also up to an error in the document. Otherwise the workers
+//  deliver the events of the chunks directly: the handler must be thread safe, the
+//  events of each chunk come from one thread in document order, and SkipSubtree()
+//  is not supported.
+//
+//  Documents with an internal DTD subset, whose entities the workers would not know,
+//  and documents too small to split are parsed sequentially.
+//  ==================================================================================
+
+struct XmlParallelOptions
+{
+    XmlParallelOptions() : numThreads(0), splitDepth(1), minChunkSize(256 * 1024), ordered(true), limits(nullptr) {}
+    //  Number of worker threads. Zero means the number of hardware threads.
+    int numThreads;
+    //  Number of ancestors of the elements distributed to workers: 1 means the children of the document element.
+    int splitDepth;
+    //  Minimum number of characters in a chunk.
+    int minChunkSize;
+    bool ordered;
+    //  The limits of this parse, applied to the whole document and to every chunk. Null means no limits.
+    const XmlLimits* limits;
+};
+
+void ParseXmlContentParallel(const std::u32string& xmlContent, const std::string& systemId, const XmlParallelOptions& options, XmlViewHandler* viewHandler);
+void ParseXmlContentParallel(const std::string& xmlContent, const std::string& systemId, const XmlParallelOptions& options, XmlViewHandler* viewHandler);
+void ParseXmlFileParallel(const std::string& xmlFileName, const XmlParallelOptions& options, XmlViewHandler* viewHandler);
+
+} } // namespace soul::xml
+
+#endif // SOUL_XML_XML_PARALLEL_PARSER
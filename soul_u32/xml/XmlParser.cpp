@@ -5,37 +5,183 @@
 
 #include <soul_u32/xml/XmlParser.hpp>
 #include <soul_u32/xml/XmlGrammar.hpp>
+#include <soul_u32/parsing/Rule.hpp>
+#include <soul_u32/parsing/Exception.hpp>
 #include <soul_u32/util/Unicode.hpp>
 #include <soul_u32/util/MappedInputFile.hpp>
 
 namespace soul { namespace xml {
 
+using namespace soul::parsing;
 using namespace soul::util;
 using namespace soul::unicode;
 
 void ParseXmlFile(const std::string& xmlFileName, XmlContentHandler* contentHandler)
 {
-    std::string xmlContent = ReadFile(xmlFileName);
-    ParseXmlContent(xmlContent, xmlFileName, contentHandler);
+    ParseXmlFile(xmlFileName, nullptr, contentHandler);
 }
 
 void ParseXmlContent(const std::string& xmlContent, const std::string& systemId, XmlContentHandler* contentHandler)
 {
-    ParseXmlContent(ToUtf32(xmlContent), systemId, contentHandler);
+    ParseXmlContent(xmlContent, systemId, nullptr, contentHandler);
 }
 
-XmlGrammar* xmlGrammar = nullptr;
-
 void ParseXmlContent(const std::u32string& xmlContent, const std::string& systemId, XmlContentHandler* contentHandler)
 {
-    const char32_t* contentStart = &xmlContent[0];
-    const char32_t* contentEnd = &xmlContent[0] + xmlContent.length();
-    XmlProcessor xmlProcessor(contentStart, contentEnd, contentHandler);
-    if (xmlGrammar == nullptr)
+    ParseXmlContent(xmlContent, systemId, nullptr, contentHandler);
+}
+
+void ParseXmlFile(const std::string& xmlFileName, XmlViewHandler* viewHandler)
+{
+    ParseXmlFile(xmlFileName, nullptr, viewHandler);
+}
+
+void ParseXmlContent(const std::string& xmlContent, const std::string& systemId, XmlViewHandler* viewHandler)
+{
+    ParseXmlContent(xmlContent, systemId, nullptr, viewHandler);
+}
+
+void ParseXmlContent(const std::u32string& xmlContent, const std::string& systemId, XmlViewHandler* viewHandler)
+{
+    ParseXmlContent(xmlContent, systemId, nullptr, viewHandler);
+}
+
+void ParseXmlFile(const std::string& xmlFileName, const XmlLimits* limits, XmlContentHandler* contentHandler)
+{
+    std::string xmlContent = ReadFile(xmlFileName);
+    ParseXmlContent(xmlContent, xmlFileName, limits, contentHandler);
+}
+
+void ParseXmlContent(const std::string& xmlContent, const std::string& systemId, const XmlLimits* limits, XmlContentHandler* contentHandler)
+{
+    CheckXmlDocumentSize(xmlContent.c_str(), xmlContent.c_str() + xmlContent.length(), limits, systemId);
+    ParseXmlContent(ToUtf32(xmlContent), systemId, limits, contentHandler);
+}
+
+void ParseXmlContent(const std::u32string& xmlContent, const std::string& systemId, const XmlLimits* limits, XmlContentHandler* contentHandler)
+{
+    XmlProcessor xmlProcessor(xmlContent.c_str(), xmlContent.c_str() + xmlContent.length(), contentHandler);
+    xmlProcessor.SetLimits(limits);
+    ParseXmlContent(xmlProcessor, systemId);
+}
+
+void ParseXmlFile(const std::string& xmlFileName, const XmlLimits* limits, XmlViewHandler* viewHandler)
+{
+    std::string xmlContent = ReadFile(xmlFileName);
+    ParseXmlContent(xmlContent, xmlFileName, limits, viewHandler);
+}
+
+void ParseXmlContent(const std::string& xmlContent, const std::string& systemId, const XmlLimits* limits, XmlViewHandler* viewHandler)
+{
+    CheckXmlDocumentSize(xmlContent.c_str(), xmlContent.c_str() + xmlContent.length(), limits, systemId);
+    ParseXmlContent(ToUtf32(xmlContent), systemId, limits, viewHandler);
+}
+
+void ParseXmlContent(const std::u32string& xmlContent, const std::string& systemId, const XmlLimits* limits, XmlViewHandler* viewHandler)
+{
+    XmlProcessor xmlProcessor(xmlContent.c_str(), xmlContent.c_str() + xmlContent.length(), viewHandler);
+    xmlProcessor.SetLimits(limits);
+    ParseXmlContent(xmlProcessor, systemId);
+}
+
+XmlGrammar* GetXmlGrammar()
+{
+    static XmlGrammar* xmlGrammar = XmlGrammar::Create();
+    return xmlGrammar;
+}
+
+void ParseXmlContent(XmlProcessor& xmlProcessor, const std::string& systemId)
+{
+    xmlProcessor.CheckDocumentSize(systemId);
+    GetXmlGrammar()->Parse(xmlProcessor.ContentStart(), xmlProcessor.ContentEnd(), 0, systemId, xmlProcessor.GetParsingLimits(), &xmlProcessor);
+}
+
+void ParseXmlContent(XmlProcessor& xmlProcessor, const std::string& systemId, ParsingData* parsingData)
+{
+    xmlProcessor.CheckDocumentSize(systemId);
+    XmlGrammar* grammar = GetXmlGrammar();
+    const char32_t* start = xmlProcessor.ContentStart();
+    const char32_t* end = xmlProcessor.ContentEnd();
+    Scanner scanner(start, end, systemId, 0, grammar->SkipRule());
+    scanner.SetParsingData(parsingData);
+    ObjectStack stack;
+    PushValue<XmlProcessor*>(stack, &xmlProcessor);
+    Match match = grammar->Grammar::Parse(scanner, stack, parsingData, xmlProcessor.GetParsingLimits());
+    Span stop = scanner.GetSpan();
+    if (!match.Hit() || stop.Start() != int(end - start))
     {
-        xmlGrammar = XmlGrammar::Create();
+        throw ExpectationFailure(grammar->StartRule()->Info(), systemId, stop, start, end);
     }
-    xmlGrammar->Parse(contentStart, contentEnd, 0, systemId, &xmlProcessor);
+}
+
+void ParseXmlFile(const std::string& xmlFileName, const XmlPaths& paths, XmlContentHandler* contentHandler)
+{
+    ParseXmlFile(xmlFileName, paths, nullptr, contentHandler);
+}
+
+void ParseXmlContent(const std::string& xmlContent, const std::string& systemId, const XmlPaths& paths, XmlContentHandler* contentHandler)
+{
+    ParseXmlContent(xmlContent, systemId, paths, nullptr, contentHandler);
+}
+
+void ParseXmlContent(const std::u32string& xmlContent, const std::string& systemId, const XmlPaths& paths, XmlContentHandler* contentHandler)
+{
+    ParseXmlContent(xmlContent, systemId, paths, nullptr, contentHandler);
+}
+
+void ParseXmlFile(const std::string& xmlFileName, const XmlPaths& paths, XmlViewHandler* viewHandler)
+{
+    ParseXmlFile(xmlFileName, paths, nullptr, viewHandler);
+}
+
+void ParseXmlContent(const std::string& xmlContent, const std::string& systemId, const XmlPaths& paths, XmlViewHandler* viewHandler)
+{
+    ParseXmlContent(xmlContent, systemId, paths, nullptr, viewHandler);
+}
+
+void ParseXmlContent(const std::u32string& xmlContent, const std::string& systemId, const XmlPaths& paths, XmlViewHandler* viewHandler)
+{
+    ParseXmlContent(xmlContent, systemId, paths, nullptr, viewHandler);
+}
+
+void ParseXmlFile(const std::string& xmlFileName, const XmlPaths& paths, const XmlLimits* limits, XmlContentHandler* contentHandler)
+{
+    std::string xmlContent = ReadFile(xmlFileName);
+    ParseXmlContent(xmlContent, xmlFileName, paths, limits, contentHandler);
+}
+
+void ParseXmlContent(const std::string& xmlContent, const std::string& systemId, const XmlPaths& paths, const XmlLimits* limits, XmlContentHandler* contentHandler)
+{
+    CheckXmlDocumentSize(xmlContent.c_str(), xmlContent.c_str() + xmlContent.length(), limits, systemId);
+    ParseXmlContent(ToUtf32(xmlContent), systemId, paths, limits, contentHandler);
+}
+
+void ParseXmlContent(const std::u32string& xmlContent, const std::string& systemId, const XmlPaths& paths, const XmlLimits* limits, XmlContentHandler* contentHandler)
+{
+    XmlProcessor xmlProcessor(xmlContent.c_str(), xmlContent.c_str() + xmlContent.length(), contentHandler);
+    xmlProcessor.SetPaths(&paths);
+    xmlProcessor.SetLimits(limits);
+    ParseXmlContent(xmlProcessor, systemId);
+}
+
+void ParseXmlFile(const std::string& xmlFileName, const XmlPaths& paths, const XmlLimits* limits, XmlViewHandler* viewHandler)
+{
+    std::string xmlContent = ReadFile(xmlFileName);
+    ParseXmlContent(xmlContent, xmlFileName, paths, limits, viewHandler);
+}
+
+void ParseXmlContent(const std::string& xmlContent, const std::string& systemId, const XmlPaths& paths, const XmlLimits* limits, XmlViewHandler* viewHandler)
+{
+    CheckXmlDocumentSize(xmlContent.c_str(), xmlContent.c_str() + xmlContent.length(), limits, systemId);
+    ParseXmlContent(ToUtf32(xmlContent), systemId, paths, limits, viewHandler);
+}
+
+void ParseXmlContent(const std::u32string& xmlContent, const std::string& systemId, const XmlPaths& paths, const XmlLimits* limits, XmlViewHandler* viewHandler)
+{
+    XmlProcessor xmlProcessor(xmlContent.c_str(), xmlContent.c_str() + xmlContent.length(), viewHandler);
+    xmlProcessor.SetPaths(&paths);
+    xmlProcessor.SetLimits(limits);
+    ParseXmlContent(xmlProcessor, systemId);
 }
 
 } } // namespace soul::xml
@@ -11,9 +11,21 @@
 #ifndef SOUL_XML_XML_PARSER
 #define SOUL_XML_XML_PARSER
 #include <soul_u32/xml/XmlContentHandler.hpp>
+#include <soul_u32/xml/XmlViewHandler.hpp>
+#include <soul_u32/xml/XmlPaths.hpp>
+
+namespace soul { namespace parsing {
+
+class ParsingData;
+
+} } // namespace soul::parsing
 
 namespace soul { namespace xml {
 
+class XmlGrammar;
+class XmlProcessor;
+class XmlLimits;
+
 //  ==================================================================================
 //  ParseXmlFile parses given UTF-8 encoded XML file using given content handler.
 //  ==================================================================================
@@ -36,6 +48,58 @@ void ParseXmlContent(const std::string& xmlContent, const std::string& systemId,
 
 void ParseXmlContent(const std::u32string& xmlContent, const std::string& systemId, XmlContentHandler* contentHandler);
 
+//  ===================================================================================
+//  These overloads deliver the events to an XmlViewHandler. Names, values and text 
+//  are passed as views to the parsed content, so no strings are allocated for them
+//  unless they contain entity or character references.
+//  ===================================================================================
+
+void ParseXmlFile(const std::string& xmlFileName, XmlViewHandler* viewHandler);
+void ParseXmlContent(const std::string& xmlContent, const std::string& systemId, XmlViewHandler* viewHandler);
+void ParseXmlContent(const std::u32string& xmlContent, const std::string& systemId, XmlViewHandler* viewHandler);
+
+//  ===================================================================================
+//  These overloads apply given limits to the parse. The limits are not shared with 
+//  other parses, so concurrent parses can have different limits. Null limits means 
+//  no limits. The overloads without limits parse without them.
+//  ===================================================================================
+
+void ParseXmlFile(const std::string& xmlFileName, const XmlLimits* limits, XmlContentHandler* contentHandler);
+void ParseXmlContent(const std::string& xmlContent, const std::string& systemId, const XmlLimits* limits, XmlContentHandler* contentHandler);
+void ParseXmlContent(const std::u32string& xmlContent, const std::string& systemId, const XmlLimits* limits, XmlContentHandler* contentHandler);
+void ParseXmlFile(const std::string& xmlFileName, const XmlLimits* limits, XmlViewHandler* viewHandler);
+void ParseXmlContent(const std::string& xmlContent, const std::string& systemId, const XmlLimits* limits, XmlViewHandler* viewHandler);
+void ParseXmlContent(const std::u32string& xmlContent, const std::string& systemId, const XmlLimits* limits, XmlViewHandler* viewHandler);
+
+//  ===================================================================================
+//  These overloads deliver only the events selected by given paths. The subtrees in 
+//  which none of the paths can match are skipped without processing them. The 
+//  limits apply to the skipped subtrees too.
+//  ===================================================================================
+
+void ParseXmlFile(const std::string& xmlFileName, const XmlPaths& paths, XmlContentHandler* contentHandler);
+void ParseXmlContent(const std::string& xmlContent, const std::string& systemId, const XmlPaths& paths, XmlContentHandler* contentHandler);
+void ParseXmlContent(const std::u32string& xmlContent, const std::string& systemId, const XmlPaths& paths, XmlContentHandler* contentHandler);
+void ParseXmlFile(const std::string& xmlFileName, const XmlPaths& paths, XmlViewHandler* viewHandler);
+void ParseXmlContent(const std::string& xmlContent, const std::string& systemId, const XmlPaths& paths, XmlViewHandler* viewHandler);
+void ParseXmlContent(const std::u32string& xmlContent, const std::string& systemId, const XmlPaths& paths, XmlViewHandler* viewHandler);
+void ParseXmlFile(const std::string& xmlFileName, const XmlPaths& paths, const XmlLimits* limits, XmlContentHandler* contentHandler);
+void ParseXmlContent(const std::string& xmlContent, const std::string& systemId, const XmlPaths& paths, const XmlLimits* limits, XmlContentHandler* contentHandler);
+void ParseXmlContent(const std::u32string& xmlContent, const std::string& systemId, const XmlPaths& paths, const XmlLimits* limits, XmlContentHandler* contentHandler);
+void ParseXmlFile(const std::string& xmlFileName, const XmlPaths& paths, const XmlLimits* limits, XmlViewHandler* viewHandler);
+void ParseXmlContent(const std::string& xmlContent, const std::string& systemId, const XmlPaths& paths, const XmlLimits* limits, XmlViewHandler* viewHandler);
+void ParseXmlContent(const std::u32string& xmlContent, const std::string& systemId, const XmlPaths& paths, const XmlLimits* limits, XmlViewHandler* viewHandler);
+
+//  ===================================================================================
+//  The grammar is created on first use and shared by all parses. Concurrent parses
+//  are safe, because each of them has its own parsing data and processor. The
+//  parsing data can be reused from parse to parse: it is recreated after an error.
+//  ===================================================================================
+
+XmlGrammar* GetXmlGrammar();
+void ParseXmlContent(XmlProcessor& xmlProcessor, const std::string& systemId);
+void ParseXmlContent(XmlProcessor& xmlProcessor, const std::string& systemId, soul::parsing::ParsingData* parsingData);
+
 } } // namespace soul::xml
 
 #endif // SOUL_XML_XML_PARSER
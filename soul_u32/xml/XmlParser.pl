@@ -7,22 +7,22 @@ namespace soul.xml
         S;
         NameStartChar;
         NameChar;
-        Name: std::u32string;
+        Name: soul::util::U32StringView;
         Names;
         Nmtoken;
         Nmtokens;
         EntityValue(XmlProcessor* processor): std::u32string;
-        AttValue(XmlProcessor* processor): std::u32string;
-        SystemLiteral: std::u32string;
-        PubidLiteral: std::u32string;
+        AttValue(XmlProcessor* processor): soul::util::U32StringView;
+        SystemLiteral: soul::util::U32StringView;
+        PubidLiteral: soul::util::U32StringView;
         PubidChar;
         CharData(XmlProcessor* processor);
         Comment(XmlProcessor* processor);
         PI(XmlProcessor* processor);
-        PITarget: std::u32string;
+        PITarget: soul::util::U32StringView;
         CDSect(XmlProcessor* processor);
         CDStart;
-        CData: std::u32string;
+        CData: soul::util::U32StringView;
         CDEnd;
         Prolog(XmlProcessor* processor);
         XMLDecl(XmlProcessor* processor);
@@ -37,7 +37,9 @@ namespace soul.xml
         ExtSubset(XmlProcessor* processor);
         ExtSubsetDecl(XmlProcessor* processor);
         SDDecl(XmlProcessor* processor, var bool standalone);
-        Element(XmlProcessor* processor, var std::u32string tagName);
+        Element(XmlProcessor* processor, var soul::util::U32StringView tagName);
+        SkippedElement(XmlProcessor* processor);
+        SkippedContent(XmlProcessor* processor);
         Attribute(XmlProcessor* processor);
         ETag(XmlProcessor* processor);
         Content(XmlProcessor* processor);
@@ -76,7 +78,7 @@ namespace soul.xml
         TextDecl(XmlProcessor* processor);
         ExtParsedEnt(XmlProcessor* processor);
         EncodingDecl(XmlProcessor* processor);
-        EncName: std::u32string;
+        EncName: soul::util::U32StringView;
         NotationDecl(XmlProcessor* processor);
         PublicID;
     }
@@ -0,0 +1,113 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <soul_u32/xml/XmlPaths.hpp>
+#include <soul_u32/util/Unicode.hpp>
+#include <algorithm>
+#include <stdexcept>
+
+namespace soul { namespace xml {
+
+using namespace soul::unicode;
+
+XmlPaths::XmlPaths()
+{
+}
+
+void XmlPaths::Add(const std::u32string& path)
+{
+    std::vector<Step> pathSteps;
+    size_t pos = 0;
+    while (pos < path.length())
+    {
+        if (path[pos] != '/')
+        {
+            throw std::runtime_error("invalid XML path '" + ToUtf8(path) + "': '/' expected at position " + std::to_string(pos));
+        }
+        Step step;
+        ++pos;
+        if (pos < path.length() && path[pos] == '/')
+        {
+            step.descendant = true;
+            ++pos;
+        }
+        bool attribute = pos < path.length() && path[pos] == '@';
+        if (attribute)
+        {
+            ++pos;
+        }
+        size_t nameEnd = path.find_first_of(U"/@", pos);
+        if (nameEnd == std::u32string::npos)
+        {
+            nameEnd = path.length();
+        }
+        std::u32string name = path.substr(pos, nameEnd - pos);
+        if (name.empty())
+        {
+            throw std::runtime_error("invalid XML path '" + ToUtf8(path) + "': name expected at position " + std::to_string(pos));
+        }
+        pos = nameEnd;
+        if (attribute)
+        {
+            if (pathSteps.empty() || step.descendant || pos != path.length())
+            {
+                throw std::runtime_error("invalid XML path '" + ToUtf8(path) + "': attribute step must be the last step and follow an element step with a single '/'");
+            }
+            pathSteps.back().attribute = name;
+        }
+        else
+        {
+            if (name != U"*")
+            {
+                step.name = name;
+            }
+            pathSteps.push_back(step);
+        }
+    }
+    if (pathSteps.empty())
+    {
+        throw std::runtime_error("invalid XML path '" + ToUtf8(path) + "': path is empty");
+    }
+    pathSteps.back().last = true;
+    initialStates.push_back(int(steps.size()));
+    steps.insert(steps.end(), pathSteps.begin(), pathSteps.end());
+}
+
+//  A state is the index of the step to match next. A descendant step stays active in the subtree, so its state is inherited by the child states.
+
+bool XmlPaths::Next(const U32StringView& elementName, std::vector<int>& states, int begin, int end, std::vector<U32StringView>& selectedAttributes) const
+{
+    bool elementMatch = false;
+    for (int i = begin; i < end; ++i)
+    {
+        int state = states[i];
+        const Step& step = steps[state];
+        if (step.descendant && std::find(states.begin() + end, states.end(), state) == states.end())
+        {
+            states.push_back(state);
+        }
+        if (step.name.empty() || elementName == U32StringView(step.name))
+        {
+            if (!step.last)
+            {
+                if (std::find(states.begin() + end, states.end(), state + 1) == states.end())
+                {
+                    states.push_back(state + 1);
+                }
+            }
+            else if (step.attribute.empty())
+            {
+                elementMatch = true;
+            }
+            else
+            {
+                selectedAttributes.push_back(U32StringView(step.attribute));
+            }
+        }
+    }
+    return elementMatch;
+}
+
+} } // namespace soul::xml
@@ -0,0 +1,60 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#ifndef SOUL_XML_XML_PATHS
+#define SOUL_XML_XML_PATHS
+#include <soul_u32/util/StringView.hpp>
+#include <string>
+#include <vector>
+
+namespace soul { namespace xml {
+
+using soul::util::U32StringView;
+
+//  ==================================================================================
+//  XmlPaths selects the events that the parser delivers to a handler. A path is a
+//  sequence of steps: '/name' selects a child element and '//name' a descendant
+//  element, '*' matches any element name, and an optional last step '/@name' or
+//  '/@*' selects attributes. Names are compared to qualified names. For example:
+//
+//      /feed/entry/title       the title elements of the entries of a feed
+//      //item/@id              the id attributes of all item elements
+//
+//  An element matched by an element path is delivered with its whole content.
+//  An element matched only by attribute paths is delivered with just the selected
+//  attributes, and only if it has one of them. Nothing else is delivered, and the
+//  parser skips the subtrees in which no path can match.
+//
+//  The paths compile to a nondeterministic automaton whose state is a position in
+//  a path. The parser keeps the set of states for each open element.
+//  ==================================================================================
+
+class XmlPaths
+{
+public:
+    XmlPaths();
+    //  Throws std::runtime_error if the path is invalid.
+    void Add(const std::u32string& path);
+    bool IsEmpty() const { return initialStates.empty(); }
+    const std::vector<int>& InitialStates() const { return initialStates; }
+    //  Appends to states the states reached from states[begin, end) by an element with given name: states.size() must be end.
+    //  Returns true if the element matches an element path. The names of the attributes selected for it are added to selectedAttributes.
+    bool Next(const U32StringView& elementName, std::vector<int>& states, int begin, int end, std::vector<U32StringView>& selectedAttributes) const;
+private:
+    struct Step
+    {
+        Step() : descendant(false), last(false) {}
+        std::u32string name;
+        bool descendant;
+        bool last;
+        std::u32string attribute;
+    };
+    std::vector<Step> steps;
+    std::vector<int> initialStates;
+};
+
+} } // namespace soul::xml
+
+#endif // SOUL_XML_XML_PATHS
@@ -4,8 +4,9 @@
 // =================================
 
 #include <soul_u32/xml/XmlProcessor.hpp>
-#include <soul_u32/util/Util.hpp>
 #include <soul_u32/util/Unicode.hpp>
+#include <algorithm>
+#include <limits>
 
 namespace soul { namespace xml {
 
@@ -16,6 +17,48 @@ XmlProcessingException::XmlProcessingException(const std::string& message_) : st
 {
 }
 
+std::string XmlLimitStr(XmlLimit limit)
+{
+    switch (limit)
+    {
+        case XmlLimit::none: return "no limit exceeded";
+        case XmlLimit::documentSize: return "document size limit exceeded";
+        case XmlLimit::elementDepth: return "element depth limit exceeded";
+        case XmlLimit::attributes: return "attribute count limit exceeded";
+        case XmlLimit::attributeValueLength: return "attribute value length limit exceeded";
+    }
+    return "";
+}
+
+XmlLimits::XmlLimits() : maxDocumentSize(0), maxElementDepth(0), maxAttributes(0), maxAttributeValueLength(0), parsingLimits(nullptr)
+{
+}
+
+XmlLimitExceeded::XmlLimitExceeded(XmlLimit limit_, const std::string& message) : XmlProcessingException(message), limit(limit_)
+{
+}
+
+[[noreturn]] void ThrowDocumentSizeExceeded(int64_t size, int64_t maxSize, const std::string& systemId)
+{
+    throw XmlLimitExceeded(XmlLimit::documentSize, "error in '" + systemId + "': " + XmlLimitStr(XmlLimit::documentSize) + " (" + std::to_string(size) + 
+        " characters, the limit is " + std::to_string(maxSize) + ")");
+}
+
+//  A UTF-8 encoded character has at least as many bytes as characters, so the bytes that are not continuation bytes are counted only when the content may be too large.
+
+void CheckXmlDocumentSize(const char* contentStart, const char* contentEnd, const XmlLimits* limits, const std::string& systemId)
+{
+    if (!limits || limits->MaxDocumentSize() <= 0 || contentEnd - contentStart <= limits->MaxDocumentSize())
+    {
+        return;
+    }
+    int64_t size = std::count_if(contentStart, contentEnd, [](char c) { return (static_cast<unsigned char>(c) & 0xC0) != 0x80; });
+    if (size > limits->MaxDocumentSize())
+    {
+        ThrowDocumentSizeExceeded(size, limits->MaxDocumentSize(), systemId);
+    }
+}
+
 Entity::~Entity()
 {
 }
@@ -24,136 +67,531 @@ InternalEntity::InternalEntity(const std::u32string& value_) : value(value_)
 {
 }
 
+//  Passes the events of the processor to an XmlContentHandler by copying the views to strings.
+//  The strings and the attributes are reused from event to event, so their memory is allocated only when they grow.
+
+class ContentHandlerAdapter : public XmlViewHandler
+{
+public:
+    ContentHandlerAdapter(XmlContentHandler* contentHandler_) : contentHandler(contentHandler_)
+    {
+        SetCoalesceText(contentHandler->CoalesceText());
+        SetIgnoreWhitespaceText(contentHandler->IgnoreWhitespaceText());
+    }
+    void StartDocument() override
+    {
+        contentHandler->StartDocument();
+    }
+    void EndDocument() override
+    {
+        contentHandler->EndDocument();
+    }
+    void Version(const U32StringView& xmlVersion) override
+    {
+        contentHandler->Version(Copy(xmlVersion, first));
+    }
+    void Standalone(bool standalone) override
+    {
+        contentHandler->Standalone(standalone);
+    }
+    void Encoding(const U32StringView& encoding) override
+    {
+        contentHandler->Encoding(Copy(encoding, first));
+    }
+    void Text(const U32StringView& text) override
+    {
+        contentHandler->Text(Copy(text, first));
+    }
+    void Comment(const U32StringView& comment) override
+    {
+        contentHandler->Comment(Copy(comment, first));
+    }
+    void PI(const U32StringView& target, const U32StringView& data) override
+    {
+        contentHandler->PI(Copy(target, first), Copy(data, second));
+    }
+    void StartElement(const U32StringView& namespaceUri, const U32StringView& localName, const U32StringView& qualifiedName, const AttributeViews& attributeViews) override
+    {
+        attributes.Clear();
+        for (const AttributeView& attribute : attributeViews)
+        {
+            attributes.Add(attribute.NamespaceUri(), attribute.LocalName(), attribute.QualifiedName(), attribute.Value());
+        }
+        contentHandler->StartElement(Copy(namespaceUri, first), Copy(localName, second), Copy(qualifiedName, third), attributes);
+        if (contentHandler->TakeSkipSubtree())
+        {
+            SkipSubtree();
+        }
+    }
+    void EndElement(const U32StringView& namespaceUri, const U32StringView& localName, const U32StringView& qualifiedName) override
+    {
+        contentHandler->EndElement(Copy(namespaceUri, first), Copy(localName, second), Copy(qualifiedName, third));
+    }
+    void SkippedEntity(const U32StringView& entityName) override
+    {
+        contentHandler->SkippedEntity(Copy(entityName, first));
+    }
+private:
+    XmlContentHandler* contentHandler;
+    Attributes attributes;
+    std::u32string first;
+    std::u32string second;
+    std::u32string third;
+    static const std::u32string& Copy(const U32StringView& view, std::u32string& s)
+    {
+        s.assign(view.begin(), view.end());
+        return s;
+    }
+};
+
+StringTable::StringTable()
+{
+    Intern(U32StringView());
+}
+
+int StringTable::Intern(const U32StringView& s)
+{
+    auto it = idMap.find(s);
+    if (it != idMap.cend())
+    {
+        return it->second;
+    }
+    int id = int(strings.size());
+    strings.push_back(s.ToString());
+    idMap[U32StringView(strings.back())] = id;
+    return id;
+}
+
+void StringTable::Clear()
+{
+    strings.clear();
+    idMap.clear();
+    Intern(U32StringView());
+}
+
+int StringTable::Find(const U32StringView& s) const
+{
+    auto it = idMap.find(s);
+    if (it != idMap.cend())
+    {
+        return it->second;
+    }
+    return -1;
+}
+
+XmlChunkSource::~XmlChunkSource()
+{
+}
+
 XmlProcessor::XmlProcessor(const char32_t* contentStart_, const char32_t* contentEnd_, XmlContentHandler* contentHandler_) : 
-    contentStart(contentStart_), contentEnd(contentEnd_), contentHandler(contentHandler_), attValue(nullptr)
+    XmlProcessor(contentStart_, contentEnd_, static_cast<XmlViewHandler*>(nullptr))
 {
-    entityMap[U"quot"] = std::unique_ptr<Entity>(new InternalEntity(U"\""));
-    entityMap[U"amp"] = std::unique_ptr<Entity>(new InternalEntity(U"&"));
-    entityMap[U"apos"] = std::unique_ptr<Entity>(new InternalEntity(U"'"));
-    entityMap[U"lt"] = std::unique_ptr<Entity>(new InternalEntity(U"<"));
-    entityMap[U"gt"] = std::unique_ptr<Entity>(new InternalEntity(U">"));
+    contentHandlerAdapter.reset(new ContentHandlerAdapter(contentHandler_));
+    viewHandler = contentHandlerAdapter.get();
+}
+
+XmlProcessor::XmlProcessor(const char32_t* contentStart_, const char32_t* contentEnd_, XmlViewHandler* viewHandler_) :
+    contentStart(contentStart_), contentEnd(contentEnd_), viewHandler(viewHandler_), inAttributeValue(false), attValueStart(nullptr), attValueEnd(nullptr), 
+    decodedAttValue(nullptr), numDecodedAttValues(0), defaultNamespaceId(0), 
+    skippingSubtree(false), skippingElement(false), skipEnd(nullptr), paths(nullptr), selectedDepth(0), 
+    chunkSource(nullptr), chunkEnd(nullptr), textBuffered(false), textRunDelivered(false), limits(nullptr), baseDepth(0), maxElementDepth(0), maxAttributes(0), 
+    maxAttributeValueLength(0), numAttributes(0)
+{
+    SetLimits(nullptr);
+    AddEntity(U"quot", U"\"");
+    AddEntity(U"amp", U"&");
+    AddEntity(U"apos", U"'");
+    AddEntity(U"lt", U"<");
+    AddEntity(U"gt", U">");
+    BindPrefix(U"xml", U"http://www.w3.org/XML/1998/namespace");
+}
+
+XmlProcessor::~XmlProcessor()
+{
+}
+
+//  The interned strings are cleared when there are many of them, so that a processor reused for many documents does not grow without bound.
+
+const int maxRetainedStrings = 1024;
+
+void XmlProcessor::Reset(const char32_t* contentStart_, const char32_t* contentEnd_, XmlViewHandler* viewHandler_)
+{
+    contentStart = contentStart_;
+    contentEnd = contentEnd_;
+    viewHandler = viewHandler_;
+    inAttributeValue = false;
+    attValueStart = nullptr;
+    attValueEnd = nullptr;
+    decodedAttValue = nullptr;
+    numDecodedAttValues = 0;
+    scopeStack.clear();
+    bindingStack.clear();
+    if (namespaceUris.Count() > maxRetainedStrings || prefixes.Count() > maxRetainedStrings)
+    {
+        namespaceUris.Clear();
+        prefixes.Clear();
+        prefixNamespaceIds.clear();
+    }
+    std::fill(prefixNamespaceIds.begin(), prefixNamespaceIds.end(), -1);
+    BindPrefix(U"xml", U"http://www.w3.org/XML/1998/namespace");
+    defaultNamespaceId = 0;
+    pendingAttributes.clear();
+    attributes.Clear();
+    skippingSubtree = false;
+    skippingElement = false;
+    skipEnd = nullptr;
+    skippedTags.clear();
+    paths = nullptr;
+    pathStates.clear();
+    selectedAttributes.clear();
+    selectedDepth = 0;
+    chunkSource = nullptr;
+    chunkEnd = nullptr;
+    heldText = U32StringView();
+    textBuffered = false;
+    textRunDelivered = false;
+    baseDepth = 0;
+    SetLimits(nullptr);
+    numAttributes = 0;
+}
+
+void XmlProcessor::SetPaths(const XmlPaths* paths_)
+{
+    paths = paths_;
+    pathStates = paths->InitialStates();
+}
+
+void XmlProcessor::SetLimits(const XmlLimits* limits_)
+{
+    limits = limits_;
+    maxElementDepth = limits && limits->MaxElementDepth() > 0 ? limits->MaxElementDepth() - baseDepth : std::numeric_limits<int>::max();
+    maxAttributes = limits && limits->MaxAttributes() > 0 ? limits->MaxAttributes() : std::numeric_limits<int>::max();
+    maxAttributeValueLength = limits && limits->MaxAttributeValueLength() > 0 ? limits->MaxAttributeValueLength() : std::numeric_limits<int>::max();
+}
+
+void XmlProcessor::SetBaseDepth(int baseDepth_)
+{
+    baseDepth = baseDepth_;
+    SetLimits(limits);
+}
+
+void XmlProcessor::CheckDocumentSize(const std::string& systemId) const
+{
+    if (limits && limits->MaxDocumentSize() > 0 && contentEnd - contentStart > limits->MaxDocumentSize())
+    {
+        ThrowDocumentSizeExceeded(contentEnd - contentStart, limits->MaxDocumentSize(), systemId);
+    }
 }
 
 void XmlProcessor::StartDocument()
 {
-    contentHandler->StartDocument();
+    viewHandler->StartDocument();
 }
 
 void XmlProcessor::EndDocument()
 {
-    contentHandler->EndDocument();
+    FlushText(false);
+    viewHandler->EndDocument();
 }
 
-void XmlProcessor::Text(const std::u32string& text)
+void XmlProcessor::Text(const U32StringView& text)
 {
-    contentHandler->Text(text);
+    AddText(text, true);
 }
 
-void XmlProcessor::Comment(const std::u32string& text)
+inline bool IsWhitespace(const U32StringView& text)
 {
-    contentHandler->Comment(text);
+    for (char32_t c : text)
+    {
+        if (c != ' ' && c != '\t' && c != '\n' && c != '\r')
+        {
+            return false;
+        }
+    }
+    return true;
 }
 
-void XmlProcessor::PI(const std::u32string& target, const std::u32string& data)
+//  Without text options each piece of text is delivered as it is parsed. Otherwise the pieces are held until the next markup: all of them when 
+//  coalescing, and the leading whitespace-only pieces when only leaving whitespace-only text out. A piece that is not stable, such as a character 
+//  reference, is copied when held.
+
+void XmlProcessor::AddText(const U32StringView& text, bool stable)
 {
-    contentHandler->PI(target, data);
+    if (!Delivering())
+    {
+        return;
+    }
+    if (!viewHandler->CoalesceText() && (!viewHandler->IgnoreWhitespaceText() || textRunDelivered || !IsWhitespace(text)))
+    {
+        FlushText(true);
+        textRunDelivered = true;
+        viewHandler->Text(text);
+    }
+    else if (textBuffered)
+    {
+        textBuffer.append(text.begin(), text.end());
+    }
+    else if (heldText.IsEmpty() && stable)
+    {
+        heldText = text;
+    }
+    else
+    {
+        textBuffer.assign(heldText.begin(), heldText.end());
+        textBuffer.append(text.begin(), text.end());
+        heldText = U32StringView();
+        textBuffered = true;
+    }
 }
 
-void XmlProcessor::Version(const std::u32string& version)
+void XmlProcessor::FlushText(bool keepWhitespace)
 {
-    contentHandler->Version(version);
+    if (heldText.IsEmpty() && !textBuffered)
+    {
+        textRunDelivered = false;
+        return;
+    }
+    U32StringView text = textBuffered ? U32StringView(textBuffer) : heldText;
+    bool ignore = viewHandler->IgnoreWhitespaceText() && !textRunDelivered && !keepWhitespace && IsWhitespace(text);
+    heldText = U32StringView();
+    textBuffered = false;
+    textRunDelivered = false;
+    if (!ignore)
+    {
+        viewHandler->Text(text);
+    }
+}
+
+void XmlProcessor::Comment(const U32StringView& text)
+{
+    FlushText(false);
+    if (!scopeStack.empty())
+    {
+        scopeStack.back().hasChildren = true;
+    }
+    if (Delivering())
+    {
+        viewHandler->Comment(text);
+    }
+}
+
+void XmlProcessor::PI(const U32StringView& target, const U32StringView& data)
+{
+    FlushText(false);
+    if (!scopeStack.empty())
+    {
+        scopeStack.back().hasChildren = true;
+    }
+    if (Delivering())
+    {
+        viewHandler->PI(target, data);
+    }
+}
+
+void XmlProcessor::Version(const U32StringView& version)
+{
+    viewHandler->Version(version);
 }
 
 void XmlProcessor::Standalone(bool standalone)
 {
-    contentHandler->Standalone(standalone);
+    viewHandler->Standalone(standalone);
 }
 
-void XmlProcessor::Encoding(const std::u32string& encoding)
+void XmlProcessor::Encoding(const U32StringView& encoding)
 {
-    contentHandler->Encoding(encoding);
+    viewHandler->Encoding(encoding);
 }
 
-void XmlProcessor::BeginStartTag(const std::u32string& tagName)
+void XmlProcessor::BeginStartTag(const U32StringView& tagName)
 {
-    tagStack.push(currentTagName);
-    currentTagName = tagName;
-    namespaceUriStack.push(currentNamespaceUri);
-    namespacePrefixStack.push(currentNamespacePrefix);
-    attributes.Clear();
+    FlushText(false);
+    numAttributes = 0;
+    if (!scopeStack.empty())
+    {
+        scopeStack.back().hasChildren = true;
+    }
+    ElementScope scope;
+    scope.qualifiedName = tagName;
+    scope.namespaceId = 0;
+    scope.prevDefaultNamespaceId = defaultNamespaceId;
+    scope.numBindings = int(bindingStack.size());
+    scope.pathStateStart = int(pathStates.size());
+    scope.selected = false;
+    scope.attributesOnly = false;
+    scope.delivered = true;
+    scope.hasChildren = false;
+    scopeStack.push_back(scope);
+    pendingAttributes.clear();
+    numDecodedAttValues = 0;
+    if (chunkSource)
+    {
+        chunkEnd = chunkSource->TakeChunk(tagName.Data() - 1);
+        if (chunkEnd)
+        {
+            skippingElement = true;
+            return;
+        }
+    }
+    if (!Delivering())
+    {
+        SelectElement(scopeStack.back());
+    }
 }
 
+//  Runs the path automaton for an element outside the selected subtrees. 
+//  An element that is not selected, and in whose subtree no path can match, is skipped as a whole including its attributes.
+//  An element that has only selected attributes is delivered with them, but its content is skipped unless a path can match in it.
+
+void XmlProcessor::SelectElement(ElementScope& scope)
+{
+    int parentStateStart = scopeStack.size() > 1 ? scopeStack[scopeStack.size() - 2].pathStateStart : 0;
+    selectedAttributes.clear();
+    scope.selected = paths->Next(scope.qualifiedName, pathStates, parentStateStart, scope.pathStateStart, selectedAttributes);
+    scope.attributesOnly = !scope.selected && !selectedAttributes.empty();
+    scope.delivered = scope.selected || scope.attributesOnly;
+    bool pathsInSubtree = int(pathStates.size()) > scope.pathStateStart;
+    if (scope.selected)
+    {
+        ++selectedDepth;
+    }
+    else if (!pathsInSubtree)
+    {
+        if (scope.attributesOnly)
+        {
+            skippingSubtree = true;
+        }
+        else
+        {
+            skippingElement = true;
+        }
+    }
+}
+
+bool XmlProcessor::IsSelectedAttribute(const U32StringView& qualifiedName) const
+{
+    for (const U32StringView& selectedAttribute : selectedAttributes)
+    {
+        if (selectedAttribute == qualifiedName || selectedAttribute == U"*")
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//  The namespace declarations of a start tag apply to the element and all its attributes, so the names are resolved only after all the attributes have been seen.
+
 void XmlProcessor::EndStartTag(const soul::parsing::Span& span, const std::string& systemId)
 {
-    std::u32string localName;
-    std::u32string prefix;
-    ParseQualifiedName(currentTagName, localName, prefix, span, systemId);
+    ElementScope& scope = scopeStack.back();
+    if (!scope.delivered)
+    {
+        return;
+    }
+    U32StringView prefix;
+    ParseQualifiedName(scope.qualifiedName, scope.localName, prefix, span, systemId);
     if (prefix == U"xmlns")
     {
         throw XmlProcessingException(GetErrorLocationStr(systemId, span) + ": 'xmlns' prefix cannot be declared for an element");
     }
-    contentHandler->StartElement(GetNamespaceUri(prefix, span, systemId), localName, currentTagName, attributes);
+    scope.namespaceId = prefix.IsEmpty() ? defaultNamespaceId : ResolvePrefix(prefix, span, systemId);
+    attributes.Clear();
+    for (const PendingAttribute& attribute : pendingAttributes)
+    {
+        if (scope.attributesOnly && !IsSelectedAttribute(attribute.qualifiedName))
+        {
+            continue;
+        }
+        int attributeNamespaceId = attribute.prefix.IsEmpty() ? 0 : ResolvePrefix(attribute.prefix, attribute.span, systemId);
+        attributes.Add(AttributeView(namespaceUris.Get(attributeNamespaceId), attribute.localName, attribute.qualifiedName, attribute.value));
+    }
+    if (scope.attributesOnly && attributes.Count() == 0)
+    {
+        scope.delivered = false;
+        return;
+    }
+    viewHandler->StartElement(namespaceUris.Get(scope.namespaceId), scope.localName, scope.qualifiedName, attributes);
+    if (viewHandler->TakeSkipSubtree())
+    {
+        skippingSubtree = true;
+    }
 }
 
-void XmlProcessor::EndTag(const std::u32string& tagName, const soul::parsing::Span& span, const std::string& systemId)
+void XmlProcessor::EndTag(const U32StringView& tagName, const soul::parsing::Span& span, const std::string& systemId)
 {
-    if (tagStack.empty())
+    if (scopeStack.empty())
     {
-        throw XmlProcessingException(GetErrorLocationStr(systemId, span) + ": end tag '" + ToUtf8(tagName) + "' has no corresponding start tag");
+        throw XmlProcessingException(GetErrorLocationStr(systemId, span) + ": end tag '" + ToUtf8(tagName.ToString()) + "' has no corresponding start tag");
     }
-    if (tagName != currentTagName)
+    const ElementScope& scope = scopeStack.back();
+    if (tagName != scope.qualifiedName)
     {
-        throw XmlProcessingException(GetErrorLocationStr(systemId, span) + ": end tag '" + ToUtf8(tagName) + "' does not match start tag '" + ToUtf8(currentTagName) + "'");
+        throw XmlProcessingException(GetErrorLocationStr(systemId, span) + ": end tag '" + ToUtf8(tagName.ToString()) + "' does not match start tag '" + ToUtf8(scope.qualifiedName.ToString()) + "'");
     }
-    std::u32string localName;
-    std::u32string prefix;
-    ParseQualifiedName(currentTagName, localName, prefix, span, systemId);
-    if (prefix == U"xmlns")
+    skippingSubtree = false;
+    FlushText(!scope.hasChildren);
+    if (scope.delivered)
     {
-        throw XmlProcessingException(GetErrorLocationStr(systemId, span) + ": 'xmlns' prefix cannot be declared for an element");
+        viewHandler->EndElement(namespaceUris.Get(scope.namespaceId), scope.localName, scope.qualifiedName);
     }
-    contentHandler->EndElement(GetNamespaceUri(prefix, span, systemId), localName, currentTagName);
-    if (namespaceUriStack.empty())
+    PopScope();
+}
+
+void XmlProcessor::PopScope()
+{
+    const ElementScope& scope = scopeStack.back();
+    if (scope.selected)
     {
-        throw std::runtime_error("namespace URI stack is empty");
+        --selectedDepth;
     }
-    currentNamespaceUri = namespaceUriStack.top();
-    namespaceUriStack.pop();
-    namespacePrefixMap.erase(currentNamespacePrefix);
-    if (namespacePrefixStack.empty())
+    pathStates.resize(scope.pathStateStart);
+    while (int(bindingStack.size()) > scope.numBindings)
     {
-        throw std::runtime_error("namespace prefix stack is empty");
+        const NamespaceBinding& binding = bindingStack.back();
+        prefixNamespaceIds[binding.prefixId] = binding.prevNamespaceId;
+        bindingStack.pop_back();
     }
-    currentNamespacePrefix = namespacePrefixStack.top();
-    namespacePrefixStack.pop();
-    namespacePrefixMap[currentNamespacePrefix] = currentNamespaceUri;
-    currentTagName = tagStack.top();
-    tagStack.pop();
+    defaultNamespaceId = scope.prevDefaultNamespaceId;
+    scopeStack.pop_back();
 }
 
-void XmlProcessor::AddAttribute(const std::u32string& attName, const std::u32string& attValue, const soul::parsing::Span& span, const std::string& systemId)
+void XmlProcessor::AddAttribute(const U32StringView& attName, const U32StringView& attValue, const soul::parsing::Span& span, const std::string& systemId)
 {
-    std::u32string localName;
-    std::u32string prefix;
+    if (++numAttributes > maxAttributes)
+    {
+        throw XmlLimitExceeded(XmlLimit::attributes, GetErrorLocationStr(systemId, span) + ": " + XmlLimitStr(XmlLimit::attributes) + " (more than " + 
+            std::to_string(maxAttributes) + " attributes in a start tag)");
+    }
+    if (attValue.Length() > size_t(maxAttributeValueLength))
+    {
+        throw XmlLimitExceeded(XmlLimit::attributeValueLength, GetErrorLocationStr(systemId, span) + ": " + XmlLimitStr(XmlLimit::attributeValueLength) + 
+            " (attribute '" + ToUtf8(attName.ToString()) + "' has " + std::to_string(attValue.Length()) + " characters, the limit is " + std::to_string(maxAttributeValueLength) + ")");
+    }
+    U32StringView localName;
+    U32StringView prefix;
     ParseQualifiedName(attName, localName, prefix, span, systemId);
     if (prefix == U"xmlns")
     {
-        currentNamespacePrefix = localName;
-        currentNamespaceUri = attValue;
-        namespacePrefixMap[currentNamespacePrefix] = currentNamespaceUri;
+        BindPrefix(localName, attValue);
     }
-    else if (localName == U"xmlns")
+    else if (prefix.IsEmpty() && localName == U"xmlns")
     {
-        currentNamespacePrefix.clear();
-        currentNamespaceUri = attValue;
+        defaultNamespaceId = namespaceUris.Intern(attValue);
     }
     else
     {
-        attributes.Add(Attribute(GetNamespaceUri(prefix, span, systemId), localName, attName, attValue));
+        PendingAttribute attribute;
+        attribute.qualifiedName = attName;
+        attribute.localName = localName;
+        attribute.prefix = prefix;
+        attribute.value = attValue;
+        attribute.span = span;
+        pendingAttributes.push_back(attribute);
     }
 }
 
-void XmlProcessor::EntityRef(const std::u32string& entityName, const soul::parsing::Span& span, const std::string& systemId)
+void XmlProcessor::EntityRef(const U32StringView& entityName, const soul::parsing::Span& span, const std::string& systemId)
 {
     auto it = entityMap.find(entityName);
     if (it != entityMap.cend())
@@ -163,76 +601,343 @@ void XmlProcessor::EntityRef(const std::u32string& entityName, const soul::parsi
         {
             InternalEntity* internalEntity = static_cast<InternalEntity*>(entity.get());
             const std::u32string& entityValue = internalEntity->Value();
-            if (attValue)
+            if (inAttributeValue)
             {
-                attValue->append(entityValue);
+                AppendAttributeValue(entityValue);
             }
             else
             {
                 Text(entityValue);
             }
         }
-        else
+        else if (Delivering())
         {
-            contentHandler->SkippedEntity(entityName);
+            FlushText(true);
+            viewHandler->SkippedEntity(entityName);
         }
     }
+    else if (Delivering())
+    {
+        FlushText(true);
+        viewHandler->SkippedEntity(entityName);
+    }
+}
+
+void XmlProcessor::CharRef(char32_t c)
+{
+    U32StringView text(&c, &c + 1);
+    if (inAttributeValue)
+    {
+        AppendAttributeValue(text);
+    }
     else
     {
-        contentHandler->SkippedEntity(entityName);
+        AddText(text, false);
     }
 }
 
-void XmlProcessor::BeginAttributeValue(std::u32string* attValue_)
+//  An attribute value is a view to the content until a reference is found in it.
+//  From then on the value is decoded to a buffer that is kept until the next start tag.
+
+void XmlProcessor::BeginAttributeValue()
 {
-    attValueStack.push(attValue);
-    attValue = attValue_;
+    inAttributeValue = true;
+    attValueStart = nullptr;
+    attValueEnd = nullptr;
+    decodedAttValue = nullptr;
+}
+
+void XmlProcessor::AttributeValueChars(const char32_t* matchBegin, const char32_t* matchEnd)
+{
+    if (decodedAttValue)
+    {
+        decodedAttValue->append(matchBegin, matchEnd);
+    }
+    else
+    {
+        if (!attValueStart)
+        {
+            attValueStart = matchBegin;
+        }
+        attValueEnd = matchEnd;
+    }
 }
 
-void XmlProcessor::EndAttributeValue()
+void XmlProcessor::AppendAttributeValue(const U32StringView& text)
 {
-    if (attValueStack.empty())
+    if (!decodedAttValue)
     {
-        throw std::runtime_error("attribute value stack is empty");
+        if (numDecodedAttValues == int(decodedAttValues.size()))
+        {
+            decodedAttValues.push_back(std::u32string());
+        }
+        decodedAttValue = &decodedAttValues[numDecodedAttValues++];
+        decodedAttValue->assign(attValueStart, attValueEnd);
     }
-    attValue = attValueStack.top();
-    attValueStack.pop();
+    decodedAttValue->append(text.begin(), text.end());
 }
 
-std::u32string XmlProcessor::GetNamespaceUri(const std::u32string& namespacePrefix, const soul::parsing::Span& span, const std::string& systemId)
+U32StringView XmlProcessor::EndAttributeValue()
 {
-    if (namespacePrefix.empty())
+    inAttributeValue = false;
+    if (decodedAttValue)
     {
-        return currentNamespaceUri;
+        return U32StringView(*decodedAttValue);
     }
-    auto it = namespacePrefixMap.find(namespacePrefix);
-    if (it != namespacePrefixMap.cend())
+    return U32StringView(attValueStart, attValueEnd);
+}
+
+//  When the content of an element is skipped, BeginSkip scans the content up to the end tag of the element with a lightweight scanner.
+//  The scanner only balances the tags and skips comments, CDATA sections and processing instructions, so that the markup in them is not mistaken for tags.
+//  The SkippedContent rule then consumes the scanned content without any further processing, and the ETag rule parses the end tag.
+
+bool XmlProcessor::BeginSkip(const char32_t* skipStart, const soul::parsing::Span& span, const std::string& systemId)
+{
+    if (!skippingSubtree)
     {
-        return it->second;
+        return false;
     }
-    else
+    skipEnd = SkipContent(skipStart, skipStart, span, systemId);
+    if (chunkSource)
+    {
+        chunkSource->SkipChunks(skipEnd);
+    }
+    return true;
+}
+
+//  When a whole element is skipped, BeginSkipElement scans the rest of its start tag, its content and its end tag. The SkippedElement rule consumes them.
+
+bool XmlProcessor::BeginSkipElement(const char32_t* skipStart, const soul::parsing::Span& span, const std::string& systemId)
+{
+    CheckElementDepth(span, systemId);
+    if (!skippingElement)
+    {
+        return false;
+    }
+    if (chunkEnd)
+    {
+        skipEnd = chunkEnd;
+        chunkEnd = nullptr;
+        return true;
+    }
+    const char32_t* p = SkipTag(skipStart, skipStart, span, systemId);
+    if (p[-2] != '/')
+    {
+        const char32_t* endTagStart = SkipContent(p, skipStart, span, systemId);
+        p = SkipTag(endTagStart + 2, skipStart, span, systemId);
+        const char32_t* nameEnd = endTagStart + 2;
+        while (*nameEnd != '>' && *nameEnd != ' ' && *nameEnd != '\t' && *nameEnd != '\r' && *nameEnd != '\n')
+        {
+            ++nameEnd;
+        }
+        U32StringView tagName(endTagStart + 2, nameEnd);
+        if (tagName != scopeStack.back().qualifiedName)
+        {
+            SkipError("end tag '" + ToUtf8(tagName.ToString()) + "' does not match start tag '" + ToUtf8(scopeStack.back().qualifiedName.ToString()) + "'", endTagStart, 
+                skipStart, span, systemId);
+        }
+    }
+    skipEnd = p;
+    if (chunkSource)
+    {
+        chunkSource->SkipChunks(skipEnd);
+    }
+    return true;
+}
+
+void XmlProcessor::EndSkippedElement()
+{
+    skippingElement = false;
+    PopScope();
+}
+
+//  Returns the start of the end tag that closes the content beginning at p.
+
+const char32_t* XmlProcessor::SkipContent(const char32_t* p, const char32_t* skipStart, const soul::parsing::Span& span, const std::string& systemId)
+{
+    skippedTags.clear();
+    while (true)
     {
-        throw XmlProcessingException(GetErrorLocationStr(systemId, span) + ": namespace prefix '" + ToUtf8(namespacePrefix) + "' not bound to any namespace URI");
+        p = std::find(p, contentEnd, '<');
+        if (p == contentEnd)
+        {
+            SkipError("end tag of element '" + ToUtf8(scopeStack.back().qualifiedName.ToString()) + "' not found", p, skipStart, span, systemId);
+        }
+        const char32_t* tagStart = p;
+        ++p;
+        if (p != contentEnd && *p == '!')
+        {
+            const char32_t* cdataStart = U"[CDATA[";
+            if (contentEnd - p > 2 && p[1] == '-' && p[2] == '-')
+            {
+                p = SkipPast(p + 3, U"-->", skipStart, span, systemId);
+            }
+            else if (contentEnd - p > 7 && std::equal(cdataStart, cdataStart + 7, p + 1))
+            {
+                p = SkipPast(p + 8, U"]]>", skipStart, span, systemId);
+            }
+            else
+            {
+                SkipError("invalid markup", tagStart, skipStart, span, systemId);
+            }
+        }
+        else if (p != contentEnd && *p == '?')
+        {
+            p = SkipPast(p + 1, U"?>", skipStart, span, systemId);
+        }
+        else
+        {
+            bool endTag = p != contentEnd && *p == '/';
+            if (endTag)
+            {
+                if (skippedTags.empty())
+                {
+                    return tagStart;
+                }
+                ++p;
+            }
+            const char32_t* nameStart = p;
+            while (p != contentEnd && *p != '>' && *p != '/' && *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n')
+            {
+                ++p;
+            }
+            U32StringView tagName(nameStart, p);
+            if (tagName.IsEmpty())
+            {
+                SkipError("invalid tag", tagStart, skipStart, span, systemId);
+            }
+            p = SkipTag(p, skipStart, span, systemId);
+            if (endTag)
+            {
+                if (tagName != skippedTags.back())
+                {
+                    SkipError("end tag '" + ToUtf8(tagName.ToString()) + "' does not match start tag '" + ToUtf8(skippedTags.back().ToString()) + "'", tagStart, 
+                        skipStart, span, systemId);
+                }
+                skippedTags.pop_back();
+            }
+            else
+            {
+                CheckSkippedElementDepth(int(skippedTags.size()), SkipSpan(tagStart, skipStart, span), systemId);
+                if (p[-2] != '/')
+                {
+                    skippedTags.push_back(tagName);
+                }
+            }
+        }
     }
 }
 
-void XmlProcessor::ParseQualifiedName(const std::u32string& qualifiedName, std::u32string& localName, std::u32string& prefix, const soul::parsing::Span& span, const std::string& systemId)
+//  Returns the position after the '>' that ends the tag, skipping quoted attribute values.
+
+const char32_t* XmlProcessor::SkipTag(const char32_t* p, const char32_t* skipStart, const soul::parsing::Span& span, const std::string& systemId) const
 {
-    std::vector<std::u32string> parts = Split(qualifiedName, ':');
-    if (parts.size() > 2)
+    const char32_t* tagStart = p;
+    while (p != contentEnd && *p != '>')
     {
-        throw XmlProcessingException(GetErrorLocationStr(systemId, span) + ": qualified name '" + ToUtf8(qualifiedName) + "' has more than one ':' character");
+        if (*p == '"' || *p == '\'')
+        {
+            p = std::find(p + 1, contentEnd, *p);
+            if (p == contentEnd)
+            {
+                break;
+            }
+        }
+        ++p;
     }
-    else if (parts.size() == 2)
+    if (p == contentEnd)
     {
-        prefix = parts[0];
-        localName = parts[1];
+        SkipError("unterminated tag", tagStart, skipStart, span, systemId);
+    }
+    return p + 1;
+}
+
+const char32_t* XmlProcessor::SkipPast(const char32_t* p, const char32_t* terminator, const char32_t* skipStart, const soul::parsing::Span& span, const std::string& systemId) const
+{
+    const char32_t* terminatorEnd = terminator + std::char_traits<char32_t>::length(terminator);
+    const char32_t* t = std::search(p, contentEnd, terminator, terminatorEnd);
+    if (t == contentEnd)
+    {
+        SkipError("'" + ToUtf8(terminator) + "' not found", p, skipStart, span, systemId);
+    }
+    return t + (terminatorEnd - terminator);
+}
+
+void XmlProcessor::ThrowElementDepthExceeded(const soul::parsing::Span& span, const std::string& systemId) const
+{
+    throw XmlLimitExceeded(XmlLimit::elementDepth, GetErrorLocationStr(systemId, span) + ": " + XmlLimitStr(XmlLimit::elementDepth) + " (the limit is " + 
+        std::to_string(maxElementDepth + baseDepth) + ")");
+}
+
+soul::parsing::Span XmlProcessor::SkipSpan(const char32_t* p, const char32_t* skipStart, const soul::parsing::Span& span) const
+{
+    int lineNumber = span.LineNumber() + int(std::count(skipStart, p, '\n'));
+    return soul::parsing::Span(span.FileIndex(), lineNumber, span.Start() + int32_t(p - skipStart));
+}
+
+void XmlProcessor::SkipError(const std::string& message, const char32_t* p, const char32_t* skipStart, const soul::parsing::Span& span, const std::string& systemId) const
+{
+    throw XmlProcessingException(GetErrorLocationStr(systemId, SkipSpan(p, skipStart, span)) + ": " + message);
+}
+
+void XmlProcessor::BindPrefix(const U32StringView& prefix, const U32StringView& namespaceUri)
+{
+    int prefixId = prefixes.Intern(prefix);
+    if (prefixId >= int(prefixNamespaceIds.size()))
+    {
+        prefixNamespaceIds.resize(prefixId + 1, -1);
+    }
+    NamespaceBinding binding;
+    binding.prefixId = prefixId;
+    binding.prevNamespaceId = prefixNamespaceIds[prefixId];
+    bindingStack.push_back(binding);
+    prefixNamespaceIds[prefixId] = namespaceUris.Intern(namespaceUri);
+}
+
+void XmlProcessor::InheritNamespace(const U32StringView& prefix, const U32StringView& namespaceUri)
+{
+    if (prefix.IsEmpty())
+    {
+        defaultNamespaceId = namespaceUris.Intern(namespaceUri);
     }
     else
     {
-        prefix.clear();
+        BindPrefix(prefix, namespaceUri);
+    }
+}
+
+int XmlProcessor::ResolvePrefix(const U32StringView& prefix, const soul::parsing::Span& span, const std::string& systemId)
+{
+    int prefixId = prefixes.Find(prefix);
+    if (prefixId != -1 && prefixNamespaceIds[prefixId] != -1)
+    {
+        return prefixNamespaceIds[prefixId];
+    }
+    throw XmlProcessingException(GetErrorLocationStr(systemId, span) + ": namespace prefix '" + ToUtf8(prefix.ToString()) + "' not bound to any namespace URI");
+}
+
+void XmlProcessor::AddEntity(const char32_t* name, const char32_t* value)
+{
+    entityMap[U32StringView(name)] = std::unique_ptr<Entity>(new InternalEntity(value));
+}
+
+void XmlProcessor::ParseQualifiedName(const U32StringView& qualifiedName, U32StringView& localName, U32StringView& prefix, const soul::parsing::Span& span, const std::string& systemId)
+{
+    size_t colonPos = qualifiedName.Find(':');
+    if (colonPos == std::u32string::npos)
+    {
+        prefix = U32StringView();
         localName = qualifiedName;
     }
+    else
+    {
+        localName = qualifiedName.Substring(colonPos + 1);
+        if (localName.Find(':') != std::u32string::npos)
+        {
+            throw XmlProcessingException(GetErrorLocationStr(systemId, span) + ": qualified name '" + ToUtf8(qualifiedName.ToString()) + "' has more than one ':' character");
+        }
+        prefix = qualifiedName.Substring(0, colonPos);
+    }
 }
 
 int XmlProcessor::GetErrorColumn(int index) const
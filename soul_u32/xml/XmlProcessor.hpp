@@ -6,11 +6,16 @@
 #ifndef SOUL_XML_XML_PROCESSOR
 #define SOUL_XML_XML_PROCESSOR
 #include <soul_u32/xml/XmlContentHandler.hpp>
+#include <soul_u32/xml/XmlViewHandler.hpp>
+#include <soul_u32/xml/XmlPaths.hpp>
 #include <soul_u32/parsing/Scanner.hpp>
+#include <deque>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 #include <string>
 #include <stdexcept>
+#include <stdint.h>
 
 namespace soul { namespace xml {
 
@@ -20,6 +25,53 @@ public:
     XmlProcessingException(const std::string& message);
 };
 
+enum class XmlLimit : uint8_t
+{
+    none, documentSize, elementDepth, attributes, attributeValueLength
+};
+
+std::string XmlLimitStr(XmlLimit limit);
+
+//  XmlLimits puts bounds on the memory that a parse of an untrusted document can use. Zero value means unlimited.
+//  Sizes and lengths are counted in characters. Namespace declarations count as attributes. The time of a parse is bounded by the parsing limits, if they are set.
+
+class XmlLimits
+{
+public:
+    XmlLimits();
+    int64_t MaxDocumentSize() const { return maxDocumentSize; }
+    void SetMaxDocumentSize(int64_t maxDocumentSize_) { maxDocumentSize = maxDocumentSize_; }
+    int MaxElementDepth() const { return maxElementDepth; }
+    void SetMaxElementDepth(int maxElementDepth_) { maxElementDepth = maxElementDepth_; }
+    int MaxAttributes() const { return maxAttributes; }
+    void SetMaxAttributes(int maxAttributes_) { maxAttributes = maxAttributes_; }
+    int MaxAttributeValueLength() const { return maxAttributeValueLength; }
+    void SetMaxAttributeValueLength(int maxAttributeValueLength_) { maxAttributeValueLength = maxAttributeValueLength_; }
+    //  Steps, deadline, rule nesting depth and cancellation of the grammar parse.
+    const soul::parsing::ParsingLimits* GetParsingLimits() const { return parsingLimits; }
+    void SetParsingLimits(const soul::parsing::ParsingLimits* parsingLimits_) { parsingLimits = parsingLimits_; }
+private:
+    int64_t maxDocumentSize;
+    int maxElementDepth;
+    int maxAttributes;
+    int maxAttributeValueLength;
+    const soul::parsing::ParsingLimits* parsingLimits;
+};
+
+class XmlLimitExceeded : public XmlProcessingException
+{
+public:
+    XmlLimitExceeded(XmlLimit limit_, const std::string& message);
+    XmlLimit Limit() const { return limit; }
+private:
+    XmlLimit limit;
+};
+
+//  Checks the document size limit for UTF-8 encoded content before it is decoded. The characters are counted only if there are more bytes than the limit.
+//  Null limits means no limits.
+
+void CheckXmlDocumentSize(const char* contentStart, const char* contentEnd, const XmlLimits* limits, const std::string& systemId);
+
 class Entity
 {
 public:
@@ -37,46 +89,175 @@ private:
     std::u32string value;
 };
 
+//  StringTable interns strings such as namespace URIs, prefixes or names: each distinct string is stored once and identified by an integer id.
+//  Id 0 is the empty string. The strings do not move, so views to them stay valid for the lifetime of the table.
+
+class StringTable
+{
+public:
+    StringTable();
+    int Intern(const U32StringView& s);
+    void Clear();
+    int Find(const U32StringView& s) const;
+    U32StringView Get(int id) const { return U32StringView(strings[id]); }
+    int Count() const { return int(strings.size()); }
+private:
+    std::deque<std::u32string> strings;
+    std::unordered_map<U32StringView, int, soul::util::U32StringViewHash> idMap;
+};
+
+//  A chunk source lets other processors parse ranges of sibling elements concurrently, see ParseXmlContentParallel.
+
+class XmlChunkSource
+{
+public:
+    virtual ~XmlChunkSource();
+    //  Called for each start tag: if a chunk starts at the tag, delivers the events of the chunk and returns the end of the chunk, otherwise returns nullptr.
+    virtual const char32_t* TakeChunk(const char32_t* tagStart) = 0;
+    //  Called when the processor skips content up to skipEnd: the chunks in the skipped content are discarded without delivering their events.
+    virtual void SkipChunks(const char32_t* skipEnd) = 0;
+};
+
 class XmlProcessor
 {
 public:
     XmlProcessor(const char32_t* contentStart_, const char32_t* contentEnd_, XmlContentHandler* contentHandler_);
+    XmlProcessor(const char32_t* contentStart_, const char32_t* contentEnd_, XmlViewHandler* viewHandler_);
+    ~XmlProcessor();
+    //  Prepares the processor for parsing another content, keeping its buffers and interned strings for reuse.
+    void Reset(const char32_t* contentStart_, const char32_t* contentEnd_, XmlViewHandler* viewHandler_);
+    //  Delivers only the events selected by the paths to the handler.
+    void SetPaths(const XmlPaths* paths_);
+    //  The processor skips the chunks of the source and lets it deliver their events.
+    void SetChunkSource(XmlChunkSource* chunkSource_) { chunkSource = chunkSource_; }
+    //  Limits apply to one parse: the processor has no limits until they are set, and Reset() clears them. Null means no limits.
+    void SetLimits(const XmlLimits* limits_);
+    const soul::parsing::ParsingLimits* GetParsingLimits() const { return limits ? limits->GetParsingLimits() : nullptr; }
+    //  The number of ancestors of the content that the processor does not see, for the element depth limit. Used for content that is parsed out of its context.
+    void SetBaseDepth(int baseDepth_);
+    void CheckDocumentSize(const std::string& systemId) const;
+    //  Binds a namespace prefix, or the default namespace if the prefix is empty, for the whole content. Used for content that is parsed out of its context.
+    void InheritNamespace(const U32StringView& prefix, const U32StringView& namespaceUri);
     const char32_t* ContentStart() const { return contentStart; }
     const char32_t* ContentEnd() const { return contentEnd; }
     void StartDocument();
     void EndDocument();
-    void Text(const std::u32string& text);
-    void Comment(const std::u32string& text);
-    void PI(const std::u32string& target, const std::u32string& data);
-    void Version(const std::u32string& version);
+    void Text(const U32StringView& text);
+    void Comment(const U32StringView& text);
+    void PI(const U32StringView& target, const U32StringView& data);
+    void Version(const U32StringView& version);
     void Standalone(bool standalone);
-    void Encoding(const std::u32string& encoding);
-    void BeginStartTag(const std::u32string& tagName);
+    void Encoding(const U32StringView& encoding);
+    void BeginStartTag(const U32StringView& tagName);
     void EndStartTag(const soul::parsing::Span& span, const std::string& systemId);
-    void EndTag(const std::u32string& tagName, const soul::parsing::Span& span, const std::string& systemId);
-    void AddAttribute(const std::u32string& attName, const std::u32string& attValue, const soul::parsing::Span& span, const std::string& systemId);
-    void EntityRef(const std::u32string& entityName, const soul::parsing::Span& span, const std::string& systemId);
-    void BeginAttributeValue(std::u32string* attValue_);
-    void EndAttributeValue();
+    void EndTag(const U32StringView& tagName, const soul::parsing::Span& span, const std::string& systemId);
+    void AddAttribute(const U32StringView& attName, const U32StringView& attValue, const soul::parsing::Span& span, const std::string& systemId);
+    void EntityRef(const U32StringView& entityName, const soul::parsing::Span& span, const std::string& systemId);
+    void CharRef(char32_t c);
+    void BeginAttributeValue();
+    void AttributeValueChars(const char32_t* matchBegin, const char32_t* matchEnd);
+    U32StringView EndAttributeValue();
+    bool BeginSkip(const char32_t* skipStart, const soul::parsing::Span& span, const std::string& systemId);
+    bool BeginSkipElement(const char32_t* skipStart, const soul::parsing::Span& span, const std::string& systemId);
+    void EndSkippedElement();
+    bool InSkippedContent(const char32_t* p) const { return p < skipEnd; }
+    //  Called for each element after BeginStartTag.
+    void CheckElementDepth(const soul::parsing::Span& span, const std::string& systemId) const { if (int(scopeStack.size()) > maxElementDepth) ThrowElementDepthExceeded(span, systemId); }
+    //  Called for each start tag inside a skipped subtree, numSkippedElements being the number of open elements in the subtree.
+    void CheckSkippedElementDepth(int numSkippedElements, const soul::parsing::Span& span, const std::string& systemId) const 
+    { 
+        if (int(scopeStack.size()) + numSkippedElements >= maxElementDepth) ThrowElementDepthExceeded(span, systemId); 
+    }
+    std::string GetErrorLocationStr(const std::string& systemId, const soul::parsing::Span& span) const;
 private:
     const char32_t* contentStart;
     const char32_t* contentEnd;
-    XmlContentHandler* contentHandler;
-    std::stack<std::u32string> tagStack;
-    std::u32string currentTagName;
-    std::stack<std::u32string*> attValueStack;
-    std::u32string* attValue;
-    std::stack<std::u32string> namespaceUriStack;
-    std::u32string currentNamespaceUri;
-    std::stack<std::u32string> namespacePrefixStack;
-    std::u32string currentNamespacePrefix;
-    std::unordered_map<std::u32string, std::u32string> namespacePrefixMap;
-    Attributes attributes;
-    std::unordered_map<std::u32string, std::unique_ptr<Entity>> entityMap;
+    std::unique_ptr<XmlViewHandler> contentHandlerAdapter;
+    XmlViewHandler* viewHandler;
+    bool inAttributeValue;
+    const char32_t* attValueStart;
+    const char32_t* attValueEnd;
+    std::u32string* decodedAttValue;
+    std::deque<std::u32string> decodedAttValues;
+    int numDecodedAttValues;
+    //  Each open element has a scope. The namespace declarations of the element are pushed to the binding stack and popped by its end tag.
+    struct ElementScope
+    {
+        U32StringView qualifiedName;
+        U32StringView localName;
+        int namespaceId;
+        int prevDefaultNamespaceId;
+        int numBindings;
+        int pathStateStart;
+        bool selected;
+        bool attributesOnly;
+        bool delivered;
+        bool hasChildren;
+    };
+    struct NamespaceBinding
+    {
+        int prefixId;
+        int prevNamespaceId;
+    };
+    struct PendingAttribute
+    {
+        U32StringView qualifiedName;
+        U32StringView localName;
+        U32StringView prefix;
+        U32StringView value;
+        soul::parsing::Span span;
+    };
+    std::vector<ElementScope> scopeStack;
+    std::vector<NamespaceBinding> bindingStack;
+    StringTable namespaceUris;
+    StringTable prefixes;
+    std::vector<int> prefixNamespaceIds;
+    int defaultNamespaceId;
+    std::vector<PendingAttribute> pendingAttributes;
+    AttributeViews attributes;
+    bool skippingSubtree;
+    bool skippingElement;
+    const char32_t* skipEnd;
+    std::vector<U32StringView> skippedTags;
+    //  The path states of the open elements are kept in one vector: the states of an element start at the pathStateStart of its scope.
+    const XmlPaths* paths;
+    std::vector<int> pathStates;
+    std::vector<U32StringView> selectedAttributes;
+    int selectedDepth;
+    bool Delivering() const { return !paths || selectedDepth > 0; }
+    XmlChunkSource* chunkSource;
+    const char32_t* chunkEnd;
+    //  When the handler wants text coalesced or whitespace-only text left out, text is held until the next markup.
+    //  A single piece of text is held as a view, more pieces are copied to the text buffer.
+    U32StringView heldText;
+    std::u32string textBuffer;
+    bool textBuffered;
+    bool textRunDelivered;
+    std::unordered_map<U32StringView, std::unique_ptr<Entity>, soul::util::U32StringViewHash> entityMap;
+    //  The limits are copied to counters that are compared without a null check: an unlimited value is the maximum of the type.
+    const XmlLimits* limits;
+    int baseDepth;
+    int maxElementDepth;
+    int maxAttributes;
+    int maxAttributeValueLength;
+    int numAttributes;
     int GetErrorColumn(int index) const;
-    std::string GetErrorLocationStr(const std::string& systemId, const soul::parsing::Span& span) const;
-    void ParseQualifiedName(const std::u32string& qualifiedName, std::u32string& localName, std::u32string& prefix, const soul::parsing::Span& span, const std::string& systemId);
-    std::u32string GetNamespaceUri(const std::u32string& namespacePrefix, const soul::parsing::Span& span, const std::string& systemId);
+    void ParseQualifiedName(const U32StringView& qualifiedName, U32StringView& localName, U32StringView& prefix, const soul::parsing::Span& span, const std::string& systemId);
+    void BindPrefix(const U32StringView& prefix, const U32StringView& namespaceUri);
+    int ResolvePrefix(const U32StringView& prefix, const soul::parsing::Span& span, const std::string& systemId);
+    void AppendAttributeValue(const U32StringView& text);
+    void AddText(const U32StringView& text, bool stable);
+    void FlushText(bool keepWhitespace);
+    void AddEntity(const char32_t* name, const char32_t* value);
+    void SelectElement(ElementScope& scope);
+    bool IsSelectedAttribute(const U32StringView& qualifiedName) const;
+    void PopScope();
+    const char32_t* SkipContent(const char32_t* p, const char32_t* skipStart, const soul::parsing::Span& span, const std::string& systemId);
+    const char32_t* SkipTag(const char32_t* p, const char32_t* skipStart, const soul::parsing::Span& span, const std::string& systemId) const;
+    const char32_t* SkipPast(const char32_t* p, const char32_t* terminator, const char32_t* skipStart, const soul::parsing::Span& span, const std::string& systemId) const;
+    soul::parsing::Span SkipSpan(const char32_t* p, const char32_t* skipStart, const soul::parsing::Span& span) const;
+    [[noreturn]] void ThrowElementDepthExceeded(const soul::parsing::Span& span, const std::string& systemId) const;
+    [[noreturn]] void SkipError(const std::string& message, const char32_t* p, const char32_t* skipStart, const soul::parsing::Span& span, const std::string& systemId) const;
 };
 
 } } // namespace soul::xml
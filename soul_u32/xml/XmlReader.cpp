@@ -0,0 +1,857 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <soul_u32/xml/XmlReader.hpp>
+#include <soul_u32/util/Unicode.hpp>
+#include <algorithm>
+
+namespace soul { namespace xml {
+
+using namespace soul::unicode;
+
+const size_t decodeChunkSize = 64 * 1024;
+
+inline bool IsSpace(char32_t c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+inline bool IsRestrictedChar(char32_t c)
+{
+    return (c >= 0x1 && c <= 0x8) || c == 0xB || c == 0xC || (c >= 0xE && c <= 0x1F);
+}
+
+inline bool IsNameStartChar(char32_t c)
+{
+    if (c < 0x80)
+    {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || c == ':';
+    }
+    return (c >= 0xC0 && c <= 0xD6) || (c >= 0xD8 && c <= 0xF6) || (c >= 0xF8 && c <= 0x2FF) || (c >= 0x370 && c <= 0x37D) || (c >= 0x37F && c <= 0x1FFF) ||
+        (c >= 0x200C && c <= 0x200D) || (c >= 0x2070 && c <= 0x218F) || (c >= 0x2C00 && c <= 0x2FEF) || (c >= 0x3001 && c <= 0xD7FF) || (c >= 0xF900 && c <= 0xFDCF) ||
+        (c >= 0xFDF0 && c <= 0xFFFD) || (c >= 0x10000 && c <= 0xEFFFF);
+}
+
+inline bool IsNameChar(char32_t c)
+{
+    if (c < 0x80)
+    {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == ':' || c == '-' || c == '.';
+    }
+    return IsNameStartChar(c) || c == 0xB7 || (c >= 0x300 && c <= 0x36F) || (c >= 0x203F && c <= 0x2040);
+}
+
+XmlReader::XmlReader(const std::u32string& xmlContent, const std::string& systemId_) : XmlReader(xmlContent, systemId_, nullptr)
+{
+}
+
+XmlReader::XmlReader(const std::string& xmlContent, const std::string& systemId_) : XmlReader(xmlContent, systemId_, nullptr)
+{
+}
+
+XmlReader::XmlReader(const std::u32string& xmlContent, const std::string& systemId_, const XmlLimits* limits) :
+    systemId(systemId_), utf8Pos(nullptr), utf8End(nullptr), contentStart(xmlContent.c_str()), pos(contentStart), end(contentStart + xmlContent.length()),
+    lineCountPos(contentStart), lineNumber(1), processor(contentStart, end, this), state(State::start), depth(0), docTypeSeen(false), numEvents(0), eventIndex(0),
+    attributes(&noAttributes)
+{
+    processor.SetLimits(limits);
+    processor.CheckDocumentSize(systemId);
+    events.push_back(Event());
+}
+
+inline size_t CheckedLength(const std::string& xmlContent, const XmlLimits* limits, const std::string& systemId)
+{
+    CheckXmlDocumentSize(xmlContent.c_str(), xmlContent.c_str() + xmlContent.length(), limits, systemId);
+    return xmlContent.length();
+}
+
+//  The number of UTF-32 characters is at most the number of UTF-8 bytes, so the decoded content fits in a buffer allocated up front and never moves.
+//  The document size limit is checked before the buffer is allocated.
+
+XmlReader::XmlReader(const std::string& xmlContent, const std::string& systemId_, const XmlLimits* limits) :
+    systemId(systemId_), utf8Pos(xmlContent.c_str()), utf8End(xmlContent.c_str() + xmlContent.length()), 
+    decodedContent(new char32_t[CheckedLength(xmlContent, limits, systemId_) + 1]),
+    contentStart(decodedContent.get()), pos(contentStart), end(contentStart), lineCountPos(contentStart), lineNumber(1), processor(contentStart, contentStart + xmlContent.length(), this),
+    state(State::start), depth(0), docTypeSeen(false), numEvents(0), eventIndex(0), attributes(&noAttributes)
+{
+    processor.SetLimits(limits);
+    events.push_back(Event());
+}
+
+XmlEventKind XmlReader::Next()
+{
+    ++eventIndex;
+    if (eventIndex >= numEvents)
+    {
+        numEvents = 0;
+        eventIndex = 0;
+        while (numEvents == 0 && state != State::end)
+        {
+            ScanStep();
+        }
+        if (numEvents == 0)
+        {
+            events[0].kind = XmlEventKind::none;
+            return XmlEventKind::none;
+        }
+    }
+    return events[eventIndex].kind;
+}
+
+void XmlReader::Skip()
+{
+    if (Kind() != XmlEventKind::startElement || eventIndex + 1 < numEvents)
+    {
+        //  Not a start tag, or the endElement of an empty element tag is already queued.
+        return;
+    }
+    skippedTags.clear();
+    while (true)
+    {
+        while ((pos != end || Fill()) && *pos != '<')
+        {
+            ++pos;
+        }
+        if (AtEnd())
+        {
+            Error("unexpected end of content: end tag missing", pos);
+        }
+        if (Matches(U"<!--"))
+        {
+            pos += 4;
+            ScanUntil(U"-->", "comment");
+        }
+        else if (Matches(U"<![CDATA["))
+        {
+            pos += 9;
+            ScanUntil(U"]]>", "CDATA section");
+        }
+        else if (Matches(U"<?"))
+        {
+            pos += 2;
+            ScanUntil(U"?>", "processing instruction");
+        }
+        else if (Matches(U"</"))
+        {
+            if (skippedTags.empty())
+            {
+                return;
+            }
+            const char32_t* tagStart = pos;
+            pos += 2;
+            U32StringView tagName = ScanName();
+            if (tagName != skippedTags.back())
+            {
+                Error("end tag '" + ToUtf8(tagName.ToString()) + "' does not match start tag '" + ToUtf8(skippedTags.back().ToString()) + "'", tagStart);
+            }
+            skippedTags.pop_back();
+            SkipSpace();
+            Expect(U">");
+        }
+        else
+        {
+            processor.CheckSkippedElementDepth(int(skippedTags.size()), GetSpan(pos), systemId);
+            ++pos;
+            U32StringView tagName = ScanName();
+            while (true)
+            {
+                if (AtEnd())
+                {
+                    Error("unexpected end of content in start tag", pos);
+                }
+                char32_t c = *pos;
+                if (c == '"' || c == '\'')
+                {
+                    ScanQuoted();
+                }
+                else if (c == '>')
+                {
+                    ++pos;
+                    skippedTags.push_back(tagName);
+                    break;
+                }
+                else if (Matches(U"/>"))
+                {
+                    pos += 2;
+                    break;
+                }
+                else
+                {
+                    ++pos;
+                }
+            }
+        }
+    }
+}
+
+const AttributeViews& XmlReader::Attributes() const
+{
+    if (CurrentEvent().kind == XmlEventKind::startElement)
+    {
+        return *attributes;
+    }
+    return noAttributes;
+}
+
+XmlReader::Event& XmlReader::AddEvent(XmlEventKind kind)
+{
+    if (numEvents == int(events.size()))
+    {
+        events.push_back(Event());
+    }
+    Event& event = events[numEvents++];
+    event.kind = kind;
+    event.depth = depth;
+    event.namespaceUri = U32StringView();
+    event.localName = U32StringView();
+    event.qualifiedName = U32StringView();
+    event.text = U32StringView();
+    event.standalone = false;
+    return event;
+}
+
+void XmlReader::StartDocument()
+{
+    AddEvent(XmlEventKind::startDocument);
+}
+
+void XmlReader::EndDocument()
+{
+    AddEvent(XmlEventKind::endDocument);
+}
+
+void XmlReader::Version(const U32StringView& xmlVersion)
+{
+    AddEvent(XmlEventKind::version).text = xmlVersion;
+}
+
+void XmlReader::Standalone(bool standalone)
+{
+    AddEvent(XmlEventKind::standalone).standalone = standalone;
+}
+
+void XmlReader::Encoding(const U32StringView& encoding)
+{
+    AddEvent(XmlEventKind::encoding).text = encoding;
+}
+
+//  The text of a character reference does not live in the content, so it is copied to the event.
+
+void XmlReader::Text(const U32StringView& text)
+{
+    Event& event = AddEvent(XmlEventKind::text);
+    if (text.Data() >= contentStart && text.Data() <= end)
+    {
+        event.text = text;
+    }
+    else
+    {
+        event.buffer.assign(text.begin(), text.end());
+        event.text = U32StringView(event.buffer);
+    }
+}
+
+void XmlReader::Comment(const U32StringView& comment)
+{
+    AddEvent(XmlEventKind::comment).text = comment;
+}
+
+void XmlReader::PI(const U32StringView& target, const U32StringView& data)
+{
+    Event& event = AddEvent(XmlEventKind::pi);
+    event.qualifiedName = target;
+    event.text = data;
+}
+
+void XmlReader::StartElement(const U32StringView& namespaceUri, const U32StringView& localName, const U32StringView& qualifiedName, const AttributeViews& attributes_)
+{
+    Event& event = AddEvent(XmlEventKind::startElement);
+    event.namespaceUri = namespaceUri;
+    event.localName = localName;
+    event.qualifiedName = qualifiedName;
+    attributes = &attributes_;
+}
+
+void XmlReader::EndElement(const U32StringView& namespaceUri, const U32StringView& localName, const U32StringView& qualifiedName)
+{
+    Event& event = AddEvent(XmlEventKind::endElement);
+    event.namespaceUri = namespaceUri;
+    event.localName = localName;
+    event.qualifiedName = qualifiedName;
+}
+
+void XmlReader::SkippedEntity(const U32StringView& entityName)
+{
+    AddEvent(XmlEventKind::skippedEntity).text = entityName;
+}
+
+bool XmlReader::Fill()
+{
+    if (utf8Pos == utf8End)
+    {
+        return false;
+    }
+    const char* chunkEnd = utf8Pos + std::min(decodeChunkSize, size_t(utf8End - utf8Pos));
+    while (chunkEnd != utf8End && chunkEnd > utf8Pos && (static_cast<uint8_t>(*chunkEnd) & 0xC0u) == 0x80u)
+    {
+        --chunkEnd;
+    }
+    std::u32string chunk = ToUtf32(std::string(utf8Pos, chunkEnd));
+    char32_t* decodedEnd = decodedContent.get() + (end - contentStart);
+    std::copy(chunk.begin(), chunk.end(), decodedEnd);
+    end = decodedEnd + chunk.length();
+    utf8Pos = chunkEnd;
+    return true;
+}
+
+bool XmlReader::FillAvailable(int n)
+{
+    while (end - pos < n)
+    {
+        if (!Fill())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool XmlReader::Matches(const char32_t* s)
+{
+    int n = int(std::char_traits<char32_t>::length(s));
+    return Available(n) && std::equal(s, s + n, pos);
+}
+
+soul::parsing::Span XmlReader::GetSpan(const char32_t* p)
+{
+    if (p < lineCountPos)
+    {
+        lineCountPos = contentStart;
+        lineNumber = 1;
+    }
+    while (lineCountPos < p)
+    {
+        if (*lineCountPos == '\n')
+        {
+            ++lineNumber;
+        }
+        ++lineCountPos;
+    }
+    return soul::parsing::Span(0, lineNumber, int32_t(p - contentStart));
+}
+
+void XmlReader::Error(const std::string& message, const char32_t* p)
+{
+    throw XmlProcessingException(processor.GetErrorLocationStr(systemId, GetSpan(p)) + ": " + message);
+}
+
+void XmlReader::Expect(const char32_t* s)
+{
+    if (!Matches(s))
+    {
+        Error("'" + ToUtf8(s) + "' expected", pos);
+    }
+    pos += std::char_traits<char32_t>::length(s);
+}
+
+bool XmlReader::SkipSpace()
+{
+    const char32_t* start = pos;
+    while ((pos != end || Fill()) && IsSpace(*pos))
+    {
+        ++pos;
+    }
+    return pos != start;
+}
+
+U32StringView XmlReader::ScanName()
+{
+    const char32_t* nameStart = pos;
+    if (AtEnd() || !IsNameStartChar(*pos))
+    {
+        Error("name expected", pos);
+    }
+    do
+    {
+        ++pos;
+    }
+    while ((pos != end || Fill()) && IsNameChar(*pos));
+    return U32StringView(nameStart, pos);
+}
+
+U32StringView XmlReader::ScanUntil(const char32_t* terminator, const char* construct)
+{
+    const char32_t* start = pos;
+    while (true)
+    {
+        if (AtEnd())
+        {
+            Error(std::string("unexpected end of content in ") + construct, start);
+        }
+        char32_t c = *pos;
+        if (c == terminator[0] && Matches(terminator))
+        {
+            U32StringView s(start, pos);
+            pos += std::char_traits<char32_t>::length(terminator);
+            return s;
+        }
+        if (IsRestrictedChar(c))
+        {
+            Error(std::string("invalid character in ") + construct, pos);
+        }
+        ++pos;
+    }
+}
+
+U32StringView XmlReader::ScanQuoted()
+{
+    if (AtEnd() || (*pos != '"' && *pos != '\''))
+    {
+        Error("quoted literal expected", pos);
+    }
+    const char32_t quote[] = { *pos, 0 };
+    ++pos;
+    return ScanUntil(quote, "quoted literal");
+}
+
+//  Scans one unit of markup or text. A unit produces the events of one grammar construct, or none for white space and the document type declaration.
+
+void XmlReader::ScanStep()
+{
+    switch (state)
+    {
+        case State::start:
+        {
+            processor.StartDocument();
+            if (Matches(U"<?xml") && Available(6) && IsSpace(pos[5]))
+            {
+                ScanXmlDecl();
+            }
+            state = State::prolog;
+            break;
+        }
+        case State::prolog:
+        case State::epilog:
+        {
+            SkipSpace();
+            if (AtEnd())
+            {
+                if (state == State::prolog)
+                {
+                    Error("document has no root element", pos);
+                }
+                processor.EndDocument();
+                state = State::end;
+            }
+            else if (Matches(U"<!--"))
+            {
+                ScanComment();
+            }
+            else if (Matches(U"<?"))
+            {
+                ScanPI();
+            }
+            else if (state == State::prolog && !docTypeSeen && Matches(U"<!DOCTYPE"))
+            {
+                ScanDocTypeDecl();
+            }
+            else if (state == State::prolog && *pos == '<')
+            {
+                state = State::content;
+                ScanStartTag();
+                if (depth == 0)
+                {
+                    state = State::epilog;
+                }
+            }
+            else
+            {
+                Error(state == State::prolog ? "root element expected" : "only comments, processing instructions and white space allowed after the root element", pos);
+            }
+            break;
+        }
+        case State::content:
+        {
+            if (AtEnd())
+            {
+                Error("unexpected end of content: end tag missing", pos);
+            }
+            if (*pos == '<')
+            {
+                if (Matches(U"</"))
+                {
+                    ScanEndTag();
+                    if (depth == 0)
+                    {
+                        state = State::epilog;
+                    }
+                }
+                else if (Matches(U"<!--"))
+                {
+                    ScanComment();
+                }
+                else if (Matches(U"<![CDATA["))
+                {
+                    ScanCDataSection();
+                }
+                else if (Matches(U"<?"))
+                {
+                    ScanPI();
+                }
+                else
+                {
+                    ScanStartTag();
+                }
+            }
+            else if (*pos == '&')
+            {
+                ScanReference();
+            }
+            else
+            {
+                ScanCharData();
+            }
+            break;
+        }
+        case State::end:
+        {
+            break;
+        }
+    }
+}
+
+void XmlReader::ScanXmlDecl()
+{
+    pos += 5;
+    SkipSpace();
+    Expect(U"version");
+    SkipSpace();
+    Expect(U"=");
+    SkipSpace();
+    const char32_t* versionStart = pos;
+    U32StringView version = ScanQuoted();
+    if (version.Length() < 3 || version[0] != '1' || version[1] != '.' || !std::all_of(version.begin() + 2, version.end(), [](char32_t c) { return c >= '0' && c <= '9'; }))
+    {
+        Error("invalid XML version", versionStart);
+    }
+    processor.Version(version);
+    bool space = SkipSpace();
+    if (space && Matches(U"encoding"))
+    {
+        pos += 8;
+        SkipSpace();
+        Expect(U"=");
+        SkipSpace();
+        const char32_t* encodingStart = pos;
+        U32StringView encoding = ScanQuoted();
+        if (encoding.IsEmpty() || !((encoding[0] >= 'a' && encoding[0] <= 'z') || (encoding[0] >= 'A' && encoding[0] <= 'Z')) ||
+            !std::all_of(encoding.begin(), encoding.end(), [](char32_t c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '.' || c == '_' || c == '-'; }))
+        {
+            Error("invalid encoding name", encodingStart);
+        }
+        processor.Encoding(encoding);
+        space = SkipSpace();
+    }
+    if (space && Matches(U"standalone"))
+    {
+        pos += 10;
+        SkipSpace();
+        Expect(U"=");
+        SkipSpace();
+        const char32_t* standaloneStart = pos;
+        U32StringView standalone = ScanQuoted();
+        if (standalone == U"yes")
+        {
+            processor.Standalone(true);
+        }
+        else if (standalone == U"no")
+        {
+            processor.Standalone(false);
+        }
+        else
+        {
+            Error("'yes' or 'no' expected", standaloneStart);
+        }
+        SkipSpace();
+    }
+    Expect(U"?>");
+}
+
+//  The document type declaration is skipped, like the XML grammar does, except for the comments and processing instructions of the internal subset.
+
+void XmlReader::ScanDocTypeDecl()
+{
+    const char32_t* declStart = pos;
+    pos += 9;
+    if (!SkipSpace())
+    {
+        Error("white space expected", pos);
+    }
+    ScanName();
+    bool internalSubset = false;
+    while (true)
+    {
+        if (AtEnd())
+        {
+            Error("unexpected end of content in document type declaration", declStart);
+        }
+        char32_t c = *pos;
+        if (c == '"' || c == '\'')
+        {
+            ScanQuoted();
+        }
+        else if (internalSubset)
+        {
+            if (c == ']')
+            {
+                internalSubset = false;
+                ++pos;
+            }
+            else if (Matches(U"<!--"))
+            {
+                ScanComment();
+            }
+            else if (Matches(U"<?"))
+            {
+                ScanPI();
+            }
+            else
+            {
+                ++pos;
+            }
+        }
+        else if (c == '[')
+        {
+            internalSubset = true;
+            ++pos;
+        }
+        else if (c == '>')
+        {
+            ++pos;
+            break;
+        }
+        else
+        {
+            ++pos;
+        }
+    }
+    docTypeSeen = true;
+}
+
+void XmlReader::ScanComment()
+{
+    pos += 4;
+    U32StringView comment = ScanUntil(U"--", "comment");
+    if (AtEnd() || *pos != '>')
+    {
+        Error("'--' not allowed in comment", pos - 2);
+    }
+    ++pos;
+    processor.Comment(comment);
+}
+
+//  Like the grammar, the data of a processing instruction includes the white space that separates it from the target.
+
+void XmlReader::ScanPI()
+{
+    pos += 2;
+    const char32_t* targetStart = pos;
+    U32StringView target = ScanName();
+    if (target.Length() == 3 && (target[0] == 'x' || target[0] == 'X') && (target[1] == 'm' || target[1] == 'M') && (target[2] == 'l' || target[2] == 'L'))
+    {
+        Error("processing instruction target 'xml' is reserved", targetStart);
+    }
+    const char32_t* dataStart = pos;
+    if (Matches(U"?>"))
+    {
+        pos += 2;
+        processor.PI(target, U32StringView(dataStart, dataStart));
+        return;
+    }
+    if (!SkipSpace())
+    {
+        Error("white space expected", pos);
+    }
+    U32StringView data = ScanUntil(U"?>", "processing instruction");
+    processor.PI(target, U32StringView(dataStart, data.end()));
+}
+
+void XmlReader::ScanCDataSection()
+{
+    pos += 9;
+    processor.Text(ScanUntil(U"]]>", "CDATA section"));
+}
+
+void XmlReader::ScanStartTag()
+{
+    ++pos;
+    U32StringView tagName = ScanName();
+    processor.BeginStartTag(tagName);
+    processor.CheckElementDepth(GetSpan(pos), systemId);
+    while (true)
+    {
+        bool space = SkipSpace();
+        if (AtEnd())
+        {
+            Error("unexpected end of content in start tag", pos);
+        }
+        if (*pos == '>')
+        {
+            soul::parsing::Span span = GetSpan(pos);
+            ++pos;
+            ++depth;
+            processor.EndStartTag(span, systemId);
+            return;
+        }
+        if (*pos == '/')
+        {
+            soul::parsing::Span span = GetSpan(pos);
+            Expect(U"/>");
+            ++depth;
+            processor.EndStartTag(span, systemId);
+            processor.EndTag(tagName, span, systemId);
+            --depth;
+            return;
+        }
+        if (!space)
+        {
+            Error("white space expected", pos);
+        }
+        U32StringView attName = ScanName();
+        SkipSpace();
+        Expect(U"=");
+        SkipSpace();
+        soul::parsing::Span attValueSpan = GetSpan(pos);
+        U32StringView attValue = ScanAttributeValue();
+        processor.AddAttribute(attName, attValue, attValueSpan, systemId);
+    }
+}
+
+void XmlReader::ScanEndTag()
+{
+    pos += 2;
+    soul::parsing::Span span = GetSpan(pos);
+    U32StringView tagName = ScanName();
+    processor.EndTag(tagName, span, systemId);
+    SkipSpace();
+    Expect(U">");
+    --depth;
+}
+
+void XmlReader::ScanReference()
+{
+    const char32_t* refStart = pos;
+    ++pos;
+    if (Available(1) && *pos == '#')
+    {
+        ++pos;
+        bool hex = false;
+        if (Available(1) && *pos == 'x')
+        {
+            hex = true;
+            ++pos;
+        }
+        uint32_t value = 0;
+        int numDigits = 0;
+        while (Available(1))
+        {
+            char32_t c = *pos;
+            uint32_t digit = 0;
+            if (c >= '0' && c <= '9')
+            {
+                digit = c - '0';
+            }
+            else if (hex && c >= 'a' && c <= 'f')
+            {
+                digit = 10 + c - 'a';
+            }
+            else if (hex && c >= 'A' && c <= 'F')
+            {
+                digit = 10 + c - 'A';
+            }
+            else
+            {
+                break;
+            }
+            value = value * (hex ? 16 : 10) + digit;
+            if (value > 0x10FFFF)
+            {
+                Error("character reference out of range", refStart);
+            }
+            ++numDigits;
+            ++pos;
+        }
+        if (numDigits == 0)
+        {
+            Error("invalid character reference", refStart);
+        }
+        Expect(U";");
+        processor.CharRef(static_cast<char32_t>(value));
+    }
+    else
+    {
+        U32StringView entityName = ScanName();
+        Expect(U";");
+        processor.EntityRef(entityName, GetSpan(refStart), systemId);
+    }
+}
+
+void XmlReader::ScanCharData()
+{
+    const char32_t* textStart = pos;
+    while ((pos != end || Fill()) && *pos != '<' && *pos != '&')
+    {
+        if (*pos == ']' && Matches(U"]]>"))
+        {
+            Error("']]>' not allowed in text", pos);
+        }
+        ++pos;
+    }
+    processor.Text(U32StringView(textStart, pos));
+}
+
+U32StringView XmlReader::ScanAttributeValue()
+{
+    if (AtEnd() || (*pos != '"' && *pos != '\''))
+    {
+        Error("attribute value expected", pos);
+    }
+    char32_t quote = *pos;
+    ++pos;
+    processor.BeginAttributeValue();
+    while (true)
+    {
+        if (AtEnd())
+        {
+            Error("unexpected end of content in attribute value", pos);
+        }
+        char32_t c = *pos;
+        if (c == quote)
+        {
+            ++pos;
+            return processor.EndAttributeValue();
+        }
+        if (c == '&')
+        {
+            ScanReference();
+        }
+        else if (c == '<')
+        {
+            Error("'<' not allowed in attribute value", pos);
+        }
+        else
+        {
+            const char32_t* runStart = pos;
+            do
+            {
+                ++pos;
+            }
+            while ((pos != end || Fill()) && *pos != quote && *pos != '&' && *pos != '<');
+            processor.AttributeValueChars(runStart, pos);
+        }
+    }
+}
+
+} } // namespace soul::xml
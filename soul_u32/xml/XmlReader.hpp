@@ -0,0 +1,144 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#ifndef SOUL_XML_XML_READER
+#define SOUL_XML_XML_READER
+#include <soul_u32/xml/XmlProcessor.hpp>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+namespace soul { namespace xml {
+
+enum class XmlEventKind : uint8_t
+{
+    none, startDocument, version, encoding, standalone, startElement, endElement, text, comment, pi, skippedEntity, endDocument
+};
+
+//  ==================================================================================
+//  XmlReader is a pull parser: each call of Next() scans only as much of the content
+//  as is needed for the next event and returns its kind. The caller can stop reading
+//  at any time, for example after the header of a large document, without the rest
+//  of the content being scanned. UTF-8 content is decoded to UTF-32 in chunks as the
+//  reading proceeds.
+//
+//  The names, values and text of the current event are views that are valid until
+//  the next call of Next(). Call ToString() for the ones that must be kept.
+//  The content passed to the constructor must outlive the reader. Null limits means
+//  no limits.
+//
+//  Errors in tag matching, namespaces and limits are reported at the same position
+//  as by ParseXmlContent. A syntax error is reported at the character where the
+//  reader stopped, whereas ParseXmlContent reports the line of the failed match.
+//  ==================================================================================
+
+class XmlReader : private XmlViewHandler
+{
+public:
+    XmlReader(const std::u32string& xmlContent, const std::string& systemId_);
+    XmlReader(const std::string& xmlContent, const std::string& systemId_);
+    XmlReader(const std::u32string& xmlContent, const std::string& systemId_, const XmlLimits* limits);
+    XmlReader(const std::string& xmlContent, const std::string& systemId_, const XmlLimits* limits);
+    XmlReader(const XmlReader&) = delete;
+    XmlReader& operator=(const XmlReader&) = delete;
+    //  Returns XmlEventKind::none after the endDocument event.
+    XmlEventKind Next();
+    //  Skips the content of the element of the current startElement event, so that the next event is the endElement of the element.
+    //  The skipped content is only checked for balanced tags and terminated comments, CDATA sections and processing instructions.
+    void Skip();
+    XmlEventKind Kind() const { return CurrentEvent().kind; }
+    //  Number of open elements: for startElement and endElement events the element itself is included.
+    int Depth() const { return CurrentEvent().depth; }
+    const U32StringView& NamespaceUri() const { return CurrentEvent().namespaceUri; }
+    const U32StringView& LocalName() const { return CurrentEvent().localName; }
+    const U32StringView& QualifiedName() const { return CurrentEvent().qualifiedName; }
+    //  The attributes of a startElement event.
+    const AttributeViews& Attributes() const;
+    //  Text of a text or comment event, data of a PI, version, encoding or the name of a skipped entity.
+    const U32StringView& Text() const { return CurrentEvent().text; }
+    //  Target of a PI.
+    const U32StringView& Target() const { return CurrentEvent().qualifiedName; }
+    bool Standalone() const { return CurrentEvent().standalone; }
+    //  Index of the first character that has not been read yet.
+    int Position() const { return int(pos - contentStart); }
+private:
+    struct Event
+    {
+        Event() : kind(XmlEventKind::none), depth(0), standalone(false) {}
+        XmlEventKind kind;
+        int depth;
+        U32StringView namespaceUri;
+        U32StringView localName;
+        U32StringView qualifiedName;
+        U32StringView text;
+        bool standalone;
+        std::u32string buffer;
+    };
+    enum class State : uint8_t
+    {
+        start, prolog, content, epilog, end
+    };
+    std::string systemId;
+    const char* utf8Pos;
+    const char* utf8End;
+    std::unique_ptr<char32_t[]> decodedContent;
+    const char32_t* contentStart;
+    const char32_t* pos;
+    const char32_t* end;
+    const char32_t* lineCountPos;
+    int lineNumber;
+    XmlProcessor processor;
+    State state;
+    int depth;
+    bool docTypeSeen;
+    std::deque<Event> events;
+    int numEvents;
+    int eventIndex;
+    const AttributeViews* attributes;
+    AttributeViews noAttributes;
+    std::vector<U32StringView> skippedTags;
+    const Event& CurrentEvent() const { return events[eventIndex]; }
+    Event& AddEvent(XmlEventKind kind);
+    void StartDocument() override;
+    void EndDocument() override;
+    void Version(const U32StringView& xmlVersion) override;
+    void Standalone(bool standalone) override;
+    void Encoding(const U32StringView& encoding) override;
+    void Text(const U32StringView& text) override;
+    void Comment(const U32StringView& comment) override;
+    void PI(const U32StringView& target, const U32StringView& data) override;
+    void StartElement(const U32StringView& namespaceUri, const U32StringView& localName, const U32StringView& qualifiedName, const AttributeViews& attributes_) override;
+    void EndElement(const U32StringView& namespaceUri, const U32StringView& localName, const U32StringView& qualifiedName) override;
+    void SkippedEntity(const U32StringView& entityName) override;
+    bool Fill();
+    bool Available(int n) { return end - pos >= n || FillAvailable(n); }
+    bool FillAvailable(int n);
+    bool AtEnd() { return pos == end && !Fill(); }
+    bool Matches(const char32_t* s);
+    soul::parsing::Span GetSpan(const char32_t* p);
+    [[noreturn]] void Error(const std::string& message, const char32_t* p);
+    void Expect(const char32_t* s);
+    bool SkipSpace();
+    U32StringView ScanName();
+    U32StringView ScanUntil(const char32_t* terminator, const char* construct);
+    U32StringView ScanQuoted();
+    void ScanStep();
+    void ScanXmlDecl();
+    void ScanDocTypeDecl();
+    void ScanComment();
+    void ScanPI();
+    void ScanCDataSection();
+    void ScanStartTag();
+    void ScanEndTag();
+    void ScanReference();
+    void ScanCharData();
+    U32StringView ScanAttributeValue();
+};
+
+} } // namespace soul::xml
+
+#endif // SOUL_XML_XML_READER
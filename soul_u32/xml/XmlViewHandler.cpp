@@ -0,0 +1,57 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <soul_u32/xml/XmlViewHandler.hpp>
+
+namespace soul { namespace xml {
+
+AttributeView::AttributeView(const U32StringView& namespaceUri_, const U32StringView& localName_, const U32StringView& qualifiedName_, const U32StringView& value_) :
+    namespaceUri(namespaceUri_), localName(localName_), qualifiedName(qualifiedName_), value(value_)
+{
+}
+
+void AttributeViews::Add(const AttributeView& attribute)
+{
+    attributes.push_back(attribute);
+}
+
+void AttributeViews::Clear()
+{
+    attributes.clear();
+}
+
+const U32StringView* AttributeViews::GetAttributeValue(const U32StringView& namespaceUri, const U32StringView& localName) const
+{
+    for (const AttributeView& attribute : attributes)
+    {
+        if (attribute.LocalName() == localName && attribute.NamespaceUri() == namespaceUri)
+        {
+            return &attribute.Value();
+        }
+    }
+    return nullptr;
+}
+
+const U32StringView* AttributeViews::GetAttributeValue(const U32StringView& qualifiedName) const
+{
+    for (const AttributeView& attribute : attributes)
+    {
+        if (attribute.QualifiedName() == qualifiedName)
+        {
+            return &attribute.Value();
+        }
+    }
+    return nullptr;
+}
+
+XmlViewHandler::XmlViewHandler() : skipSubtree(false), coalesceText(false), ignoreWhitespaceText(false)
+{
+}
+
+XmlViewHandler::~XmlViewHandler()
+{
+}
+
+} } // namespace soul::xml
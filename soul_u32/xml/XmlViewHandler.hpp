@@ -0,0 +1,91 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#ifndef SOUL_XML_XML_VIEW_HANDLER
+#define SOUL_XML_XML_VIEW_HANDLER
+#include <soul_u32/util/StringView.hpp>
+#include <vector>
+
+namespace soul { namespace xml {
+
+using soul::util::U32StringView;
+
+//  ==================================================================================
+//  XmlViewHandler receives the same events as XmlContentHandler, but the names,
+//  values and text are passed as views instead of strings. A view points directly
+//  into the parsed content when the text does not contain entity or character
+//  references, otherwise it points to a decoded copy held by the XML processor.
+//  Views are valid only until the callback returns: call ToString() to keep them.
+//  ==================================================================================
+
+class AttributeView
+{
+public:
+    AttributeView(const U32StringView& namespaceUri_, const U32StringView& localName_, const U32StringView& qualifiedName_, const U32StringView& value_);
+    const U32StringView& NamespaceUri() const { return namespaceUri; }
+    const U32StringView& LocalName() const { return localName; }
+    const U32StringView& QualifiedName() const { return qualifiedName; }
+    const U32StringView& Value() const { return value; }
+private:
+    U32StringView namespaceUri;
+    U32StringView localName;
+    U32StringView qualifiedName;
+    U32StringView value;
+};
+
+class AttributeViews
+{
+public:
+    typedef std::vector<AttributeView>::const_iterator const_iterator;
+    const_iterator begin() const { return attributes.begin(); }
+    const_iterator end() const { return attributes.end(); }
+    const_iterator cbegin() const { return attributes.cbegin(); }
+    const_iterator cend() const { return attributes.cend(); }
+    int Count() const { return int(attributes.size()); }
+    void Add(const AttributeView& attribute);
+    void Clear();
+    const U32StringView* GetAttributeValue(const U32StringView& namespaceUri, const U32StringView& localName) const;
+    const U32StringView* GetAttributeValue(const U32StringView& qualifiedName) const;
+private:
+    std::vector<AttributeView> attributes;
+};
+
+class XmlViewHandler
+{
+public:
+    XmlViewHandler();
+    virtual ~XmlViewHandler();
+    virtual void StartDocument() {}
+    virtual void EndDocument() {}
+    virtual void Version(const U32StringView& /* xmlVersion */) {}
+    virtual void Standalone(bool /* standalone */) {}
+    virtual void Encoding(const U32StringView& /* encoding */) {}
+    virtual void Text(const U32StringView& /* text */) {}
+    virtual void Comment(const U32StringView& /* comment */) {}
+    virtual void PI(const U32StringView& /* target */, const U32StringView& /* data */) {}
+    virtual void StartElement(const U32StringView& /* namespaceUri */, const U32StringView& /* localName */, const U32StringView& /* qualifiedName */, 
+        const AttributeViews& /* attributes */) {}
+    virtual void EndElement(const U32StringView& /* namespaceUri */, const U32StringView& /* localName */, const U32StringView& /* qualifiedName */) {}
+    virtual void SkippedEntity(const U32StringView& /* entityName */) {}
+    //  StartElement can call SkipSubtree() to make the parser skip the content of the element.
+    //  The skipped content is only checked for balanced tags: no events are delivered for it. EndElement is delivered for the element itself.
+    void SkipSubtree() { skipSubtree = true; }
+    bool TakeSkipSubtree() { bool skip = skipSubtree; skipSubtree = false; return skip; }
+    //  With CoalesceText, adjacent character data, CDATA sections and references are delivered as a single Text event.
+    //  With IgnoreWhitespaceText, text that consists of whitespace only is not delivered, unless it is the whole content of an element.
+    //  Set these before parsing.
+    void SetCoalesceText(bool coalesceText_) { coalesceText = coalesceText_; }
+    bool CoalesceText() const { return coalesceText; }
+    void SetIgnoreWhitespaceText(bool ignoreWhitespaceText_) { ignoreWhitespaceText = ignoreWhitespaceText_; }
+    bool IgnoreWhitespaceText() const { return ignoreWhitespaceText; }
+private:
+    bool skipSubtree;
+    bool coalesceText;
+    bool ignoreWhitespaceText;
+};
+
+} } // namespace soul::xml
+
+#endif // SOUL_XML_XML_VIEW_HANDLER
@@ -0,0 +1,620 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <soul_u32/xml/XmlWriter.hpp>
+#include <soul_u32/util/TextUtils.hpp>
+#include <soul_u32/util/Unicode.hpp>
+#include <algorithm>
+#include <stdexcept>
+#include <errno.h>
+#include <string.h>
+#if defined(__linux) || defined(__posix) || defined(__unix)
+#include <unistd.h>
+#elif defined(_WIN32)
+#include <io.h>
+#else
+    #error unknown platform
+#endif
+
+namespace soul { namespace xml {
+
+using namespace soul::unicode;
+using soul::util::ToHexString;
+
+const int textEscape = 1;
+const int attributeEscape = 2;
+const int invalidChar = 4;
+
+//  Escaping needs at most six bytes for a character ("&quot;"), and UTF-8 at most four.
+
+const size_t maxCharBytes = 6;
+const size_t blockSize = 4096;
+
+struct EscapeTable
+{
+    EscapeTable()
+    {
+        for (int c = 0; c < 0x80; ++c)
+        {
+            flags[c] = c < 0x20 ? invalidChar : 0;
+        }
+        flags['\t'] = attributeEscape;
+        flags['\n'] = attributeEscape;
+        flags['\r'] = textEscape | attributeEscape;
+        flags['<'] = textEscape | attributeEscape;
+        flags['&'] = textEscape | attributeEscape;
+        flags['>'] = textEscape;
+        flags['"'] = attributeEscape;
+    }
+    unsigned char flags[0x80];
+};
+
+const EscapeTable escapeTable;
+
+inline char* Copy(char* p, const char* s)
+{
+    while (*s)
+    {
+        *p++ = *s++;
+    }
+    return p;
+}
+
+inline char* WriteReference(char* p, char32_t c)
+{
+    switch (c)
+    {
+        case '<': return Copy(p, "&lt;");
+        case '>': return Copy(p, "&gt;");
+        case '&': return Copy(p, "&amp;");
+        case '"': return Copy(p, "&quot;");
+    }
+    const char* hexDigits = "0123456789ABCDEF";
+    p = Copy(p, "&#x");
+    if (c >= 0x10)
+    {
+        *p++ = hexDigits[c >> 4];
+    }
+    *p++ = hexDigits[c & 0xF];
+    *p++ = ';';
+    return p;
+}
+
+inline bool IsXmlChar(char32_t c)
+{
+    return c < 0xD800 || (c >= 0xE000 && c < 0xFFFE) || (c >= 0x10000 && c < 0x110000);
+}
+
+inline char* EncodeUtf8(char* p, char32_t c)
+{
+    if (c < 0x800)
+    {
+        *p++ = char(0xC0 | (c >> 6));
+    }
+    else
+    {
+        if (c < 0x10000)
+        {
+            *p++ = char(0xE0 | (c >> 12));
+        }
+        else
+        {
+            *p++ = char(0xF0 | (c >> 18));
+            *p++ = char(0x80 | ((c >> 12) & 0x3F));
+        }
+        *p++ = char(0x80 | ((c >> 6) & 0x3F));
+    }
+    *p++ = char(0x80 | (c & 0x3F));
+    return p;
+}
+
+const char32_t* const xmlNamespaceUri = U"http://www.w3.org/XML/1998/namespace";
+const char32_t* const xmlnsNamespaceUri = U"http://www.w3.org/2000/xmlns/";
+
+XmlWriter::XmlWriter(std::string& buffer_) : XmlWriter(buffer_, XmlWriterOptions())
+{
+}
+
+XmlWriter::XmlWriter(std::string& buffer_, const XmlWriterOptions& options_) : buffer(&buffer_), fd(-1), options(options_)
+{
+    Init();
+}
+
+XmlWriter::XmlWriter(int fd_) : XmlWriter(fd_, XmlWriterOptions())
+{
+}
+
+XmlWriter::XmlWriter(int fd_, const XmlWriterOptions& options_) : buffer(&ownBuffer), fd(fd_), options(options_)
+{
+    ownBuffer.reserve(flushSize + blockSize * maxCharBytes);
+    Init();
+}
+
+XmlWriter::~XmlWriter()
+{
+    try
+    {
+        Flush();
+    }
+    catch (...)
+    {
+    }
+}
+
+void XmlWriter::Init()
+{
+    startTagOpen = false;
+    atStart = true;
+    mixedDepth = 0;
+    defaultNamespaceId = 0;
+    generatedPrefixCount = 0;
+    BindPrefix(U"xml", xmlNamespaceUri);
+}
+
+void XmlWriter::XmlDeclaration()
+{
+    if (!atStart)
+    {
+        throw std::runtime_error("XML declaration must be written first");
+    }
+    WriteAscii("<?xml version=\"1.0\" encoding=\"UTF-8\"?>");
+    atStart = false;
+}
+
+void XmlWriter::XmlDeclaration(bool standalone)
+{
+    if (!atStart)
+    {
+        throw std::runtime_error("XML declaration must be written first");
+    }
+    WriteAscii(standalone ? "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>" : "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>");
+    atStart = false;
+}
+
+void XmlWriter::StartElement(const U32StringView& qualifiedName)
+{
+    BeginMarkup();
+    buffer->append(1, '<');
+    size_t nameStart = buffer->size();
+    Write(qualifiedName, 0);
+    ElementScope scope;
+    scope.nameStart = int(openNames.size());
+    scope.numBindings = int(bindingStack.size());
+    scope.prevDefaultNamespaceId = defaultNamespaceId;
+    scope.defaultDeclared = false;
+    scope.hasChildren = false;
+    scopeStack.push_back(scope);
+    openNames.append(*buffer, nameStart, std::string::npos);
+    startTagOpen = true;
+}
+
+void XmlWriter::StartElement(const U32StringView& namespaceUri, const U32StringView& qualifiedName)
+{
+    StartElement(qualifiedName);
+    size_t colonPos = qualifiedName.Find(':');
+    if (colonPos == std::u32string::npos)
+    {
+        if (namespaceUris.Get(defaultNamespaceId) != namespaceUri)
+        {
+            WriteDeclaration(U32StringView(), namespaceUri);
+        }
+    }
+    else
+    {
+        U32StringView prefix = qualifiedName.Substring(0, colonPos);
+        if (!IsBound(prefix, namespaceUri))
+        {
+            WriteDeclaration(prefix, namespaceUri);
+        }
+    }
+}
+
+void XmlWriter::DeclareNamespace(const U32StringView& prefix, const U32StringView& namespaceUri)
+{
+    CheckStartTagOpen("namespace declaration");
+    if (prefix.IsEmpty() ? namespaceUris.Get(defaultNamespaceId) != namespaceUri : !IsBound(prefix, namespaceUri))
+    {
+        WriteDeclaration(prefix, namespaceUri);
+    }
+}
+
+void XmlWriter::Attribute(const U32StringView& qualifiedName, const U32StringView& value)
+{
+    CheckStartTagOpen("attribute");
+    if (qualifiedName == U"xmlns")
+    {
+        DeclareNamespace(U32StringView(), value);
+    }
+    else if (qualifiedName.Length() > 6 && qualifiedName.Substring(0, 6) == U"xmlns:")
+    {
+        DeclareNamespace(qualifiedName.Substring(6), value);
+    }
+    else
+    {
+        buffer->append(1, ' ');
+        Write(qualifiedName, 0);
+        WriteAscii("=\"");
+        Write(value, attributeEscape);
+        buffer->append(1, '"');
+    }
+}
+
+//  An unprefixed attribute is in no namespace, so an attribute with a namespace URI always gets a prefix bound to the URI.
+
+void XmlWriter::Attribute(const U32StringView& namespaceUri, const U32StringView& qualifiedName, const U32StringView& value)
+{
+    if (namespaceUri.IsEmpty() || namespaceUri == xmlnsNamespaceUri)
+    {
+        Attribute(qualifiedName, value);
+        return;
+    }
+    CheckStartTagOpen("attribute");
+    size_t colonPos = qualifiedName.Find(':');
+    U32StringView prefix;
+    U32StringView localName = qualifiedName;
+    if (colonPos != std::u32string::npos)
+    {
+        prefix = qualifiedName.Substring(0, colonPos);
+        localName = qualifiedName.Substring(colonPos + 1);
+    }
+    if (!prefix.IsEmpty() && !IsBound(prefix, namespaceUri))
+    {
+        if (prefix != U"xml" && prefix != U"xmlns" && namespaceUri != xmlNamespaceUri && !DeclaredInStartTag(prefix))
+        {
+            WriteDeclaration(prefix, namespaceUri);
+        }
+        else
+        {
+            prefix = U32StringView();
+        }
+    }
+    if (prefix.IsEmpty())
+    {
+        prefix = FindPrefix(namespaceUri);
+        if (prefix.IsEmpty())
+        {
+            prefix = GeneratePrefix();
+            WriteDeclaration(prefix, namespaceUri);
+        }
+    }
+    buffer->append(1, ' ');
+    Write(prefix, 0);
+    buffer->append(1, ':');
+    Write(localName, 0);
+    WriteAscii("=\"");
+    Write(value, attributeEscape);
+    buffer->append(1, '"');
+}
+
+void XmlWriter::EndElement()
+{
+    if (scopeStack.empty())
+    {
+        throw std::runtime_error("no open element to end");
+    }
+    const ElementScope& scope = scopeStack.back();
+    if (startTagOpen)
+    {
+        WriteAscii("/>");
+        startTagOpen = false;
+    }
+    else
+    {
+        if (options.indent && mixedDepth == 0 && scope.hasChildren)
+        {
+            NewLine(Depth() - 1);
+        }
+        WriteAscii("</");
+        buffer->append(openNames, scope.nameStart, std::string::npos);
+        buffer->append(1, '>');
+    }
+    if (mixedDepth == Depth())
+    {
+        mixedDepth = 0;
+    }
+    openNames.resize(scope.nameStart);
+    while (int(bindingStack.size()) > scope.numBindings)
+    {
+        const NamespaceBinding& binding = bindingStack.back();
+        prefixNamespaceIds[binding.prefixId] = binding.prevNamespaceId;
+        bindingStack.pop_back();
+    }
+    defaultNamespaceId = scope.prevDefaultNamespaceId;
+    scopeStack.pop_back();
+    FlushIfFull();
+}
+
+void XmlWriter::Text(const U32StringView& text)
+{
+    if (text.IsEmpty())
+    {
+        return;
+    }
+    CloseStartTag();
+    if (!scopeStack.empty() && mixedDepth == 0)
+    {
+        mixedDepth = Depth();
+    }
+    atStart = false;
+    Write(text, textEscape);
+    FlushIfFull();
+}
+
+//  "]]>" cannot occur in a CDATA section, so the section is split between "]]" and ">".
+
+void XmlWriter::CData(const U32StringView& text)
+{
+    CloseStartTag();
+    if (!scopeStack.empty() && mixedDepth == 0)
+    {
+        mixedDepth = Depth();
+    }
+    atStart = false;
+    WriteAscii("<![CDATA[");
+    U32StringView rest = text;
+    size_t endPos = rest.Find(']');
+    while (endPos != std::u32string::npos)
+    {
+        if (rest.Length() - endPos >= 3 && rest.Substring(endPos, 3) == U"]]>")
+        {
+            Write(rest.Substring(0, endPos + 2), 0);
+            WriteAscii("]]><![CDATA[");
+            rest = rest.Substring(endPos + 2);
+            endPos = rest.Find(']');
+        }
+        else
+        {
+            size_t nextPos = rest.Substring(endPos + 1).Find(']');
+            endPos = nextPos != std::u32string::npos ? endPos + 1 + nextPos : nextPos;
+        }
+    }
+    Write(rest, 0);
+    WriteAscii("]]>");
+    FlushIfFull();
+}
+
+void XmlWriter::Comment(const U32StringView& text)
+{
+    for (size_t i = 0; i < text.Length(); ++i)
+    {
+        if (text[i] == '-' && (i + 1 == text.Length() || text[i + 1] == '-'))
+        {
+            throw std::runtime_error("comment cannot contain \"--\" or end with '-'");
+        }
+    }
+    BeginMarkup();
+    WriteAscii("<!--");
+    Write(text, 0);
+    WriteAscii("-->");
+    FlushIfFull();
+}
+
+void XmlWriter::PI(const U32StringView& target, const U32StringView& data)
+{
+    for (size_t i = 0; i + 1 < data.Length(); ++i)
+    {
+        if (data[i] == '?' && data[i + 1] == '>')
+        {
+            throw std::runtime_error("processing instruction cannot contain \"?>\"");
+        }
+    }
+    BeginMarkup();
+    WriteAscii("<?");
+    Write(target, 0);
+    if (!data.IsEmpty())
+    {
+        if (data[0] != ' ' && data[0] != '\t' && data[0] != '\n' && data[0] != '\r')
+        {
+            buffer->append(1, ' ');
+        }
+        Write(data, 0);
+    }
+    WriteAscii("?>");
+    FlushIfFull();
+}
+
+void XmlWriter::Flush()
+{
+    if (fd == -1)
+    {
+        return;
+    }
+    const char* p = buffer->data();
+    size_t n = buffer->size();
+    while (n > 0)
+    {
+#if defined(__linux) || defined(__posix) || defined(__unix)
+        ssize_t result = write(fd, p, n);
+#elif defined(_WIN32)
+        int result = _write(fd, p, unsigned(std::min(n, size_t(1) << 30)));
+#endif
+        if (result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            buffer->clear();
+            throw std::runtime_error("could not write XML output: " + std::string(strerror(errno)));
+        }
+        p += result;
+        n -= size_t(result);
+    }
+    buffer->clear();
+}
+
+void XmlWriter::CloseStartTag()
+{
+    if (startTagOpen)
+    {
+        buffer->append(1, '>');
+        startTagOpen = false;
+    }
+}
+
+//  Starts an element, comment or processing instruction: in indented output it goes on a new line unless it is part of text content.
+
+void XmlWriter::BeginMarkup()
+{
+    CloseStartTag();
+    if (!scopeStack.empty())
+    {
+        scopeStack.back().hasChildren = true;
+    }
+    if (options.indent && mixedDepth == 0 && !atStart)
+    {
+        NewLine(Depth());
+    }
+    atStart = false;
+}
+
+void XmlWriter::NewLine(int depth)
+{
+    buffer->append(1, '\n');
+    buffer->append(options.indentSize * depth, ' ');
+}
+
+void XmlWriter::CheckStartTagOpen(const char* operation) const
+{
+    if (!startTagOpen)
+    {
+        throw std::runtime_error(std::string(operation) + " can be written only in a start tag");
+    }
+}
+
+bool XmlWriter::IsBound(const U32StringView& prefix, const U32StringView& namespaceUri) const
+{
+    int prefixId = prefixes.Find(prefix);
+    return prefixId != -1 && prefixNamespaceIds[prefixId] != -1 && namespaceUris.Get(prefixNamespaceIds[prefixId]) == namespaceUri;
+}
+
+bool XmlWriter::DeclaredInStartTag(const U32StringView& prefix) const
+{
+    int prefixId = prefixes.Find(prefix);
+    for (int i = scopeStack.back().numBindings; i < int(bindingStack.size()); ++i)
+    {
+        if (bindingStack[i].prefixId == prefixId)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void XmlWriter::BindPrefix(const U32StringView& prefix, const U32StringView& namespaceUri)
+{
+    int prefixId = prefixes.Intern(prefix);
+    if (prefixId >= int(prefixNamespaceIds.size()))
+    {
+        prefixNamespaceIds.resize(prefixId + 1, -1);
+    }
+    NamespaceBinding binding;
+    binding.prefixId = prefixId;
+    binding.prevNamespaceId = prefixNamespaceIds[prefixId];
+    bindingStack.push_back(binding);
+    prefixNamespaceIds[prefixId] = namespaceUris.Intern(namespaceUri);
+}
+
+void XmlWriter::WriteDeclaration(const U32StringView& prefix, const U32StringView& namespaceUri)
+{
+    ElementScope& scope = scopeStack.back();
+    if (prefix.IsEmpty())
+    {
+        if (scope.defaultDeclared)
+        {
+            throw std::runtime_error("default namespace already declared for element '" + openNames.substr(scope.nameStart) + "'");
+        }
+        scope.defaultDeclared = true;
+        defaultNamespaceId = namespaceUris.Intern(namespaceUri);
+        WriteAscii(" xmlns=\"");
+    }
+    else
+    {
+        if (prefix == U"xmlns" || (prefix == U"xml") != (namespaceUri == xmlNamespaceUri))
+        {
+            throw std::runtime_error("namespace prefix '" + ToUtf8(prefix.ToString()) + "' cannot be bound to '" + ToUtf8(namespaceUri.ToString()) + "'");
+        }
+        if (namespaceUri.IsEmpty())
+        {
+            throw std::runtime_error("namespace prefix '" + ToUtf8(prefix.ToString()) + "' cannot be bound to an empty namespace URI");
+        }
+        if (DeclaredInStartTag(prefix))
+        {
+            throw std::runtime_error("namespace prefix '" + ToUtf8(prefix.ToString()) + "' already declared for element '" + openNames.substr(scope.nameStart) + "'");
+        }
+        BindPrefix(prefix, namespaceUri);
+        WriteAscii(" xmlns:");
+        Write(prefix, 0);
+        WriteAscii("=\"");
+    }
+    Write(namespaceUri, attributeEscape);
+    buffer->append(1, '"');
+}
+
+U32StringView XmlWriter::FindPrefix(const U32StringView& namespaceUri) const
+{
+    for (int i = int(bindingStack.size()) - 1; i >= 0; --i)
+    {
+        int prefixId = bindingStack[i].prefixId;
+        if (prefixNamespaceIds[prefixId] != -1 && namespaceUris.Get(prefixNamespaceIds[prefixId]) == namespaceUri)
+        {
+            return prefixes.Get(prefixId);
+        }
+    }
+    return U32StringView();
+}
+
+U32StringView XmlWriter::GeneratePrefix()
+{
+    int prefixId = -1;
+    do
+    {
+        generatedPrefix = U"ns" + ToUtf32(std::to_string(++generatedPrefixCount));
+        prefixId = prefixes.Find(generatedPrefix);
+    }
+    while (prefixId != -1 && prefixNamespaceIds[prefixId] != -1);
+    return generatedPrefix;
+}
+
+//  Room for the worst case of a block is reserved up front, so that the common case, an ASCII character written as is, costs a table lookup and a store.
+
+void XmlWriter::Write(const U32StringView& text, int escapeMask)
+{
+    const char32_t* s = text.begin();
+    const char32_t* e = text.end();
+    int mask = escapeMask | invalidChar;
+    while (s != e)
+    {
+        const char32_t* blockEnd = s + std::min(size_t(e - s), blockSize);
+        size_t start = buffer->size();
+        buffer->resize(start + maxCharBytes * (blockEnd - s));
+        char* begin = &(*buffer)[start];
+        char* p = begin;
+        for (; s != blockEnd; ++s)
+        {
+            char32_t c = *s;
+            if (c < 0x80 && (escapeTable.flags[c] & mask) == 0)
+            {
+                *p++ = char(c);
+            }
+            else if (c < 0x80 && escapeTable.flags[c] != invalidChar)
+            {
+                p = WriteReference(p, c);
+            }
+            else if (c >= 0x80 && IsXmlChar(c))
+            {
+                p = EncodeUtf8(p, c);
+            }
+            else
+            {
+                buffer->resize(start + (p - begin));
+                throw std::runtime_error("character #x" + ToHexString(uint32_t(c)) + " is not allowed in XML 1.0");
+            }
+        }
+        buffer->resize(start + (p - begin));
+    }
+}
+
+} } // namespace soul::xml
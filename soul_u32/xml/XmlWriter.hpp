@@ -0,0 +1,122 @@
+// =================================
+// Copyright (c) 2017 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#ifndef SOUL_XML_XML_WRITER
+#define SOUL_XML_XML_WRITER
+#include <soul_u32/xml/XmlProcessor.hpp>
+#include <string>
+#include <vector>
+
+namespace soul { namespace xml {
+
+//  ==================================================================================
+//  XmlWriter writes XML as UTF-8 to a string buffer or to a file descriptor.
+//  Text and attribute values are escaped: '<', '&', '>' and carriage return in
+//  text, '<', '&', '"', tab, line feed and carriage return in attribute values.
+//  White space is written as character references, so that a parser does not
+//  normalize it. Characters not allowed in XML 1.0, the other control characters
+//  below 0x20, surrogates, 0xFFFE and 0xFFFF, cannot be written: they throw like
+//  "--" in a comment does.
+//
+//  The writer keeps the namespace bindings in scope like XmlProcessor does. An
+//  element or attribute written with a namespace URI gets the prefix of its
+//  qualified name, and a namespace declaration is added to the start tag when the
+//  prefix is not already bound to the URI. An attribute whose prefix is bound to
+//  another URI in the same start tag gets a generated prefix instead.
+//
+//  Indented output puts each element, comment and processing instruction on its
+//  own line, indented by its depth like CodeFormatter does. Elements with text
+//  content are written as is, so indenting never changes the text of a document.
+//  ==================================================================================
+
+struct XmlWriterOptions
+{
+    XmlWriterOptions() : indent(false), indentSize(4) {}
+    bool indent;
+    int indentSize;
+};
+
+class XmlWriter
+{
+public:
+    //  Appends the output to the buffer.
+    XmlWriter(std::string& buffer_);
+    XmlWriter(std::string& buffer_, const XmlWriterOptions& options_);
+    //  Writes the output to the file descriptor in blocks. The descriptor is not closed.
+    XmlWriter(int fd_);
+    XmlWriter(int fd_, const XmlWriterOptions& options_);
+    //  Flushes the output to the file descriptor. Call Flush() before to get write errors reported.
+    ~XmlWriter();
+    XmlWriter(const XmlWriter&) = delete;
+    XmlWriter& operator=(const XmlWriter&) = delete;
+    void XmlDeclaration();
+    void XmlDeclaration(bool standalone);
+    //  Writes a start tag without namespace processing.
+    void StartElement(const U32StringView& qualifiedName);
+    void StartElement(const U32StringView& namespaceUri, const U32StringView& qualifiedName);
+    //  Declares a namespace prefix, or the default namespace if the prefix is empty, for the element whose start tag is open.
+    void DeclareNamespace(const U32StringView& prefix, const U32StringView& namespaceUri);
+    //  Writes an attribute without namespace processing. 'xmlns' attributes are declarations, see DeclareNamespace.
+    void Attribute(const U32StringView& qualifiedName, const U32StringView& value);
+    void Attribute(const U32StringView& namespaceUri, const U32StringView& qualifiedName, const U32StringView& value);
+    //  Writes an empty element tag if the element has no content, otherwise an end tag.
+    void EndElement();
+    void Text(const U32StringView& text);
+    void CData(const U32StringView& text);
+    void Comment(const U32StringView& text);
+    void PI(const U32StringView& target, const U32StringView& data);
+    int Depth() const { return int(scopeStack.size()); }
+    void Flush();
+private:
+    static const size_t flushSize = 64 * 1024;
+    std::string ownBuffer;
+    std::string* buffer;
+    int fd;
+    XmlWriterOptions options;
+    //  The qualified names of the open elements are kept in UTF-8 for their end tags: the name of an element starts at the nameStart of its scope.
+    struct ElementScope
+    {
+        int nameStart;
+        int numBindings;
+        int prevDefaultNamespaceId;
+        bool defaultDeclared;
+        bool hasChildren;
+    };
+    struct NamespaceBinding
+    {
+        int prefixId;
+        int prevNamespaceId;
+    };
+    std::vector<ElementScope> scopeStack;
+    std::string openNames;
+    bool startTagOpen;
+    bool atStart;
+    int mixedDepth;
+    std::vector<NamespaceBinding> bindingStack;
+    StringTable namespaceUris;
+    StringTable prefixes;
+    std::vector<int> prefixNamespaceIds;
+    int defaultNamespaceId;
+    int generatedPrefixCount;
+    std::u32string generatedPrefix;
+    void Init();
+    void CloseStartTag();
+    void BeginMarkup();
+    void NewLine(int depth);
+    void CheckStartTagOpen(const char* operation) const;
+    bool IsBound(const U32StringView& prefix, const U32StringView& namespaceUri) const;
+    bool DeclaredInStartTag(const U32StringView& prefix) const;
+    void BindPrefix(const U32StringView& prefix, const U32StringView& namespaceUri);
+    void WriteDeclaration(const U32StringView& prefix, const U32StringView& namespaceUri);
+    U32StringView FindPrefix(const U32StringView& namespaceUri) const;
+    U32StringView GeneratePrefix();
+    void WriteAscii(const char* s) { buffer->append(s); }
+    void Write(const U32StringView& text, int escapeMask);
+    void FlushIfFull() { if (fd != -1 && buffer->size() >= flushSize) Flush(); }
+};
+
+} } // namespace soul::xml
+
+#endif // SOUL_XML_XML_WRITER